@@ -94,7 +94,10 @@
 #include <string>
 #include <map>
 #include <vector>
+#include <algorithm>
 #include <string.h>
+#include <math.h>
+#include <stdint.h>
 
 // ------------------------------------------------------------------------------
 
@@ -109,11 +112,43 @@
 #  define BITMAP_FONT_GL BITMAP_FONT_GL3
 #endif
 
+#define BITMAP_FONT_UPLOAD_SUBDATA  1           /* upload the vertices with glBufferData/glBufferSubData (default) */
+#define BITMAP_FONT_UPLOAD_RING     2           /* upload into a ring of buffer segments; persistent mapped + fences on GL 4.4, orphaning otherwise; see BufferRing */
+
+#if !defined(BITMAP_FONT_UPLOAD)
+#  define BITMAP_FONT_UPLOAD BITMAP_FONT_UPLOAD_SUBDATA
+#endif
+
+#define BITMAP_FONT_VERTEX_FLOAT    1           /* CharacterVertex uses float positions, texcoords and colors: 32 bytes (default) */
+#define BITMAP_FONT_VERTEX_COMPACT  2           /* CharacterVertex uses int16 positions, uint16 texcoords and RGBA8 colors: 12 bytes */
+
+#if !defined(BITMAP_FONT_VERTEX_FORMAT)
+#  define BITMAP_FONT_VERTEX_FORMAT BITMAP_FONT_VERTEX_FLOAT
+#endif
+
+#if !defined(BITMAP_FONT_FLAT_GLYPHS)
+#  define BITMAP_FONT_FLAT_GLYPHS 256       /* code points below this are looked up directly by GlyphTable; the others (e.g. icons) are hashed */
+#endif
+
+#define BITMAP_FONT_NO_GLYPH 0xFFFFFFFFu    /* id of the unused entries of a GlyphTable */
+
+#define BITMAP_FONT_LZ_MIN_MATCH 4          /* shortest match of the compressed pixel data, see decompress() */
+
+#if !defined(BITMAP_FONT_RUN_CACHE_SIZE)
+#  define BITMAP_FONT_RUN_CACHE_SIZE 1024    /* number of glyph runs writeCached() keeps per font; must be a power of two */
+#endif
+
+#if BITMAP_FONT_GL == BITMAP_FONT_GL2 && !defined(BUFFER_RING_NO_PERSIST)
+#  define BUFFER_RING_NO_PERSIST            /* a GL2 context has no glBufferStorage() */
+#endif
+
 #if defined(__APPLE__) && BITMAP_FONT_GL == BITMAP_FONT_GL2
 #  define glGenVertexArrays glGenVertexArraysAPPLE
 #  define glBindVertexArray glBindVertexArrayAPPLE
 #endif
 
+#include <gui/bitmapfont/BufferRing.h>
+
 // ------------------------------------------------------------------------------
 
 #if BITMAP_FONT_GL == BITMAP_FONT_GL2
@@ -202,11 +237,85 @@ struct CharacterVertex {
   CharacterVertex();
   CharacterVertex(float x, float y, int s, int t, float* rgba);
 
+#if BITMAP_FONT_VERTEX_FORMAT == BITMAP_FONT_VERTEX_COMPACT
+  int16_t x;                    /* glyphs are positioned on whole pixels */
+  int16_t y;
+  uint16_t s;                   /* texel coordinates into the rectangle texture */
+  uint16_t t;
+  uint8_t fg_color[4];          /* normalized by GL */
+#else
   float x;
   float y;
   float s;
   float t;
   float fg_color[4];
+#endif
+};
+
+// ------------------------------------------------------------------------------
+
+struct GlyphTable {             /* lookup of the characters by code point; built once from the characters of a font, read only after that so it can be used by several threads */
+  void build(std::map<unsigned int, Character>& chars);
+  const Character* find(unsigned int id) const;
+
+  std::vector<Character> flat;  /* indexed by the code point, for code points below BITMAP_FONT_FLAT_GLYPHS */
+  std::vector<Character> sparse;/* open addressing on the code point for the others; size is a power of two */
+};
+
+inline uint32_t bitmapfont_hash_glyph(unsigned int id) {
+  uint32_t h = id * 2654435761u;
+  return h ^ (h >> 16);
+}
+
+inline const Character* GlyphTable::find(unsigned int id) const {
+
+  if(id < flat.size()) {
+    return (flat[id].id == id) ? &flat[id] : NULL;
+  }
+
+  if(sparse.empty()) {
+    return NULL;
+  }
+
+  size_t mask = sparse.size() - 1;
+  size_t i = bitmapfont_hash_glyph(id) & mask;
+
+  while(BITMAP_FONT_NO_GLYPH != sparse[i].id) {
+    if(sparse[i].id == id) {
+      return &sparse[i];
+    }
+    i = (i + 1) & mask;
+  }
+
+  return NULL;
+}
+
+// ------------------------------------------------------------------------------
+
+struct GlyphRun {               /* the vertices of a string, written at 0,0 with `color`; see writeCached() */
+  GlyphRun();
+
+  uint32_t hash;                /* of the text and color; 0 when the run is unused */
+  std::string text;
+  float color[4];
+  float width;
+  std::vector<CharacterVertex> vertices;
+};
+
+// ------------------------------------------------------------------------------
+
+struct BitmapFontShared {       /* texture and glyphs of a baked font; shared by all BitmapFonts that are setup from the same data, see setupShared() */
+  BitmapFontShared();
+
+  int refcount;
+  GLuint tex;
+  int line_height;
+  int scale_w;
+  int scale_h;
+  int pages;
+  int base;
+  std::map<unsigned int, Character> chars;
+  GlyphTable table;             /* built from `chars` */
 };
 
 // ------------------------------------------------------------------------------
@@ -215,11 +324,16 @@ class BitmapFont {
 
  public:
   BitmapFont();
+  ~BitmapFont();                                               /* releases the shared texture + glyphs */
 
   void clear();
+  void replace(size_t dst, size_t src, size_t count);          /* copy `count` vertices from `src` over the vertices at `dst`; only this range will be uploaded again */
+  void truncate(size_t count);                                 /* remove all vertices after `count`, e.g. to undo the last writes */
   void write(float x, float y, std::string str, int align);    /* write a complete string */
+  void write(float x, float y, const char* str, size_t len, int align); /* write `len` characters without creating a string */
+  void writeCached(float x, float y, const std::string& str, int align); /* same as write() but copies the vertices of the same string + color when it was written before; use it for text that rarely changes, like labels */
   void write(float x, float y, unsigned int id);               /* write a specific character */
-  void write(float x, float y, Character& c);                  /* write a specific character */
+  void write(float x, float y, const Character& c);            /* write a specific character */
   void draw();
   void setColor(float r, float g, float b, float a = 1.0);
   void resize(int winW, int winH);                             /* whenever the viewport changes call this; it will recalculate the ortho matrix */
@@ -227,16 +341,29 @@ class BitmapFont {
 
   bool getChar(unsigned int code, Character& result);          /* get a specific character, returns false when the font doesn't have the char */
   float getWidth(const std::string& str);                      /* get the width for the given string, as it would be drawn on screen */
+  float getWidth(const char* str, size_t len);
+
+  static bool decompress(const unsigned char* src, size_t nsrc, unsigned char* dst, size_t ndst); /* decompresses the pixel data of the fontbaker, returns false when it doesn't decompress into exactly `ndst` bytes */
 
  protected:
   bool setupGraphics();
-  void setupTexture(int w, int h, unsigned char* pix);
+  void setupTexture(int w, int h, unsigned char* pix);         /* when setupShared() was called, the texture and `chars` are shared under its key */
+  bool setupTexture(int w, int h, const unsigned char* data, size_t nbytes); /* decompresses the single channel pixel data that the fontbaker created and calls setupTexture() */
+  bool setupShared(const void* key);                           /* returns true when another font was setup from the same key (e.g. the baked pixel data); we then use its texture + glyphs and you can skip the rest of the setup */
+  void setupAttributes(size_t offset);                         /* binds the vbo to our vao, starting at the given byte offset */
   void updateVertices();
+  void updateVerticesRing();                                   /* used with BITMAP_FONT_UPLOAD_RING */
+
+ private:
+  BitmapFont(const BitmapFont& other);                         /* not copyable; `glyphs` points into this instance or to `shared` */
+  BitmapFont& operator=(const BitmapFont& other);
 
  public:
 
   /* state */
   bool needs_update;
+  size_t dirty_start;           /* first vertex of the range that needs to be uploaded when only a part changed, see replace() */
+  size_t dirty_end;             /* one past the last vertex of the range that needs to be uploaded */
   int win_w;
   int win_h;
   float color[4];
@@ -249,7 +376,13 @@ class BitmapFont {
   int base;
 
   /* characters */
-  std::map<unsigned int, Character> chars;
+  std::map<unsigned int, Character> chars;                    /* filled while setting up; moved into `shared` when the font is shared */
+  std::map<unsigned int, Character>* glyphs;                  /* the characters we use; either `chars` or the ones in `shared` */
+  GlyphTable char_table;                                      /* built from `chars` in setupTexture() when the font isn't shared */
+  GlyphTable* glyph_table;                                    /* the lookup table for `glyphs`; used by write(), getWidth() and getChar() */
+  const void* shared_key;
+  BitmapFontShared* shared;
+  static std::map<const void*, BitmapFontShared*> shared_fonts;  /* all shared fonts, by key */
 
   /* opengl */
   float pm[16];  
@@ -263,6 +396,9 @@ class BitmapFont {
   GLuint tex;
   size_t bytes_allocated;
   std::vector<CharacterVertex> vertices;
+  std::vector<GlyphRun> runs;   /* cache for writeCached(), indexed by the hash of the text and color */
+
+  BufferRing ring;              /* owns `vbo` when we use BITMAP_FONT_UPLOAD_RING */
 };
 
 } // namespace rx
@@ -275,12 +411,20 @@ class BitmapFont {
 
 #if defined(BITMAP_FONT_IMPLEMENTATION)
 
+#define BUFFER_RING_IMPLEMENTATION
+#include <gui/bitmapfont/BufferRing.h>
+
 namespace rx { 
 
 GLuint BitmapFont::prog = 0;
 GLuint BitmapFont::vert = 0;
 GLuint BitmapFont::frag = 0;
 bool BitmapFont::is_initialized = false;
+std::map<const void*, BitmapFontShared*> BitmapFont::shared_fonts;
+
+#if BITMAP_FONT_VERTEX_FORMAT == BITMAP_FONT_VERTEX_COMPACT
+static int16_t bitmapfont_quantize_pos(float v);
+#endif
 
 // ------------------------------------------------------------------------------
 
@@ -322,21 +466,69 @@ static void bitmapfont_ortho(float l, float r, float b, float t, float n, float
 
 BitmapFont::BitmapFont()
   :needs_update(false)
+  ,dirty_start(0)
+  ,dirty_end(0)
   ,win_w(0)
   ,win_h(0)
-  ,vbo(0)
-  ,vao(0)
-  ,tex(0)
-  ,bytes_allocated(0)
   ,line_height(0)
   ,scale_w(0)
   ,scale_h(0)
   ,pages(0)
   ,base(0)
+  ,glyphs(&chars)
+  ,glyph_table(&char_table)
+  ,shared_key(NULL)
+  ,shared(NULL)
+  ,vao(0)
+  ,vbo(0)
+  ,tex(0)
+  ,bytes_allocated(0)
 {
   color[0] = color[1] = color[2] = color[3] = 1.0f;
 }
 
+BitmapFont::~BitmapFont() {
+
+  if(NULL == shared) {
+    return;
+  }
+
+  shared->refcount--;
+
+  if(0 == shared->refcount) {
+    glDeleteTextures(1, &shared->tex);
+    shared_fonts.erase(shared_key);
+    delete shared;
+  }
+
+  shared = NULL;
+}
+
+bool BitmapFont::setupShared(const void* key) {
+
+  shared_key = key;
+
+  std::map<const void*, BitmapFontShared*>::iterator it = shared_fonts.find(key);
+  if(it == shared_fonts.end()) {
+    return false;
+  }
+
+  shared = it->second;
+  shared->refcount++;
+
+  tex = shared->tex;
+  line_height = shared->line_height;
+  scale_w = shared->scale_w;
+  scale_h = shared->scale_h;
+  pages = shared->pages;
+  base = shared->base;
+  glyphs = &shared->chars;
+  glyph_table = &shared->table;
+  runs.clear();
+
+  return true;
+}
+
 bool BitmapFont::setupGraphics() {
 
   if(!BitmapFont::is_initialized) {
@@ -358,19 +550,37 @@ bool BitmapFont::setupGraphics() {
   }
 
   glGenVertexArrays(1, &vao);
+
+#if BITMAP_FONT_UPLOAD == BITMAP_FONT_UPLOAD_RING
+  ring.setup();
+  vbo = ring.vbo;
+#else
+  glGenBuffers(1, &vbo);
+#endif
+
+  setupAttributes(0);
+
+  return true;
+}
+
+void BitmapFont::setupAttributes(size_t offset) {
+
   glBindVertexArray(vao);
 
   glEnableVertexAttribArray(0);  // pos
   glEnableVertexAttribArray(1);  // tex
   glEnableVertexAttribArray(2);  // fg_color
 
-  glGenBuffers(1, &vbo);
   glBindBuffer(GL_ARRAY_BUFFER, vbo);
-  glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(CharacterVertex), (GLvoid*)0); // pos
-  glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(CharacterVertex), (GLvoid*)8); // tex
-  glVertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, sizeof(CharacterVertex), (GLvoid*)16); // fg_color
-
-  return true;
+#if BITMAP_FONT_VERTEX_FORMAT == BITMAP_FONT_VERTEX_COMPACT
+  glVertexAttribPointer(0, 2, GL_SHORT, GL_FALSE, sizeof(CharacterVertex), (GLvoid*)(offset + 0)); // pos
+  glVertexAttribPointer(1, 2, GL_UNSIGNED_SHORT, GL_FALSE, sizeof(CharacterVertex), (GLvoid*)(offset + 4)); // tex
+  glVertexAttribPointer(2, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(CharacterVertex), (GLvoid*)(offset + 8)); // fg_color
+#else
+  glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(CharacterVertex), (GLvoid*)(offset + 0)); // pos
+  glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(CharacterVertex), (GLvoid*)(offset + 8)); // tex
+  glVertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, sizeof(CharacterVertex), (GLvoid*)(offset + 16)); // fg_color
+#endif
 }
 
 void BitmapFont::setupTexture(int w, int h, unsigned char* pix) {
@@ -381,6 +591,119 @@ void BitmapFont::setupTexture(int w, int h, unsigned char* pix) {
   glTexParameteri(GL_TEXTURE_RECTANGLE, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
   glTexParameteri(GL_TEXTURE_RECTANGLE, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
   glTexParameteri(GL_TEXTURE_RECTANGLE, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+  if(NULL == shared_key || NULL != shared) {
+    char_table.build(chars);
+    glyph_table = &char_table;
+    runs.clear();
+    return;
+  }
+
+  shared = new BitmapFontShared();
+  shared->refcount = 1;
+  shared->tex = tex;
+  shared->line_height = line_height;
+  shared->scale_w = scale_w;
+  shared->scale_h = scale_h;
+  shared->pages = pages;
+  shared->base = base;
+  shared->chars.swap(chars);
+  shared->table.build(shared->chars);
+  glyphs = &shared->chars;
+  glyph_table = &shared->table;
+  runs.clear();
+
+  shared_fonts[shared_key] = shared;
+}
+
+bool BitmapFont::setupTexture(int w, int h, const unsigned char* data, size_t nbytes) {
+
+  std::vector<unsigned char> pix(w * h);
+
+  if(!decompress(data, nbytes, &pix[0], pix.size())) {
+    printf("Error: cannot decompress the font pixel data.\n");
+    return false;
+  }
+
+  setupTexture(w, h, &pix[0]);
+
+  return true;
+}
+
+/*
+  The fontbaker stores the pixels as a stream of sequences. Each sequence
+  starts with a token; the high nibble is the number of literal bytes and
+  the low nibble the length of the match minus BITMAP_FONT_LZ_MIN_MATCH.
+  A nibble of 15 is followed by bytes that are added to it until a byte is
+  not 255. Then follow the literals, the little endian 16 bit offset of the
+  match (back from the current position, may overlap) and the extra match
+  length bytes. The last sequence only has literals.
+ */
+bool BitmapFont::decompress(const unsigned char* src, size_t nsrc, unsigned char* dst, size_t ndst) {
+
+  const unsigned char* end = src + nsrc;
+  size_t pos = 0;
+
+  while(src < end) {
+
+    unsigned int token = *src++;
+    size_t num_literals = token >> 4;
+    size_t match_len = token & 0x0F;
+    size_t offset = 0;
+    unsigned int b = 0;
+
+    if(15 == num_literals) {
+      do {
+        if(src >= end) {
+          return false;
+        }
+        b = *src++;
+        num_literals += b;
+      } while(255 == b);
+    }
+
+    if(num_literals > (size_t)(end - src) || num_literals > (ndst - pos)) {
+      return false;
+    }
+
+    memcpy(dst + pos, src, num_literals);
+    src += num_literals;
+    pos += num_literals;
+
+    if(src == end) {
+      break;
+    }
+
+    if((end - src) < 2) {
+      return false;
+    }
+
+    offset = src[0] | (src[1] << 8);
+    src += 2;
+
+    if(15 == match_len) {
+      do {
+        if(src >= end) {
+          return false;
+        }
+        b = *src++;
+        match_len += b;
+      } while(255 == b);
+    }
+
+    match_len += BITMAP_FONT_LZ_MIN_MATCH;
+
+    if(0 == offset || offset > pos || match_len > (ndst - pos)) {
+      return false;
+    }
+
+    /* byte by byte; the match may overlap the bytes we're writing (runs) */
+    for(size_t i = 0; i < match_len; ++i, ++pos) {
+      dst[pos] = dst[pos - offset];
+    }
+  }
+
+  return pos == ndst;
 }
 
 void BitmapFont::resize(int winW, int winH) {
@@ -406,48 +729,169 @@ void BitmapFont::setColor(float r, float g, float b, float a) {
 
 void BitmapFont::clear() {
   vertices.clear();
+  dirty_start = 0;
+  dirty_end = 0;
+}
+
+void BitmapFont::replace(size_t dst, size_t src, size_t count) {
+
+  if(!count) {
+    return;
+  }
+
+  if((dst + count) > vertices.size() || (src + count) > vertices.size()) {
+    printf("Error: trying to replace font vertices out of range.\n");
+    return;
+  }
+
+  std::copy(vertices.begin() + src, vertices.begin() + src + count, vertices.begin() + dst);
+
+  if(dirty_end == dirty_start) {
+    dirty_start = dst;
+    dirty_end = dst + count;
+  }
+  else {
+    dirty_start = std::min<size_t>(dirty_start, dst);
+    dirty_end = std::max<size_t>(dirty_end, dst + count);
+  }
+}
+
+void BitmapFont::truncate(size_t count) {
+
+  if(count < vertices.size()) {
+    vertices.resize(count);
+  }
 }
 
 
 void BitmapFont::write(float x, float y, std::string str, int align) {
+  write(x, y, str.c_str(), str.size(), align);
+}
+
+void BitmapFont::write(float x, float y, const char* str, size_t len, int align) {
 
   float xoffset = x;
   float yoffset = y;
 
   if(align == BITMAP_FONT_ALIGN_RIGHT) {
-    xoffset -= getWidth(str);
+    xoffset -= getWidth(str, len);
   }
 
-  for(size_t i = 0; i < str.size(); ++i) {
+  for(size_t i = 0; i < len; ++i) {
 
-    std::map<unsigned int, Character>::iterator it = chars.find(str[i]);
-    if(it == chars.end()) {
+    const Character* c = glyph_table->find(str[i]);
+    if(NULL == c) {
       printf("character: %c not found.\n", str[i]);
       continue;
     }
 
-    Character& c = it->second;
-    
-    write(xoffset, yoffset, c);
+    write(xoffset, yoffset, *c);
+
+    xoffset += c->xadvance;
+  }
+
+}
+
+void BitmapFont::writeCached(float x, float y, const std::string& str, int align) {
+
+  /* FNV-1a of the text and color */
+  uint32_t hash = 2166136261u;
+  uint32_t bits[4];
+
+  for(size_t i = 0; i < str.size(); ++i) {
+    hash = (hash ^ (uint8_t)str[i]) * 16777619u;
+  }
+
+  memcpy(bits, color, sizeof(bits));
+
+  for(int i = 0; i < 4; ++i) {
+    hash = (hash ^ bits[i]) * 16777619u;
+  }
+
+  if(runs.empty()) {
+    runs.resize(BITMAP_FONT_RUN_CACHE_SIZE);
+  }
+
+  size_t slot = hash;
+
+  if(0 == hash) {
+    hash = 1; /* 0 means unused */
+  }
+
+  /* look at a couple of slots so two labels with the same slot don't keep replacing each other */
+  GlyphRun* run = NULL;
+  GlyphRun* unused = NULL;
+
+  for(int i = 0; i < 4; ++i) {
+
+    GlyphRun* r = &runs[(slot + i) & (BITMAP_FONT_RUN_CACHE_SIZE - 1)];
+
+    if(r->hash == hash && r->text == str && 0 == memcmp(r->color, color, sizeof(color))) {
+      run = r;
+      break;
+    }
+
+    if(NULL == unused && 0 == r->hash) {
+      unused = r;
+    }
+  }
+
+  if(NULL == run) {
+
+    /* shape the string at 0,0 and keep the vertices; when all slots are used we replace the first one */
+    run = (NULL != unused) ? unused : &runs[slot & (BITMAP_FONT_RUN_CACHE_SIZE - 1)];
+
+    size_t start = vertices.size();
+    write(0.0f, 0.0f, str.c_str(), str.size(), BITMAP_FONT_ALIGN_LEFT);
+
+    run->vertices.assign(vertices.begin() + start, vertices.end());
+    vertices.resize(start);
+
+    run->hash = hash;
+    run->text = str;
+    run->width = getWidth(str.c_str(), str.size());
+    memcpy(run->color, color, sizeof(color));
+  }
+
+  if(run->vertices.empty()) {
+    return;
+  }
+
+  float xoffset = (align == BITMAP_FONT_ALIGN_RIGHT) ? (x - run->width) : x;
+
+#if BITMAP_FONT_VERTEX_FORMAT == BITMAP_FONT_VERTEX_COMPACT
+  /* the glyph offsets are whole pixels, so this gives the same positions as write() */
+  int16_t dx = bitmapfont_quantize_pos(xoffset);
+  int16_t dy = bitmapfont_quantize_pos(y);
+#else
+  float dx = xoffset;
+  float dy = y;
+#endif
+
+  size_t start = vertices.size();
+  vertices.insert(vertices.end(), run->vertices.begin(), run->vertices.end());
 
-    xoffset += c.xadvance;
+  for(size_t i = start; i < vertices.size(); ++i) {
+    vertices[i].x += dx;
+    vertices[i].y += dy;
   }
 
+  needs_update = true;
 }
 
 void BitmapFont::write(float x, float y, unsigned int id)  {
 
-  std::map<unsigned int, Character>::iterator it = chars.find(id);
+  const Character* c = glyph_table->find(id);
 
-  if(it == chars.end()) {
+  if(NULL == c) {
     printf("Character for id: %u not found.\n", id);
     return;
   }
 
-  write(x, y, it->second);
+  write(x, y, *c);
 }
 
-void BitmapFont::write(float x, float y, Character& c) {
+void BitmapFont::write(float x, float y, const Character& c) {
 
   float x0 = x + c.xoffset;
   float y0 = y + c.yoffset;
@@ -489,11 +933,32 @@ void BitmapFont::draw() {
   glUseProgram(prog);
   glBindVertexArray(vao);
   glDrawArrays(GL_TRIANGLES, 0, vertices.size());
+
+#if BITMAP_FONT_UPLOAD == BITMAP_FONT_UPLOAD_RING
+  ring.fence();
+#endif
 }
 
 void BitmapFont::updateVertices() {
 
+#if BITMAP_FONT_UPLOAD == BITMAP_FONT_UPLOAD_RING
+  updateVerticesRing();
+  return;
+#endif
+
   if(!needs_update) {
+
+    /* only a part of the vertices changed, see replace() */
+    if(dirty_end > dirty_start && dirty_end <= vertices.size()) {
+      glBindBuffer(GL_ARRAY_BUFFER, vbo);
+      glBufferSubData(GL_ARRAY_BUFFER, 
+                      sizeof(CharacterVertex) * dirty_start, 
+                      sizeof(CharacterVertex) * (dirty_end - dirty_start), 
+                      &vertices[dirty_start].x);
+    }
+
+    dirty_start = 0;
+    dirty_end = 0;
     return;
   }
 
@@ -513,28 +978,57 @@ void BitmapFont::updateVertices() {
   }
 
   needs_update = false;
+  dirty_start = 0;
+  dirty_end = 0;
+}
+
+// Writes all vertices into the next segment of the ring. The other segments 
+// hold older vertices, so we always write everything, also after replace().
+void BitmapFont::updateVerticesRing() {
+
+  if(!needs_update && dirty_end == dirty_start) {
+    return;
+  }
+
+  size_t needed = sizeof(CharacterVertex) * vertices.size();
+  if(!needed) {
+    return;
+  }
+
+  needs_update = false;
+  dirty_start = 0;
+  dirty_end = 0;
+
+  if(ring.upload(&vertices[0].x, needed)) {
+    vbo = ring.vbo;
+    setupAttributes(ring.offset);
+  }
 }
 
 bool BitmapFont::getChar(unsigned int code, Character& result) {
 
-  std::map<unsigned int, Character>::iterator it = chars.find(code);
+  const Character* c = glyph_table->find(code);
 
-  if(it == chars.end()) {
+  if(NULL == c) {
     return false;
   }
   
-  result = it->second;
+  result = *c;
 
   return true;
 }
 
 float BitmapFont::getWidth(const std::string& str) {
+  return getWidth(str.c_str(), str.size());
+}
+
+float BitmapFont::getWidth(const char* str, size_t len) {
   float w = 0.0f;
-  Character ch;
 
-  for(size_t i = 0; i < str.size(); ++i) {
-    if(getChar(str[i], ch)) {
-      w += ch.xadvance;
+  for(size_t i = 0; i < len; ++i) {
+    const Character* c = glyph_table->find(str[i]);
+    if(NULL != c) {
+      w += c->xadvance;
     }
   }
 
@@ -551,6 +1045,19 @@ void BitmapFont::print() {
 
 // -----------------------------------------------------------------------------
 
+BitmapFontShared::BitmapFontShared()
+  :refcount(0)
+  ,tex(0)
+  ,line_height(0)
+  ,scale_w(0)
+  ,scale_h(0)
+  ,pages(0)
+  ,base(0)
+{
+}
+
+// -----------------------------------------------------------------------------
+
 Character::Character() 
   :id(0)
   ,x(0)
@@ -565,15 +1072,104 @@ Character::Character()
 
 // -----------------------------------------------------------------------------
 
+void GlyphTable::build(std::map<unsigned int, Character>& chars) {
+
+  Character unused;
+  unused.id = BITMAP_FONT_NO_GLYPH;
+
+  size_t num_sparse = 0;
+  size_t size = 0;
+
+  flat.assign(BITMAP_FONT_FLAT_GLYPHS, unused);
+  sparse.clear();
+
+  for(std::map<unsigned int, Character>::iterator it = chars.begin(); it != chars.end(); ++it) {
+    if(it->first < BITMAP_FONT_FLAT_GLYPHS) {
+      flat[it->first] = it->second;
+      flat[it->first].id = it->first;
+    }
+    else if(BITMAP_FONT_NO_GLYPH != it->first) {
+      num_sparse++;
+    }
+  }
+
+  if(0 == num_sparse) {
+    return;
+  }
+
+  /* at most half full so the probes stay short */
+  size = 8;
+  while(size < num_sparse * 2) {
+    size *= 2;
+  }
+
+  sparse.assign(size, unused);
+
+  for(std::map<unsigned int, Character>::iterator it = chars.begin(); it != chars.end(); ++it) {
+
+    if(it->first < BITMAP_FONT_FLAT_GLYPHS || BITMAP_FONT_NO_GLYPH == it->first) {
+      continue;
+    }
+
+    size_t i = bitmapfont_hash_glyph(it->first) & (size - 1);
+    while(BITMAP_FONT_NO_GLYPH != sparse[i].id) {
+      i = (i + 1) & (size - 1);
+    }
+
+    sparse[i] = it->second;
+    sparse[i].id = it->first;
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+GlyphRun::GlyphRun()
+  :hash(0)
+  ,width(0.0f)
+{
+  color[0] = color[1] = color[2] = color[3] = 0.0f;
+}
+
+// -----------------------------------------------------------------------------
+
 CharacterVertex::CharacterVertex()
-  :x(0.0f)
-  ,y(0.0f)
-  ,s(0.0f)
-  ,t(0.0f)
+  :x(0)
+  ,y(0)
+  ,s(0)
+  ,t(0)
 {
+#if BITMAP_FONT_VERTEX_FORMAT == BITMAP_FONT_VERTEX_COMPACT
+  fg_color[0] = fg_color[1] = fg_color[2] = fg_color[3] = 255;
+#else
   fg_color[0] = fg_color[1] = fg_color[2] = fg_color[3] = 1.0f;
+#endif
 }
 
+#if BITMAP_FONT_VERTEX_FORMAT == BITMAP_FONT_VERTEX_COMPACT
+
+static int16_t bitmapfont_quantize_pos(float v) {
+  v = floorf(v + 0.5f);
+  return (int16_t)std::max<float>(-32768.0f, std::min<float>(32767.0f, v));
+}
+
+static uint8_t bitmapfont_quantize_color(float v) {
+  return (uint8_t)(std::max<float>(0.0f, std::min<float>(1.0f, v)) * 255.0f + 0.5f);
+}
+
+CharacterVertex::CharacterVertex(float x, float y, int s, int t, float* rgba) 
+  :x(bitmapfont_quantize_pos(x))
+  ,y(bitmapfont_quantize_pos(y))
+  ,s((uint16_t)s)
+  ,t((uint16_t)t)
+{
+  fg_color[0] = bitmapfont_quantize_color(rgba[0]);
+  fg_color[1] = bitmapfont_quantize_color(rgba[1]);
+  fg_color[2] = bitmapfont_quantize_color(rgba[2]); 
+  fg_color[3] = bitmapfont_quantize_color(rgba[3]);
+}
+
+#else
+
 CharacterVertex::CharacterVertex(float x, float y, int s, int t, float* rgba) 
   :x(x)
   ,y(y)
@@ -586,6 +1182,8 @@ CharacterVertex::CharacterVertex(float x, float y, int s, int t, float* rgba)
   fg_color[3] = rgba[3];
 }
 
+#endif
+
 } // namespace rx
 
 #endif // BITMAP_FONT_IMPLEMENTATION
@@ -0,0 +1,232 @@
+/*
+
+  BufferRing
+  ----------
+  BufferRing.setup()                                                 - create the buffer; call this when the GL context is current
+  BufferRing.upload(data, nbytes)                                    - copy the data into the next segment
+  BufferRing.fence()                                                 - call this after the draw calls that used the latest segment
+
+  Streams vertices into a ring of buffer segments so we never write into
+  memory the GPU may still read from. With a GL 4.4 context we allocate
+  one persistent, coherent mapped buffer with BUFFER_RING_SEGMENTS
+  segments and write into a segment the GPU is done with (guarded by
+  fences). Without GL 4.4 we orphan the buffer before every upload so
+  the driver can give us fresh memory instead of stalling.
+
+  upload() returns true when `vbo` or `offset` changed; the vertex
+  attributes must then be set again, starting at `offset`. BitmapFont
+  (BITMAP_FONT_UPLOAD_RING) and RenderGL (RENDER_GL_UPLOAD_RING) use
+  this class. Define BUFFER_RING_NO_PERSIST when the context can't be
+  GL 4.4; BitmapFont does this for BITMAP_FONT_GL2.
+
+*/
+
+// ------------------------------------------------------------------------------
+// H E A D E R
+// ------------------------------------------------------------------------------
+
+#ifndef ROXLU_BUFFER_RING_H
+#define ROXLU_BUFFER_RING_H
+
+#include <stdio.h>
+#include <string.h>
+
+#if !defined(BUFFER_RING_SEGMENTS)
+#  define BUFFER_RING_SEGMENTS 3            /* number of segments; the CPU writes into one while the GPU may still read from the others */
+#endif
+
+#if defined(GL_MAP_PERSISTENT_BIT) && !defined(BUFFER_RING_NO_PERSIST)
+#  define BUFFER_RING_CAN_PERSIST           /* the GL headers know about glBufferStorage(); we still check the context version at runtime */
+#endif
+
+namespace rx {
+
+class BufferRing {
+ public:
+  BufferRing();
+  void setup();                             /* creates the buffer and checks if we can use persistent mapping */
+  bool upload(const void* data, size_t nbytes); /* copies the data into the next segment; returns true when `vbo` or `offset` changed */
+  void fence();                             /* call this after the draw calls that use the current segment */
+
+ private:
+  bool grow(size_t nbytes);                 /* recreates the persistent storage so a segment can hold nbytes; returns false when mapping fails */
+  void wait(int dx);                        /* waits until the GPU is done with the given segment */
+
+ public:
+  GLuint vbo;                               /* the buffer; this changes when the persistent storage grows */
+  size_t offset;                            /* byte offset of the segment that holds the latest vertices */
+  size_t segment_size;                      /* size of one segment in bytes */
+  int index;                                /* the segment we wrote into last */
+  bool is_persistent;                       /* true when we use persistent mapping */
+  char* mapped;                             /* the mapped storage (persistent mode only) */
+#if defined(BUFFER_RING_CAN_PERSIST)
+  GLsync fences[BUFFER_RING_SEGMENTS];      /* one fence per segment, set after drawing from it */
+#endif
+};
+
+} // namespace rx
+
+#endif
+
+// ------------------------------------------------------------------------------
+// I M P L E M E N T A T I O N
+// ------------------------------------------------------------------------------
+
+#if defined(BUFFER_RING_IMPLEMENTATION)
+
+namespace rx {
+
+BufferRing::BufferRing()
+  :vbo(0)
+  ,offset(0)
+  ,segment_size(0)
+  ,index(0)
+  ,is_persistent(false)
+  ,mapped(NULL)
+{
+#if defined(BUFFER_RING_CAN_PERSIST)
+  for(int i = 0; i < BUFFER_RING_SEGMENTS; ++i) {
+    fences[i] = 0;
+  }
+#endif
+}
+
+void BufferRing::setup() {
+
+  glGenBuffers(1, &vbo);
+
+#if defined(BUFFER_RING_CAN_PERSIST)
+  GLint major = 0;
+  GLint minor = 0;
+  glGetIntegerv(GL_MAJOR_VERSION, &major);
+  glGetIntegerv(GL_MINOR_VERSION, &minor);
+  is_persistent = (major > 4) || (major == 4 && minor >= 4);
+#endif
+}
+
+bool BufferRing::upload(const void* data, size_t nbytes) {
+
+  bool changed = false;
+
+  if(!nbytes) {
+    return false;
+  }
+
+#if defined(BUFFER_RING_CAN_PERSIST)
+  if(is_persistent) {
+
+    if(nbytes > segment_size) {
+      if(grow(nbytes)) {
+        index = 0;
+        memcpy(mapped, data, nbytes);
+        offset = 0;
+        return true;
+      }
+
+      // storage is immutable; we need a new buffer before we can orphan it.
+      printf("Error: cannot map the ring buffer, falling back to buffer orphaning.\n");
+      glDeleteBuffers(1, &vbo);
+      glGenBuffers(1, &vbo);
+      is_persistent = false;
+      segment_size = 0;
+      changed = true;
+    }
+    else {
+      index = (index + 1) % BUFFER_RING_SEGMENTS;
+      wait(index);
+      offset = index * segment_size;
+      memcpy(mapped + offset, data, nbytes);
+      return true;
+    }
+  }
+#endif
+
+  // orphan the old storage; the driver keeps it alive for the draws that still use it.
+  glBindBuffer(GL_ARRAY_BUFFER, vbo);
+
+  if(nbytes > segment_size) {
+    segment_size = nbytes;
+  }
+
+  glBufferData(GL_ARRAY_BUFFER, segment_size, NULL, GL_STREAM_DRAW);
+  glBufferSubData(GL_ARRAY_BUFFER, 0, nbytes, data);
+
+  if(offset) {
+    offset = 0;
+    changed = true;
+  }
+
+  return changed;
+}
+
+void BufferRing::fence() {
+
+#if defined(BUFFER_RING_CAN_PERSIST)
+  if(!is_persistent || !mapped) {
+    return;
+  }
+
+  if(fences[index]) {
+    glDeleteSync(fences[index]);
+  }
+
+  fences[index] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+#endif
+}
+
+bool BufferRing::grow(size_t nbytes) {
+
+#if defined(BUFFER_RING_CAN_PERSIST)
+  GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+  if(mapped) {
+    glBindBuffer(GL_ARRAY_BUFFER, vbo);
+    glUnmapBuffer(GL_ARRAY_BUFFER);
+    mapped = NULL;
+  }
+
+  for(int i = 0; i < BUFFER_RING_SEGMENTS; ++i) {
+    if(fences[i]) {
+      glDeleteSync(fences[i]);
+      fences[i] = 0;
+    }
+  }
+
+  // storage from glBufferStorage() is immutable, so create a new buffer. add some space so we don't grow often.
+  glDeleteBuffers(1, &vbo);
+  glGenBuffers(1, &vbo);
+  glBindBuffer(GL_ARRAY_BUFFER, vbo);
+
+  segment_size = nbytes + (nbytes / 2);
+  glBufferStorage(GL_ARRAY_BUFFER, segment_size * BUFFER_RING_SEGMENTS, NULL, flags);
+  mapped = (char*)glMapBufferRange(GL_ARRAY_BUFFER, 0, segment_size * BUFFER_RING_SEGMENTS, flags);
+
+  return (NULL != mapped);
+#else
+  (void)nbytes;
+  return false;
+#endif
+}
+
+void BufferRing::wait(int dx) {
+
+#if defined(BUFFER_RING_CAN_PERSIST)
+  if(!fences[dx]) {
+    return;
+  }
+
+  GLenum result = GL_TIMEOUT_EXPIRED;
+  while(result == GL_TIMEOUT_EXPIRED) {
+    result = glClientWaitSync(fences[dx], GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);
+  }
+
+  glDeleteSync(fences[dx]);
+  fences[dx] = 0;
+#else
+  (void)dx;
+#endif
+}
+
+} // namespace rx
+
+#endif // BUFFER_RING_IMPLEMENTATION
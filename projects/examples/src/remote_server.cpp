@@ -1,7 +1,9 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <unistd.h>
 
 #include <gui/remote/Server.h>
+#include <gui/remote/ShardedServer.h>
 #include <signal.h>
 
 using namespace rx; 
@@ -9,16 +11,35 @@ using namespace rx;
 void sighandler(int sig);
 bool must_run = true;
 
-int main() {
+/* remote_server [num_shards]; with shards every shard runs on its own thread and listens on 2255 + shard index */
+int main(int argc, char** argv) {
   printf("Remoxly Standalone Server (20140213).\n");
 
   signal(SIGINT, sighandler);
 
+  if(argc > 1) {
+
+    ShardedServer sharded(2255, atoi(argv[1]), false);
+    if(!sharded.start()) {
+      return EXIT_FAILURE;
+    }
+
+    printf("Running %d shards on port 2255-%d.\n", sharded.getNumShards(), 2255 + sharded.getNumShards() - 1);
+
+    while(must_run) {
+      sleep(1);
+    }
+
+    sharded.stop();
+    return EXIT_SUCCESS;
+  }
+
   Server server(2255, false);
   server.start();
 
+  /* sleeps until a client sends something, so an idle server doesn't use any cpu */
   while(must_run) {
-     server.update();     
+     server.update(REMOXLY_SERVER_DEFAULT_TIMEOUT);
   }
 
   return EXIT_SUCCESS;
@@ -27,4 +48,3 @@ int main() {
 void sighandler(int sig) {
   must_run = false;
 }
-
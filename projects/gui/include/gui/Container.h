@@ -53,9 +53,11 @@ namespace rx {
   inline void Container::update() {
 
     if (group.needsRedraw()) {
-      group.render->clear();
-      position();
-      group.build();
+      if (false == group.rebuild()) {
+        group.render->clear();
+        position();
+        group.build();
+      }
       group.render->update();
     }
   }
@@ -77,7 +79,10 @@ namespace rx {
 
       wid->position();
       wid->setBoundingBox();
+      wid->needs_layout = false;
     }
+
+    group.needs_layout = false;
   }
 
 } /* namespace rx */
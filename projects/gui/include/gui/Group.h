@@ -22,6 +22,7 @@
 #include <gui/Widget.h>
 #include <gui/Render.h>
 #include <gui/IconButton.h>
+#include <gui/HitIndex.h>
 
 namespace rx { 
 
@@ -42,6 +43,9 @@ namespace rx {
     void draw();                                                 /* will draw the group */
     void create();                                               /* is called when you need to the shapes for the element(s) */
     void position();
+    void setBoundingBox();                                       /* uses the bounding boxes that position() set for the children */
+    void setCullRange(int miny, int maxy);                       /* used by a Panel with virtual scrolling; children outside this range are not positioned or drawn. */
+    void disableCulling();
     void hideHeader();                                           /* hide the header */
     void showHeader();                                           /* show the header (default) */
     bool childrenClosed();                                       /* returns true when the children are closed. */
@@ -50,7 +54,12 @@ namespace rx {
     void onMousePress(float mx, float my, int button, int mods);
     void onMouseRelease(float mx, float my, int button, int mods);
     void onMouseMove(float mx, float my);
+    void onMousePressChildren(float mx, float my, int button, int mods);      /* only the children under the mouse and the ones holding the mouse, see HitIndex */
+    void onMouseReleaseChildren(float mx, float my, int button, int mods);
+    void onMouseMoveChildren(float mx, float my);
+    bool hasCapture();
     bool needsRedraw();
+    bool rebuild();
     void unsetNeedsRedraw();
 
     /* colors */
@@ -77,6 +86,12 @@ namespace rx {
 
     Widget* overlay;
     int overlay_bbox[4];
+    HitIndex hit_index;             /* the children sorted on y, rebuilt in position(). */
+
+    /* virtual scrolling */
+    bool use_culling;               /* when true, position() marks the children outside cull_miny..cull_maxy with GUI_STATE_CULLED */
+    int cull_miny;
+    int cull_maxy;
 
     /* theme: colors, shades */
     float fg_color[4];              /* foreground color; use this for e.g. fills */
@@ -104,14 +119,26 @@ namespace rx {
     return children_closed;
   }
 
+  inline void Group::setCullRange(int miny, int maxy) {
+    use_culling = true;
+    cull_miny = miny;
+    cull_maxy = maxy;
+  }
+
+  inline void Group::disableCulling() {
+    use_culling = false;
+  }
+
   inline void Group::showHeader() {
     show_header = true;
     h = 22;
+    setNeedsLayout();
   }
 
   inline void Group::hideHeader() {
     show_header = false;
     h = 0;
+    setNeedsLayout();
   }
 
 }  // namespace rx
@@ -0,0 +1,87 @@
+/*
+
+  HitIndex
+  --------
+
+  Used by Group and Panel to forward mouse events only to the children
+  that are under the cursor, instead of to every child. The children
+  of a Group (and the groups of a Panel) are stacked vertically, so we
+  keep a list of their bounding boxes sorted on y. For each entry we
+  store the largest bottom of all entries before it (`reach`), so a
+  binary search plus a short scan backwards finds all children which
+  contain the mouse y, also when some of them overlap.
+
+  Widgets that hold the mouse (see Widget::hasCapture(), e.g. a slider
+  that is being dragged, a select with an open menu or a number that is
+  being edited) get all events until they release it, also when the
+  mouse is outside of them.
+
+  The index is rebuilt in position(). When the children changed after
+  that (e.g. a widget was added) the index is invalid and the events
+  are forwarded to all children like before.
+
+ */
+#ifndef REMOXLY_GUI_HIT_INDEX_H
+#define REMOXLY_GUI_HIT_INDEX_H
+
+#include <vector>
+#include <stddef.h>
+
+namespace rx {
+
+  class Widget;
+
+  /* -------------------------------------------------------------------------------------------------------------- */
+
+  struct HitEntry {
+    size_t index;                                                /* Index into the children. */
+    int top;                                                     /* bbox[1] */
+    int bottom;                                                  /* bbox[1] + bbox[3] */
+    int reach;                                                   /* The largest bottom of this and all previous entries. */
+  };
+
+  /* -------------------------------------------------------------------------------------------------------------- */
+
+  class HitIndex {
+
+  public:
+    HitIndex();
+    void build(std::vector<Widget*>& widgets);                   /* Creates the index from the bounding boxes of the drawn widgets; call this after positioning them. */
+    void invalidate();                                           /* Forward all events to all widgets until the next build(). */
+    bool isValid(std::vector<Widget*>& widgets);                 /* Returns true when the index was built for the given widgets. */
+    bool hasCapture();                                           /* Returns true when one of the widgets holds the mouse. */
+
+    /* interaction; these return false when the index is invalid and the caller must forward the event to all widgets. */
+    bool onMousePress(std::vector<Widget*>& widgets, float mx, float my, int button, int modkeys);
+    bool onMouseRelease(std::vector<Widget*>& widgets, float mx, float my, int button, int modkeys);
+    bool onMouseMove(std::vector<Widget*>& widgets, float mx, float my);
+
+  private:
+    void query(float my);                                        /* Fills `targets` with the indices of the widgets under `my` and the ones that hold the mouse, in the order of the children. */
+    void capture(std::vector<Widget*>& widgets);                 /* Updates `captured` after an event was forwarded to `targets`. */
+
+  public:
+    bool is_valid;
+    size_t num_widgets;                                          /* The number of children when the index was built. */
+    std::vector<HitEntry> entries;                               /* The drawn widgets, sorted on top. */
+    std::vector<size_t> captured;                                /* Indices of the widgets that hold the mouse. */
+    std::vector<size_t> targets;                                 /* The widgets that receive the current event; reused to prevent allocations. */
+  };
+
+  /* -------------------------------------------------------------------------------------------------------------- */
+
+  inline void HitIndex::invalidate() {
+    is_valid = false;
+  }
+
+  inline bool HitIndex::isValid(std::vector<Widget*>& widgets) {
+    return is_valid && num_widgets == widgets.size();
+  }
+
+  inline bool HitIndex::hasCapture() {
+    return captured.size() > 0;
+  }
+
+} /* namespace rx */
+
+#endif
@@ -13,6 +13,25 @@
   For performance issues the renderer should make sure that 
   it only initialize the shader/programs once. 
 
+  Virtual scrolling:
+  ------------------
+
+  By default all groups and widgets are positioned and drawn, also
+  when they are scrolled out of view. For panels with thousands of
+  widgets call enableVirtualScroll(). Groups and widgets that are
+  outside the visible area are then marked with GUI_STATE_CULLED;
+  they keep the height of their last layout and are not positioned 
+  or drawn until they are scrolled into view again.
+
+  Layout:
+  -------
+
+  position() only positions the widgets that changed size, were 
+  shown/hidden or opened/closed (see Widget::setNeedsLayout()). The
+  widgets after them are moved; all others keep their layout. When 
+  the panel is dragged or scrolled the widgets are moved but not 
+  measured again.
+
  */
 
 #ifndef REMOXLY_GUI_PANEL_H
@@ -22,6 +41,7 @@
 #include <gui/Widget.h>
 #include <gui/Group.h>
 #include <gui/Scroll.h>
+#include <gui/HitIndex.h>
 
 namespace rx { 
 
@@ -36,18 +56,29 @@ class Panel : public Widget {
   void create();
   void draw();
   void position();
+  void enableVirtualScroll();                /* only position and draw the groups and widgets that are inside the visible area; use this for panels with a lot of widgets. */
+  void disableVirtualScroll();
 
   void onMousePress(float mx, float my, int button, int modkeys);
   void onMouseRelease(float mx, float my, int button, int modkeys);
   void onMouseMove(float mx, float my);
+  void onMousePressChildren(float mx, float my, int button, int modkeys);    /* only the groups under the mouse and the ones holding the mouse, see HitIndex */
+  void onMouseReleaseChildren(float mx, float my, int button, int modkeys);
+  void onMouseMoveChildren(float mx, float my);
   bool needsRedraw();
+  bool prepare();                    /* the CPU part of update(): rebuilds the widgets into the buffers of the renderer without GL calls; returns true when upload() must be called. PanelSet calls this for several panels in parallel. */
+  void upload();                     /* the GL part of update(): uploads the buffers after prepare(); must be called on the GL thread. */
 
  private:
   void update();
+  int positionGroups();              /* positions the groups with the current scroll offset and returns the height of the content; groups that didn't move or change keep their layout. */
 
  public:
   Scroll scroll;
   std::vector<Group*> groups;
+  HitIndex hit_index;                /* the groups sorted on y, rebuilt in position(). */
+  bool is_virtual;                   /* see enableVirtualScroll() */
+  bool needs_upload;                 /* set by prepare(), see upload() */
 };
 
 } // namespace rx
@@ -0,0 +1,75 @@
+/*
+
+  PanelSet
+  --------
+
+  Updates a couple of panels at once. Every Panel has its own Render so
+  the panels are independent; when several of them changed (e.g. after
+  a preset was loaded on a control surface with 6-10 panels) we position
+  and build the dirty panels on a small pool of threads (see
+  Panel::prepare()) and then upload the buffers one after another on the
+  GL thread (see Panel::upload()). This means a rebuild takes the time
+  of the slowest panel and not the sum of all of them. When only one
+  panel changed, or on a machine with one processor, we build on the
+  calling thread.
+
+  Each panel must have its own render; add() returns false when a render
+  is shared with a panel that was added before. The widget callbacks are
+  not called while building so nothing special is needed there, but
+  don't change the widgets from another thread while update() runs.
+
+  Usage:
+
+      PanelSet panel_set;
+      panel_set.add(panel_a);
+      panel_set.add(panel_b);
+
+      // in the draw loop (GL thread)
+      panel_set.draw();
+
+ */
+#ifndef REMOXLY_GUI_PANEL_SET_H
+#define REMOXLY_GUI_PANEL_SET_H
+
+#include <vector>
+#include <gui/Thread.h>
+
+namespace rx {
+
+  class Panel;
+
+  /* -------------------------------------------------------------------------------------------------------------- */
+
+  class PanelSet {
+
+  public:
+    PanelSet(int numThreads = -1);                               /* The number of worker threads; the calling thread builds panels too. -1 uses one less than the number of processors (at most 3). */
+    ~PanelSet();                                                 /* Stops the worker threads. */
+    bool add(Panel* panel);                                      /* Adds a panel; the panel must have its own render. */
+    void update();                                               /* Builds the panels that changed in parallel and uploads them; call this on the GL thread. */
+    void draw();                                                 /* Calls update() and draws all panels. */
+
+  private:
+    bool start();                                                /* Starts the worker threads, called the first time more than one panel must be built. */
+    void stop();
+    static void threadMain(void* user);
+    void run();                                                  /* The worker loop. */
+    void work();                                                 /* Builds jobs until there are none left; the mutex must be locked. */
+
+  public:
+    std::vector<Panel*> panels;
+    std::vector<Panel*> dirty;                                   /* The panels that need to be built in this update(); only used by the calling thread. */
+    std::vector<Thread*> threads;
+    int num_threads;
+    Mutex mutex;                                                 /* Protects the members below. */
+    std::vector<Panel*> jobs;                                    /* The panels the workers build; filled and cleared while update() holds the lock. */
+    Condition work_cond;                                         /* Signalled when new jobs were added or when we must stop. */
+    Condition done_cond;                                         /* Signalled when the last job was built. */
+    size_t next_job;                                             /* Index into `jobs` of the next panel to build. */
+    size_t num_done;                                             /* The number of jobs that were built. */
+    bool must_stop;
+  };
+
+} /* namespace rx */
+
+#endif
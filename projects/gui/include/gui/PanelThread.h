@@ -0,0 +1,125 @@
+/*
+
+  PanelThread
+  -----------
+
+  Builds a Panel on a worker thread so a heavy rebuild (e.g. after
+  opening a group with a lot of widgets) doesn't block the frame of
+  the application. The panel must be created with a RenderSnapshot;
+  the worker positions and builds the panel into it and publishes a
+  complete snapshot after every change. draw() only uploads the latest
+  snapshot into the GL renderer (when there is a new one) and draws it.
+
+  Mouse and key events are queued and handled by the worker, in the
+  order they were received; consecutive mouse moves are merged. This
+  means that the widget callbacks and listeners are called on the
+  worker thread.
+
+  Usage:
+
+      RenderGL* gl = new RenderGL();
+      gl->setup();
+
+      RenderSnapshot* snapshot = new RenderSnapshot(gl);
+      Panel* panel = new Panel(snapshot, 500);
+      // add groups and widgets
+
+      PanelThread panel_thread(panel, snapshot);
+      panel_thread.start();
+
+      // in the draw loop (GL thread)
+      panel_thread.draw();
+
+      // in the GLFW callbacks
+      panel_thread.onMouseMove(x, y);
+
+      // when your application changed a value of a widget
+      panel_thread.setNeedsRedraw();
+
+  Don't add, remove or change widgets while the thread is running;
+  call stop() first.
+
+ */
+#ifndef REMOXLY_GUI_PANEL_THREAD_H
+#define REMOXLY_GUI_PANEL_THREAD_H
+
+#include <vector>
+#include <gui/Thread.h>
+
+#define GUI_PANEL_EVENT_MOUSE_PRESS     1
+#define GUI_PANEL_EVENT_MOUSE_RELEASE   2
+#define GUI_PANEL_EVENT_MOUSE_MOVE      3
+#define GUI_PANEL_EVENT_CHAR_PRESS      4
+#define GUI_PANEL_EVENT_KEY_PRESS       5
+#define GUI_PANEL_EVENT_KEY_RELEASE     6
+#define GUI_PANEL_EVENT_RESIZE          7
+
+namespace rx {
+
+  class Panel;
+  class RenderSnapshot;
+
+  /* -------------------------------------------------------------------------------------------------------------- */
+
+  struct PanelEvent {
+    PanelEvent();
+    int type;                                                    /* GUI_PANEL_EVENT_* */
+    float x;                                                     /* Mouse position, or the new size for a resize. */
+    float y;
+    int button;
+    int mods;
+    unsigned int key;
+  };
+
+  inline PanelEvent::PanelEvent()
+    :type(0)
+    ,x(0.0f)
+    ,y(0.0f)
+    ,button(0)
+    ,mods(0)
+    ,key(0)
+  {
+  }
+
+  /* -------------------------------------------------------------------------------------------------------------- */
+
+  class PanelThread {
+
+  public:
+    PanelThread(Panel* panel, RenderSnapshot* snapshot);
+    ~PanelThread();                                              /* Stops the thread. */
+    bool start();                                                /* Starts the worker, which builds the first snapshot. */
+    void stop();                                                 /* Waits until the worker handled the queued events and stopped. */
+    void draw();                                                 /* Uploads the latest snapshot (if there is a new one) and draws it; call this on the GL thread. */
+    void setNeedsRedraw();                                       /* Rebuild the whole panel, e.g. when the application changed the value of a widget. */
+    void resize(int w, int h);                                   /* Resizes the GL renderer and the snapshot. */
+
+    /* interaction; queued for the worker. */
+    void onMousePress(float mx, float my, int button, int modkeys);
+    void onMouseRelease(float mx, float my, int button, int modkeys);
+    void onMouseMove(float mx, float my);
+    void onCharPress(unsigned int key);                          /* The key is also passed to the text/number input of the GL renderer, see RenderSnapshot. */
+    void onKeyPress(int key, int modkeys);
+    void onKeyRelease(int key, int modkeys);
+
+  private:
+    static void threadMain(void* user);
+    void run();                                                  /* The worker loop. */
+    void push(PanelEvent& ev);                                   /* Queues the event and wakes up the worker. */
+    void handle(PanelEvent& ev);                                 /* Passes the event to the panel; called on the worker. */
+
+  public:
+    Panel* panel;
+    RenderSnapshot* snapshot;
+    Thread thread;
+    Mutex mutex;                                                 /* Protects `events`, `needs_redraw` and `must_stop`. */
+    Condition cond;                                              /* Signalled when an event was queued or when we must stop. */
+    std::vector<PanelEvent> events;                              /* Queued by the GL thread. */
+    std::vector<PanelEvent> work;                                /* The events the worker is handling; swapped with `events` so we don't hold the lock. */
+    bool needs_redraw;
+    bool must_stop;
+  };
+
+} /* namespace rx */
+
+#endif
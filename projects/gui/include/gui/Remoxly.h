@@ -47,12 +47,17 @@
 #include <gui/IconButton.h>
 #include <gui/WidgetListener.h>
 #include <gui/Panel.h>
+#include <gui/PanelSet.h>
+#include <gui/PanelThread.h>
 #include <gui/Render.h>
+#include <gui/RenderRecorder.h>
+#include <gui/RenderSnapshot.h>
 #include <gui/Scroll.h>
 #include <gui/Slider.h>
 #include <gui/Storage.h>
 #include <gui/Text.h>
 #include <gui/Texture.h>
+#include <gui/Thread.h>
 #include <gui/Toggle.h>
 #include <gui/Types.h>
 #include <gui/Utils.h>
@@ -14,8 +14,9 @@
 #ifndef REMOXLY_RENDER_H
 #define REMOXLY_RENDER_H
 
-#include <sstream>
 #include <string>
+#include <stdint.h>
+#include <gui/Utils.h>
 
 namespace rx { 
 
@@ -36,6 +37,7 @@ namespace rx {
 
   public:
     Render();
+    virtual ~Render() { }
     virtual bool setup();                                                                                                                                                                         /* Initialize the Render object */
     virtual void update();                                                                                                                                                                        /* Update the vertices, GPU buffers, etc.. if somethings that gets drawn changed */
     virtual void draw();                                                                                                                                                                          /* Draw everything to screen */
@@ -59,8 +61,9 @@ namespace rx {
     virtual void getTextInputValue(std::string& result);
     virtual void disableTextInput();
     virtual void enableTextInput(float x, float y, float maxw, std::string value, float* color); 
-    virtual void writeText(float x, float y, std::string text, float* color);                                                                                                                     /* Write some text */
+    virtual void writeText(float x, float y, const std::string& text, float* color);                                                                                                              /* Write some text */
     virtual void writeNumber(float x, float y, std::string number, float* color);                                                                                                                 /* Write a number; we will right align numbers */
+    virtual void writeNumber(float x, float y, const char* number, size_t len, float* color);                                                                                                     /* Write `len` characters of a number without creating a string; used by writeNumber<T>(). The default implementation calls the std::string version. */
     virtual void writeIcon(float x, float y, unsigned int icon, float* color);
     virtual bool getIconSize(unsigned int id, int& w, int& h);
     virtual void addRectangle(float x, float y, float w, float h, float* color, bool filled = true, float shadetop = -0.15, float shadebot = 0.15f);                                              /* Draw a rectangle at x/y with w/h and given color; must have 4 elements */
@@ -69,37 +72,41 @@ namespace rx {
     virtual void addRoundedShadowLine(float x, float y, float w, float h, float radius, float* color, int corners);
     virtual void setLayer(int layer);                                                                                                                                                             /* Set the active layer to draw on. Layer 0 is the bottom layer, on which most elements are drawn. This allowed you to create overlays. Though, make sure that you don't create too many different layers because each layer will need some GL/DX resources. */
 
+    /* incremental updates */
+    virtual void beginSpan(uint32_t id);                                                                                                                                                          /* Called by Widget::build() before a widget creates its shapes. A renderer can use this to remember which vertices belong to the widget with the given Widget::span_id. */
+    virtual void endSpan(uint32_t id);                                                                                                                                                            /* Called by Widget::build() after the widget created its shapes. */
+    virtual bool beginPatch(uint32_t id);                                                                                                                                                         /* Start rewriting the shapes of a widget that was built before, without clearing everything. Returns false when the renderer cannot patch this widget; the caller must do a full rebuild. */
+    virtual bool endPatch(uint32_t id);                                                                                                                                                           /* Returns true when the new shapes replaced the old ones in place. When false nothing was changed and the caller must do a full rebuild (e.g. the number of vertices changed). */
+
+    /* building on another thread */
+    virtual Render* createStagingRender();                                                                                                                                                        /* Returns a new render of the same type that another thread can write into, see swapBuffers() and RenderSnapshot. Returns NULL when the renderer doesn't support this (default). Call this on the GL thread. */
+    virtual bool swapBuffers(Render* staging);                                                                                                                                                    /* Exchanges the vertices and draw lists (not the GPU buffers) with a render that was created by createStagingRender(); the next update() uploads them. The text and number input are not exchanged. Returns false when not supported. */
+
     /* helpers */
-    template<class T> void writeNumber(float x, float y, T number, float* color);
-    template<class T> void enableNumberInput(float x, float y, float maxw, T number, float* color);
+    template<class T> void writeNumber(float x, float y, T number, float* color, int precision = -1);                                                                                             /* Formats the number on the stack, see gui_format_number() for the precision */
+    template<class T> void enableNumberInput(float x, float y, float maxw, T number, float* color, int precision = -1);
     template<class T> void getNumberInputValue(T& value);
   };
 
   template<class T>
-    void Render::writeNumber(float x, float y, T number, float* color) {
-    std::stringstream ss;
-    std::string text;
-    ss << number;
-    ss >> text;
-    writeNumber(x, y, text, color);
+    void Render::writeNumber(float x, float y, T number, float* color, int precision) {
+    char buf[GUI_NUMBER_BUFFER_SIZE];
+    int len = gui_format_number(number, precision, buf, sizeof(buf));
+    writeNumber(x, y, buf, len, color);
   }
 
   template<class T>
-    void Render::enableNumberInput(float x, float y, float maxw, T number, float* color) {
-    std::stringstream ss;
-    std::string text;
-    ss << number;
-    ss >> text;
-    enableNumberInput(x, y, maxw, text, color);
+    void Render::enableNumberInput(float x, float y, float maxw, T number, float* color, int precision) {
+    char buf[GUI_NUMBER_BUFFER_SIZE];
+    gui_format_number(number, precision, buf, sizeof(buf));
+    enableNumberInput(x, y, maxw, std::string(buf), color);
   }
 
   template<class T>
     void Render::getNumberInputValue(T& value) {
     std::string result;
-    std::stringstream ss;
     getNumberInputValue(result);
-    ss << result;
-    ss >> value;
+    gui_parse_number(result.c_str(), value);
   }
 
 } /* namespace rx */
@@ -0,0 +1,166 @@
+/*
+
+  RenderRecorder
+  --------------
+
+  A Render implementation that doesn't need a GL context. Everything a
+  widget draws is recorded into flat arrays: one RecordedShape for each
+  (rounded) rectangle and shadow line and one RecordedText for each text,
+  number or icon. The characters of all text runs are stored in
+  `text_data`. We use this to measure the cost of layouting and building
+  widget trees and to test them on machines without a GPU.
+
+  The vertex counts are the ones RenderGL would create when it doesn't use
+  instancing: 6 vertices for a filled shape, 5 for an outline rectangle and
+  6 for each glyph. Icons have no glyph table here, getIconSize() returns
+  `icon_w` and `icon_h`.
+
+  Spans and patches are supported the same way as in RenderGL: when a
+  widget recreates the same number of shapes and text runs they replace
+  the recorded ones, otherwise endPatch() returns false.
+
+ */
+#ifndef REMOXLY_RENDER_RECORDER_H
+#define REMOXLY_RENDER_RECORDER_H
+
+#include <vector>
+#include <string>
+#include <stdint.h>
+#include <gui/Render.h>
+
+#define GUI_RECORD_RECTANGLE          1
+#define GUI_RECORD_OUTLINE            2
+#define GUI_RECORD_ROUNDED_RECTANGLE  3
+#define GUI_RECORD_ROUNDED_OUTLINE    4
+#define GUI_RECORD_SHADOW_LINE        5
+#define GUI_RECORD_TEXTURE            6
+#define GUI_RECORD_TEXT               7
+#define GUI_RECORD_NUMBER             8
+#define GUI_RECORD_ICON               9
+
+namespace rx {
+
+  /* -------------------------------------------------------------------------------------------------------------- */
+
+  struct RecordedShape {
+    int type;                                                    /* GUI_RECORD_{RECTANGLE, OUTLINE, ROUNDED_RECTANGLE, ROUNDED_OUTLINE, SHADOW_LINE, TEXTURE} */
+    int layer;
+    float x;
+    float y;
+    float w;
+    float h;
+    float radius;
+    float shade_top;
+    float shade_bottom;
+    int corners;
+    float color[4];
+    TextureInfo* texture;                                        /* Only for GUI_RECORD_TEXTURE. */
+  };
+
+  struct RecordedText {
+    int type;                                                    /* GUI_RECORD_{TEXT, NUMBER, ICON} */
+    int layer;
+    float x;
+    float y;
+    unsigned int icon;
+    size_t offset;                                               /* Offset into RenderRecorder::text_data. */
+    size_t count;                                                /* Number of characters; 1 for icons. */
+    float color[4];
+  };
+
+  struct RecordedMark {
+    size_t shapes;
+    size_t texts;
+  };
+
+  struct RecordedSpan {
+    RecordedSpan():build(0),is_duplicate(false) {}
+    RecordedMark begin;
+    RecordedMark end;
+    uint32_t build;                                              /* The full build that recorded this span, see RenderRecorder::spans_build. */
+    bool is_duplicate;                                           /* Two widgets used the same span id; we never patch it. */
+  };
+
+  /* -------------------------------------------------------------------------------------------------------------- */
+
+  class RenderRecorder : public Render {
+
+  public:
+    RenderRecorder();
+    bool setup();
+    void update();
+    void draw();
+    void resize(int w, int h);
+
+    /* Layouting. */
+    void getWindowSize(int& ww, int& wh);
+    void beginScissor();
+    void scissor(int sx, int sy, int sw, int sh);
+    void endScissor();
+
+    /* Interaction. */
+    void onCharPress(unsigned int key);                          /* Appended to the enabled text or number input. */
+    void onKeyPress(int key, int mods);
+
+    /* Drawing */
+    void clear();                                                /* Removes all recorded shapes, text runs and spans; the counters are kept. */
+    void getNumberInputValue(std::string& result);
+    void disableNumberInput();
+    void enableNumberInput(float x, float y, float maxw, std::string value, float* color);
+    void getTextInputValue(std::string& result);
+    void disableTextInput();
+    void enableTextInput(float x, float y, float maxw, std::string value, float* color);
+    void writeText(float x, float y, const std::string& text, float* color);
+    void writeNumber(float x, float y, std::string number, float* color);
+    void writeNumber(float x, float y, const char* number, size_t len, float* color);
+    void writeIcon(float x, float y, unsigned int icon, float* color);
+    bool getIconSize(unsigned int id, int& w, int& h);
+    void addRectangle(float x, float y, float w, float h, float* color, bool filled = true, float shadetop = -0.15, float shadebot = 0.15f);
+    void addRectangle(float x, float y, float w, float h, TextureInfo* texinfo);
+    void addRoundedRectangle(float x, float y, float w, float h, float radius, float* color, bool filled = true, float shadetop = 0.10f, float shadebot = -0.10f, int corners = 0xFF);
+    void addRoundedShadowLine(float x, float y, float w, float h, float radius, float* color, int corners);
+    void setLayer(int layer);
+
+    /* Incremental updates */
+    void beginSpan(uint32_t id);
+    void endSpan(uint32_t id);
+    bool beginPatch(uint32_t id);
+    bool endPatch(uint32_t id);
+
+    /* Statistics */
+    size_t getNumShapeVertices();                                /* The number of vertices RenderGL would create for the recorded shapes. */
+    size_t getNumGlyphVertices();                                /* The number of vertices RenderGL would create for the recorded text runs. */
+
+  private:
+    void addShape(int type, float x, float y, float w, float h, float radius, float* color, float shadetop, float shadebot, int corners);
+    void addText(int type, float x, float y, const char* text, size_t len, unsigned int icon, float* color);
+    void getMark(RecordedMark& mark);
+
+  public:
+    std::vector<RecordedShape> shapes;
+    std::vector<RecordedText> texts;
+    std::string text_data;                                       /* The characters of all text runs. */
+    std::vector<RecordedSpan> spans;                             /* The shapes and text runs of each widget indexed by span id, see beginSpan(). */
+    uint32_t spans_build;                                        /* Incremented by clear(); only spans of the current build are valid. */
+    RecordedMark span_mark;
+    int layer;                                                   /* The current layer. */
+    int win_w;
+    int win_h;
+    int icon_w;                                                  /* Returned by getIconSize(). */
+    int icon_h;
+    bool is_text_input_enabled;
+    bool is_number_input_enabled;
+    std::string text_input_value;
+    std::string number_input_value;
+
+    /* Counters; these are not reset by clear(). */
+    uint64_t num_clears;
+    uint64_t num_updates;
+    uint64_t num_draws;
+    uint64_t num_patches;                                        /* Patches that replaced the shapes in place. */
+    uint64_t num_failed_patches;                                 /* Patches that needed a full rebuild. */
+  };
+
+} /* namespace rx */
+
+#endif
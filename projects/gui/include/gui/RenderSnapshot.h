@@ -0,0 +1,126 @@
+/*
+
+  RenderSnapshot
+  --------------
+
+  A Render which is used by PanelThread to build a panel on another
+  thread than the GL thread. The widgets draw into it like they do into
+  a RenderRecorder (it is one), so rebuilding a widget only patches the
+  recorded shapes. When a build is complete (in draw()) we replay the
+  recorded shapes and text runs into a staging render that the target
+  created (see Render::createStagingRender()); this creates the vertices
+  and draw lists of the target on the building thread. The GL thread
+  calls upload() to swap the latest complete snapshot into the `target`
+  Render (e.g. a RenderGL) and to upload its buffers, and drawTarget()
+  to draw it. A snapshot is never changed after it was published; we
+  keep three of them (the one that is being written, the latest
+  complete one and the one that was swapped into the target), so
+  neither thread has to wait for the other. When no new snapshot was
+  published the GL thread draws the vertices it uploaded before.
+
+  When the target can't create a staging render we copy the recorded
+  shapes into the snapshot instead and replay them on the GL thread.
+
+  The text and number inputs are edited on the GL thread (the target
+  owns them); their values are copied into this object so the widgets
+  can read them with getTextInputValue() and getNumberInputValue().
+
+  All functions of the Render interface must be called on the thread
+  that builds the panel; upload(), drawTarget(), onTargetCharPress()
+  and onTargetKeyPress() must be called on the GL thread.
+
+ */
+#ifndef REMOXLY_RENDER_SNAPSHOT_H
+#define REMOXLY_RENDER_SNAPSHOT_H
+
+#include <vector>
+#include <string>
+#include <gui/RenderRecorder.h>
+#include <gui/Thread.h>
+
+namespace rx {
+
+  /* -------------------------------------------------------------------------------------------------------------- */
+
+  struct RecordedInput {                                         /* The state of the text or number input. */
+    bool is_enabled;
+    int layer;
+    float x;
+    float y;
+    float maxw;
+    std::string value;                                           /* The value the widget passed into enable*Input(); not the edited one. */
+    float color[4];
+  };
+
+  struct RenderDrawList {                                        /* Everything a panel drew in one complete build. */
+    Render* staging;                                             /* The vertices and draw lists of the target, created on the building thread; NULL when the target doesn't support this. */
+    std::vector<RecordedShape> shapes;                           /* Only used without `staging`. */
+    std::vector<RecordedText> texts;
+    std::string text_data;
+    RecordedInput text_input;
+    RecordedInput number_input;
+    bool is_scissor_enabled;
+    int scissor[4];
+  };
+
+  /* -------------------------------------------------------------------------------------------------------------- */
+
+  class RenderSnapshot : public RenderRecorder {
+
+  public:
+    RenderSnapshot(Render* target);                              /* The target is used on the GL thread; it must be setup. Create the snapshot on the GL thread, we create the staging renders here. */
+    ~RenderSnapshot();                                           /* Deletes the staging renders; call this on the GL thread. */
+    void update();                                               /* Called after a (partial) rebuild. */
+    void draw();                                                 /* Publishes a new snapshot when something changed since the previous one. */
+
+    /* Layouting. */
+    void beginScissor();
+    void scissor(int sx, int sy, int sw, int sh);
+    void endScissor();
+
+    /* Interaction; the inputs are edited on the GL thread, see onTargetCharPress(). */
+    void onCharPress(unsigned int key);
+    void onKeyPress(int key, int mods);
+    void getNumberInputValue(std::string& result);
+    void disableNumberInput();
+    void enableNumberInput(float x, float y, float maxw, std::string value, float* color);
+    void getTextInputValue(std::string& result);
+    void disableTextInput();
+    void enableTextInput(float x, float y, float maxw, std::string value, float* color);
+    bool getIconSize(unsigned int id, int& w, int& h);           /* Asks the target; only called when a widget is added. */
+
+    /* GL thread */
+    bool upload();                                               /* Swaps the latest complete snapshot into the target and uploads it; returns false when there was no new snapshot. */
+    void drawTarget();                                           /* Draws the target with the scissor of the snapshot that was uploaded. */
+    void onTargetCharPress(unsigned int key);                    /* Edits the input of the target and copies its value. */
+    void onTargetKeyPress(int key, int mods);
+
+  private:
+    void replay(Render* dest, std::vector<RecordedShape>& shape_list, std::vector<RecordedText>& text_list, std::string& chars); /* Clears `dest` and recreates the given shapes and text runs in it; `chars` holds the characters of the text runs. */
+    void applyInputs(RenderDrawList& list);                      /* Enables or disables the inputs of the target when they changed. */
+    void copyInputValues();                                      /* Copies the edited values of the target inputs. */
+
+  public:
+    Render* target;
+    Mutex mutex;                                                 /* Protects `pending`, `has_pending` and the edited input values. */
+    RenderDrawList lists[3];
+    RenderDrawList* back;                                        /* Build thread: the snapshot we write. */
+    RenderDrawList* pending;                                     /* The latest complete snapshot. */
+    RenderDrawList* front;                                       /* GL thread: the snapshot that was uploaded. */
+    bool has_pending;                                            /* True when `pending` wasn't uploaded yet. */
+    bool has_changes;                                            /* Build thread: true when something changed since the last snapshot. */
+    RecordedInput text_input;                                    /* Build thread: the current state of the inputs. */
+    RecordedInput number_input;
+    RecordedInput target_text_input;                             /* GL thread: the state we applied to the target. */
+    RecordedInput target_number_input;
+    bool is_scissor_enabled;
+    int scissor_rect[4];
+    std::string edited_text;                                     /* The values of the target inputs, copied on the GL thread. */
+    std::string edited_number;
+    uint64_t num_published;                                      /* Number of snapshots that were published. */
+    uint64_t num_uploaded;                                       /* Number of snapshots that were uploaded. */
+  };
+
+} /* namespace rx */
+
+#endif
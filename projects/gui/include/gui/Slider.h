@@ -55,6 +55,8 @@ class Slider : public Widget {
   void stepMin();
   void stepPlus();
 
+  void setPrecision(int p);                                         /* the number of decimals we show; by default we use the number of decimals of the step size */
+
   void setType(int dummy);
   void setType(float dummy);
 
@@ -68,6 +70,7 @@ class Slider : public Widget {
   int num_w;                                                        /* the width of the number field */
   int text_x;
   int text_w;
+  int precision;                                                    /* the number of decimals of the number field, see setPrecision() */
   IconButton min_button;                                            /* button that decreases the value by step size */
   IconButton plus_button;
 };
@@ -116,11 +119,19 @@ template<class T>
   ,num_w(0)
   ,text_x(0)
   ,text_w(0)
+  ,precision(0)
   ,min_button(0, GUI_ICON_CHEVRON_LEFT, slider_min_click, this, (style & GUI_CORNER_LEFT) ? GUI_CORNER_LEFT : GUI_STYLE_NONE)
   ,plus_button(1, GUI_ICON_CHEVRON_RIGHT, slider_plus_click, this, (style & GUI_CORNER_RIGHT) ? GUI_CORNER_RIGHT : GUI_STYLE_NONE)
 {
   setType(T(0));
   setAbsoluteValue(value);
+
+  /* e.g. 2 decimals for a step of 0.01; integers are written without decimals anyway */
+  double s = fabs(double(step));
+  while (precision < 6 && fabs(s - floor(s + 0.5)) > 1e-6 * (1.0 + s)) {
+    s *= 10.0;
+    precision++;
+  }
 }
 
 template<class T>
@@ -128,13 +139,15 @@ void Slider<T>::setGroup(Group* g) {
 
   Widget::setGroup(g);
 
-  needs_redraw = true;
+  setNeedsRedraw();
   h = 22;
 
   min_button.icon_y = 1;
   plus_button.icon_y = 1;
   plus_button.icon_x = 1;
 
+  min_button.parent = this;
+  plus_button.parent = this;
   min_button.setGroup(g);
   plus_button.setGroup(g);
 }
@@ -164,10 +177,10 @@ void Slider<T>::create() {
   render->writeText(x + group->xindent, y + group->yindent, label, group->label_color);
 
   if(state & GUI_STATE_EDITABLE) {
-    render->enableNumberInput(num_x + (num_w - group->xindent - group->padding - GUI_CURSOR_WIDTH), y + group->yindent, num_w - 15, value, group->number_color);
+    render->enableNumberInput(num_x + (num_w - group->xindent - group->padding - GUI_CURSOR_WIDTH), y + group->yindent, num_w - 15, value, group->number_color, precision);
   }
   else {
-    render->writeNumber(num_x + (num_w - group->xindent - group->padding - GUI_CURSOR_WIDTH), y + group->yindent, value, group->label_color);
+    render->writeNumber(num_x + (num_w - group->xindent - group->padding - GUI_CURSOR_WIDTH), y + group->yindent, value, group->label_color, precision);
   }
 
   min_button.create();
@@ -234,7 +247,7 @@ void Slider<T>::onMousePress(float mx, float my, int button, int modkeys) {
     // inside number area and not yet editable
     if(!(state & GUI_STATE_EDITABLE)) {
       state |= GUI_STATE_EDITABLE;
-      needs_redraw = true;
+      setNeedsRedraw();
     }
   }
   else {
@@ -264,7 +277,7 @@ void Slider<T>::onMouseRelease(float mx, float my, int button, int modkeys) {
   plus_button.onMouseRelease(mx, my, button, modkeys);
 
   if(state & GUI_STATE_DOWN_INSIDE) {
-    needs_redraw = true;
+    setNeedsRedraw();
   }
 
   state &= ~GUI_STATE_DOWN_INSIDE;
@@ -308,7 +321,7 @@ void Slider<T>::setMousePositionValue(float mx) {
 
   //  setPercentageValue(slide_v );
   setAbsoluteValue(minv + slide_v * (maxv - minv));
-  needs_redraw = true ;
+  setNeedsRedraw();
 }
 
 template<class T>
@@ -321,7 +334,7 @@ void Slider<T>::disableInputAndCopyValue() {
   setAbsoluteValue(value);
 
   state &= ~GUI_STATE_EDITABLE;
-  needs_redraw = true;
+  setNeedsRedraw();
 }
 
 template<class T>
@@ -339,6 +352,12 @@ void Slider<T>::stepPlus() {
   setAbsoluteValue(value + step);
 }
 
+template<class T>
+void Slider<T>::setPrecision(int p) {
+  precision = gui_clamp<int>(p, 0, 9);
+  setNeedsRedraw();
+}
+
 template<class T> 
 void Slider<T>::setType(int dummy) {
   type = GUI_TYPE_SLIDER_INT;
@@ -0,0 +1,159 @@
+/*
+
+  Thread
+  ------
+
+  Minimal wrappers around pthreads (or the Win32 API on Windows) that
+  are used by PanelThread, PanelSet and RenderSnapshot. They only implement what
+  we need: a mutex, a condition variable and a thread that can be
+  joined. The gui_atomic_* functions are used by the lock free queues
+  and reference counts of the remote server.
+
+ */
+#ifndef REMOXLY_GUI_THREAD_H
+#define REMOXLY_GUI_THREAD_H
+
+#if defined(_WIN32)
+#  include <windows.h>
+#else
+#  include <pthread.h>
+#endif
+
+namespace rx {
+
+  typedef void(*gui_thread_function)(void* user);
+
+  int gui_get_num_cpus();                                        /* The number of online processors, at least 1. */
+
+  int gui_atomic_add(volatile int* value, int n);                /* Adds n and returns the new value; full barrier. */
+  int gui_atomic_load(volatile int* value);                      /* Acquire. */
+  void gui_atomic_store(volatile int* value, int v);             /* Release. */
+  template<class T> T* gui_atomic_exchange_ptr(T* volatile* ptr, T* v);   /* Stores v and returns the previous pointer; full barrier. */
+  template<class T> T* gui_atomic_load_ptr(T* volatile* ptr);             /* Acquire. */
+  template<class T> void gui_atomic_store_ptr(T* volatile* ptr, T* v);    /* Release. */
+
+  /* -------------------------------------------------------------------------------------------------------------- */
+
+  class Mutex {
+
+  public:
+    Mutex();
+    ~Mutex();
+    void lock();
+    void unlock();
+
+  public:
+#if defined(_WIN32)
+    CRITICAL_SECTION handle;
+#else
+    pthread_mutex_t handle;
+#endif
+  };
+
+  /* -------------------------------------------------------------------------------------------------------------- */
+
+  class Condition {
+
+  public:
+    Condition();
+    ~Condition();
+    void wait(Mutex& m);                                         /* The mutex must be locked; it's unlocked while we wait and locked again when we return. */
+    void signal();                                               /* Wakes up the thread that waits. */
+    void broadcast();                                            /* Wakes up all the threads that wait. */
+
+  public:
+#if defined(_WIN32)
+    CONDITION_VARIABLE handle;
+#else
+    pthread_cond_t handle;
+#endif
+  };
+
+  /* -------------------------------------------------------------------------------------------------------------- */
+
+  class Thread {
+
+  public:
+    Thread();
+    ~Thread();
+    bool create(gui_thread_function func, void* user);           /* Starts a new thread which calls func(user). Returns false when the thread couldn't be created. */
+    void join();                                                 /* Waits until the thread returned; does nothing when it isn't running. */
+    bool isRunning();
+
+  public:
+    gui_thread_function func;
+    void* user;
+    bool is_running;
+#if defined(_WIN32)
+    HANDLE handle;
+#else
+    pthread_t handle;
+#endif
+  };
+
+  /* -------------------------------------------------------------------------------------------------------------- */
+
+  inline bool Thread::isRunning() {
+    return is_running;
+  }
+
+  /* -------------------------------------------------------------------------------------------------------------- */
+
+#if defined(_WIN32)
+
+  /* On x86/x64 MSVC, volatile reads and writes have acquire and release semantics. */
+  inline int gui_atomic_add(volatile int* value, int n) {
+    return (int)InterlockedExchangeAdd((volatile LONG*)value, (LONG)n) + n;
+  }
+
+  inline int gui_atomic_load(volatile int* value) {
+    return *value;
+  }
+
+  inline void gui_atomic_store(volatile int* value, int v) {
+    *value = v;
+  }
+
+  template<class T> inline T* gui_atomic_exchange_ptr(T* volatile* ptr, T* v) {
+    return (T*)InterlockedExchangePointer((PVOID volatile*)ptr, (PVOID)v);
+  }
+
+  template<class T> inline T* gui_atomic_load_ptr(T* volatile* ptr) {
+    return *ptr;
+  }
+
+  template<class T> inline void gui_atomic_store_ptr(T* volatile* ptr, T* v) {
+    *ptr = v;
+  }
+
+#else
+
+  inline int gui_atomic_add(volatile int* value, int n) {
+    return __atomic_add_fetch(value, n, __ATOMIC_SEQ_CST);
+  }
+
+  inline int gui_atomic_load(volatile int* value) {
+    return __atomic_load_n(value, __ATOMIC_ACQUIRE);
+  }
+
+  inline void gui_atomic_store(volatile int* value, int v) {
+    __atomic_store_n(value, v, __ATOMIC_RELEASE);
+  }
+
+  template<class T> inline T* gui_atomic_exchange_ptr(T* volatile* ptr, T* v) {
+    return __atomic_exchange_n(ptr, v, __ATOMIC_SEQ_CST);
+  }
+
+  template<class T> inline T* gui_atomic_load_ptr(T* volatile* ptr) {
+    return __atomic_load_n(ptr, __ATOMIC_ACQUIRE);
+  }
+
+  template<class T> inline void gui_atomic_store_ptr(T* volatile* ptr, T* v) {
+    __atomic_store_n(ptr, v, __ATOMIC_RELEASE);
+  }
+
+#endif
+
+} /* namespace rx */
+
+#endif
@@ -53,6 +53,8 @@
 #define GUI_STATE_DOWN_CUSTOM3               0x0080     /* Use this if you have more than four hit areas */
 #define GUI_STATE_POSITION_LOCKED            0x0100     /* We can lock and unlock the position of a widget. When locked it means we cannot change the position of if. */
 #define GUI_STATE_NOTIFICATIONS_DISABLED     0x0200     /* We can disable notification, which is necessary when we want to set the value of widgets when we receive them over the network */
+#define GUI_STATE_CULLED                     0x0400     /* The widget is outside the visible area of a Panel with virtual scrolling. It keeps the height of its last layout but is not positioned, drawn or used for interaction. */
+#define GUI_STATE_CAPTURE                    0x00F9     /* Combination of EDITABLE and the DOWN_* states. A widget with one of these states receives all mouse events, also when the mouse is outside of it. See HitIndex. */
 
 #define GUI_EVENT_VALUE_CHANGED              0x0001     /* Listeners of widgets will be notified whenever a value changes with this event type */
 
@@ -3,6 +3,8 @@
 
 #include <string>
 
+#define GUI_NUMBER_BUFFER_SIZE 32                                 /* the size of the buffers we format numbers into, see gui_format_number() */
+
 namespace rx { 
 
 /* just a one liner to set the colors in rgba, must be float 4 */
@@ -16,6 +18,35 @@ int gui_string_to_int(std::string str);
 float gui_string_to_float(std::string str);
 bool gui_string_to_bool(std::string str);
 
+/* 
+   writes the number into `buf` (zero terminated) without allocating and 
+   without using the locale; returns the number of characters written. 
+   floats are written with `precision` decimals; with a negative precision 
+   we use up to 6 decimals and strip the trailing zeros. integers ignore
+   `precision`; it's only there so all overloads can be called the same way.
+   every integer type has an overload (they widen to (unsigned) long long) 
+   so Render::writeNumber<T>() works for e.g. Slider<unsigned int>.
+*/
+int gui_format_number(int value, int precision, char* buf, int nbytes);
+int gui_format_number(unsigned int value, int precision, char* buf, int nbytes);
+int gui_format_number(long value, int precision, char* buf, int nbytes);
+int gui_format_number(unsigned long value, int precision, char* buf, int nbytes);
+int gui_format_number(long long value, int precision, char* buf, int nbytes);
+int gui_format_number(unsigned long long value, int precision, char* buf, int nbytes);
+int gui_format_number(float value, int precision, char* buf, int nbytes);
+int gui_format_number(double value, int precision, char* buf, int nbytes);
+
+/* parses a number as written by gui_format_number() (or typed by the user); sets result to 0 when the string doesn't start with a number. unsigned types get 0 for negative numbers */
+void gui_parse_number(const char* str, int& result);
+void gui_parse_number(const char* str, unsigned int& result);
+void gui_parse_number(const char* str, long& result);
+void gui_parse_number(const char* str, unsigned long& result);
+void gui_parse_number(const char* str, long long& result);
+void gui_parse_number(const char* str, unsigned long long& result);
+void gui_parse_number(const char* str, float& result);
+void gui_parse_number(const char* str, double& result);
+template<class T> void gui_parse_number(const char* str, T& result);   /* the smaller integer types, e.g. short, char and bool */
+
 /* color conversion */
 void gui_hsv_to_rgb(float h, float s, float v, float& r, float& g, float& b);
 
@@ -29,6 +60,18 @@ T gui_clamp(const T& value, const T& low, const T& high) {
   return value < low ? low : (value > high ? high : value);
 }
 
+template<class T>
+void gui_parse_number(const char* str, T& result) {
+  long long v = 0;
+  gui_parse_number(str, v);
+  result = T(v);
+}
+
+/* returns true when the vertical range top..top+height doesn't overlap miny..maxy */
+inline bool gui_is_outside_range(int top, int height, int miny, int maxy) {
+  return (top + height) < miny || top > maxy;
+}
+
 } // namespace rx 
 
 #endif
@@ -16,7 +16,19 @@
   are not added to the children vector, you need to make sure that
   you override `unsetNeedsRedraw()` and set the `needs_redraw` to 
   false for all children. See the Slider widget for an example of
-  where we do exactly that.
+  where we do exactly that. Also set the `parent` of these sub 
+  widgets so they can tell the panel when they need to be redrawn.
+
+  - Use setNeedsRedraw() when a widget changed. It sets `needs_redraw`
+  and `needs_redraw_children` of all its parents, so the Panel or
+  Group only has to check its own flags each frame instead of walking
+  the whole tree.
+
+  - Use setNeedsLayout() when the size of a widget changed, or when it
+  was hidden, shown, opened or closed. Only these widgets are positioned
+  again by their Group; the widgets after them are moved, the others
+  keep their layout. Changing a value (e.g. a slider) doesn't need
+  this; the widget is redrawn in place.
 
 */
 
@@ -69,6 +81,8 @@ namespace rx {
     virtual void closeChildren();                                    /* call close() on all children */
     virtual bool isDrawn();                                          /* checks if the state is CLOSED or HIDDEN. if so, we will not use this widget */
 
+    void setNeedsRedraw();                                           /* sets `needs_redraw` and tells all parents that one of their children needs to be redrawn. */
+    void setNeedsLayout();                                           /* sets `needs_layout` of this widget and all its parents; call this when the size or visibility changed. */
     virtual void unsetNeedsRedraw();                                 /* after calling create we will call this on all the elements. the goal of this function is to set "needs_redraw = false". This should also be done for all other elements which are not added as children but are part of the widget */
     virtual void unsetNeedsRedrawChildren();                         /* calls unsetNeedsRedraw() on all children */
 
@@ -81,6 +95,7 @@ namespace rx {
     virtual void onMouseRelease(float mx, float my, int button, int modkeys);                 /* gets called when the mouse is released */
     virtual void onMouseReleaseOutside(float mx, float my, int button, int modkeys);          /* gets called when the mouse is released outside the "container" that wraps around this widget. we needs this function so you can disable e.g. the number input when the user pressed outside the "clickable" area of the container. w/o this the Panel + scroll bar won't have a way to prevent mouse releases outside the visible area. See the slider widget. This function should only be used to disable a certain state (e.g. disable editing state) */
     virtual void onMouseMove(float mx, float my);                                             /* gets called when the mouse is moved */
+    virtual bool hasCapture();                                                                /* returns true when this widget (or one of its children) needs all mouse events, e.g. while dragging. see GUI_STATE_CAPTURE */
 
     /* forward interaction to children */
     virtual void onCharPressChildren(unsigned int key);
@@ -90,13 +105,16 @@ namespace rx {
     virtual void onMouseReleaseOutsideChildren(float mx, float my, int button, int modkeys);   /* calls onReleaseOutside() on all chilren */
     virtual void onMousePressChildren(float mx, float my, int button, int modkeys);            /* calls onPress() on all children */
     virtual void onMousePressOutsideChildren(float mx, float my, int button, int modkeys);     /* calls onPressOutSide() on all children */
-    virtual void onMouseMoveChildren(float mx, float my);                                      /* calls onMove() on all children */
+    virtual void onMouseMoveChildren(float mx, float my);                                      /* calls onMove() on all children; Group and Panel only call the children under the mouse, see HitIndex */
   
     /* functions operating on all children */
     virtual void removeChildren();                                   /* cleans up the children vector. deletes them all */
-    virtual bool needsRedraw();                                      /* checks if the widget needs to be recreated/redrawn, checks itself and iterates over all children and returns true as soon as one needs to be redrawn. */
-    virtual bool needsRedrawChildren();                              /* checks if the children need to be redrawn */
+    virtual bool needsRedraw();                                      /* checks if the widget or one of its children needs to be recreated/redrawn. */
+    virtual bool needsRedrawChildren();                              /* checks if the children need to be redrawn; this is set by setNeedsRedraw() so we don't have to iterate over the children. */
     virtual void buildChildren();                                    /* call create() on this element and scalls all create() functions of the child elements of the widget */
+    virtual bool rebuild();                                          /* rewrite the shapes of this widget and/or its dirty children in place, without a full clear() + position() + build(). returns false when this is not possible (e.g. the layout changed) and the caller must do a full rebuild */
+    virtual bool rebuildChildren();                                  /* calls rebuild() on all children that need to be redrawn; returns false as soon as one of them fails */
+    bool patch();                                                    /* calls create() and asks the renderer to replace the vertices that were created for this widget during the last build(); returns false when the renderer couldn't do this */
     void setBoundingBoxChildren();                                   /* calculate bounding boxes for all children */
 
     /* events and listeners */
@@ -108,9 +126,11 @@ namespace rx {
 
   public:
     Group* group;                                                    /* the group in which this widget is contained */
+    Widget* parent;                                                  /* the widget that contains this widget; the Panel for a Group in a Panel, NULL for the top most widget. */
     Render* render;                                                  /* the renderer which takes care of the drawing */
     static uint32_t generated_ids;                                   /* each widget is assigned an auto incremented unique ID. this can be used when doing networked guis */
     uint32_t id;                                                     /* the unique ID assigned to this widget */
+    uint32_t span_id;                                                /* the key of the vertices of this widget in the renderer (see Render::beginSpan()); unlike `id` this is never changed, e.g. by the Deserializer of a remote gui */
     int type;                                                        /* the widget type, see Types.h */
     int state;                                                       /* the current state of the widget, see Types.h for available states */
     int mods;                                                        /* the mods that were pressed on mouse down, will be unsed in onRelease(). This can be used to have a different kind of interaction when someone e.g. drags with SHIFT down. */
@@ -121,7 +141,9 @@ namespace rx {
     int h;                                                           /* the height of the visual elements of this widget */
     int bbox[4];                                                     /* bounding box of the visual elements that this widget contains. must be set in setBoundingBox(), 0 = top left x, 1 = top left y, 2 = width, 3 = height */
     int margin[4];                                                   /* >> @todo UPDATE THIS COMMENT WHEN WE IMPLEMENT ALL MARGINS <<<< | margin `outside` of the element, at this  moment only margin bottom is used. We follow CSS order (top,right,bottom,left) */
-    bool needs_redraw;                                               /* this flag is used in needsRedraw() by default (if you didn't override this function). when you set needs_redraw to true your create() function will be called during the next render */
+    bool needs_redraw;                                               /* this flag is used in needsRedraw() by default (if you didn't override this function). when it's set, your create() function will be called during the next render. use setNeedsRedraw() to set it. */
+    bool needs_redraw_children;                                      /* set by setNeedsRedraw() of one of the (grand) children; cleared when the children are built or rebuilt. */
+    bool needs_layout;                                               /* when true the parent calls position() and setBoundingBox() again; when false and the widget didn't move, the parent keeps its layout. use setNeedsLayout() to set it. */
     std::string label;                                               /* the label for this element */
     std::vector<Widget*> children;
     std::vector<WidgetListener*> listeners;
@@ -141,6 +163,37 @@ namespace rx {
     return !(state & GUI_STATE_UNUSED);
   }
 
+  inline bool Widget::needsRedraw() {
+    return needs_redraw || needs_redraw_children;
+  }
+
+  inline bool Widget::needsRedrawChildren() {
+    return needs_redraw_children;
+  }
+
+  inline void Widget::setNeedsRedraw() {
+
+    needs_redraw = true;
+
+    /* the tree is only a couple of levels deep, so we don't stop at parents that were already marked. */
+    for (Widget* p = parent; NULL != p; p = p->parent) {
+      p->needs_redraw_children = true;
+    }
+  }
+
+  inline void Widget::setNeedsLayout() {
+
+    needs_layout = true;
+
+    for (Widget* p = parent; NULL != p; p = p->parent) {
+      p->needs_layout = true;
+    }
+  }
+
+  inline bool Widget::hasCapture() {
+    return (state & GUI_STATE_CAPTURE) != 0;
+  }
+
   inline Widget& Widget::setPosition(float px, float py) {
     x = px;
     y = py;
@@ -155,16 +208,19 @@ namespace rx {
 
   inline Widget& Widget::setWidth(float pw) {
     w = pw;
+    setNeedsLayout();
     return *this;
   }
 
   inline Widget& Widget::setHeight(float ph) {
     h = ph;
+    setNeedsLayout();
     return *this;
   }
 
   inline Widget& Widget::setMarginBottom(int mb) {
     margin[3] = mb;
+    setNeedsLayout();
     return *this;
   }
 
@@ -3,7 +3,400 @@
 
 namespace rx {
 
-static uint64_t dejavu_pixel_data[] = {0x0,0x2ff7530000,0x0,0x0,0x0,0x0,0x0,0x0,0xa347bb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffffff1f000000,0x0,0x0,0x0,0x0,0x0,0x1be7ef4300,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1b000000,0x0,0x0,0x0,0xaf2bbb030000,0x0,0x300000000000000,0x170013,0x0,0x5f0b,0xbb03ff1f00000000,0xaf2b,0x0,0xff1f00000000,0x0,0x0,0x0,0x0,0x0,0x5f0b,0x0,0x0,0x0,0x0,0x0,0x0,0x1f1f1f03000000,0x0,0x0,0x0,0x0,0x1f13000000000000,0x9bb317,0x0,0x0,0x0,0x0,0x71f170000,0x0,0x0,0x0,0x6fd70b00000000,0x0,0x0,0x0,0x0,0x8fbf0300000000,0x6bd3ffffff1f,0xe7ffffffffffff1f,0x6bd3ffffff1f00,0xffffffffffff1f00,0x6bd3ffffff1f00e7,0x2ff753000000,0x6bd3ffffff1f,0x0,0xe3fff3c757000000,0x73,0xff1f,0x5300ff1f00000000,0x5f00000000002ff7,0xb7bd3fff7c3,0xff1f00000000,0x0,0x0,0x3fff0000001fff,0xc353000000000000,0xfffffffffffff3,0xff1f,0x0,0x0,0xffffffffffffcf00,0xff3f0000ff1f00,0x1f00000000df5f00,0xffffff,0xffffffffffcf0000,0xff,0xffff1f0000000000,0xbb83000000,0xffffffffcf000000,0xdffbbf1f0000ffff,0xff1f00000063fff3,0xbb830000c7ff,0x0,0xffff1f00000000,0xbb830000,0x93f7ffffe7f3c723,0x6ff3eb6700000000,0x7700000000000000,0x5fdfffe7,0x6fbf03000000,0xf707000000000000,0x13ef170000bb631b,0x7b0017ef17000000,0x3db5f005feff7,0x8fa300000000,0x6bf363231fff1f,0x3bef371f1f1f1f03,0x6bf363231fff1f00,0xef371f1f1f1f0300,0xf363231fff1f003b,0x1b0000006b,0x6bf363231fff1f,0x3300000000000000,0xfffffffff3afffd7,0x1717000000006fff,0x131f00ff1f,0xff1f00000000,0xebab03000000001b,0x13d7cf5b232b73,0xff1f00000000,0x1717000000000000,0x131f000000,0x3fff0000001fff,0x73f3630000000000,0x1f1f1f1fff3b2b,0x131b00ff1f,0x0,0x0,0x1f1f1f1fff3fe73b,0xff3f0000ff1f00,0x300000000df5f00,0x1f1f1f,0x1f1f1fff3fe73b00,0x1f,0xff3b030000000000,0x27f7270000,0x1f1fff3fe73b0000,0xfabd303001f1f,0x3b030000004b5b03,0x27f72700a7ff,0x0,0xff3b0300000000,0x300000027f72700,0xfb2bff630007abd7,0xbf3367fb0f000033,0xe777000000000000,0xf74f63f3631f57,0x1b07000000,0xcb3f000000000000,0x77a30000006bb300,0xff00009b7b000000,0x5fdb03f36b4f,0x1f03000000,0xd367000000ff1f,0x5bcf0b00000000,0xd367000000ff1f00,0x5bcf0b0000000000,0x67000000ff1f0000,0xffffffffff1fd3,0x1fd367000000ff1f,0xd70000ffffffffff,0xffffffff7353ffff,0xd7f393000000e3ff,0x6ff3d3bfffbf,0xffffffa3f7e33b00,0x1be36b0000ffffff,0x9bb70300000000,0xffffffa3f7e33b00,0xd7f3930000ffffff,0x6ff3d3bfffbf,0x3fff0000001fff,0x5be300003fff00,0xff1f00,0x370077f7dfbbff1f,0xebf797ff1f00003b,0x4febf79757,0xff1f7bab,0xff3f0000ff1f00,0xffff1f0000df5f00,0x3bd7ffc763e3,0xff1f7bab00,0x63e3ffff1f000000,0xff1f00003bd7ffc7,0x87c30000,0xff1f7bab0000,0xff74b000000,0x300000000000000,0x87c300f75b,0xcb57cbffd73b0000,0xff1f00003bdbff,0x4b0000000087c300,0xdf00ff1f00000ff7,0x3001bff1f00005f,0x57eb000000000000,0xdfd3d373000000,0xffc763e3ffff1f00,0xffffff7f00003bd7,0xdf330000ffffffff,0xff00002be7030000,0x3d763f74f2f,0xffffd7330000,0xff27000000ff1f,0x83b703000000,0xff27000000ff1f00,0x83b70300000000,0x27000000ff1f0000,0xaf8f1f1f1f03ff,0x3ff27000000ff1f,0xff1700af8f1f1f1f,0xffffffff2b1fffff,0x17ef430013ffff,0x1ffb330067ff87,0x1f1fffaf2397d700,0x57e30000af8f1f,0xf33300ffbbfb87,0x1f1fffaf2397d700,0x17ef4300af8f1f,0x1ffb330067ff87,0x3fffbfbfbfc7ff,0xbff1b003fff00,0xffffffffff1f00,0x1b00f34b005fff1f,0x832397ff1f007bdb,0x1b0000df832397ff,0xffffffffff1f17f3,0xff3f0000ff1f00,0x1f1f030000df5f00,0xd37f1f7bff73,0xffffffff1f17f31b,0xff731f1f030000ff,0xffff1f00d37f1f7b,0xbe35fff,0xffffff1f17f31b00,0x170000cb7b00ffff,0xff1f000000273f3f,0xbe35fb7ff,0x7bffaf2397db0000,0xffffff1f00d77f1f,0x7b000000000be35f,0xdf00ff1f000000cb,0x13c3fb1300005f,0xbff1b0000000000,0xb0bfb2b000000,0x1f7bff731f1f0300,0x5fcb1f0f0000d37f,0xc70000001f1fdf3f,0x9b000000b75b004b,0x4fe783ffff,0x1f239bd70000,0xff23000000ff1f,0xa797000000,0xff23000000ff1f00,0xa79700000000,0x23000000ff1f0000,0xbc36f000000ff,0xff23000000ff1f,0xff1b000bc36f0000,0xffffffff2723ffff,0xab7b0017ffff,0x57d3000007ff2b,0xff2f000fff17,0x130bff17000bc36f,0xf72f00ff6b4fff,0xff2f000fff17,0xab7b000bc36f,0x57d3000007ff2b,0x3fff3f3f3f57ff,0x7ff1f003fff00,0x1f1f1f1fff1f00,0xff1f0003ff1f,0x1f0007ff1f00eb47,0x870000ff1f0007ff,0x1f1f1f1fff1f009b,0xff3f0000ff1f00,0xffdf670000df5f00,0xffffffffffff,0x1f1f1fff1f009b87,0xffffffdf6700001f,0x1f1f0300ffffffff,0xff63004feb33,0x1f1fff1f009b8700,0x530000c77f001f1f,0x1f030000009ff3df,0xff63004feb131b,0xffff2f000fff1700,0x331f1f0300ffffff,0x7f00b3ffff1f4feb,0xdf00ff1f000000c7,0x3be37b73b700005f,0x7ff1f0000eb5300,0xff27000000,0xffffffffffdf6700,0x17f707000000ffff,0x5700000000009f5f,0x47cb00b3,0x5ff3f77bcf6f1317,0xfff1700,0xdb5b000000ff1f,0xbc7730000,0xdb5b000000ff1f00,0xbc773000000,0x5b000000ff1f0000,0x13d76f0000db,0xdb5b000000ff1f,0xe300000013d76f00,0xffffffff6763ffff,0xa77f0000ebff,0x5bcf000003ff27,0x6f00ff2b000bff1b,0x1707ff1f000013d7,0xa7c327ff4f2fff,0x6f00ff2b000bff1b,0xa77f000013d7,0x5bcf000003ff27,0x3fff0000001fff,0x4beb00003fff00,0xff1f00,0xff1f0000ff1f,0x1f0000ff1f00ff23,0xeb0700ff1f0000ff,0xffffffff,0xff430000ff1f00,0x1f67fb0f00df5f00,0x7001f1f1f33ff47,0xffffffffeb,0xff471f67fb0f0000,0x1f1f1f33,0xffe74f00b79b,0xffffffffeb07,0x7f353000000,0x9f9f00,0xffe74f00b79b00,0x33ff2b000bff1f00,0x9b000000001f1f1f,0x5300eb631f0300b7,0xdf00ff1f000007f3,0xf75b0013ff1b005f,0x47f30000007bdf7f,0xd367000000,0x1f33ff471f67fb0f,0xffffffff1f001f1f,0x30000005fffffff,0xd357e3,0xf36b4fff57eb0f00,0xbff1b00,0x7fe7430300ff1f,0x17e35300,0x7fe7430300ff1f00,0x17e3530000,0xe7430300ff1f0000,0x1be76f007f,0x7fe7430300ff1f,0x47000000001be76f,0xffffffffdbcfffef,0xbe74b000083ff,0x27fb230053ff73,0xe76fff97037be300,0x47ef000000001b,0xb8befffd7ffa7,0xe76fff97037be300,0xbe74b0000001b,0x27fb230053ff73,0x5bf30000001fff,0x53e77b00002bff1f,0xff1f0b,0x17ff0b0000ff1f,0x1f0000ff1f00bb83,0xcf6300ff1f0000ff,0xff3b1f1f,0x17ff930023ff1700,0xb37ff1700dfab00,0x630000000b9bffaf,0xff3b1f1fcf,0xffaf0b37ff170000,0x3b00000000000b9b,0xfffffff31323f7,0xff3b1f1fcf63,0x393e307000000,0x9fa300,0xfffffff31323f73b,0x9bff97037be70000,0xf73b00000000000b,0x70077e35f000023,0xdf00ff4b000093e3,0xb31b0b93ef0b005f,0xd78700000000abff,0x6be7430037,0xb9bffaf0b37ff17,0x1fa3931f03000000,0xb1f4feb,0x63f77b,0xf74f2fff17bf7f00,0x37fe30000,0x38bf3ffffff1f,0xfffffffffffff313,0x38bf3ffffff1f00,0xfffffffffff31300,0x8bf3ffffff1f00ff,0xffffffffff1b03,0x1b038bf3ffffff1f,0xffffffffff,0xf7fffbab1f031f07,0xb7dfb30300000393,0x8be7b3cfffd3,0xffffffbffff74f00,0xfcb8b0000ffffff,0x71b031b00,0xffffffbffff74f00,0xb7dfb30300ffffff,0x8be7b3cfffd3,0xbff7870000001fff,0xe37300000000bfe7,0xffffffffffffff,0xe7eba7000000ff1f,0x1f0000ff1f001fdb,0x4fcf00ff1f0000ff,0xffffffffff1f0000,0xdfcf9fcfe3b70000,0xffff9b0000dfd3cf,0xcf00ffffffeb73d3,0xffffffff1f00004f,0x73d3ffff9b0000ff,0xd7030000ffffffeb,0x1fff3b1f030083,0xffffff1f00004fcf,0xbfe7db270000ffff,0x3000000005befcf,0x1fff3b1f030083d7,0xe373e7ffef4f0000,0x83d7030000ffffff,0xffffff1f0000,0xdf009bfbc7dbdf3b,0xcbffffd73b00005f,0x9703000013a7c33f,0x7ff7fffb,0xffeb73d3ffff9b00,0x3b43bf000000ffff,0xe3,0x7df17,0x7bffff9b003fef0f,0xffffef470000,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1717000000000000,0x131f000000,0x0,0xdfbf030000000000,0xbb932f2767,0x0,0x1717000000000000,0x131f00ff1f,0x1f0f000000000000,0x13,0x0,0x0,0x0,0x0,0x0,0x1f0000131b000000,0xf,0x0,0x0,0x0,0x0,0x0,0x0,0x1f0f000000000000,0x13,0x0,0x0,0x0,0x0,0x71f170000,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6b03000000000000,0x4bbff7ffd3,0x0,0x0,0xff1f,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3f07,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xa7fb8300000000,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xa347bb00000000,0x0,0x0,0x0,0x0,0x0,0x0,0x47bb000000000000,0xa3,0x3b00000000000000,0xbcf,0x93870000,0x0,0xb3fb57ff17,0xff1fff1f0000,0xd323bf0000000000,0x1f,0xbb00000000000000,0x1f00000000009bff,0xffffff,0x0,0x0,0xff1f000000,0x2fa3834f00000000,0x0,0xffbb000000000000,0x9b,0x0,0x0,0x0,0x0,0x0,0x4ffb171f1300,0x0,0x0,0x0,0x0,0xf0000000000,0x0,0x23f73f0000000000,0x0,0x0,0x0,0x0,0x171f130000000000,0x0,0xf000000,0xf0b000000,0x17001303000000,0x170b0000,0x0,0x0,0x0,0x5f0b00000000,0x0,0x13030000000000,0x3f00000000000017,0x23f7,0x233b,0x35b0300,0x0,0x313001f03,0x1f031f030000,0x1703170300000000,0x0,0x300000000000000,0x30000000000001f,0x1f1f1f,0x0,0x0,0x1f03000000,0xf07031300000000,0x0,0x1f03000000000000,0x0,0x0,0x370000d7070017e7,0x1f00009fff1f00df,0x4bcb0300ff1fff,0x17000003c34f0000,0x1ffff7dff7bf,0xd3fffffffffb9f00,0xfffffffb9f00004b,0x6bd3,0x0,0x3cb63dbffe377,0x23b3f7fbbf330000,0xa347bb0000000000,0xff1f00000000,0xff1f00,0x0,0xff1f000000ff1f00,0xf3dffbbf1f000000,0xe3770000000033d7,0x6bb30003cb63dbff,0x397f7d7070000,0x370000d7070017e7,0xffffffffff1f00df,0x9fff1f0000bfff,0xff1fff1f00,0x23b3f7fbbf33,0xff1f00000000,0x0,0xf783000000000000,0xbb0000000000000f,0x770000000000a347,0x5fdfffe7,0x5fdfffe777,0x0,0x5fdfffe7770000,0x4bcffffbcb570000,0xdfffe77700000000,0x5f,0xe777000000000000,0x77000000005fdfff,0xff1f00005fdfffe7,0x1f00008fe72b0000,0xff,0x53cbfbfbcb530000,0xcbfbfbcb53000000,0xfbfbcb5300000053,0xfbcb5300000053cb,0xff1f0053cbfb,0xff1f0000,0x770023ff3f0057a7,0x1f002bf3ff1f009f,0x13df270000ff1fff,0xd30300001bdb1b00,0x1b830b000fab,0x83271f1fff33eb1b,0x231fff33eb1b00f3,0x1b000000006bf363,0x7700000000000013,0x73ff731f57e7,0xf39b2f2b87fb3f00,0x1700130300000027,0xff1f00000000,0xf74fff1f00,0x0,0xffffffffffffff1f,0x3000fabd30300ff,0x57e7770000004b5b,0xe71b000073ff731f,0x4707af8b0027,0x770023ff3f0057a7,0xdf43b76300009f,0x2bf3ff1f00000000,0x3f00001f03ff1f00,0x27f39b2f2b87fb,0xff1f17170000,0x0,0xe7df000000000000,0x1303000000000063,0xe777000000001700,0x77000053f3631f57,0x53f3631f57e7,0xff1f0000,0x53fff3571f636b00,0xfbf3631f57e75b00,0x631f57e777000037,0x53f3,0x57e777000000070b,0xe777000053f3631f,0xff1f0053f3631f57,0x1f0000006ff33b00,0xff,0xd75f272767f35f00,0x5f272767f35f0000,0x272767f35f0000d7,0x2767f35f0000d75f,0xff1f00d75f27,0xff1f0000,0xaf0067f77f00976b,0x1f00b387ff1f005f,0xab67000000ff1fff,0xf74b00000047bf03,0xf,0x67070000ff1f470b,0xff1f470b00eb,0xdfbbff1f00d36700,0xeb000000000073f7,0xc3c3b7030057,0x9bffffe36383d700,0x13f72b00b36700b7,0xff1f002bf300,0xb36700dfd3ff1f00,0x2bf30013f72b00,0xff3b1f1f1fff5703,0xff74b003b,0x57eb0000000000,0x5f000000c3c3b703,0x13e73bcb,0xaf0067f77f00976b,0xdfcf830000005f,0xb387ff1f00000000,0xd70000ff1fff1f00,0xb79b87f3ffffa3,0xffbfd3f39700,0x0,0x43fb3b0000000000,0xcf4f000000c3,0x57eb000023f31700,0xeb0000cb73000000,0xcb7300000057,0xff1f0000,0xcbff630000004f00,0xff7300000057cf00,0x57eb0000a3,0x2b00008b9300cb73,0x57eb000057ebef,0x57eb0000cb730000,0xff1f00cb73000000,0x3000000006fef4b,0x53ebf797ff1f1f,0x70000000057e300,0x57e30000,0x57e3000007,0x57e300000700,0xff1f00070000,0xff1f0000,0xef00b397bf00d72f,0x1f3feb0fff1f001f,0xffff1f0000ff1fff,0xcb7b000000ffffbf,0x0,0xffffffffff1f0000,0xff1f00000053,0x5fff1f00ff2700,0xff1b00000000f34b,0xf72b8fa7000b,0x2f1f1f6bfb23ff17,0x6bff8b00eb2700f7,0xff1f0000f71f,0xeb27000b0bff1f00,0xf71f6bff8b00,0xffffffffffff3f00,0x3f170000cb7b001f,0xbff1b0000273f,0xf72b8fa7,0x53f7b3,0xef00b397bf00d72f,0xdfa3000000001f,0xeb0fff1f00000000,0xff1700ff1fff1f3f,0xf72fff5f1fff33,0xff870017ef43,0xffffffffff1f0000,0xaf8f000000ffff,0x4fcf0000001fd3,0xbff1b00009f8b00,0xff1b00fb2b000000,0xfb2b0000000b,0xff1f0000,0xfbff17000000231b,0xff2b0000000bff00,0xbff1b00d7,0x970007eb2b00fb2b,0xbff1b00332393,0xbff1b00fb2b0000,0xff1f00fb2b000000,0x67fb,0xe3872393ff1f00,0xbff1b,0xbff1b00,0xbff1b0000,0xbff1b000000,0xff1f00000000,0xff1f0000,0xdf2ff31beb1fef00,0x1fcf6b00ff1f0000,0x5f1f030000ff1fff,0xc77f0000001f37ff,0x0,0x9b271f1fff1f0000,0xff1f000000c3,0x3ff1f00ff2300,0xff1b00000000ff1f,0xff2700a38f03,0x2b00004bff1fff1b,0xcbabeb23ef0000fb,0xff1f0000cb4f,0xef00000000ff1f00,0xcb4fcbabeb23,0xff3b1f1f1fff3f00,0xdf530000c77f001f,0x8f03ff1b00009ff3,0xff2700a3,0xe343,0xdf2ff31beb1fef00,0x2ff73f0000000000,0x6b00ff1f00000000,0xff1b00ff1fff1fcf,0xfb2b83ffffff2b,0xff2b0000ab7b,0x1f1f1f1f1f030000,0x53eb0300001f1f,0xcf5f0000007f73,0x7ff1f000023eb0f,0xff1f00ff27000000,0x1f00ff2700000007,0xffffffffffffff,0xffff130000001f1f,0xff2700000007ff00,0x7ff1f00db,0xf30b5bc70000ff27,0x7ff1f00000027,0x7ff1f00ff270000,0xff1f00ff27000000,0x17d7ab,0xff1f0007ff1f00,0xffffff1f0007ff1f,0xffff1f0007ff1f00,0xff1f0007ff1f00ff,0x1f0007ff1f00ffff,0xff1f00ffffff,0xff1f0000,0x9fa7cb00ab97b300,0x7bd70300ff1f0000,0xffff1f0000ff1fff,0xf353000000ffffff,0x7,0x23000000ff1f0000,0xff1f000000ff,0xff1f00db5b00,0xeb0000379f5fff1f,0xd3670003b3a7,0x87fffff77f6fe300,0xf30bdba3af0000c3,0xfff17000093a7,0xaf00000000f72f00,0x93a7f30bdba3,0xff1f000000ff3f00,0x8b000007f353001f,0xb3a7eb000027dbdb,0xd3670003,0xdf3f,0x9fa7cb00ab97b300,0xcfef3f0000000000,0x300ff1f0000001b,0xe30000ff1fff7bd7,0xc3879f8723ff8f,0x9f5fff270000a77f,0xffffffffff1f0033,0xffffff430000ffff,0x4fdf03000000dbff,0x47f3000000009f73,0xf30000d367000000,0x300d36700000047,0x1f1f1fff3b1f1f,0xd3ff530000004f00,0xff6700000047db00,0x47f30000ab,0xbf67c7570000d367,0x47f30000000000,0x47f30000d3670000,0xff1f00d367000000,0x1fd7ab03,0xff1f0000ff1f00,0xff3b1f030047ef00,0x3b1f030047ef0000,0x1f030047ef0000ff,0x30047ef0000ff3b,0xff1f00ff3b1f,0xff1f0000,0x5ffb870067f77700,0xef4b0000ff1f0000,0x3b1f030000ff1fff,0xe3070000001f1fff,0x176300000393,0x83070000ff1f0000,0x300ff1f000000e3,0xff1f007fe743,0x9300009fabefff1f,0x6be7430043fb,0xfb9f2f176ffb5300,0x930073ff77000037,0xb97d700000067ff,0x7700000000b7af13,0x67ff930073ff,0xff1f000000ff3f00,0x393e307001f,0x43fb930000009fa3,0x6be74300,0xdf3f,0x5ffb870067f77700,0x3bdf3f0000000000,0xff1f00000bc7,0x530000ff1fffef4b,0x37fb9b0f0b8fff,0xb3efff73000be74b,0x1f1f1f1f1f03009f,0x1f1f879f00001f1f,0xcf6f0000003bf323,0xd7870000000023e3,0x8700006be7430037,0x6be7430037d7,0xff1f0000,0x6bffe73700436f00,0xffe7430037d76f00,0x430037d787000047,0x57dfeb0700006be7,0x37d7870000000000,0xd78700006be74300,0xff1f006be7430037,0x27e78f0300,0xff1f0000ff1f00,0xff47030747e77b00,0x47030747e77b0000,0x30747e77b0000ff,0x747e77b0000ff47,0xff1f00ff4703,0xff1f0000,0x1fff3f001fff3700,0xbf000000ff1f0000,0x1f00000000ff23ff,0x27000000000000ff,0xfcfe3bfe3db,0xebffffffff1f0000,0xffffff1f0000004b,0xff1f00038bf3,0xc30f006bebe3f303,0x7ff3fff787,0x3bd3ffffdf4f0000,0x2b0013f737000000,0xffdf3b00000033ff,0x370000000027cfff,0x33ff2b0013f7,0xff1f000000ff3f00,0xcfbfe7db2700001f,0xf787c30f00005bef,0x7ff3ff,0xdf3f,0x1fff3f001fff3700,0xdf3f0000000000,0xff1f0003b743,0xff1fffbf00,0x3bd3ffffdf4f,0xefdbfbc7b7dfaf00,0x5f,0x23f307000000,0xeb0700000097a300,0x970300000000009f,0x30000007ff7fffb,0x7ff7fffb97,0xff1f0000,0x7ff7fffb970300,0x67ebffffeb770000,0xf7fffb9703000000,0x3e78b000000007f,0xfb97030000000000,0x97030000007ff7ff,0xff1f00007ff7fffb,0x27e78f000000,0xff1f0000ff1f00,0x6fe3ffffeb7b0000,0xe3ffffeb7b000000,0xffffeb7b0000006f,0xffeb7b0000006fe3,0xffffff1f006fe3ff,0xff1f00ff23ffff,0x0,0x300000000000000,0xd39323,0x0,0xf1f1300,0x0,0x0,0x0,0x170300001323b727,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x131f0f0000000000,0x170300000000,0x0,0x0,0x0,0x0,0x2b00,0xf35b030000,0x0,0xf1fb73317170000,0x0,0x0,0xcb271f0000000000,0x2b,0x0,0x0,0x0,0x0,0x0,0x0,0x8ba30000000000,0x0,0x0,0x0,0x1f0700,0x0,0x0,0x0,0x1f070000000000,0x0,0x0,0xff1f00d3932303,0x0,0x1f00000000000000,0x3bdfff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x77fb1f0000,0x0,0x0,0x0,0x0,0x63fbff0000000000,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1ff3b327000000,0x0,0x0,0x0,0xbf5b00,0x0,0x0,0x0,0xbf5b0000000000,0x0,0x0,0x3bdfff1f,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1b3f0f000000,0x0,0x0,0x0,0x4f8b00,0x0,0x0,0x0,0x4f8b0000000000,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffffff1f000000,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2ff75300,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1f1f1f03000000,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x31f0000,0x0,0x0,0x0,0x0,0x0,0x0,0xb170000,0x170b0f1f13,0x0,0x0,0x1b0000,0x8fbf030000000000,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7000000000000,0x0,0xff1f00000000ff1f,0x1f00000000000000,0xff,0xffffffff1f000000,0xe7ffff,0xffffbf0000000000,0xffffff5f9f,0x1f0053cbfbfbcb53,0x8fe72b0000ff,0x5fdfffe7770000,0x5fdfffe777000000,0x0,0xfbcb530000000000,0xcb5300000053cbfb,0x7700000053cbfbfb,0x5fdfffe7,0x1f00000000000000,0x8fe72b0000ff,0xff7f0000004fff1f,0x5fdfffe777000000,0xdfffe77700000000,0xff1f00005f,0xe777000000ff1f00,0x77000000005fdfff,0x70000005fdfffe7,0x43df9b273b,0x5fdfffe77700,0x5fdfffe7770000,0x5fdfffe777000000,0xdfffe77700000000,0xffff1f000000005f,0xff2b0000000000ff,0xbf17000037c3078b,0x9f00005be7f7dff7,0x3bd3fffffffb,0x6fff8f0000,0x36fdbffefab1700,0x8fa30000000000,0x0,0x1fff1f0000000000,0xe7770000000000ff,0x63000000005fdfff,0x1f000000000047ff,0xff1f00009fff,0x0,0x0,0x47ebcb0b001fff00,0x0,0x1f0300000000ff1f,0x300000000000000,0x1f,0x1f1f1f1f03000000,0x3bef37,0xe79b170000000000,0x5f000023d7b7132f,0x1f00d75f272767f3,0x6ff33b00ff,0x53f3631f57e77700,0xf3631f57e7770000,0x53,0x2767f35f00000000,0x67f35f0000d75f27,0xe7770000d75f2727,0x53f3631f57,0x1f00f74f0f000000,0x6ff33b00ff,0xffef0f0000cfff1f,0xf3631f57e7770000,0x631f57e777000053,0xff1f0053f3,0x57e7770000ff1f00,0xe777000053f3631f,0xe3170053f3631f57,0xcb6f002fab,0x53f3631f57e777,0x53f3631f57e77700,0xf3631f57e7770000,0x631f57e777000053,0x1f1f0300000053f3,0xc78b00000000001f,0xabd30300005fa7eb,0xeb1b001bc3a3000f,0xd79b231fff33,0x6fd73fc78f00,0x3fbf531f37bfb700,0x1f0300000000,0x31f0f00000000,0x31f030000000000,0x53e777000000001f,0xbf00000053f76b1f,0x1f0000000000a3e7,0xff1f002bf3ff,0x0,0x0,0x9f37abcf171fff00,0x3,0xff1f00000000ff1f,0x1f53ebf797ff1f00,0x1f000000000000ff,0xb0000000000d77b,0x176fcb1f00005bcf,0x2ffb2f0000000000,0xe300007bdb0b0000,0x1f00070000000057,0x6fef4bff,0xcb7300000057eb00,0x7300000057eb0000,0xff1f00000000cb,0x57e300000000,0x57e30000070000,0x57eb000007000000,0xff1f00cb73000000,0x1f00dfd3ff1f0000,0x6fef4bff,0xffe77f004fe7ff1f,0x7300000057eb0000,0x57eb0000cb,0xff1f00cb73,0x57eb00001f0300,0x57eb0000cb730000,0xf73b00cb73000000,0xc78300000b,0xcb7300000057eb,0xcb7300000057eb00,0x7300000057eb0000,0x57eb0000cb,0xcf4f00cb73,0x33e703000023f317,0xff74b00000097df,0x470b000003af7700,0xff230000ff1f,0x6fcb17000bb78f,0x7000000005fd700,0xf317000000cf4f00,0xffffd7ef87000023,0xcf4f0007c7,0x53eb000023f317,0xfb1b0000cb830000,0x1f000000000bf743,0x1700ff1f00b387ff,0x17f72f000017ef,0x0,0x39fd743ff00,0xffffd733000000,0xff1f00000000ff1f,0x1fe3872393ff1f00,0xf7c36713000000ff,0xb703000000004bab,0xf7b3530300000083,0xbf8b00000b5bbb,0xff1b00cf77000000,0x1f0000000000000b,0x67fbff,0xfb2b0000000bff1b,0x2b0000000bff1b00,0x1f0300000000fb,0xbff1b000000,0xbff1b00000000,0xbff1b0000000000,0xff1f00fb2b000000,0x1f000b0bff1f0000,0x67fbff,0xff67ef0fcf67ff1f,0x2b0000000bff1b00,0xbff1b00fb,0xff1f00fb2b,0xbff1b00000000,0xbff1b00fb2b0000,0x930000fb2b000000,0x1b000027dbbfa3db,0xfb2b0000000bff,0xfb2b0000000bff1b,0x2b0000000bff1b00,0xbff1b00fb,0x4fcf0000fb2b,0x5bd34b0000009f8b,0xcb7b000000b3eb,0xbc34b,0x300df830300ff1f,0x1f07000000031f,0x7638bbffb6b00,0x9f8b00004fcf0000,0x63c3001ff73b0000,0x4fcf00004fdb,0x7ff1b00009f8b,0xaf6f0000fb2f0000,0x1f000000005fd300,0xff1f3feb0fff,0xa39b00007ba3,0x300000000000000,0x97f3ff00,0x1f239bd7000000,0xff1f00000000ff1f,0x1fff1f0007ff1f00,0x136fcffbaf0f00ff,0xa797000000000000,0x1700000000000000,0x9f9f00a3f7d373,0xff1f00df5f000000,0x1f00ffffff1f0007,0x17d7abff,0xff2700000007ff1f,0x2700000007ff1f00,0xffffffffff1f00ff,0x1f0007ff1f00ffff,0x7ff1f00ffffff,0x7ff1f00ffffff1f,0xff1f00ff27000000,0x1f000000ff1f0000,0x17d7abff,0xff1fbbc3d703ff1f,0x2700000007ff1f00,0x7ff1f00ff,0xff1f00ff27,0x7ff1f00000000,0x7ff1f00ff270000,0xe31f00ff27000000,0x1f00008fdb675f9b,0xff2700000007ff,0xff2700000007ff1f,0x2700000007ff1f00,0x7ff1f00ff,0xf00cf5f0000ff27,0xc7b7ab00000023eb,0x2bc77f00001bf72b,0x17cf,0x4fefffffff1f,0x0,0x7d3df8f5f230000,0x23eb0f00cf5f0000,0x5fbf0000b37b0000,0xf00cf5f00005fbf,0xffffff1f000023eb,0x53cf0000ffffffff,0x1f00000000bf7300,0xff1fcf6b00ff,0x33f71303e333,0xbb1f1b8feff37b00,0x17d7c3ff00,0xfff170000,0xff1f00000000ff1f,0x1fff1f0000ff1f00,0x75bb3fbcf1300ff,0xbc7730000000000,0xb00000000000000,0xc77f00c3fbbb5b,0xef0000c783000000,0x1f00ff3b1f030047,0x1fd7ab03ff,0xd36700000047f300,0x6700000047f30000,0x1f1f1f1f1f0300d3,0x30047ef00001f1f,0x47ef0000ff3b1f,0x47f30000ff3b1f03,0xff1f00d367000000,0x1f000000ff230000,0x1fd7ab03ff,0xff1f2fff4f00ff1f,0x6700000047f30000,0x47f30000d3,0xff1f00d367,0x47f30000000000,0x47f30000cf670000,0xcb7b00d367000000,0xfff33000000,0xd36700000047f3,0xd36700000047f300,0x6700000047f30000,0x47f30000d3,0x734fdf030000d367,0xfffff7130000009f,0xcbf353000083ffff,0x27,0x31f1fff1f,0x0,0x3beb070000000000,0x9f734fdf030000,0x5fbf0000af7f0000,0x734fdf0300005fbf,0x1f3ff3000000009f,0xffff2300d3631f1f,0x1f0000001bffffff,0xff7bd70300ff,0xcb7353cb00,0x83fbffbf472b9f1f,0x1bd7ab23ff00,0xbff1b0000,0xff1f00000000ff1f,0x1fff1f0000ff1f00,0xf3d77b23000000ff,0x17e353000043a3,0xf7ab4f0300000000,0x6bf72300001b6fcb,0x7b000063ef2f0000,0x1f00ff47030747e7,0x27e78f0300ff,0x6be7430037d78700,0xe7430037d7870000,0xff1f000000006b,0x747e77b00000000,0x47e77b0000ff4703,0xd7870000ff470307,0xfb0f006be7430037,0x1f000000ff93074f,0x27e78f0300ff,0xff1f001b0000ff1f,0xe7430037d7870000,0x430037d78700006b,0xff1f006be7,0x37d7870000000000,0xd787000067e74300,0xe36b006be7430037,0x3f763000013,0x6be7430037d787,0x6be7430037d78700,0xe7430037d7870000,0x430037d78700006b,0xe3cf6f0000006be7,0x33f36b00000023,0xa7fb0f0003e74b00,0x1763000003,0xff1f,0x0,0x2bfb53070b53b300,0x23e3cf6f000000,0x5fbf0017ef470000,0xe3cf6f0000005fbf,0x2bc7870000000023,0x1fa37f006bdb3b00,0x1f0000007bb71f1f,0xffef4b0000ff,0x5bdfc35b00,0xf130000000000,0x27e78f031fff00,0x37fe3000000,0xff1fffffffffff1f,0x1fff1f0000ff1f00,0x2f000000000000ff,0xfffffff31300db83,0x237bcf1f00ffffff,0xef4f000000000000,0x83f7cbdb,0x1f006fe3ffffeb7b,0x27e78f000000ff,0x7ffffffb970300,0x7ffffffb97030000,0x1f030000000000,0xffeb7b0000000000,0xeb7b0000006fe3ff,0x970300006fe3ffff,0x830000007ff7fffb,0x1f000000ffb7ffff,0x27e78f000000ff,0xff1f00000000ff1f,0x7ff7fffb97030000,0xf7fffb9703000000,0xffffffff1f00007f,0xfb970300000000ff,0x970300000083ffff,0xbf0b00007ff7fffb,0x63f7cbbff3,0x7ff7fffb9703,0x7ff7fffb970300,0x7ff7fffb97030000,0xf7fffb9703000000,0x9feb07000000007f,0x73cf00000000,0xdb8ba30053e70300,0xfcfe3bfe3,0xff1f,0x0,0x7bf3ffffd75700,0x9feb07000000,0x3bf3c3e7a7000000,0x9feb070000005fbf,0xfb97030000000000,0x43db00007ff7ff,0x2300001fd74b0000,0xffbf000000ff,0x7e7e70700,0x0,0x27e78f00001fff00,0xffffef47000000,0xf35b030000000000,0x5b03000000000000,0xf3,0x0,0x0,0x0,0x31f1b,0x0,0x0,0x63d307000000,0x63d30700000000,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x17cfab03,0x0,0x1b1f0b,0x0,0x0,0x0,0x0,0x2bcb271f00000000,0x2300000000,0x2b0000000000,0xf1f13,0x0,0x0,0x0,0x2bcb271f0000,0x31f0f00000000,0x2bcb271f00005fbf,0x0,0x0,0x931f0063d3070000,0xd3,0x0,0x0,0x0,0xbb7f0300000000,0x77fb1f0000000000,0xfb1f000000000000,0x77,0x0,0x0,0x0,0x0,0x0,0x0,0xf7e30f000000,0xf7e30f00000000,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x63fbff00000000,0x0,0x0,0x0,0x0,0x0,0x0,0x63fbff0000,0x0,0x63fbff00005fbf,0x0,0x0,0xdbff00f7e30f0000,0x3b,0x0,0x0,0x0,0xd3f71b00000000,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x172f,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5300000000000000,0x2ff7,0xff1f,0x93870000,0xff1fff1f000000,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1fd323bf00000000,0xa3ffc3030000,0xbbdb00000000,0x93870000000000,0x2ff753000000,0x979f03000000,0x2ff7530000000000,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x938700000000,0x0,0x0,0xa347bb000000,0xff1fff1f0000,0x938700000000,0x0,0x0,0x2ff75300000000,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1b,0x1f03,0x35b0300,0x1f031f03000000,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x17031703000000,0x1f00000000,0x70b00000000,0x35b0300000000,0x1b00000000,0xf0f03000000,0x1b000000000000,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x35b03000000,0x0,0x0,0x170013030000,0x1f031f030000,0x35b03000000,0x0,0x0,0x1b0000000000,0xff1f0000000000,0xbb830000000063bb,0x63dfffe377000000,0x0,0x0,0x0,0xffff1f0000000000,0xff1f00e7ffffffff,0x1f00e7ffffffffff,0xe7ffffffffffff,0x9b8f000000007fb3,0xff1f000000ff1f00,0x67e7fffff77f00,0x0,0x1fffffffffff0000,0x7fffffffffff1f00,0x5fffffffffff3f00,0xdbffffffffff7f00,0xff1f000000ff1f00,0xff1f000000ff1f00,0xff1f000000ff1f00,0xff1f00009fff1f00,0x1fdf00000fefbf00,0xff1f000000ff1f00,0x1fffffffffffff00,0x1f07001fff00,0x47ff63000000,0x4bd3ffffffff1f00,0x5fdfffdf73000000,0x6bd3ffffff1f00,0x0,0xff1f000000ff1f00,0xff1f00009fff1f00,0x3bd3ffffff1f00,0x4bc3fbf7c3370000,0xffffffffffffff00,0xff1f000000ff1f00,0xafaf0000008fb300,0xaf7b0000005bb300,0x47ff63000000,0xbfffffffffffff00,0xfffffffffff39b00,0x7f9f0000003fff00,0xff3f0000001fff00,0xaf7b0000005bb300,0x0,0x0,0x6bd3ffffff1f00,0xff1f0000000000,0x23f327000013eb2b,0xf3631f3fbb1f0000,0x5b,0xff1f000000000000,0x0,0x1f1f030000000000,0x1f03003bef371f1f,0x3003bef371f1f1f,0x3bef371f1f1f1f,0x3b797030057eb13,0xff1f000000ff1f00,0x1fff6b00000f3700,0x71f1300000000,0x1fff0000,0x3cba30000,0xbcf8f0000000000,0x57df130000000000,0xff1f000000ff1f00,0xff1f000000ff1f00,0xff1f000000ff1f00,0xff1f002bf3ff1f00,0x1fdf00007ff7bf00,0xff1f000000ff1f00,0x31f1fc73b1f1f00,0x83db1b001fff00,0xa3e7bf000000,0xf383271f1fff1f00,0xcb4b1f57e7770000,0x6bf363231fff1f00,0x23000000000000,0xff1f000000ff1f00,0xff1f002bf3ff1f00,0xdb97231fff1f00,0xdb67272b8bef0700,0x1f1f1fff3b1f1f00,0xff1f000000ff1f00,0x13e3670047eb1700,0xfdf47002fdf1300,0xa3e7bf000000,0xdf3f000000,0x1f1f1fff3b43ff00,0x7f9f0000003fff00,0xff3f0000001fff00,0xfdf47002fdf1300,0x0,0x8f5f0000004b9b00,0x6bf363231fff1f00,0xff1f0000000000,0x7fc30000a38f00,0x6700000003030000,0xcb,0xff1f000000000000,0xcf4f00000000,0x23f31700,0x5bcf0b00,0x5bcf0b0000,0x5bcf0b000000,0xbcfab37f34b00,0xff1f000000ff1f00,0x3fff030000000000,0xfe3f3f79fff1f00,0x1fff0000,0x8fc3070000,0x17db4f00000000,0x8fbf0300000000,0xff1f000000ff1f00,0xff1f000000ff1f00,0xff1f000000ff1f00,0xff1f00b387ff1f00,0x1fdf0017f38fbf00,0xff1f000000ff1f00,0xbf1f000000,0x2bff3300001fff00,0xbf743fb1b0000,0xeb67070000ff1f00,0x30000004feb0000,0xd367000000ff1f00,0xfcfb3ffd73b0000,0xff1f000000ff1f00,0xff1f00b387ff1f00,0xff230000ff1f00,0x700000017ff1b00,0xff1f000000,0xff1f000000ff1f00,0x3ff343eb530000,0x3beb37df4b0000,0xbf743fb1b0000,0xdf3f000000,0xff1f001f00,0x7f9f0000003fff00,0xff3f0000001fff00,0x3beb37df4b0000,0x27cbffeb670000,0x5ff7bbffcbef6700,0xd367000000ff1f00,0xffa3f7e33b0000,0x7db6343e70f00,0x2300000000000000,0xffffffffff1f00fb,0xffffffff1f00ffff,0x4fcf0000ffffff,0x9f8b00,0x83b703,0x83b70300,0x83b7030000,0x17e3fb970000,0xff1f000000ff1f00,0x17fb871f1b000000,0x57eb0b0797ff1f00,0x337f9fabff0000,0x3fff8f1f0000,0x33a3ef0f000000,0x1f83fbaf7f6f0000,0xff1f000000ff1f00,0xff1f000000ff1f00,0xff1f000000ff1f00,0xff1f3feb0fff1f00,0x1fdf008faf5fbf00,0xffffffffffff1f00,0xbf1f000000,0x73d30000001fff00,0x5fd300af6f0000,0x53ffffffffff1f00,0x7ff1b00,0xff27000000ff1f00,0xa7e32397df0000,0xffffffffffff1f00,0xff1f3feb0fff1f00,0xdf7f0300ff1f00,0x4b83aff3b30000,0xff1f000000,0xff1f000000ff1f00,0x87fba3000000,0x7ffb97000000,0x5fd300af6f0000,0xdf3f000000,0xff1f000000,0x7f9f0000003fff00,0xff3f0000001fff00,0x7ffb97000000,0xcf97033ffb2f00,0xbb9f238fdb0000,0xff27000000ff1f00,0xffaf2397d70000,0x47efdb630000,0xffffffffffff1f00,0x1f1f1f1f1f0300ff,0xff3b1f1f0300ff3b,0xcf5f00001f1f1f,0x23eb0f,0xa797,0xa79700,0xa7970000,0x63ff230000,0xff1f000000ff1f00,0x4bc7ebdf000000,0x4bd3000003ff1f00,0x5bf3937f7f7f0000,0x2f7fa3f32b00,0x53ef937f0f000000,0x175f5fe3b7530000,0xff1f000000ff1f00,0xff1f000000ff1f00,0xff1f000000ff1f00,0xff1fcf6b00ff1f00,0x1fdf1ff32f5fbf00,0xff3b1f1f1fff1f00,0xbf1f000000,0x7fbf0000001fff00,0xbf730053cf0000,0xc39b271f1fff1f00,0x3ff1f00,0xff23000000ff1f00,0xf3937f0fff1b00,0xff3b1f1f1fff1f00,0xff1fcf6b00ff1f00,0x33e3ffffff1f00,0x93ef9f673b000000,0xff1f000000,0xff1f000000ff1f00,0x6ffb8f000000,0x3ff23000000,0xbf730053cf0000,0xdf3f000000,0xff1f000000,0x7f9f0000003fff00,0xff3f0000001fff00,0x3ff23000000,0x13ff1b0000b77700,0xff230003ff1f00,0xff23000000ff1f00,0xff2f000fff1700,0xbfdf000000,0x5b1f1f1f3ff30000,0xd3,0xff1f00000000ff1f,0x4fdf030000000000,0x7300000000009f73,0xbc7,0xbc773,0xbc77300,0x5fff1f0000,0xf72f00000fff1700,0x5fdf000000,0x7d7630000ff1f00,0xcf73000000131300,0xaf9700,0xc777000000000000,0x37f73f0000,0xf72f00000fff1700,0xf72f00000fff1700,0xf72f00000fff1700,0xff7bd70300ff1f00,0x1fdf9f9f005fbf00,0xff1f000000ff1f00,0xbf1f000000,0x5fef07000027ff00,0x1bffffffffff2300,0xff23000000ff1f00,0x43f30000,0xdb5b000000ff1f00,0xff2b9b57ff1700,0xff1f000000ff1f00,0xff7bd70300ff1f00,0x53df3b1fff1f00,0xf73b000000000000,0xff1f000000,0xf72f00000fff1700,0x33ef37e3470000,0xff1f000000,0x1bffffffffff2300,0xdf3f000000,0xff1f000000,0x7bab0000004fef00,0xf76300000043ff00,0xff1f000000,0x1bff0b0000ab7f00,0xc78f0377e30300,0xdb5b000000ff1f00,0xff2b000bff1b00,0x23f3f33b0000,0xd73b002bc78b0000,0x6b,0x1f03000000001f03,0xcf6f000000000000,0xe3530000000023e3,0x5300000000000017,0x17e3,0x17e353,0x5fff1f0000,0xb7af130b97d70000,0x5fdf000000,0x27e37300ff1f00,0xc783000000bb9300,0x700000000bb9300,0xc383000000030300,0x67eb2300,0xb7af130b97d70000,0xb7af130b97d70000,0xb7af130b97d70000,0xffef4b0000ff1f00,0x1ff3f723005fbf00,0xff1f000000ff1f00,0xbf1f000000,0x7dfa70f006beb00,0x7bb71f1f1fa37f00,0xe383070000ff1f00,0xaf2b0037d78b0000,0x7fe7430300ff1f00,0xcb9707d7cf0000,0xff1f000000ff1f00,0xffef4b0000ff1f00,0x1beb2f0000ff1f00,0xeb870f033bb31f00,0xff1f000000,0xb7af130b97d70000,0xfdf57003bdf1300,0xff1f000000,0x7bb71f1f1fa37f00,0xdf3f000000,0xff1f000000,0x3bf74b001bc7ab00,0xafd72b001fc3cf00,0xff1f000000,0xd753001bef4700,0x4befd3ffe3e74b00,0x7fe7430300ff1f00,0xff97037be30000,0x9f8f6fbf0000,0x7ff7fffb9b070000,0x0,0xffffffff1f000000,0xeb07000000ffffff,0xfff313000000009f,0xf31300ffffffffff,0x1300ffffffffffff,0xfffffffffffff3,0x5fff1f0000,0x27cfffffdf3b0000,0x5fdf000000,0x1fcbb7ff1f00,0x47fbb39fc7eb2700,0x5fdba39fc7eb2700,0x47fbb39fabe31f00,0xdfdfdfdfdfff9b00,0x27cfffffdf3b0000,0x27cfffffdf3b0000,0x27cfffffdf3b0000,0xffbf000000ff1f00,0x1fff9f00005fbf00,0xff1f000000ff1f00,0xbf1f000000,0x23bffbe3f76700,0xd74b00000043db00,0x4bebffffffff1f00,0x7ff7fff793030000,0x38bf3ffffff1f00,0x37e7ffe3cf2700,0xff1f000000ff1f00,0xffbf000000ff1f00,0xb38b000000ff1f00,0x47e3ffffeb7f0300,0xff1f000000,0x27cfffffdf3b0000,0xaf9700000077af00,0xff1f000000,0xd74b00000043db00,0xe343000000,0xff1f000000,0x7ff7ffffbf1700,0x17b7ffffffc72700,0xff1f000000,0x37efb7ef9b0000,0x9b67001f034ba300,0x38bf3ffffff1f00,0xffbffff74f0000,0xfb573bff1b00,0x0,0x0,0x0,0xcb271f0000000000,0x2b,0x0,0x0,0x0,0x0,0x63d307000000,0x0,0x53ff1f00,0xb4b5f37030000,0x234b5f3b030000,0xb4b5f43130000,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1f0f00,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1bff33000000,0x0,0x0,0x0,0x0,0x77cf3303000000,0x0,0x0,0x0,0x8bf3f7a70000,0x0,0x0,0x0,0x63fbff0000000000,0x0,0x0,0x0,0x0,0x0,0xf7e30f000000,0x0,0xff1f00,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6ff3bb00000000,0x0,0x0,0x0,0x0,0x53efabafab0000,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3f0700,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1f2b0000000000,0x0,0x0,0x0,0x0,0x1b3f3f0f0000,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x53ff97bb5700,0xff1fff1f00,0x0,0x9bffb70300,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2ff753000000,0x53ff7bef170000,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xff1f000000,0x0,0xffff1f0000,0x0,0x93870000,0x0,0x0,0xa347bb0000,0x0,0x0,0xa347bb000000,0x2ff75300,0x938700000000,0x0,0x9387000000,0x0,0x9bffb70300,0x0,0x0,0x0,0x0,0x0,0x0,0x1700130b00,0x1f031f0300,0x0,0xf76bff1700,0xff1f,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1b00000000,0x17001b030000,0xff1f00000000,0x0,0x535b1300,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1f03000000,0x70f5f0700,0x1f1f030000,0x0,0x35b0300,0x0,0x5f0b,0x1700130300,0x0,0x0,0x170013030000,0x1b0000,0x35b03000000,0x0,0x35b030000,0x0,0xf76bff1700,0x0,0xff1f,0x0,0x3aba3000000,0x0,0x0,0x47ff630000,0xa3e3000000,0xff1f00004bff1f,0x53ff730000,0xff1f,0xffffffffffffff,0x0,0x0,0x9fe33f00000000,0xff1f00009fff1f,0x5fdfffdf730000,0x3bd3ffffff1f,0x77dbffffff1f,0x5fdfffdf730000,0xff1f000000ff1f,0xffffffff1f0000,0x47ff630000,0x8bbbdb00,0xff1f000000ff1f,0xff1f000000ff1f,0xff1f000000ff1f,0xff1f000000ff1f,0xff1f000000ff1f,0x47ff630000,0x47ff630000,0x5fdfffdf730000,0xfa7c3e70700,0xff1f000000ff1f,0x0,0x3bd3ffffff1f,0x0,0xff1f,0xaf7b0000005bb3,0x77dbffffff1f,0x5fffffffffff3f,0x5fdfffdf730000,0x3bd3ffffff1f,0x5fdfffdf730000,0xffffffffff1f00,0x4bc3fbf7c33700,0xff1f00009fff1f,0x53ff730000,0x1f9befffd35f00,0xff1f,0x0,0x3ab830000,0x77dbffffff1f,0x47ff630000,0x3fa3ffbf0000,0x3efe7330000,0xff1f000be3ff1f,0x6bff870000,0xff1f,0x1f1f1fff3b1f1f,0x0,0x0,0x7fb71f0b0000,0xff1f002bf3ff1f,0xcb4b1f57e77700,0xdb97231fff1f,0x6fe7571f1fff1f,0xcb4b1f57e77700,0xff1f000000ff1f,0x1fff3b1f030000,0xa3e7bf0000,0x7ff1f,0xff1f000000ff1f,0xff1f000000ff1f,0xff1f000000ff1f,0xff1f000000ff1f,0xff1f000000ff1f,0xa3e7bf0000,0xa3e7bf0000,0xcb4b1f57e77700,0xb7a7ab2f,0xff1f000000ff1f,0x17170000,0xdb97231fff1f,0x0,0xff1f,0xfdf47002fdf13,0x6fe7571f1fff1f,0xbcf8f00000000,0xcb4b1f57e77700,0xdb97231fff1f,0xcb4b1f57e77700,0xff3b1f1f1f0300,0xdb67272b8bef07,0xff1f002bf3ff1f,0x6bff870000,0x978f372363f73b,0xff1f,0xf74f0f00000000,0x2300031f0000,0x6fe7571f1fff1f,0xa3e7bf0000,0x3e7f3ffff1b00,0x43ff437f0000,0xff1f0093bfff1f,0xd3abe70300,0x6bd31700ff1f,0xff1f0000,0xff1f0000ff1f,0x6bd31700ff1f,0x5fefcff37700,0xff1f00b387ff1f,0x30000004feb00,0xff230000ff1f,0xd35f000000ff1f,0x30000004feb00,0xff1f000000ff1f,0xffa3f7e33b00,0xbf743fb1b00,0xbb39b0300ff1f,0xff1f000000ff1f,0xff1f000000ff1f,0xff1f000000ff1f,0xff1f000000ff1f,0xff1f000000ff1f,0xbf743fb1b00,0xbf743fb1b00,0x30000004feb00,0x1bff3b0000,0xff1f000000ff1f,0xffbfd3f39f00,0xff230000ff1f,0xff1f0000ff1f,0xbb39b0300ff1f,0x3beb37df4b00,0xd35f000000ff1f,0x17db4f000000,0x30000004feb00,0xff230000ff1f,0x30000004feb00,0xff1f0000000000,0x700000017ff1b,0xff1f00b387ff1f,0xd3abe70300,0x700000003d35b,0x6bd31700ff1f,0xdffbd3ffd73b00,0xfcfb3ffd73b00,0xd35f000000ff1f,0xbf743fb1b00,0x4bbfafffff6f00,0x9bd3008b0000,0xff1f3ff31fff1f,0x37f30bdf4b00,0x53db27ff1f,0xff1f0000,0xff1f0000ff1f,0x53db27ff1f,0x1303002bf73b,0xff1f3feb0fff1f,0x7ff1b,0xdf7f0300ff1f,0xff2300ffffffff,0x7ff1b,0xff1f000000ff1f,0xffaf2397d700,0x5fd300af6f00,0x38bb70bff1f,0xff1f000000ff1f,0xff1f000000ff1f,0xff1f000000ff1f,0xff1f000000ff1f,0xff1f000000ff1f,0x5fd300af6f00,0x5fd300af6f00,0x7ff1b,0x7ff7af0000,0xff1f000000ff1f,0xff870017ef47,0xdf7f0300ff1f,0xff1f0000ff1f,0x38bb70bff1f,0x7ffb970000,0xff2300ffffffff,0x33a3ef0f0000,0x7ff1b,0xdf7f0300ff1f,0x7ff1b,0xfffffffbc73700,0x4b83aff3b300,0xff1f3feb0fff1f,0x37f30bdf4b00,0x23739fe3e317,0x53db27ff1f,0xbc7af2397db00,0xa7e32397df00,0xff2300ffffffff,0x5fd300af6f00,0xab5f53ffffcf00,0xe37300532300,0xff27df6b00ff1f,0x9f970077af00,0x5fe7ff1f,0xffffff1f00,0xff1f0000ff1f,0x5fe7ff1f,0xb37b,0xff1fcf6b00ff1f,0x3ff1f,0x33e3ffffff1f,0xff23001f1fff3b,0x3ff1f,0xff1f000000ff1f,0xff2f000fff17,0xbf730053cf00,0x67cfff1f,0xff1f000000ff1f,0xff1f000000ff1f,0xff1f000000ff1f,0xff1f000000ff1f,0xff1f000000ff1f,0xbf730053cf00,0xbf730053cf00,0x3ff1f,0x3e35ff72300,0xff1f000000ff1f,0xff270000a77f,0x33e3ffffff1f,0xff1f0000ff1f,0x67cfff1f,0x3ff230000,0xff23001f1fff3b,0x53ef937f0f0000,0x3ff1f,0x33e3ffffff1f,0x3ff1f,0xff3b1f2787ef03,0x93ef9f673b0000,0xff1fcf6b00ff1f,0x9f970077af00,0x37f7bb734f0700,0x5fe7ff1f,0xf72f000fff17,0xf3937f0fff1b,0xff23001f1fff3b,0xbf730053cf00,0x37ffffffffff23,0x3bffffffff7b00,0xffabbf0000ff1f,0xff7fffffffb13,0x27e76fff1f,0x1fff3b0300,0xff230000ff1f,0x27e76fff1f,0xaf7f,0xff7bd70300ff1f,0x43f300,0x53df3b1fff1f,0xdb57000000ff1f,0x43f300,0xf72f00000fff17,0xff2b000bff1b,0x1bffffffffff23,0xbb3abff1f,0xf72f00000fff17,0xf72f00000fff17,0xf72f00000fff17,0xf72f00000fff17,0xf72f00000fff17,0x1bffffffffff23,0x1bffffffffff23,0x43f300,0x4be3038f9f00,0xf72f00000fff17,0xff2b0000ab7b,0x53df3b1fff1f,0xff1f0000ff1f,0xbb3abff1f,0xff1f0000,0xdb57000000ff1f,0xc7770000000000,0x43f300,0x53df3b1fff1f,0x43f300,0xff1f000003ff1f,0xf73b0000000000,0xff7bd70300ff1f,0xff7fffffffb13,0x979b0000000000,0x27e76fff1f,0xfb2b000bff1b,0xff2b9b57ff17,0xdb57000000ff1f,0x1bffffffffff23,0x7bbf1f1f1fb77f,0x8b9b1f1f4fcb00,0xfff31f0000ff1f,0x6bd31f1f1fb773,0x27e76f00ff1f,0xff1f0000,0xff93074ffb0f,0x27e76f00ff1f,0x700001bf343,0xffef4b0000ff1f,0xaf2b0037d78b00,0x1beb2f0000ff1f,0x83db370000ff1f,0xaf2b0037d78b00,0xb7af130b97d700,0xff97037be300,0x7bb71f1f1fa37f,0xbc39f03ff1f,0xb7af130b97d700,0xb7af130b97d700,0xb7af130b97d700,0xb7af130b97d700,0xb7af130b97d700,0x7bb71f1f1fa37f,0x7bb71f1f1fa37f,0xaf2b0037d78b00,0xab870017ef17,0xb7af130b97d700,0xff8b001bef43,0x1beb2f0000ff1f,0xbff7f034fff1f,0xbc39f03ff1f,0xff1f0000,0x83db370000ff1f,0xc3830000000303,0xaf2b0037d78b00,0x1beb2f0000ff1f,0xaf2b0037d78b00,0xff1f00076ff707,0xeb870f033bb31f,0xffef4b0000ff1f,0x6bd31f1f1fb773,0x83cf2b00278f5b,0x27e76f00ff1f,0xc797037be700,0xcb9707d7cf00,0x83db370000ff1f,0x7bb71f1f1fa37f,0xd7630000004bdb,0xdb2b000000e31b,0xff6b000000ff1f,0xd36b0000004bd3,0x27e76f0000ff1f,0xff1f0000,0x1fffb7ffff8300,0x27e76f0000ff1f,0x5bd3bfef9300,0xffbf000000ff1f,0x7ff7fff7930300,0xb38b000000ff1f,0x397f7ffffff1f,0x7ff7fff7930300,0x27cfffffdf3b00,0xffbffff74f00,0xd74b00000043db,0x17d38f0000ff1f,0x27cfffffdf3b00,0x27cfffffdf3b00,0x27cfffffdf3b00,0x27cfffffdf3b00,0x27cfffffdf3b00,0xd74b00000043db,0xd74b00000043db,0x7ff7fff7930300,0x17fb2700008f8f,0x27cfffffdf3b00,0xffb7e7f39700,0xb38b000000ff1f,0xfbe7bfffd7ff1f,0x17d38f0000ff1f,0xff1f0000,0x397f7ffffff1f,0x47fbb39fabe31f,0x7ff7fff7930300,0xb38b000000ff1f,0x7ff7fff7930300,0xffffffffeb5300,0x47e3ffffeb7f03,0xffbf000000ff1f,0xd36b0000004bd3,0x13affbfff79f17,0x27e76f0000ff1f,0x37e7ffef4f00,0x37e7ffe3cf27,0x397f7ffffff1f,0xd74b00000043db,0x0,0x0,0xf34f1f03000000,0x0,0x1f070000,0x0,0x63d30700000000,0x0,0xf1f0b0000,0x1f07000000,0xbb7f03000000,0x1f07000000,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6fe3bb7f7f7300,0x0,0xff1f,0x0,0x0,0x0,0xb4b5f431300,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1f0f,0x0,0x0,0x0,0x0,0x83fbff1f000000,0x0,0xbf5b0000,0x0,0xf7e30f00000000,0x0,0x0,0xbf5b000000,0xd3f71b000000,0xbf5b000000,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4bf3b7b3b300,0x0,0xff1f,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4f8b0000,0x0,0x0,0x0,0x0,0x4f8b000000,0x0,0x4f8b000000,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x133f3f0f00,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3dfe767eb00,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x9bffbb0000,0x0,0x0,0x0,0xbf170000,0x0,0xbcf3b0000,0x0,0x0,0xffffff1f00,0x0,0xffffff1f00,0x0,0x0,0xbcf3b0000,0x938700000000,0x0,0x0,0xffffff1f00,0x0,0x9bffbb,0xff1f000000000000,0x0,0x0,0x0,0x2ff7530000,0x0,0x0,0x0,0x0,0x0,0x938700000000,0x0,0x0,0x0,0x0,0x0,0x0,0xb0f031f00,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xb1f0b0000,0x0,0x1f030000,0x0,0x0,0x0,0x5f0b0000,0x0,0x233b000000,0x0,0x0,0x1f1f1f0300,0x0,0x1f1f1f0300,0x0,0x0,0x233b000000,0x35b03000000,0x0,0x0,0x1f1f1f0300,0x0,0xff17000000001f03,0x1f0300000000f74f,0x0,0x0,0x0,0x1b000000,0xaf2bbb03,0xff1700000023f73f,0xf74f,0x0,0xff1f0000,0x35b03000000,0x0,0x6b00000000000000,0x3000000002f9b53,0x8fbf,0xaf2bbb0300000000,0x77539b230000,0xbf5f00007fff3f,0x5bd7ffffff1f,0x3bd3ffffff1f,0x3bd3ffffff1f,0xff1f000000ff1f,0xff1f000000ff1f,0x4bc3fbf7c33700,0xffffffffffffff,0x53efe7f38f00,0xff1f000000ff1f,0x47ff630000,0xffffffffff1f,0xf0000000f00,0xdbffffffffff7f,0x47ff630000,0xff4f,0x47ff630000,0x0,0x0,0xaf7b0000005bb3,0x0,0x47ff630000,0x4bc3fbf7c33700,0xffffffffffffff,0xff1f000000ff1f,0xff1f000000ff1f,0x1fff00,0x47ff630000,0xffffffffff1f,0xff1f0000ffffff1f,0xbb000000ffffffff,0xffffff1f00009bff,0xff1f000000ffff,0xffffffffff1f0000,0x0,0xffffffffff1f,0x2ff75300,0xbb00000000a347bb,0xff1f000000009bff,0xd7170000000000,0xffffffff0000,0xff1f00,0x1f0000000000ff1f,0x13000000000000ff,0xa300000000af4bcf,0x8f,0x2ff7530000000000,0x17d34fa3000000,0xbf5f000feff73f,0x57f363231f1f03,0xdb97231fff1f,0xdb97231fff1f,0xff1f000000ff1f,0xff1f000000ff1f,0xdb67272b8bef07,0x1f1f1fff3b1f1f,0xdb8300179700,0xff1f000000ff1f,0xa3e7bf0000,0x1f1f1f1fff1f,0xbb5f0007f327,0x57df1700000000,0xa3e7bf0000,0xffc3,0xa3e7bf0000,0x0,0xa75300003bbb03,0xfdf47002fdf13,0x0,0xa3e7bf0000,0xdb67272b8bef07,0x1f1f1fff3b1f1f,0xff1f000000ff1f,0xff1f000000ff1f,0x1fff00,0xa3e7bf0000,0x1f1f1f1fff1f,0xff1f00001f1f1f03,0x30000001f1f1f1f,0x1f1fff1f0000001f,0x1f030000001f1f,0x1f1f1f1fff1f0000,0x0,0x1f1f1f1fff1f,0x3000000001b0000,0x300000000170013,0x1f0300000000001f,0x9f830000000000,0x1f1fff3b0000,0xff1f00,0x1f0000000000ff1f,0xff,0x1f030000034f1b37,0x0,0x1b000000000000,0x272b3f13000000,0xbf5f008bc7bf3f,0xcb6f0000000000,0xff230000ff1f,0xff230000ff1f,0xff1f000000ff1f,0xff1f000000ff1f,0x700000017ff1b,0xff1f0000,0xdf5700000000,0xff1f000000ff1f,0xbf743fb1b00,0xff1f,0xbb5f000bef2f,0x8bbf03000000,0xbf743fb1b00,0xff3b,0xbf743fb1b00,0x38f1f038f1f,0x3bef533bef5300,0x3beb37df4b00,0xa70b00a70b0000,0xbf743fb1b00,0x700000017ff1b,0xff1f0000,0xff1f000000ff1f,0xff1f000000ff1f,0x1fff00,0xbf743fb1b00,0xff1f,0xff1f003bdbffcb27,0xcb27000000000000,0xff1f003bdbff,0xdbffcb2700000000,0xff1f003b,0x3bdbffcb270000,0xff1f,0x3b00003bdbffcb27,0xe33b0000ffa3f7e3,0xf7e33b0000ffa3f7,0xa3f7ef3b0000ffa3,0x53ebf797ff1f00ff,0xff1f00,0x1f0000000000ff1f,0x1f000000ff1f00ff,0x97ff1f004fe7ffff,0xf797ff1f0053ebf7,0xebf797ff1f0053eb,0xffef8bff1f0053,0xbf5f17f73bbf3f,0xfb270000000000,0xdf7f0300ff1f,0xdf7f0300ff1f,0xff1f000000ff1f,0xff1f000000ff1f,0x4b83aff3b300,0xff1f0000,0x7fd71b000000,0xffffffffffff1f,0x5fd300af6f00,0x27bbfbffffff1f,0x3bebabdfa300,0x3bf9b000000,0x5fd300af6f00,0x27bbfbffffff1f,0x5fd300af6f00,0x1fcbcb2bcbcb0b,0x3befef530000,0x7ffb970000,0xb7db2fb7db2f00,0x5fd300af6f00,0x4b83aff3b300,0xff1f0000,0xff1f000000ff1f,0xff1f000000ff1f,0x1f8fff7f,0x5fd300af6f00,0xffffffffff1f,0xff1f00d77f1f7bcf,0x7bcf0000ffffffff,0xffffff1f00d77f1f,0x7f1f7bcf0000ffff,0xffffffffff1f00d7,0xd77f1f7bcf0000,0xffffffffff1f,0xdb0000d77f1f7bcf,0x97db0000ffaf2397,0x2397db0000ffaf23,0xaf2397db0000ffaf,0xe3872393ff1f00ff,0xff1f00,0x1f0000000000ff1f,0x30000001f0300ff,0x93ff1f00df731f1f,0x2393ff1f00e38723,0x872393ff1f00e387,0x1f2bafff1f00e3,0xbf5f97ab00bf3f,0xff230000000000,0x33e3ffffff1f,0x33e3ffffff1f,0xff1f000000ff1f,0xff1f000000ff1f,0x93ef9f673b0000,0xff1f0000,0x23ebef8b1b00,0xff3b1f1f1fff1f,0xbf730053cf00,0xd3a32b1f1fff1f,0xa7c75f83ef27,0x17e36b0000,0xbf730053cf00,0xd3a32b1f1fff1f,0xbf730053cf00,0xebcf03ebcf0300,0x27e7ef3b0000,0x3ff230000,0xb3f713b3f713,0xbf730053cf00,0x93ef9f673b0000,0xff1f0000,0xff1f000000ff1f,0xff1f000000ff1f,0x1773ff5f,0xbf730053cf00,0x17001f1f1f1fff1f,0xff1f00ffffffffff,0xffff17001f1f1f1f,0x1f1fff1f00ffffff,0xffffffff17001f1f,0x1f1f1f1fff1f00ff,0xffffffffff1700,0x17001f1f1f1fff1f,0xff1b00ffffffffff,0xbff1b00ff2b000b,0xbff1b00ff2b00,0x2b000bff1b00ff2b,0xff1f0007ff1f00ff,0xff1f00,0x1f0000000000ff1f,0x67000000000000ff,0x7ff1f00ffffffdf,0x7ff1f00ff1f00,0x1f0007ff1f00ff1f,0xfff1f00ff,0xbf83f32300bf3f,0xd3630000000000,0x53df3b1fff1f,0x53df3b1fff1f,0xf72f00000fff17,0xf72f00000fff17,0xf73b0000000000,0xff1f0000,0x3df7f277f4f00,0xff1f000000ff1f,0x1bffffffffff23,0xff23000000ff1f,0x17ff270000c77b,0x37f74300,0x1bffffffffff23,0xff23000000ff1f,0x1bffffffffff23,0x3be3af43e3af07,0x27e76f53ef3b00,0xff1f0000,0x97ef4f97ef4f00,0x1bffffffffff23,0xf73b0000000000,0xff1f0000,0xf72f00000fff17,0xf72f00000fff17,0x1fff00,0x1bffffffffff23,0x1b0000000000ff1f,0xff1f001f1f1f33ff,0x33ff1b0000000000,0xff1f001f1f1f,0x1f1f33ff1b000000,0xff1f001f,0x1f1f1f33ff1b00,0x1b0000000000ff1f,0xff1b001f1f1f33ff,0x7ff1b00ff270007,0x7ff1b00ff2700,0x270007ff1b00ff27,0xff1f0000ff1f00ff,0xff1f00,0x1f0000000000ff1f,0xfb0f0000000000ff,0xff1f00ff431f67,0xff1f00ff1f00,0x1f0000ff1f00ff1f,0xff1f00ff,0xbfef8b0000bf3f,0x6be74303000000,0x1beb2f0000ff1f,0x1beb2f0000ff1f,0xb7af130b97d700,0xb7af130b97d700,0xeb870f033bb31f,0xff1f0000,0x1fff2300000000,0xff1f000000ff1f,0x7bb71f1f1fa37f,0xdf8b0b0000ff1f,0xbfb4f000bdf73,0x67eb23,0x7bb71f1f1fa37f,0xdf8b0b0000ff1f,0x7bb71f1f1fa37f,0x13b71f13b71f,0xbb6f000053d303,0xff1f0000,0xcb1f00cb1f0000,0x7bb71f1f1fa37f,0xeb870f033bb31f,0xff1f0000,0xb7af130b97d700,0xb7af130b97d700,0x1fff00,0x7bb71f1f1fa37f,0xff1f,0xff1f00b7230b9bdb,0x9bdb000000000000,0xff1f00b7230b,0x230b9bdb00000000,0xff1f00b7,0xb7230b9bdb0000,0xff1f,0xe70000b7230b9bdb,0x7be70000ff97037b,0x37be70000ff9703,0x97037be70000ff97,0xff1f0000ff1f00ff,0xff1f00,0x1f0000000000ff1f,0xff170000000000ff,0xff1f00ff9b0b37,0xff1f00ff1f00,0x1f0000ff1f00ff1f,0xff1f00ff,0xbfef0f0000bf3f,0x7bf3ffffff1f,0xb38b000000ff1f,0xb38b000000ff1f,0x27cfffffdf3b00,0x27cfffffdf3b00,0x47e3ffffeb7f03,0xff1f0000,0xe39303000000,0xff1f000000ff1f,0xd74b00000043db,0x3be3ffffffff1f,0x7ff7bfdfd30f,0xdfdfdfdfdfff9b,0xd74b00000043db,0x3be3ffffffff1f,0xd74b00000043db,0x3000003,0x3000000000300,0xff1f0000,0x3000003000000,0xd74b00000043db,0x47e3ffffeb7f03,0xff3b0300,0x27cfffffdf3b00,0x27cfffffdf3b00,0x1bdfdfdfe3ff00,0xd74b00000043db,0xffffffffff1f,0xff1f0073f7ffdb37,0xdb370000ffffffff,0xffffff1f0073f7ff,0xf7ffdb370000ffff,0xffffffffff1f0073,0x93ffffdb370000,0xffffffffff1f,0x4f000073f7ffdb37,0xf74f0000ffc3fff7,0xfff74f0000ffc3ff,0xc3fff74f0000ffc3,0xff1f0000ff1f00ff,0xffffffffff1f00,0x1f00ffffffffff1f,0xa30000ffffffffff,0xff1f00ffb7ffff,0xff1f00ff1f00,0x1f0000ff1f00ff1f,0xff1f00ff,0x0,0x0,0x0,0x0,0x0,0x0,0x1f070000,0x1f070000,0x27cfd3530300,0x0,0x0,0x0,0x71f130000,0xff230000000000,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xbb7f030000,0xbb7f0300,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x63d3070000000000,0x63d30700000000,0x0,0x300000000000000,0x1f030000cb9f231f,0x231f030000cb9f23,0x9f231f030000cb9f,0xcb,0x0,0x1f070000,0x0,0x0,0x1f07000000000000,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xbf5b0000,0xbf5b0000,0x35bc7eb2f,0x0,0x0,0x0,0x0,0xb3cb9f27000000,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xd3f71b0000,0xd3f71b00,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xf7e30f0000000000,0xf7e30f00000000,0x0,0x1f00000000000000,0xff1f00003bdbffff,0xffff1f00003bdbff,0xdbffff1f00003bdb,0x3b,0x0,0xbf5b0000,0x0,0x0,0xbf5b000000000000,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4f8b0000,0x4f8b0000,0x2313,0x0,0x0,0x0,0x0,0x73f3f0f000000,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4f8b0000,0x0,0x0,0x4f8b000000000000,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xa700000000000000,0x8bfb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffffff1f00000000,0x0,0x0,0x0,0x0,0x0,0x0,0xffffff1f000000,0x0,0x0,0x1700000000000000,0x2b00000000f74fff,0xbf03000000b75fb3,0x23f73f000000008f,0x0,0xaf2bbb030000,0xfb6f7bfba300,0x1700000000000000,0xff1b000000f74fff,0xb32b00000000ff6b,0xffffffff00b75f,0x0,0xffffffff1f00,0xff3f,0x5f5f5f5f3b,0x0,0x0,0x0,0xfffb8f000000,0x0,0x71f1f0300,0x0,0x5747000000000000,0xf,0x0,0x0,0x31f1b000000,0x0,0x0,0x0,0x0,0x0,0x0,0xaf2bbb030000,0x0,0xaf2bbb03,0xbb03000000000000,0xaf2b,0x1f1f1f0300000000,0x0,0x0,0x0,0x0,0x0,0x0,0x1f1f1f03000000,0x0,0x0,0xffffff1f,0xbf000000009bffbb,0x8fa30000001fd323,0xa347bb0000000000,0x0,0x2ff753000000,0x9fffb36bff17,0xffffff1f,0xc3030000009bffbb,0x23bf00000000a3ff,0x1f1fff3b001fd3,0xff1f0000,0x1f1f1fff1f00,0xff8b,0xff1f00ffab9f9f63,0xdf5f0000ffffffff,0xffffff1f00ffffff,0xffff,0x1f43fb0b0000,0x1fff00,0x53efe7e7f333,0xff1f000000000000,0xc3d76300ffffffff,0xc7,0x0,0x0,0x37e3efefe32b00,0x0,0x2300000000ff1f00,0xffff1f0013bbffcf,0xffe36700000000ff,0xd3ffe367000037c7,0xfb77000000004b,0x2ff753000000,0xffffffff1f,0x30000002ff75300,0x53000000ffffef87,0xffffff1f00002ff7,0xff1fff1f0000f7ff,0x4fdfffe767000000,0x0,0xfb7ffe34700,0xff1f000000000000,0xffffffff,0xffffff1f00000000,0xff1fff1f0000ffff,0xff1f00000000,0x0,0x1f1f1f03,0x1703000000001f03,0x1f030000001703,0x1700130300000000,0x0,0x1b00000000,0x1f00071f03,0x1f1f1f03,0x1f03,0x31703000000001f,0xff1f000017,0xff1f0000,0xff1f00,0xffd7,0x1f0300ff1f171700,0x6bfb1300ff3b1f1f,0x1f1fff1f001f1f1f,0x1f1f,0xff1f0000,0x177b9fabff00,0xeb6f00002717,0xab03000000000000,0xe7ef3f001f1f23d7,0xdfff,0x0,0x0,0xc3a30300472300,0x0,0xb70000fffffff373,0x3b1f030097c32bab,0x2747c71f000000ff,0x87273bbb1f00df9b,0xc3cb43000000ef,0x1b00000000,0x1f1f1fff1f,0x7b000000001b0000,0x1f1f47e7,0x1f1f1f030000001b,0x1f031f0300009f9f,0xf37f1f63ff130000,0x0,0x8f9b2383ef03,0xff1f000000000000,0x1f1f1f1f,0x1f1fff1f00000000,0x1f031f0300001f1f,0x1f0300000000,0x4febf797ff1f,0x3b000027cbffd73b,0xd73b000027cbffd7,0xffe373000027cbff,0xe3ffe373000063e3,0x63e3ffe373000063,0x63e3ffe3730000,0x1f00ff1f0000ff1f,0xff1f00ff1f0000ff,0xff1f00ff1f0000,0xff1f00ff1f00,0xd7fb9fff1f00ff1f,0x972bff1f0027,0x27d7fb9fff1f00,0x27d7fb9fff3b,0xffbfd7f393,0x4bf30f00ff1f0000,0xff1f00000003,0xebf797ff1f000000,0x27d7f75fff1f0053,0x7e3bb6773ff00,0xfb5700000000,0x3000057dbffeb7b,0x1f0000000003abbf,0xdfdfdf6f000000ff,0xdfdfe7ff1f003fff,0x3fffdfdfdf6f00a7,0xd7670000000000,0xf003fffffffff1f,0xfb03001f1fff6bfb,0x1f000000df4b002b,0x303000000ff,0x670700030300ff2b,0xd31fd31b0000e3,0x4fe7ffff1f0000,0xff1f,0xeb000027cbffd73b,0xff1f0000000053,0x700000000ff1f00,0x1f0000ff1f003feb,0xdf630043f30b00ff,0xff1f0000ff1f00,0x1f00db230003ff1f,0xff1f00ff1f0000ff,0xff1f0000000000,0xff1f00ff1f00,0xe7ffff1f00000000,0xffffd73300004f,0xe3872393ff1f,0xdb0000bbaf2397db,0x97db0000bbaf2397,0x1f53ff1700bbaf23,0x431f53ff1700cb43,0xcb431f53ff1700cb,0xcb431f53ff1700,0x1f00ff1f0000ff1f,0xff1f00ff1f0000ff,0xff1f00ff1f0000,0xff1f00ff1f00,0xaf279bff1f00ff1f,0x23c7ff1f00b7,0xb7af2397ff1f00,0x4300b7af2397ff1f,0xff1f00ff870017f3,0xff5f0000ffffffff,0xffffff1f0000ffff,0x8b239bff1f00ffff,0xb7af238fff1f00e3,0x3bff13001fff00,0x1f009bfbc78f3b00,0xf76f1f3bb7,0x1f000000008bcb0b,0x77000000000000ff,0x3b39f000003cb,0x3bf770000000000,0x7bdb0b00000000,0x170000000000ff1f,0xff1f000000ff57ff,0x1f000000ff1f0000,0xff,0xfbffff1f0000bb9b,0xf30043bf03003f,0xdf731f1f030000,0x23b7f7f7ff1f,0xff1b00bbaf2397db,0xff1f003bd7fbaf,0x5700000000ff1f00,0x1f0000ff1f0000d7,0x3ffbffff5f0000ff,0xff1f0000ff1f00,0x1f00ff7f0363f707,0xff1f00ff1f0000ff,0xff1f00ffffffff,0xffffff1f00ff1f00,0x731f1f030000ffff,0x1f239bd70000df,0x1700ff1f0007ff1f,0xff1700f72f000fff,0xfff1700f72f000f,0x93cbc30300f72f00,0x4b93cbc30300034b,0x34b93cbc3030003,0x34b93cbc30300,0x1f00ff1f0000ff1f,0xff1f00ff1f0000ff,0xff1f00ff1f0000,0xff1f00ff1f00,0x2b0013ff1f00ff1f,0x7ff8f00f7,0xf72b000bff1f00,0x7b00f72f000fff1f,0x1f0300ff2b0000af,0x97e70300ff3b1f1f,0x1f1fff1f00001f27,0x23000bff1f001f1f,0xf72f000fff1f00ff,0x33ff2f001fff00,0x30000376bbbff5b,0xa7d7975703,0x1f0000000053eb1f,0xff8b7f0f000000ff,0x93b3030000009f,0x13d74b00000000,0x8be7ffe3c30000,0xff1f,0xff1f0037bffffb83,0x1f000000ff1f0000,0x77000000000000ff,0xaf2b1f0300001fe7,0xff0f00738f00c7,0xffffffdf670000,0x1700c7b3331f1f03,0xff1f00f72f000fff,0xff1f00d397237f,0xbf00000000ff1f00,0x1f0000ff1f000077,0xc797237fe30300ff,0xff1f0000ff1f00,0x1f00ffcbfff76700,0xff1f00ff1f0000ff,0xff1f001f1f1f1f,0x1f1fff1f00ff1f00,0xffffdf6700001f1f,0xfff1700ff,0x1b00ff1f0000ff1f,0xff1b00fb2b000bff,0xbff1b00fb2b000b,0x974b030000fb2b00,0xe7974b030000afe7,0xafe7974b030000af,0xafe7974b030000,0x1f00ff230000ff1f,0xff1f00ff230000ff,0xff1f00ff230000,0xff1f00ff2300,0x27000bff1f00ff23,0xff5f00fb,0xfb270007ff1f00,0x7f00fb2b000bff1f,0xff270000ab,0x3ff1f00ff1f0000,0xff1f00000000,0x1f0000ff1f000000,0xfb2b000bff1f00ff,0xb3efbfc7ff00,0x300000000009bb7,0xb000000438bdfcb,0x1f00000000007fd3,0x63f3930b000000ff,0x5bfb7f170000005f,0x1fbfeff32b000000,0x3abab030000,0x2f7f9fff1f,0xff0700eb8fff2700,0x1f000000e7430023,0xe78f0000000000ff,0x2300000000000027,0xffffffffffff00ff,0xff431f67fb0f00,0x1b00ff2700000000,0xfb0700fb2b000bff,0xff1f00ff230003,0xfb27000000ff2300,0x230000ff1f000017,0xff230003ff1f00ff,0xff230000ff1f00,0x1f00d367170b0000,0xff1f00ff230000ff,0xff1f0000000000,0xff1f00ff2300,0x431f67fb0f000000,0xbff1b00ff,0xff1f0000ff1f,0xe70000c797037be7,0x7be70000c797037b,0x1f8f1f00c79703,0x57001f8f1f00fb57,0xfb57001f8f1f00fb,0xfb57001f8f1f00,0xf00ff93074ffb0f,0xfb0f00ff93074ffb,0x4ffb0f00ff93074f,0x74ffb0f00ff9307,0x970783ff1f00ff93,0xff1f00c3,0xc397037bff1f00,0x4b00c397037bff1f,0xff73000be7,0x7bef0700ff1f0000,0xff1f00000007,0x1f0000ff1f000000,0xc397037bff1f00ff,0x5bf75fff00,0x1b0047000000abab,0xab0000a7270037ff,0x1f000000000000b3,0x47e31f000000ff,0x3f7fabe71f000000,0x5bd7070000000000,0x7c39b0000,0x57f3937f7f0f,0xc30000f753ff1f00,0x1f000000a3af0b93,0x27e78f00000000ff,0x970b138b1f000000,0x1fff3b1f1f1f00d7,0xff9b0b37ff1700,0xd7970b000000,0xbb0000c797037be7,0x4ffb0f00df830367,0xaf8b000000ff9307,0x93074ffb0f000000,0xe37f0363f70b00ff,0xff93074ffb0f00,0xf006be737000000,0xff1f00ff93074ffb,0x4ffb0f0000000000,0xff1f00ff9307,0x9b0b37ff17000000,0x37fe30000ff,0xff1f0000ff1f,0x4f000037e7ffef4f,0xef4f000037e7ffef,0xfffb9f030037e7ff,0xf3fffb9f030073f3,0x73f3ffffa3030073,0x73f3fffb9f0300,0xffb7ffff8300,0x830000ffb7ffff83,0xff830000ffb7ffff,0xffff830000ffb7ff,0xefffbfff1f00ffb7,0xffffffffff1f0037,0x37efffbfff1f00,0x30037efffbfff1f,0xff1f00ffd3b7dfb3,0xe74f0000ffffffff,0xff1f00ffffff,0x1f0000ff1f000000,0x37efffbfff1f00ff,0x9f971fff00,0xebe3bfdbe733,0xff1f0087f7fff78b,0x1f000000ffffffff,0xbfbff39b000000ff,0xb783002fbf,0xfbfefb76f030000,0xc3dfdfe7ff3b00,0x1f00cf7700000000,0x33000073fbffffff,0xffff1f001fdfffe7,0xffffff1f00ffffff,0xdbffff9b0300ffff,0xff1f000000003b,0xffb7ffffa30000,0x3bdbffffff1f,0x2f000037e7ffef4f,0xff83000047efffe3,0x4beb070000ffb7ff,0xb7ffff8300000000,0x4feffff7670000ff,0xffb7ffff830000,0x393fbffff1f,0xff1f00ffb7ffff83,0xff830000ffffffff,0xff1f00ffb7ff,0xb7ffffa300000000,0xffffef470000ff,0xf7571f030000,0x0,0x0,0x0,0x0,0xbb7f03000000,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x171700,0x0,0xdb6f00000000,0x1f00000000000000,0xff1f00ff,0x17fb27000000,0xf1f170000,0x0,0x1b00000000000000,0x3ff,0x7d777000000,0x3000027d35b0017,0x0,0xc3970000000f,0xff1f00,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x83fbff1f0000,0x0,0x0,0x0,0x0,0xd3f71b000000,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x67f700000000,0x1f00000000000000,0xff1f00ff,0x3bd7ab00000000,0x0,0x0,0x0,0x8bbfd3,0xcbbfe3d313000000,0x1fdfa7bbef2f00db,0x0,0x33efd3bfdb7f,0xff1f00,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x173b0300000000,0x0,0x0,0x0,0x373f07,0x475f370300000000,0x273f3f0b00000f,0x0,0xb4b5f3703,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8bfba700,0x0,0x0,0x0,0xbcf3b00000000,0x938700000000,0x0,0x0,0x0,0x0,0xa347bb0000000000,0x0,0xff1fff1f0000,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xfba7000000000000,0x8b,0x0,0x0,0x0,0x0,0x0,0x0,0xff1f0000,0x23ab4b7f0000,0xff1f00000000,0x0,0x0,0xff1f00000000,0x0,0x0,0x0,0x0,0x0,0x0,0x3aba3,0x171f0b0000000000,0x0,0x2be73b0000,0x0,0xff6bff1b,0x0,0x0,0x0,0x233b0000000000,0x35b03000000,0x87ff930000,0x4f00000000000000,0x476b83,0xf343000000000000,0x1700130300000fd3,0x2f835f67000000,0x1f031f030000,0x7c7f7570000,0x6700000000000000,0x9f8f00004feff3,0x539b370000000000,0x8fbf03000000005f,0xfd7ef4300000000,0x23f73f000000,0x0,0xe777d300,0x0,0x6bff1b0000000000,0xff1f0000ff,0x0,0xff1f,0xff1f000000000000,0x3bd3ffff,0xffff1f0000000000,0xff,0xff1f0000,0x8fdf0b0000,0xff1f00000000,0x0,0x0,0xff1f00000000,0xffffff1f00000000,0x0,0x0,0x0,0x0,0x8300000000000000,0x3ab,0xfffff787ff000000,0x63,0x17db3b000000,0xfff39b000000,0xff1f0000a3ffc303,0x1f000000000083ef,0xe34b0000000000ff,0xffffeb5b00007bf7,0xffffffffff1f00ff,0xffffffffff1f00,0x1f0000f76ffb0700,0x30000ffffffffff,0xffff1f0000c74bc7,0x97ab000000ffffff,0xffffffff1f0057d7,0xaf3fc70f0000ff,0xffffffffff1f00,0x1f003bef87bb0000,0xf3070000000000ff,0x7fab030000d77363,0x57af000000000000,0x8fa300000007cf,0x57d797a300000000,0xa347bb000000,0x0,0x1f000000c3afcf1b,0xff1fff,0xffc3030000000000,0xff1f0000a3,0x0,0xff1f,0xff1f000000000000,0xd79b231f,0x1f1f030000000000,0x1f,0xff1f0000,0x713000000,0xff1f00000000,0x0,0x0,0xff1f00000000,0x1f1f1f0300000000,0x0,0x0,0x0,0x0,0x1f00000000000000,0x3,0x9f032fd7ff000000,0xd3,0xf1300000000,0x1f43ff170000,0x1f030000001f0000,0x1f0000000000f75f,0x7be70000000000ff,0x3bfffff70700b327,0x1f1f1f1fff1f00ff,0x1f1f1f1fff1f00,0x1f00001f031f0300,0x1f1f1f1fff,0x1fff1f000f43331f,0xb170000001f1f1f,0x1f1f1fff1f000b17,0x34f1b2b0000001f,0x1f1f1f1fff1f00,0x1f000b1b0b170000,0xff1f003bd3ffffff,0x1f03000000f37f00,0x3f13000000000000,0x1f0300001b37,0xb170b1700000000,0x170013030000,0x0,0x30000000b071703,0x1f000000001f031f,0x1f0000000000000f,0xff1f000000,0x0,0xff1f,0xff1f004fe7ffff1f,0xff230000,0xffff1f0000000000,0xe7ffff1f00004fe7,0x27d7fb9fff1f004f,0xffa3f7e33b0000,0xffa3f7e33b00,0x3b00003bdbffcb27,0xd73b0000ffa3f7e3,0xf797ff1f0027cbff,0xcbffd73b000053eb,0x53ebf797ff1f0027,0x27cbffd73b0000,0x27d7fb9fff1f,0x730000ffa3f7e33b,0xe33b000063e3ffe3,0xff1f00ffa3f7,0x6300002fff00ff1f,0xa363000047a300d7,0x53ebf797ff1f00,0xff1f0000,0x4fe7ffff1f,0xe73f00000000ff1f,0x7ff1b0000ffffff,0x1fffffff1f000300,0xff1f00ff,0xff1f00,0x1f004fe7ffff1f00,0x27000000000000ff,0xff1f003bdbffcb,0xffcb270000000000,0xff1f003bdb,0x27cbffd73b000000,0xff1f00,0x1f0027cbffd73b00,0xff1f00d79b231fff,0xff1f00000027ff0f,0xff1f004fe7ff,0xe7ffff1f0000ff1f,0xff1f0000ff1f004f,0x4fe7ffff1f0000,0x63e3ffe37300,0x1f00004fe7ffff1f,0xbfd747004fe7ffff,0xffff1f0000007feb,0x6ff797ff1f004fe7,0xffffd733000000,0xff1f,0xff1f00df731f1f03,0xdf830300,0x1f1f030000000000,0x731f1f030000df73,0xb7af2397ff1f00df,0xffaf2397db0000,0xffaf2397d700,0xdb0000d77f1f7bcf,0x97db0000ffaf2397,0x2393ff1f00bbaf23,0xaf2397db0000e387,0xe3872393ff1f00bb,0xbbaf2397db0000,0xb7af2397ff1f,0xff1700ffaf2397d7,0x97db0000cb431f53,0xff1f00ffaf23,0xc703001fff00ff1f,0x7c34f37c70b007f,0xe3872393ff1f00,0xf7530000,0xdf731f1f03,0x97e300000033ff17,0xff1f00001f1fff,0x1fffffe703000000,0xffffffffff1f00ff,0xffffffffff1f00,0x1f00df731f1f0300,0xcf0000ffffffffff,0xffff1f00d77f1f7b,0x1f7bcf0000ffffff,0xffffffff1f00d77f,0xbbaf2397db0000ff,0xffffffffff1f00,0x1f00bbaf2397db00,0xff1f00ff230000ff,0x1f0300000000ff17,0xff1f00df731f,0x731f1f030000ff1f,0xff1f0000ff1f00df,0xdf731f1f030000,0xcb431f53ff17,0x30000df731f1f03,0xf3300df731f1f,0x1f1f03000000f72f,0x872393ff1f00df73,0x1f239bd7000057,0xff1f,0xff1f00ffffffdf67,0x4fefffff,0xffdf670000000000,0xffffdf670000ffff,0xf72f000fff1f00ff,0xff2b000bff1b00,0x1700ff2f000fff17,0xff1b00ffffffffff,0xfff1700ff2b000b,0x7ff1f00f72f00,0x2f000fff1700ff1f,0xff1f0007ff1f00f7,0xf72f000fff1700,0x1700f72f000fff1f,0xc30300ff2f000fff,0xbff1b00034b93cb,0xff1f00ff2b00,0xc3af0b1fff00ff1f,0x17d7db23000007,0xff1f0007ff1f00,0x83ffff1f,0xffffffdf67,0x2bff1b00ffffa300,0xffffff1f000000ff,0x1fffbf37000000ff,0x1f1f1f1fff1f00ff,0x1f1f1f1fff1f00,0x1f00ffffffdf6700,0xff17001f1f1f1fff,0x1fff1f00ffffffff,0xffffff17001f1f1f,0x1f1f1fff1f00ffff,0xf72f000fff17001f,0x1f1f1f1fff1f00,0x1f00f72f000fff17,0xff1f00df830300ff,0xdf6700001fbb8b00,0xff1f00ffffff,0xffffdf670000ff1f,0xff1f0000ff1f00ff,0xffffffdf670000,0x34b93cbc303,0x670000ffffffdf67,0xffffffdf,0xffdf67000000c77b,0x1f0007ff1f00ffff,0xfff1700ef,0xf0000000000ff1f,0xff1f00ff431f67fb,0x31f1f,0x1f67fb0f00000000,0x431f67fb0f00ff43,0xfb2b000bff1f00ff,0xff270007ff1b00,0x1b00ff2b000bff1b,0xff1b001f1f1f33ff,0xbff1b00ff270007,0xff1f00fb2b00,0x2b000bff1b00ff1f,0xff1f0000ff1f00fb,0xfb2b000bff1b00,0x1b00fb2b000bff1f,0x30000ff2b000bff,0x7ff1b00afe7974b,0xff1f00ff2700,0xbbbd34fff00ff23,0x23ebef33000000,0xff1f0000ff1f00,0xf000000e3871f03,0xff431f67fb,0x27ff1f001f6bf70b,0x1fff3b03000000ff,0x1fff1f000000001f,0xff1f00ff,0xff1f00,0x1f00ff431f67fb0f,0xff1b0000000000ff,0xff1f001f1f1f33,0x1f33ff1b00000000,0xff1f001f1f,0xfb2b000bff1b0000,0xff1f00,0x1f00fb2b000bff1b,0xff1f004fefffffff,0x67fb0f00db970700,0xff1f00ff431f,0x431f67fb0f00ff23,0xff230000ff1f00ff,0xff431f67fb0f00,0xf00afe7974b0300,0xfb0f00ff431f67fb,0xb33f0000ff431f67,0x1f67fb0f00003ffb,0x1f0000ff1f00ff43,0xbff1b00ff,0x170000000000ff1f,0xff1f00ff9b0b37ff,0x0,0xb37ff1700000000,0x9b0b37ff1700ff9b,0xc397037bff1f00ff,0xff97037be70000,0xff97037be300,0xe70000b7230b9bdb,0x7be70000ff97037b,0xff1f00c79703,0x97037be70000ff1f,0xff1f0000ff1f00c7,0xc797037be70000,0xc397037bff1f,0x8f1f00ff97037be3,0x7be70000fb57001f,0x74ffb0f00ff9703,0x73efff00ff93,0xbcf674bdb0f0000,0xff1f0000ff1f00,0x17000000ff1f0000,0xff9b0b37ff,0x7feb00000000ff1f,0xff1f00000000ff,0x1fff1f0000000000,0xff1f00ff,0xff1f00,0x1f00ff9b0b37ff17,0xdb000000000000ff,0xff1f00b7230b9b,0xb9bdb0000000000,0xff1f00b723,0xc797037be7000000,0xff1f00,0x1f00c797037be700,0xff1f0000031f1fff,0x37ff1700f73f0000,0x74ffb0f00ff9b0b,0x9b0b37ff1700ff93,0xff93074ffb0f00ff,0xff9b0b37ff1700,0x1700fb57001f8f1f,0xff1700ff9b0b37ff,0x37830000ff9b0b37,0xb37ff17000beb57,0x1f0000ff1f00ff9b,0x37fe30000ff,0xffffffffff1f,0xff1f00ffb7ffffa3,0x0,0xffffa30000000000,0xb7ffffa30000ffb7,0x37efffbfff1f00ff,0xffc3fff74f0000,0xffbffff74f00,0x4f000073f7ffdb37,0xef4f0000ffc3fff7,0xff1f0037f7ff,0xf7ffef4f0000ff1f,0xff1f0000ff1f0037,0x37e7ffef4f0000,0x37efffbfff1f,0x9f0300ffbffff74f,0xf74f000073f3fffb,0xffff830000ffc3ff,0x2fff00ffb7,0xa383000063af0000,0xff1f0000ff1f00,0xff1f0000,0xffb7ffffa3,0xf75f00000000ff1f,0xffffff1f00ffffff,0x1fff1f000000ffff,0xffffffffff1f00ff,0xffffffffff1f00,0x1f00ffb7ffffa300,0x370000ffffffffff,0xffff1f0073f7ffdb,0xffdb370000ffffff,0xffffffff1f0073f7,0x37e7ffef4f0000ff,0xffffffffff1f00,0x1f0037e7ffef4f00,0xff1f0000000000ff,0xffa300008fffff1f,0xffff830000ffb7ff,0xb7ffffa30000ffb7,0xffb7ffff830000ff,0xffb7ffffa30000,0x73f3fffb9f03,0xa30000ffb7ffffa3,0xffb7ffff,0xffffa3000017ff13,0x1f0000ff1f00ffb7,0xffffef470000ff,0x0,0x0,0x0,0x0,0x0,0x0,0xcb9f231f030000,0x0,0x300000000000000,0x7000000cb9f231f,0x63d3,0x63d3070000000000,0x0,0x0,0xff1f,0xff1f000000,0x1f03000000000000,0xcb9f23,0x1fff000000,0x0,0x0,0x1f53ff130000,0x1f03000000000000,0x1f0000000000f36f,0xff,0x1fff1f0000000000,0xff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1f070000,0x0,0x4f03000000000000,0x87df,0x0,0x0,0x0,0x0,0x1f1f1f0000000000,0x1f1f1f,0x0,0x0,0x3bdbffff1f0000,0x0,0x1f00000000000000,0xf0000003bdbffff,0xf7e3,0xf7e30f0000000000,0x0,0x0,0xff1f,0xff1f000000,0xff1f000000000000,0x3bdbff,0x1fff000000,0x0,0x0,0xffef8b000000,0xff1f000000000000,0x1f00000000006feb,0xff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xbf5b0000,0x0,0xabdb730000000000,0x3b,0x0,0x0,0x0,0x0,0xffffff0000000000,0xffffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x73f000000,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4f8b0000,0x0,0xb330000000000,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3000000000000,0x0,0x0,0x0,0xff1f000000000000,0xffff,0x0,0x0,0x0,0x0,0xffffff1f,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x300000b1f0b0000,0x9fab,0x3f0000008fbf0300,0x23f7,0x0,0x17d76bfb37000000,0x0,0x0,0x0,0x1f030000fb43e3bb,0x9fab0300001f1f,0x0,0x8fbf030000000000,0x0,0x23f73f0000,0x1f1f1f03,0xe777d3,0x9fab0300000000,0xbf03000000000000,0x23f73f0000008f,0x0,0xff1f,0x1700000000000000,0xf74fff,0x0,0x0,0x0,0x7000023f73f0000,0x6b539b230000939b,0x8fbf0300000000,0x0,0x0,0xfff37300000000,0x0,0x0,0x0,0x0,0x9f7f00000000,0xaf2bbb030000,0xfb83000000000000,0xfb6f7b,0x0,0xf00000000000000,0xbf0300000043f3d3,0x5f0b008f,0x300000000000000,0xaf2bbb,0x8fbf030000,0x37effff773ff,0x7fab03,0xc7000000008fa300,0x1fff1f000000a34f,0xff,0x37ffbe747000000,0x7f9f000000,0xffffffffff1f,0x1700000000000000,0xff1f0000b3fb57ff,0x7fab03000000ff1f,0x0,0x8fa30000000000,0xff1f000000,0xa347bb0000,0x1b00000000ff1f00,0xff1f000000c3afcf,0x7fab03000000ff1f,0x8fa3000000000000,0xa347bb00000000,0xff1fff1f0000,0xff1f,0x0,0x9bffbb,0x0,0x0,0xff1f00ff1f0000,0xa347bb0000,0xcb4fa30000007393,0x8fa300000017,0x97ffff1f00,0x0,0x1f4ffb0b000000,0xff1f00ffffffe377,0xff1f0000006bf3ff,0xff1f00ff1f0000,0x1f000063f3f77b00,0x9f7f000000ff,0x2ff753000000,0x6bf7000000ff1f00,0xa72f00009fffb3,0x1fff1f000000,0x5300000000000000,0x8fa3000000af93db,0xff1f0000,0xbf17,0x23db002ff753,0x8fa30000,0xc3b30b27dbff,0x1f0300,0x1703000000001f03,0x31f030000001700,0x1f,0x3cf774b77000000,0xf13000000,0x1f1f1f1fff1f,0x300000000000000,0x1f0300000313001f,0x1f03000000001f03,0x0,0x1f0300000000,0x1f03000000,0x1700130300,0x3000000001f0300,0x1f030000000b0717,0x1f03000000001f03,0x1f030000000000,0x17001303000000,0x1f031f030000,0xff1f,0x470f1f0b00,0x1f03,0x1f1f030000000000,0x3,0xff1f00ff1f0000,0x1700130300,0x2b3f13000000070b,0x1f03000027,0xffffffa300,0x0,0xff1f000000,0x1f03001f1f1f5bff,0x1f03000000f7671f,0x1f03001f030000,0x30000f36b4fff13,0x9f7f0000001f,0x1b00000000,0x71f00a71fff33a3,0x3fe76f1f00001f00,0x1fff1f000007,0xb00000000000000,0x1f030000170b17,0xff1f0000,0xff1f,0x7b8300001b00,0x1f0300,0xfb47000053ff,0x2700003bdbffcb27,0xcb2700003bdbffcb,0xffcb2700003bdbff,0xffdfdfdf6f003bdb,0x5bffffd73300003f,0x4fe7ffff1f0000,0xff1f,0xff1f003bdbffcb27,0xd73b000053ebf797,0xffd73b000027cbff,0xcbffd73b000027cb,0x27cbffd73b000027,0x27cbffd73b0000,0x27cbffd73b00,0x3b000027cbffd73b,0xd73b000027cbffd7,0xff1f0027cbff,0x1f0000ff1f00ff1f,0xff1f0000ff1f00ff,0xff1f0000ff1f00,0x27d7fb9fff1f,0x1f00008ff7cff377,0xff1f00004fe7ffff,0xd3dbe31f004fe7ff,0xffdfdfdf6f0000d7,0xff1f00ff1f003f,0xff1f00ffffd73300,0xff1f0000ffef8b,0xffffffffff0000,0xff1f00ff6b43ff1b,0xffffffff00ffef8b,0xffffffff0000ff,0x2b87dfa3,0xff1f000000cbab03,0xff1f00ff1f0000,0xffff00f74f2fff17,0xdbcbc37f00ffffff,0xffffffffff000b,0x1f00001fbbffc327,0xbff7cf5f000000ff,0x1fff1f000017,0xff1f00ffef8bff1f,0xef8bff1f00ffef8b,0xff1f00ff,0x33000000dfdfffc7,0xcf3700ffffd7,0xff1f00,0xff27000023ff,0xcf0000d77f1f7bcf,0x7bcf0000d77f1f7b,0x1f7bcf0000d77f1f,0xc37700000000d77f,0xc393239fd7000003,0xdf731f1f030000,0xffffffffff1f,0xff1f00d77f1f7bcf,0x97db0000e3872393,0x2397db0000bbaf23,0xaf2397db0000bbaf,0xbbaf2397db0000bb,0xbbaf2397db0000,0xbbaf2397db00,0xdb0000bbaf2397db,0x97db0000bbaf2397,0xff1f00bbaf23,0x1f0000ff1f00ff1f,0xff1f0000ff1f00ff,0xff1f0000ff1f00,0x3b00b7af2397ff1f,0x3000013bb3b2bf7,0x1f030000df731f1f,0xaf7b00df731f,0xc377000000000013,0xff1f00ff1f0003,0xff1f001f239bd700,0xff1f00001f2baf,0xaf8f1f1f1f0000,0xff1f00ffcbffd703,0x8f1f1f1f001f2baf,0x1f1fff3b0000af,0x67fbbb5bef,0xf73700000017d79f,0xff1f00ff1f0000,0x1f1f0083ffff9b00,0x2f4ff37f00af8f1f,0xaf8f1f1f1f0087,0x1f00000fabffb713,0x7ff33f00000000ff,0xbfc7ffc7bf000b,0xff1f001f2bafff1f,0x2bafff1f001f2baf,0xff1f001f,0xd70000000000ff1f,0x23e300001f239b,0xff1f00,0x1700ff1f00001fff,0xff1700ffffffffff,0xffff1700ffffffff,0xffffff1700ffffff,0x17df53000000ffff,0xf72b000fff170000,0xffffffdf670000,0x17001f1f1f1fff1f,0xff1f00ffffffffff,0xfff1700ff1f0007,0xfff1700f72f00,0x2f000fff1700f72f,0xf72f000fff1700f7,0xf72f000fff1700,0x1700f72f000fff17,0xff1700f72f000fff,0xfff1700f72f000f,0xff1f00f72f00,0x1f0000ff1f00ff1f,0xff1f0000ff1f00ff,0xff1f0000ff1f00,0x7b00f72f000fff1f,0x6700000013c323b3,0xdf670000ffffffdf,0x5f9ff74700ffffff,0x17df53000000000f,0xff1f00ff1f0000,0xff1f0000000fff17,0xff1f000000000f,0xbc36f00000000,0xff1f001f031f0300,0xc36f00000000000f,0xff1f00000b,0x130000f7630043ff,0x97cf1700000023ff,0xff1f00ff1f0000,0x13170000,0xa77f000bc36f,0xbc36f000000bb,0x1f0000b337ff47af,0xc3470f00000000ff,0x5f73ff735f00af,0xff1f0000000fff1f,0xfff1f0000000f,0xff1f0000,0xff1700000000ff1f,0x7f8f000000000f,0xff1f00,0x1b00ff1f00001fff,0xff1b001f1f1f33ff,0x33ff1b001f1f1f33,0x1f33ff1b001f1f1f,0x2be73700001f1f,0xfb2b000bff1b0000,0xff431f67fb0f00,0x1b0000000000ff1f,0xff1f001f1f1f33ff,0xbff1b00ff1f0000,0xbff1b00fb2b00,0x2b000bff1b00fb2b,0xfb2b000bff1b00fb,0xfb2b000bff1b00,0x1b00fb2b000bff1b,0xff1b00fb2b000bff,0xbff1b00fb2b000b,0xff1f00fb2b00,0x230000ff1f00ff23,0xff230000ff1f00ff,0xff230000ff1f00,0x7f00fb2b000bff1f,0xfb0f00000027cbbb,0x67fb0f00ff431f67,0xcb732b0000ff431f,0x2be73700000be7,0xff1f00ff1f0000,0xff1f0000000bff1b,0xff1f0000000000,0x13d753000000,0xff1f00ffffffbf00,0x13d7530000000000,0xff1f000000,0x1f0000d7679ffb83,0x3abd303000000ff,0xff1f00ff1f0000,0x530000bfffffdf00,0x9f7f000013d7,0x13d7530000bf,0x1f00000300ff1f03,0x33000000000000ff,0x7f8fff8f7f00ff,0xff1f00000000ff1f,0xff1f00000000,0x339f5fff1f0000,0xff1b00339f5fff1f,0xdb3b000000000b,0xff1f00,0xff1f00001fff,0xdb0000b7230b9bdb,0x9bdb0000b7230b9b,0xb9bdb0000b7230b,0x4be31f00b723,0xbf97037bdf000000,0xff9b0b37ff1700,0xff1f,0xff1f00b7230b9bdb,0x7be70000ff1f0000,0x37be70000c79703,0x97037be70000c797,0xc797037be70000c7,0xc797037be70000,0xc797037be700,0xe70000c797037be7,0x7be70000c797037b,0x74ffb0f00c79703,0x93074ffb0f00ff93,0xff93074ffb0f00ff,0xff93074ffb0f00,0x4300c397037bff1f,0xff17000700005bff,0x37ff1700ff9b0b37,0x700001300ff9b0b,0x4be31f0027ff,0xff1f00ff1f0000,0xff1f0000037fe300,0xff1f0000000000,0x1be3530000,0xff1f001f1f1f1700,0x1be35300000000,0xff1f000000,0x300007fef9b3700,0x2fff1b0000001f,0xff1f00ff1f0000,0xe35300171f1f1b00,0x9f7f0000001b,0x1be35300bf,0x1f000000001f0300,0x67000007000000ff,0x7f8fff8f7f00eb,0xff1f00000000ff1f,0xff1f00000000,0x9fb3efff1f0000,0xe300009fafefff1f,0x2fe700000000037f,0xff1f00,0xff1f00001fff,0x37000073f7ffdb37,0xdb37000073f7ffdb,0xffdb37000073f7ff,0xbfbfbff39b0073f7,0x27e3ffef3b00002f,0xffb7ffffa30000,0xffffffffff1f,0xff1f0073f7ffdf37,0xef4f0000ff1f0000,0xffef4f000037e7ff,0xe7ffef4f000037e7,0x37e7ffef4f000037,0x37e7ffef4f0000,0x37e7ffef4f00,0x4f000037e7ffef4f,0xef4f000037e7ffef,0xffff83000037e7ff,0xb7ffff830000ffb7,0xffb7ffff830000ff,0xffb7ffff830000,0x7f0037efffbfff1f,0xa300005bd3bfefbf,0xffa30000ffb7ffff,0xd7abdb7b00ffbbff,0x4ff39b0003bf,0xff2300ff1f0000,0xff1f00ffffef4700,0xff1f0000000000,0xfffffffffb0000,0xff1f000000000000,0xfffffffb00000000,0xff1f0000ff,0x1f0000fb631f1f1f,0xffffa700000000ff,0xff1f00ff1f00ff,0xfffb000000000000,0x9f7f00ffffff,0xfffffffffb00bf,0x1f00000000000000,0xf3c3c79b000000ff,0x1fff1f000053,0xff1f00000000ff1f,0xff1f00000000,0x5fefdbfb0f0000,0x47000067ebe3f70b,0x839b000000ffffef,0xff1f00,0xff1f00000000,0x0,0x0,0x0,0xdf00000000000000,0x3f,0x0,0x9b970b0000,0x63bf1b00,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4b0000000000ff1f,0xf1f0b00,0x0,0xcbab0f000063d307,0x53ef3f0000000b,0xd3932303000000,0x0,0x0,0x0,0x1f07000000000000,0x0,0xeb5f1b0000,0x5fdbffffff,0x0,0xf35b0300000000,0x0,0x0,0x0,0x0,0x31f170000000000,0x1fff1f000000,0x0,0x0,0xf1fb7330000,0xf23b72f,0xdb43000000000000,0x0,0xff1f00000000,0x0,0x0,0x0,0xebb39f0000000000,0xf,0x0,0xb3fb370000,0x77ff7300,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xff1f,0x0,0x0,0xb303000000f7e30f,0x8bf32700000033cf,0x3bdfff1f00002f,0x0,0x0,0x0,0xbf5b000000000000,0x0,0x67f3df0000,0x0,0x0,0x77fb1f00000000,0x0,0x0,0x0,0x0,0x0,0x1fff1f000000,0x0,0x0,0x0,0x0,0x0,0x0,0x3f0700000000,0x0,0x0,0x0,0x173f3f0000000000,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x300000000000000,0x932b000000006373,0x77,0x0,0x0,0x0,0x4f8b000000000000,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x73f07000000,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x70000ffff1f0000,0x938700008b53bf,0xbc7330000,0x0,0x0,0x0,0x0,0x35b0300,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffffff009bffbb00,0x0,0x0,0x0,0x0,0x0,0x0,0xff1f00,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x700001f1f030000,0x35b030017000f,0x233b000000,0x0,0x8fbf0300,0x1f00fff77f000000,0xfff37300000000ff,0xff1f00,0x0,0x2bbb030000000000,0xaf,0x0,0x8300000000000000,0xdff7,0x0,0x0,0xff1f00000000,0xff1f0007c7f75700,0x0,0x9f8f0000000000,0x0,0xaf2baf00,0xf74fff00,0x3cf0700009f8f00,0xff1f00cb0f0000,0x1f1f1f00001f0300,0x0,0xaf2baf0023f73f00,0x23f73f00,0xff1f0000000000,0x0,0x0,0x1f0300,0xff1f0000,0x0,0x0,0xff1f0000,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xff1f000000ff1f,0xff1f00000000,0xff1f001fff00,0xbf170000ff1f0000,0x1fff1fff000000,0xffff1f00008fa300,0x1f001f3ffb0b0000,0x1f4ffb0b00ff1fff,0xff1f000000ff1f00,0xb3ffff1f00c7ff,0xf753000087fba700,0x1f00ffffff1f002f,0xff1fff1f00ff1fff,0xfb0f000000ff1f00,0x1b43,0x4300000000000000,0x1f001fbf000000db,0xff1fff1f000000ff,0xff1f003bef87bb00,0xff1f000000,0x7fab0300ff1fff1f,0xff1f0000000000,0xff1f002ff74f00,0xff1f009bffbb00,0x4ba300007fab0300,0xff1f00836b0000,0xff1f0000ff1f00,0xffffff00ffff1f00,0x2ff74f00a347ab00,0xffff1f00a347ab00,0xff1f00ff1f0000,0x1fff00ff1fff00,0xff1f00ff1f00ff1f,0xff00000000ff1f00,0xff1f00ff1f001f,0xff1f00ff1f00ff1f,0x1f00ff1f00000000,0xff1f00ff,0xff1f000000,0xff00ff1f00000000,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xff1f000000ff1f,0xff1f00000000,0xff1f001fff00,0xff1f0000ff1f0000,0x1fff1fff000000,0xff3b030000001f03,0x1f000000ff1f0000,0xff1f00ff1fff,0x3b03000000ff1f00,0xeb631f0300a7ff,0x1b000000fb6bff1b,0x3001f1f1f030000,0xff1fff1f001f031f,0xff1f000000ff1f00,0x0,0x9b00000000000000,0x1f001fbf00000083,0x1f03ff1f000000ff,0xff1f000b1b0b1700,0xff1f000000,0x1f030000ff1fff1f,0x1f030000000000,0xff1f00001b0000,0xff1f00001f0300,0xa36b00001f030000,0xff1f004bc30000,0xff1f0000ff1f00,0x1f1f1f00ff3b0300,0x1b000017001300,0x1fff1f0017001300,0xff1f00ff1f0000,0x1fff001f031f00,0xff1f00ff1f00ff1f,0xff00000000ff1f00,0x1f0300ff1f001f,0x1f03001f0300ff1f,0x1f00ff1f00000000,0xff1f00ff,0xff1f000000,0xff00ff1f00000000,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffffff000000ff1f,0xff1f000000ff,0xff1f001fff00,0xffc70000ff1f0000,0x1fff1fff00dfdf,0xff1f000000000000,0x1f000000ffff0000,0xffffffff001f03ff,0x300000000ff1f00,0x77e35f0000f75b,0xabffcf03,0x0,0xffffffff00000000,0xffff00ffffffff00,0xffff,0xe700000000000000,0xff001fbf0000002f,0xff1fff1f00ffffff,0xff1f000000ff1f00,0xffffffff00ff1f,0xff1f0000ff1fff1f,0xff1f0000000000,0xff1f0000ff1f00,0xff1f0000ff1f00,0xd73b000000000000,0xff1f001bf70000,0xff1f0000ff1f00,0xff1f00ff1f0000,0xff1f0000ff1f00,0xff1f0000ff1f00,0xafff1f00ff1f0000,0x1fff0000ff1f00,0xff1f00ff1f00ff1f,0xff00ff1f00ff1f00,0xff1f00ff1f001f,0xdf0000ff1f00ff1f,0x1f00ff1f00ff1f00,0xff1f00ff1f00ff,0xff1f00ff1f,0xff00ff1f00000000,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1fff3b000000ff1f,0xff1f0000001f,0xff1f001fff00,0xff1f0000ff1f0000,0x1fff1fff000000,0xffff1f0000000000,0x1f000000ff3b00ff,0x1f1fff3b000000ff,0xff1f000000ff1f00,0xffffff1f00b7ff,0x1f0300,0x0,0x1f1fff3b00000000,0xff3b001f1fff3b00,0x1f1f,0xdb3b000000000000,0x3b001fbf00000000,0xff1fff1f001f1fff,0xff1f000000ff1f00,0x1f1fff3b001f03,0xff1f00001f031f03,0xff1f0000000000,0xff1f0000ff1f00,0xff1f0000ff1f00,0xff1f000000000000,0xffffff0000ff1f00,0xff1f0000ff1f00,0xff1f00ff1f0000,0xff1f0000ff1f00,0xff1f0000ff1f00,0x23ff6700ff1f0000,0x1fff0000ff1f00,0xff1f00ff1f00ff1f,0xff00ff1f00ff1f00,0xff1f00ff1f001f,0xfb1b00ff1f00ff1f,0x1f00ff1f00ff1f00,0x1f0300ff1f00ff,0xff1f001f03,0xff001f0300ff1f00,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xff1f000000ff1f,0xff1f00000000,0xff1f001fff00,0xff1f0000ff1f0000,0x1fff1fff000000,0x1f1f030000000000,0x1f000000ff1f001f,0xff1f000000ff,0x1f03000000ff1f00,0x1f1f1f0300001b,0x0,0x0,0xff1f00000000,0xff1f000000ff1f00,0xffffff1f000000,0x7f8f0000ffffff1f,0xff001fbf00000000,0xff1fff1f0000ffff,0xff1f000000ff1f00,0xff1f000000,0xff1f000000000000,0xff1f0000000000,0xff1f0000ff1f00,0xffffff0000ff1f00,0xff1f000000000000,0x1fff3b0000ff1f00,0xff1f0000ff1f00,0xff1f00ff1f0000,0xff1f0000ff1f00,0xff1f0000ff1f00,0xff8f00ff1f0000,0x1fff0000ff1f00,0xff1f00ff1f00ff1f,0xff00ff1f00ff1f00,0xff1f00ff1f001f,0xff1f00ff1f00ff1f,0x1f00ff1f00ff1f00,0xff1f00ff,0x1f03000000,0xff000000001f0300,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xff1f000003ff1f,0xff1f00000000,0xff1f001fff00,0xff1f0000ff1f0000,0x1fff1fff000000,0x0,0x1f000000ff1f0000,0xff1f000000ff,0xff1f00,0x0,0x0,0x0,0xff1f00000000,0xff1f000000ff1f00,0x1f1f1f03000000,0x23e300001f1f1f03,0x3b001fbf00000000,0xff1fff1f00001fff,0xff1f000000ff1f00,0xff1f000000,0xff1f000000000000,0xff1f0000000000,0xff1f0000ff1f00,0x1fff3b0000ff1f00,0xdf37000000000000,0xff1f0017fb0300,0xff1f0000ff1f00,0xff1f00ff1f0000,0xff1f0000ff1f00,0xff1f0000ff1f00,0xff1f00ff1f0000,0x1fff0000ff1f00,0xff1f00ff1f00ff1f,0xff00ff1f00ff1f00,0xff1f00ff1f001f,0xff1f00ff1f00ff1f,0x1f00df0000ff1f00,0xff1f00ff,0xff1f000000,0xdf00000000000000,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x17ff1b000063f703,0xff1f00000000,0xff1f001fff00,0xff170000ff1f0000,0x1fff1fff00000f,0x0,0x1f000000ff1f0000,0xff1f000000ff,0xff1f00,0x0,0x0,0x0,0x17ff1b00000000,0xff1b000017ff1b00,0x17,0xcf370000000000,0x1f001fbf00000000,0xff1fff1f000013ff,0xff1f000000ff1f00,0x17ff1b000000,0xff1f000000000000,0xff1f0000000000,0xff1f0000ff1f00,0xff1f0000ff1f00,0xab63000000000000,0xff1f0043cb0000,0xff1f0000ff1f00,0xff1f00ff1f0000,0xff1f0000ff1f00,0xff1f0000ff1f00,0xff1f00ff1f0000,0x1fff0000ff1f00,0xff1f00ff1f00ff1f,0xff00ff1f00ff1f00,0xff1f00ff1f001f,0xff1f00ff1f00ff1f,0x1f001b0000ff1f00,0xff1f00ff,0xff1f000000,0x1b00000000000000,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffbf0000fff76b00,0xff1f000000ff,0xff1f001fff00,0xbb000000ff1f0000,0x1fff1fff00dfeb,0x0,0x1f000000ff1f0000,0xff1f000000ff,0xff1f00,0x0,0x0,0x0,0xffffbf0000000000,0xbf0000ffffbf0000,0xffff,0x7b830000000000,0x1fcb00000000,0xff1fff1f00ffffcf,0xff1f000000ff1f00,0xffffbf00000000,0xff1f000000000000,0x1fff1f00031f0300,0x1fff1f0000ff1f00,0xff1f0000ff1f00,0x579b000000000000,0xff1f007b770000,0xff1f0000ff1f00,0xff1f00ff1f0000,0xff1f0000ff1f00,0xff1f0000ff1f00,0xff1f00ff230000,0x1fff0000ff1f00,0xff1f00ff1f00ff1f,0xff00ff1f00ff1f00,0xff1f00ff1f001f,0xff1f00ff1f00ff1f,0x1f00ff1f00ff1f00,0xff1f00ff1f00ff,0xff1f00ff1f00ff1f,0xff00000000000000,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1fff1fff00ff1f,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1f07000000,0x0,0x23db0000000000,0x3ef3f0f0000,0xf35b030000000000,0x0,0xbb7f0300000000,0x0,0x63d30700bb7f0300,0x63d3070000f35b00,0x0,0x3cf070000000000,0xcb0f0000,0x0,0xff3b0300,0xf35b00,0x1fff1f0000000000,0xd3931f00,0x0,0xff1f000000,0xff00000000000000,0xf35b001f07001f,0x0,0xf35b00,0xff1f0000000000,0xff1f000000,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2700000000000000,0x1fff1fff00bfcb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xbf5b000000,0x0,0x0,0x77f77f0000,0x77fb1f0000000000,0x0,0xd3f71b00000000,0x0,0xf7e30f00d3f71b00,0xf7e30f000077fb00,0x0,0x0,0x0,0x0,0xffff1f00,0x77fb00,0xffff1f0000000000,0x3bdfff00,0x0,0xff1f000000,0xff00000000000000,0x77fb00bf5b001f,0x0,0x77fb00,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xf00000000000000,0x73f073f00073b,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4f8b000000,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xff1f000000,0x3f00000000000000,0x4f8b0007,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+static const unsigned char dejavu_pixel_data[] = {
+21,0,1,0,54,83,247,47,13,0,15,1,0,22,63,187,71,163,54,0,32,15,1,0,82,79,31,255,255,255,46,0,23,79,67,239,231,27,176,0,107,
+15,127,0,12,78,3,187,43,175,21,0,57,19,0,23,17,0,40,11,95,1,1,15,52,0,2,47,0,31,23,1,24,8,80,0,15,1,0,28,79,3,31,31,31,43,
+0,20,95,19,31,23,179,155,44,0,20,63,23,31,7,180,0,13,47,215,111,161,0,19,33,191,143,37,2,34,211,107,45,2,79,255,255,255,
+231,17,0,7,2,33,3,5,14,0,6,1,0,111,87,199,243,255,227,115,92,1,0,37,31,255,85,3,127,95,195,247,255,211,123,11,128,1,7,16,
+255,43,1,35,255,63,14,0,50,83,195,243,127,0,15,172,1,7,23,207,33,0,98,63,255,0,0,95,223,91,0,5,244,2,4,33,0,7,1,0,17,31,
+15,0,43,131,187,33,0,114,31,191,251,223,243,255,99,33,0,22,199,33,0,15,55,0,1,128,35,199,243,231,255,255,247,147,12,0,52,
+103,235,243,105,1,68,119,231,255,223,42,2,37,3,191,127,1,160,7,247,27,99,187,0,0,23,239,19,185,1,177,239,23,0,123,247,239,
+95,0,95,219,3,30,0,32,163,143,92,0,81,31,35,99,243,107,45,2,79,31,55,239,59,17,0,7,2,33,3,6,14,0,1,1,0,66,51,215,255,175,
+43,1,1,116,0,96,23,23,31,255,0,31,109,0,4,104,1,1,85,3,146,3,171,235,115,43,35,91,207,215,26,0,6,84,1,16,23,61,3,1,48,0,
+9,128,1,96,99,243,115,43,59,255,129,0,0,44,0,20,27,80,0,8,1,0,53,59,231,63,33,0,7,128,1,6,244,2,5,33,0,8,113,2,122,59,255,
+0,0,39,247,39,33,0,130,3,211,171,15,0,3,91,75,33,0,21,167,33,0,15,55,0,1,244,2,3,215,171,7,0,99,255,43,251,51,0,0,15,251,
+103,51,191,127,1,113,87,31,99,243,99,79,247,117,1,6,73,4,64,63,203,0,179,44,1,242,0,163,119,0,0,0,123,155,0,0,255,79,107,
+243,3,219,170,1,16,3,156,0,1,12,1,34,103,211,56,3,47,207,91,17,0,7,2,16,3,11,14,0,97,0,215,255,255,83,115,12,0,177,227,0,
+0,0,147,243,215,191,255,191,211,22,2,68,59,227,247,163,97,2,34,107,227,135,1,42,183,155,24,0,7,48,0,5,128,1,0,4,0,20,227,
+119,0,0,7,0,112,187,223,247,119,0,55,59,11,0,213,151,247,235,87,151,247,235,79,0,0,0,171,123,33,0,6,128,1,152,31,255,255,
+227,99,199,255,215,59,33,0,8,22,0,0,19,0,34,195,135,23,0,5,33,0,54,75,247,15,107,1,36,91,247,33,0,137,59,215,255,203,87,
+203,255,219,55,0,1,44,0,48,31,255,0,237,2,66,31,255,27,0,201,2,154,0,235,87,0,0,0,115,211,211,132,0,18,127,232,0,241,3,255,
+0,0,51,223,0,0,3,231,43,0,0,255,47,79,247,99,215,54,0,33,51,215,124,3,0,132,0,17,39,137,0,52,3,183,131,145,1,15,17,0,0,0,
+90,2,43,143,175,14,0,98,23,255,255,255,31,43,102,0,240,4,19,0,67,239,23,0,135,255,103,0,51,251,31,0,0,215,151,35,175,96,
+2,233,143,175,0,0,227,87,0,135,251,187,255,0,51,243,24,0,8,48,0,83,255,199,191,191,191,128,1,52,27,255,11,0,5,176,0,31,255,
+95,0,75,243,0,27,219,123,128,1,32,35,131,4,0,103,223,0,0,27,243,23,17,2,4,128,1,152,3,31,31,115,255,123,31,127,211,33,0,
+7,22,0,0,18,0,34,95,227,6,5,6,33,0,112,123,203,0,0,23,63,63,223,2,68,31,255,255,183,33,0,16,219,169,0,72,123,31,127,215,
+55,0,0,44,0,4,128,1,51,19,251,195,154,3,1,177,0,89,0,43,251,11,11,132,0,97,15,31,203,95,63,223,131,3,208,199,75,0,91,183,
+0,0,0,155,255,255,131,231,64,2,99,0,0,215,155,35,31,94,1,17,35,111,1,37,151,167,29,4,15,17,0,3,59,111,195,11,14,0,98,27,
+255,255,255,35,39,128,1,242,5,23,0,123,171,0,0,43,255,7,0,0,211,87,0,23,255,15,0,47,255,38,0,185,23,255,11,19,255,79,107,
+255,0,47,247,24,0,8,48,0,83,255,87,63,63,63,128,1,16,31,20,0,20,31,95,4,17,3,116,0,33,71,235,23,0,2,4,0,70,0,0,135,155,33,
+0,6,128,1,37,103,223,114,2,6,33,0,7,22,0,128,3,31,31,51,235,79,0,99,191,0,6,33,0,129,127,199,0,0,83,223,243,159,19,4,35,
+27,19,33,0,2,169,0,7,55,0,65,31,255,255,179,44,0,4,128,1,128,183,115,123,227,59,0,83,235,17,0,0,147,7,2,181,2,7,132,0,80,
+0,7,247,23,95,87,0,113,0,0,87,179,0,203,71,114,5,113,19,111,207,123,247,243,95,96,0,4,94,1,32,91,219,63,3,17,199,226,1,15,
+17,0,7,16,111,191,5,10,14,0,97,0,227,255,255,99,103,111,0,81,235,0,0,127,167,27,3,65,0,0,207,91,19,2,36,43,255,52,0,153,
+7,23,255,47,79,255,39,195,167,24,0,8,48,0,9,128,4,39,235,75,128,4,2,4,0,18,35,234,2,3,4,0,37,7,235,91,7,0,18,0,18,67,128,
+1,112,15,251,103,31,71,255,51,84,1,7,33,0,7,22,0,0,129,2,104,183,0,79,231,255,0,33,0,32,83,243,62,1,18,159,41,1,5,33,0,17,
+31,169,0,7,55,0,66,3,31,99,235,44,0,2,128,1,208,27,255,19,0,91,247,127,223,123,0,0,0,243,92,1,1,181,5,7,110,0,3,194,8,16,
+255,238,5,50,3,227,87,211,5,64,0,15,235,87,5,6,3,52,3,0,76,0,130,3,67,231,127,0,0,83,227,73,10,15,17,0,6,17,111,32,11,10,
+14,0,97,0,71,239,255,207,219,102,0,243,6,131,0,0,75,231,11,0,115,255,83,0,35,251,39,0,0,227,123,3,151,255,38,0,169,239,71,
+0,167,255,215,255,239,139,11,24,0,8,48,0,1,128,1,199,243,91,0,31,255,43,0,0,123,231,83,11,128,1,48,11,255,23,126,8,7,128,
+1,64,99,207,31,31,21,7,0,81,2,240,2,255,35,0,147,255,23,0,171,223,0,23,255,55,11,175,255,155,216,0,9,33,0,5,22,0,96,0,0,
+59,247,35,19,48,8,8,33,0,114,7,227,147,3,0,0,163,128,1,5,33,0,32,0,231,169,0,6,55,0,80,0,0,95,227,119,44,0,49,0,0,75,128,
+1,128,11,239,147,11,27,179,255,171,32,0,96,135,215,55,0,67,231,106,7,7,110,0,130,3,31,147,163,31,235,79,31,185,4,16,247,
+96,9,80,0,0,0,127,191,140,2,80,247,0,0,227,127,7,6,0,165,1,65,243,139,3,0,117,0,2,80,5,15,17,0,3,0,107,4,13,14,0,160,0,0,
+7,31,3,31,171,251,255,247,195,0,244,2,3,179,223,183,211,255,207,179,231,139,0,0,0,79,247,255,191,137,3,113,139,203,15,0,
+27,3,27,56,11,7,24,0,8,48,0,1,128,1,65,135,247,191,231,82,8,36,115,227,197,3,1,135,1,66,167,235,231,219,106,4,3,4,0,37,207,
+79,33,6,128,0,183,227,207,159,207,223,207,252,6,80,155,255,255,211,115,217,2,9,33,0,6,22,0,169,0,3,215,131,0,3,31,59,255,
+31,33,0,113,39,219,231,191,207,239,91,243,6,5,33,0,81,0,79,239,255,231,136,0,2,22,0,3,219,10,97,59,223,219,199,251,155,128,
+4,242,2,59,215,255,255,203,63,195,167,19,0,0,3,151,251,255,247,127,64,3,6,110,0,64,0,191,67,59,151,8,1,6,2,18,223,54,12,
+48,15,239,63,35,0,17,123,187,2,15,8,13,24,15,1,0,19,6,80,10,10,193,9,107,191,223,103,39,47,147,87,11,13,176,10,0,178,6,15,
+108,10,1,15,1,0,12,0,160,10,22,31,195,8,15,1,0,33,15,120,0,25,15,128,13,15,15,1,0,127,96,3,107,211,255,247,191,98,11,12,
+1,0,15,12,15,25,15,1,0,255,66,20,7,243,14,15,1,0,255,255,138,33,131,251,9,12,15,1,0,102,15,100,21,39,13,58,0,35,59,207,132,
+18,49,0,0,135,196,17,4,1,0,81,23,255,87,251,179,10,0,37,31,255,20,5,59,191,35,211,194,19,34,187,255,167,19,15,92,21,9,5,
+63,0,59,79,131,163,83,22,4,63,0,15,1,0,24,66,19,31,23,251,177,13,15,1,0,15,12,5,7,16,63,183,9,15,100,0,19,15,70,0,0,19,11,
+9,0,3,100,21,26,11,105,21,15,1,0,0,13,44,21,6,158,21,5,138,0,20,59,146,0,35,3,91,60,16,3,15,0,50,31,0,19,17,0,33,3,31,153,
+17,0,10,0,44,23,3,116,0,5,27,0,15,92,21,8,4,36,0,75,0,19,3,7,18,1,5,27,0,5,1,0,211,231,23,0,7,215,0,0,55,223,0,31,255,159,
+253,1,32,3,203,42,7,161,79,195,3,0,0,23,191,247,223,247,28,10,32,159,251,173,9,35,211,75,10,0,11,4,21,112,0,119,227,255,
+219,99,203,194,0,82,51,191,251,247,179,230,0,3,127,2,1,17,2,12,105,7,6,21,0,1,127,20,40,215,51,70,0,0,181,18,89,7,215,247,
+151,3,160,0,1,1,0,16,191,54,0,4,170,0,9,110,0,15,204,7,0,20,131,219,17,4,9,3,5,168,20,8,177,20,3,194,0,3,18,0,81,87,203,
+251,255,207,43,8,15,36,0,7,4,9,0,0,114,0,33,43,231,199,20,5,36,0,111,83,203,251,251,203,83,9,0,9,2,45,0,2,6,0,227,167,87,
+0,63,255,35,0,119,159,0,31,255,243,43,214,0,130,39,223,19,0,27,219,27,0,27,20,226,11,131,27,0,0,27,235,51,255,31,31,39,131,
+243,10,0,4,4,21,4,156,20,0,1,20,32,115,255,133,22,113,63,251,135,43,47,155,243,45,20,3,127,2,3,107,1,2,30,20,5,127,1,5,21,
+16,6,127,20,5,70,0,136,27,231,39,0,139,175,7,71,160,0,65,0,99,183,67,228,20,4,170,0,0,77,2,7,110,0,1,204,10,11,1,0,34,223,
+231,246,12,4,138,0,2,168,20,23,83,9,0,5,59,1,145,107,99,31,87,243,255,83,0,91,26,0,41,251,55,36,0,48,0,0,11,117,10,13,63,
+0,65,31,255,0,59,110,20,6,123,0,127,95,243,103,39,39,95,215,9,0,9,8,128,1,228,107,151,0,127,247,103,0,175,95,0,31,255,135,
+179,86,2,64,103,171,3,191,83,15,6,27,20,32,11,71,25,0,51,7,103,235,10,0,0,110,15,1,156,20,2,249,23,112,235,87,0,3,183,195,
+195,87,18,241,0,131,99,227,255,255,155,183,0,103,179,0,43,247,19,0,43,1,1,111,0,39,211,223,20,0,32,3,87,125,17,56,59,255,
+59,127,20,6,70,0,65,95,203,59,231,219,1,6,160,0,68,0,0,131,207,128,1,5,170,0,236,215,163,255,255,243,135,155,183,0,0,151,
+243,211,191,128,1,48,59,251,67,77,0,32,79,207,159,1,36,243,35,168,20,23,203,9,0,5,59,1,0,100,5,81,99,255,203,0,207,26,0,
+38,255,163,36,0,96,147,139,0,0,43,239,14,0,13,63,0,65,31,255,75,239,121,23,33,3,31,158,21,17,83,108,20,0,215,9,15,9,0,9,
+8,128,1,128,47,215,0,191,151,179,0,239,95,14,50,15,235,63,214,0,32,31,255,164,14,4,239,19,9,178,2,0,15,2,4,35,21,3,156,20,
+3,1,20,65,167,143,43,247,15,16,245,0,251,107,31,31,47,247,0,39,235,0,139,255,107,31,247,0,3,39,11,11,20,0,34,0,63,255,2,
+23,31,127,20,6,70,0,66,0,0,179,247,121,2,6,160,0,0,71,23,4,128,1,4,170,0,147,23,255,51,255,31,95,255,47,247,76,21,8,90,3,
+97,0,0,0,143,175,0,65,7,0,237,14,38,139,159,168,20,6,9,0,5,8,1,16,27,196,4,66,23,255,251,0,26,0,38,255,215,36,0,143,43,235,
+7,0,151,147,35,51,63,0,0,69,31,255,251,103,31,1,68,147,35,135,227,215,17,4,108,0,15,9,0,2,8,128,1,113,0,239,31,235,27,243,
+47,185,22,50,0,107,207,128,1,80,3,31,95,255,55,185,0,1,239,19,5,97,0,64,31,31,39,155,80,2,4,4,21,4,156,20,0,91,0,49,3,143,
+163,1,20,82,27,255,31,255,75,219,0,121,239,35,235,171,203,79,203,0,6,5,20,0,17,0,253,24,0,233,15,6,127,20,6,70,0,52,0,0,
+67,185,15,5,160,0,1,70,7,1,80,8,6,170,0,32,27,255,253,22,51,131,43,251,76,21,3,139,2,1,1,0,112,0,0,3,235,83,0,115,22,16,
+103,95,207,0,15,235,35,168,20,7,9,0,4,232,16,0,239,0,67,19,255,255,0,26,0,23,219,213,20,49,199,91,11,226,4,15,63,0,1,35,
+171,215,163,7,3,154,21,2,7,0,1,57,17,15,9,0,8,7,128,1,97,179,151,171,0,203,167,209,6,68,0,3,215,123,0,3,2,65,2,2,27,20,7,
+182,1,1,122,22,4,4,21,2,43,0,146,95,159,55,0,0,235,167,179,3,1,20,242,2,227,111,127,247,255,255,135,195,0,0,175,163,219,
+11,243,167,147,203,21,0,124,22,23,0,20,0,1,52,22,0,212,1,2,100,0,72,139,219,219,39,70,0,34,0,63,114,1,7,160,0,0,21,0,36,
+239,207,4,20,3,170,0,131,227,143,255,35,135,159,135,195,76,21,55,95,159,51,0,3,16,67,7,0,0,202,21,65,3,223,79,115,66,0,5,
+168,20,4,9,0,17,3,4,2,0,125,1,0,128,4,81,83,255,211,0,219,26,0,0,87,19,5,45,0,50,87,199,103,232,26,13,63,0,82,31,255,3,171,
+215,212,8,4,158,18,33,239,71,65,18,15,9,0,9,9,128,1,99,119,247,103,0,135,251,204,7,35,75,239,0,3,0,149,0,5,27,20,21,99,70,
+7,32,7,131,151,2,4,4,21,2,115,0,131,239,171,159,0,0,147,251,67,1,20,97,83,251,111,23,47,159,192,6,80,255,115,0,147,255,160,
+3,80,215,151,11,19,175,127,24,7,20,0,5,128,1,7,127,20,6,70,0,6,128,1,5,160,0,1,21,0,16,59,20,23,7,170,0,131,83,255,143,11,
+15,155,251,55,76,21,55,239,179,159,0,3,96,159,135,31,31,35,243,13,27,49,111,207,227,36,9,5,168,20,6,177,20,4,8,1,145,111,
+67,0,55,231,255,107,0,111,26,0,39,255,71,36,0,49,7,235,223,186,5,14,63,0,0,10,1,33,143,231,175,28,4,128,1,111,123,231,71,
+7,3,71,9,0,10,9,128,1,48,55,255,31,12,4,3,16,0,34,191,255,123,25,4,208,7,99,39,219,227,191,227,207,42,24,0,230,23,0,167,
+8,4,35,21,1,171,1,178,243,227,235,107,0,15,195,135,247,255,243,1,20,80,79,223,255,255,211,245,0,48,55,247,19,66,23,0,8,7,
+65,223,255,255,207,166,0,6,20,0,5,128,1,6,127,20,8,70,0,5,128,1,5,160,0,2,21,0,35,67,183,244,4,18,191,42,8,5,110,0,119,175,
+223,183,199,251,219,239,48,10,16,7,114,7,48,0,163,151,11,0,18,235,65,3,5,168,20,7,177,20,3,235,0,5,18,0,80,119,235,255,255,
+235,34,2,6,36,0,35,139,231,27,12,12,63,0,1,60,0,2,129,1,4,128,1,96,0,123,235,255,255,227,149,7,15,9,0,6,2,162,3,3,210,24,
+10,1,0,51,3,35,147,40,24,4,1,0,31,19,91,20,11,48,39,183,35,128,21,15,28,13,14,15,1,0,10,3,127,20,15,70,0,18,21,43,171,0,
+17,91,251,7,5,1,0,79,23,23,51,183,172,0,4,53,31,39,203,55,0,15,1,0,33,16,163,81,23,15,1,0,4,31,7,228,34,16,15,36,0,0,1,105,
+1,14,128,1,48,31,255,223,77,2,15,1,0,145,32,31,251,85,32,15,1,0,18,35,255,251,253,24,15,1,0,34,63,39,179,243,100,1,8,19,
+91,3,33,15,1,0,9,15,36,0,0,15,105,1,152,15,1,0,109,47,15,63,154,38,9,31,139,157,17,16,15,36,0,17,15,1,0,255,184,15,120,41,
+27,15,1,0,141,15,23,43,35,15,1,0,105,15,120,41,24,15,1,0,57,25,31,208,20,15,1,0,23,17,23,150,14,63,19,31,15,97,21,4,7,125,
+4,0,177,41,15,1,0,50,11,86,13,6,137,7,10,191,41,3,2,42,5,1,0,83,191,255,255,159,95,154,13,6,203,19,1,1,20,15,91,20,10,14,
+10,20,12,36,0,7,73,20,0,44,5,16,127,99,0,15,109,20,1,3,6,0,13,108,0,111,7,59,39,155,223,67,135,0,3,14,9,0,5,162,3,99,43,
+255,139,7,195,55,231,21,36,231,91,220,21,1,26,7,19,143,83,41,86,171,239,255,219,111,177,41,9,243,1,4,43,24,5,90,0,16,99,
+57,12,1,26,0,2,210,14,14,1,0,98,255,31,0,11,203,235,38,0,5,113,1,5,152,22,8,161,22,5,2,42,6,43,2,96,155,231,47,19,183,215,
+140,33,6,203,19,2,1,20,15,91,20,2,3,1,0,14,10,20,9,36,0,56,15,79,247,73,20,16,207,37,32,31,255,109,20,3,3,177,0,13,27,0,
+96,23,227,171,47,0,111,215,16,14,135,0,15,153,0,0,5,162,3,83,139,199,235,167,95,231,21,51,163,195,27,220,21,32,155,215,127,
+1,33,199,63,199,44,97,183,191,55,31,83,191,38,29,4,29,1,20,15,107,3,4,43,24,81,119,231,83,31,107,177,18,34,191,231,232,22,
+3,163,21,15,128,1,2,84,23,207,171,55,159,173,3,5,213,0,2,192,19,5,52,41,16,123,132,0,4,2,42,34,203,111,155,3,136,47,251,
+47,0,0,11,219,123,203,19,3,1,20,15,91,20,9,14,10,20,6,64,20,3,25,21,5,72,0,96,31,255,231,79,0,127,1,37,15,109,20,0,4,5,1,
+13,27,0,96,59,247,11,0,0,131,173,18,14,135,0,13,9,0,6,15,21,64,3,231,51,223,159,13,0,131,21,52,119,175,3,230,21,0,131,14,
+161,143,183,11,0,23,203,111,0,0,215,216,2,23,7,54,0,104,135,239,215,255,255,199,18,0,0,248,20,128,0,131,203,0,0,27,251,67,
+138,0,5,163,21,1,244,44,55,0,47,247,218,4,51,255,67,215,125,1,1,1,42,7,128,1,0,192,19,1,15,0,81,19,103,195,247,171,130,24,
+2,2,42,161,3,83,179,247,187,91,11,0,0,139,200,10,40,119,207,203,19,3,1,20,15,91,20,2,2,30,2,15,10,20,5,1,64,20,3,25,21,5,
+72,0,112,31,255,103,207,15,239,103,91,19,14,109,20,3,195,0,15,108,0,0,64,147,219,163,191,66,18,14,27,0,15,45,0,0,4,15,21,
+80,0,75,211,91,235,117,28,82,123,203,0,75,195,156,0,0,82,16,32,131,223,218,2,3,56,13,80,107,251,191,139,99,176,5,4,54,0,
+136,59,247,31,0,195,99,219,79,87,21,0,32,0,131,47,251,0,0,111,175,0,211,226,4,1,163,21,118,0,0,163,123,0,0,155,5,29,64,3,
+0,255,243,242,1,0,1,0,1,1,42,7,128,1,0,206,2,131,31,255,0,15,175,251,207,111,87,25,2,2,42,0,231,1,67,115,211,247,163,164,
+39,16,95,175,2,5,203,19,3,1,20,15,91,20,9,15,10,20,2,3,36,0,5,30,21,5,72,0,67,3,215,195,187,144,0,12,81,0,5,180,3,13,27,
+0,81,227,155,95,103,219,63,6,14,54,0,12,9,0,5,15,21,112,0,171,183,199,43,247,27,231,21,37,43,207,199,20,57,255,255,239,175,
+11,102,35,95,143,223,211,7,54,0,136,123,179,0,0,191,95,191,95,87,21,4,242,19,65,207,83,0,115,164,2,3,163,21,112,0,0,51,227,
+3,19,247,112,17,163,123,243,239,143,27,31,187,0,255,195,50,21,2,1,42,7,128,1,3,80,6,82,19,207,251,179,91,161,7,3,2,42,0,
+136,4,67,91,187,251,195,143,22,0,232,3,6,203,19,4,1,20,15,91,20,1,3,8,19,14,10,20,6,64,20,5,83,21,3,72,0,96,31,255,0,79,
+255,47,24,0,15,109,20,0,4,19,1,2,18,0,22,207,27,0,1,168,24,16,51,209,0,13,54,0,15,9,0,0,4,15,21,35,19,247,57,41,52,83,243,
+203,243,47,0,102,23,13,73,9,54,7,235,59,54,0,36,127,175,128,1,6,87,21,129,63,31,31,31,99,211,0,35,135,1,7,163,21,81,0,0,
+0,203,83,140,5,209,31,159,43,71,191,255,251,131,0,255,35,171,215,83,9,2,144,3,14,128,1,134,0,0,35,123,215,243,163,67,2,42,
+249,2,3,79,171,247,203,111,27,0,0,35,247,107,0,0,47,239,99,203,19,3,1,20,15,91,20,8,14,10,20,4,36,0,83,15,251,79,7,147,211,
+22,2,72,0,2,180,49,1,227,44,15,109,20,0,3,1,0,2,18,0,22,103,27,0,143,107,227,19,0,0,99,247,3,135,0,1,15,153,0,0,3,15,21,
+48,107,243,51,133,42,84,3,0,15,251,167,231,21,13,52,7,96,179,83,11,7,83,251,63,18,3,54,0,51,71,239,23,128,1,6,87,21,208,
+199,43,0,59,219,107,0,127,163,31,31,31,183,145,43,3,163,21,0,124,16,33,195,223,218,40,0,1,0,32,19,15,128,7,4,50,21,1,1,42,
+2,60,3,10,128,1,0,205,4,39,131,219,2,42,35,207,123,226,30,80,79,239,219,203,247,19,6,6,203,19,4,1,20,0,19,20,20,255,28,20,
+1,9,0,6,49,8,13,10,20,5,73,20,69,131,255,255,183,83,24,0,72,0,6,229,8,15,109,20,0,4,179,44,1,99,0,1,154,6,3,27,0,81,11,191,
+243,191,203,226,42,14,226,20,15,244,20,0,3,15,21,16,207,60,29,101,3,231,83,0,163,139,231,21,13,128,1,80,87,215,255,255,243,
+83,1,5,69,21,81,167,231,195,243,59,128,1,12,87,21,16,219,2,11,16,75,200,3,1,213,3,1,16,29,57,7,231,231,176,40,0,203,21,2,
+129,1,6,1,42,5,75,20,12,84,20,14,1,0,31,27,231,12,7,35,7,211,230,18,5,9,0,15,1,0,72,36,3,171,178,5,2,1,0,47,11,31,190,56,
+23,4,15,21,5,29,35,31,43,231,21,14,9,69,21,0,128,10,0,128,1,15,87,21,3,0,254,0,28,31,70,22,15,196,0,3,19,127,18,43,5,75,
+20,15,84,20,24,14,1,0,35,15,227,225,32,5,9,0,15,1,0,132,15,15,21,35,10,54,0,0,128,1,15,72,0,3,0,254,0,1,182,52,15,1,0,14,
+47,27,247,166,1,17,15,1,0,255,4,31,47,242,24,43,15,1,0,255,166,5,14,20,7,141,8,4,72,41,7,57,41,15,1,0,35,2,111,41,32,3,195,
+125,35,0,1,0,20,219,49,48,2,99,0,4,124,0,36,3,159,194,12,15,156,20,100,10,58,42,5,1,0,5,238,39,4,7,1,15,40,0,4,15,183,0,
+42,4,230,6,6,50,18,5,72,41,6,57,41,15,1,0,35,5,111,41,4,70,0,1,116,38,7,99,0,3,124,0,37,3,15,43,7,15,50,64,98,11,58,42,5,
+23,0,3,100,39,5,7,1,15,40,0,4,7,183,0,65,31,255,0,187,67,6,1,220,61,79,119,227,255,223,153,6,11,9,20,63,10,9,0,17,179,217,
+9,16,143,85,56,2,89,0,0,134,34,0,163,11,5,1,0,3,111,37,2,50,0,19,127,128,37,19,95,37,59,2,205,34,4,136,12,10,8,0,2,74,20,
+99,191,239,15,0,0,223,177,15,34,31,255,79,0,32,255,31,208,9,3,95,29,2,124,20,1,96,0,0,167,42,48,0,115,223,149,20,12,177,
+63,12,88,0,1,32,0,1,47,32,83,195,247,251,195,75,88,0,6,128,0,16,179,244,20,64,175,175,0,179,198,11,16,123,78,65,2,104,0,
+4,142,42,18,155,166,11,2,60,62,34,159,127,73,53,39,63,255,48,0,14,68,1,4,144,0,144,31,255,0,43,235,19,0,0,39,69,18,101,31,
+187,63,31,99,243,44,12,6,173,0,7,227,1,4,18,21,14,9,0,16,19,60,40,20,151,157,32,130,31,255,0,55,15,0,0,107,184,32,17,19,
+178,51,3,196,32,33,0,163,166,43,1,1,0,19,143,14,46,63,19,223,87,128,1,8,2,74,20,16,191,97,11,7,128,1,64,31,31,59,199,171,
+14,81,255,31,0,27,219,147,12,2,124,20,1,39,38,34,131,243,239,20,16,75,182,19,7,177,63,1,45,16,10,88,0,0,32,0,176,151,219,
+0,0,7,239,139,43,39,103,219,88,0,1,17,36,4,40,0,224,23,235,71,0,103,227,19,0,19,223,47,0,71,223,122,3,4,228,20,2,163,33,
+34,255,67,48,0,12,128,1,6,48,0,2,1,0,16,155,19,2,16,95,241,65,6,144,0,0,100,0,81,143,163,0,0,195,159,12,0,23,1,23,103,113,
+40,5,128,1,6,233,19,4,18,21,15,9,0,0,64,75,243,55,171,79,1,8,237,44,17,3,205,59,65,159,247,243,227,249,13,2,47,0,36,7,195,
+70,23,35,79,219,96,15,0,215,24,15,128,1,7,2,74,20,72,191,143,243,23,128,1,0,56,45,1,0,1,16,31,122,16,21,43,124,20,4,167,
+42,17,0,39,63,3,16,2,0,118,16,109,59,215,255,179,207,15,88,0,4,3,17,32,27,255,141,0,0,41,2,7,104,24,1,99,36,48,235,67,243,
+92,1,48,75,223,55,135,16,6,228,20,2,128,1,4,67,19,12,128,1,5,48,0,48,103,235,255,222,16,96,103,239,203,255,187,247,144,3,
+4,144,0,0,9,64,117,0,0,15,231,67,99,219,162,13,16,35,103,20,7,249,56,3,87,18,4,49,20,4,18,21,15,9,0,1,33,151,251,175,16,
+6,32,1,80,27,31,135,251,23,216,22,32,7,11,251,21,64,255,171,159,127,137,18,35,31,143,231,65,48,15,239,163,16,0,87,111,127,
+175,251,131,216,2,13,8,0,2,74,20,66,191,95,175,143,128,1,4,7,15,6,128,1,53,0,211,115,124,20,4,167,42,2,149,20,7,208,63,85,
+223,151,35,227,167,68,5,5,88,0,0,250,16,16,127,74,1,65,179,243,175,131,245,21,11,128,1,50,0,163,251,145,64,33,151,251,100,
+5,5,228,20,4,163,36,15,128,1,4,3,48,0,80,47,251,63,3,151,193,2,87,219,143,35,159,187,144,0,1,9,64,0,207,4,37,219,239,56,
+5,3,238,61,1,154,41,7,156,39,5,49,20,7,18,21,13,9,0,17,35,66,68,7,184,0,49,223,235,199,72,61,48,3,0,0,144,5,178,127,127,
+127,147,243,91,0,43,243,163,127,255,7,192,15,127,147,239,83,0,0,83,183,227,95,95,168,1,15,128,1,5,2,74,20,81,191,95,47,243,
+31,128,1,2,158,0,9,128,1,37,191,127,124,20,4,167,42,1,120,0,7,55,41,99,27,255,15,127,147,243,88,63,2,5,40,1,88,0,0,248,0,
+17,227,125,48,64,59,103,159,239,178,8,12,128,1,34,143,251,226,24,18,35,82,0,5,228,20,15,128,1,13,2,48,0,32,119,183,92,3,
+17,19,144,0,0,104,3,4,144,0,4,9,64,51,0,0,223,221,40,0,197,19,20,91,146,13,9,152,28,5,233,19,6,18,21,14,9,0,0,14,45,4,87,
+21,1,237,41,4,236,27,112,0,0,99,215,7,0,19,211,22,72,115,207,0,151,147,6,32,119,199,85,43,24,55,56,0,12,8,0,4,74,20,95,191,
+95,0,159,159,128,4,1,16,39,188,5,21,95,124,20,5,167,42,17,243,143,28,5,173,42,64,23,255,87,155,161,43,7,216,1,1,88,0,84,
+31,255,31,59,223,174,27,16,59,184,0,2,245,0,5,200,0,65,71,227,55,239,160,1,2,24,0,6,228,20,10,128,1,1,181,22,64,171,123,
+0,255,119,0,22,99,72,0,32,127,171,65,62,134,27,0,3,227,119,3,143,199,144,0,3,9,64,66,0,0,59,243,218,5,16,139,197,19,20,215,
+42,8,2,68,9,4,81,10,4,233,19,4,18,21,15,9,0,0,4,128,1,6,237,41,5,128,1,81,115,227,39,0,0,254,59,34,131,199,8,0,34,0,7,111,
+6,65,131,195,0,35,236,39,7,56,0,11,8,0,4,74,20,110,191,95,0,35,247,243,128,1,0,254,40,53,167,223,7,124,20,5,167,42,81,139,
+215,55,0,43,49,68,2,208,63,71,207,215,7,151,141,45,4,88,0,0,8,0,182,47,235,27,0,31,179,59,3,15,135,235,117,2,3,128,0,81,
+19,223,59,0,87,72,7,3,80,1,5,228,20,10,128,1,224,171,199,27,0,75,247,59,0,207,195,31,0,43,215,101,2,2,24,0,96,71,239,27,
+0,83,215,104,21,86,227,255,211,239,75,144,0,1,9,64,0,188,3,33,111,143,220,2,37,7,155,19,41,6,42,9,4,230,62,2,233,19,5,18,
+21,14,9,0,6,128,1,5,237,41,4,128,1,32,183,203,198,1,113,39,235,199,159,179,251,71,8,0,113,163,219,95,0,31,227,171,16,0,48,
+155,255,223,1,0,6,56,0,11,8,0,3,237,41,1,113,17,17,159,192,10,10,128,1,101,103,247,227,251,191,35,124,20,6,167,42,48,3,147,
+247,208,0,4,173,42,107,39,207,227,255,231,55,232,7,19,191,8,0,80,139,179,0,3,127,156,21,2,138,5,8,200,0,16,175,18,19,1,181,
+3,2,24,0,4,104,0,6,35,47,3,48,3,33,191,255,63,1,103,39,199,255,255,255,183,203,22,208,155,239,183,239,55,0,0,163,75,3,31,
+0,103,160,11,2,144,0,2,9,64,0,156,4,33,59,87,45,28,15,1,0,8,15,64,41,27,10,255,20,17,31,179,49,0,76,3,49,55,95,75,23,65,
+48,59,95,75,77,3,34,19,67,16,0,15,1,0,84,31,15,20,35,62,17,51,134,4,15,1,0,15,63,3,51,207,214,20,9,63,167,247,243,95,42,
+8,1,1,0,15,49,20,27,10,255,20,15,225,62,200,21,187,127,76,15,1,0,9,48,171,175,171,103,8,15,1,0,101,15,225,62,201,31,43,84,
+3,17,47,15,63,64,42,10,15,1,0,255,110,51,87,187,151,85,55,10,42,4,47,3,183,172,61,31,15,1,0,11,3,247,19,52,23,239,123,19,
+6,15,1,0,59,11,234,4,2,182,80,6,1,0,15,142,20,5,15,94,63,6,2,25,0,7,173,20,11,66,0,10,15,0,15,48,1,37,28,11,183,19,3,1,0,
+54,23,255,107,197,10,15,1,0,51,2,135,3,36,3,27,149,62,9,92,0,47,19,91,149,1,45,2,192,0,50,7,95,15,249,14,27,3,252,80,10,
+142,20,5,44,63,13,194,84,5,49,0,3,25,0,5,61,4,12,50,63,10,15,0,3,48,1,4,1,0,15,56,1,0,47,163,171,16,21,2,4,179,40,34,0,227,
+191,18,4,252,75,0,154,74,6,72,0,6,140,10,14,1,0,32,63,227,190,61,4,241,40,7,119,20,1,59,80,49,255,255,219,255,7,4,24,0,6,
+92,14,2,80,0,3,128,0,33,219,187,6,8,15,7,15,8,9,8,0,6,184,0,4,8,0,2,96,0,82,0,7,231,195,167,164,80,9,5,1,5,231,20,11,32,
+1,4,167,20,4,168,0,4,151,21,12,200,0,5,96,0,4,6,32,3,47,21,7,248,0,2,214,3,84,95,211,255,239,155,21,18,8,1,0,17,131,127,
+1,6,16,1,4,184,0,49,191,255,163,35,7,49,51,231,239,16,33,19,227,101,79,32,135,255,140,13,5,145,40,4,140,16,13,1,0,49,11,
+31,183,157,32,3,241,40,7,119,20,0,87,20,0,239,15,55,87,231,111,24,0,4,85,0,3,103,74,5,183,20,7,175,17,15,128,1,18,4,135,
+20,3,8,0,3,96,0,49,47,171,167,233,55,6,40,0,1,20,74,5,144,0,12,128,1,4,167,20,5,168,0,4,151,21,11,200,0,4,16,0,1,159,17,
+38,59,255,47,21,5,233,41,2,48,1,121,59,247,99,35,55,143,151,128,1,0,225,42,1,160,45,1,127,21,4,104,0,3,184,0,65,27,255,255,
+243,95,54,32,127,67,59,15,66,31,255,191,147,255,33,32,231,171,140,16,0,130,21,2,175,22,6,146,16,3,4,0,2,24,0,48,119,243,
+207,245,54,4,79,20,8,119,20,5,239,16,42,95,211,143,20,0,5,0,3,255,19,7,183,20,51,3,155,179,251,1,15,128,1,17,4,135,20,4,
+8,0,3,96,0,52,0,0,59,1,37,2,5,0,18,159,24,63,8,144,0,3,4,0,1,112,0,4,167,20,5,168,0,4,151,21,11,200,0,6,96,0,2,88,0,4,47,
+21,5,248,0,3,48,1,33,91,211,185,40,6,32,1,80,59,215,255,211,251,95,14,7,127,21,0,104,0,4,184,0,65,111,255,255,175,154,74,
+65,139,0,211,155,160,1,17,243,185,40,65,75,223,11,243,47,14,34,39,219,153,5,12,128,1,2,24,0,48,59,247,43,42,5,5,79,20,7,
+119,20,1,87,20,1,173,3,1,255,18,10,224,2,5,255,19,5,183,20,32,11,183,22,14,15,128,1,22,4,135,20,3,8,0,4,96,0,49,0,0,175,
+197,15,4,40,0,0,46,37,0,24,63,4,144,0,6,192,0,2,112,0,4,167,20,4,168,0,4,151,21,12,200,0,5,96,0,32,55,199,163,46,5,47,21,
+5,233,41,3,48,1,81,23,227,227,159,115,232,2,3,56,1,0,71,84,0,35,19,3,127,21,5,104,0,4,192,0,210,207,255,255,83,95,171,0,
+0,35,83,0,115,227,185,40,16,223,31,21,65,175,119,0,151,219,4,18,231,170,6,3,52,47,6,192,0,2,24,0,0,14,41,3,168,0,3,79,20,
+4,119,20,2,87,20,1,73,60,3,44,63,8,128,1,5,255,19,5,183,20,17,207,8,18,15,128,1,22,4,135,20,5,64,0,3,156,2,71,35,247,95,
+227,200,1,2,152,61,6,144,0,6,192,0,2,112,0,4,167,20,4,168,0,4,151,21,12,200,0,4,16,0,66,3,239,135,39,127,21,2,47,21,5,233,
+41,3,48,1,117,0,7,79,115,187,247,55,32,1,1,232,0,16,247,192,1,2,127,21,5,104,0,3,184,0,2,207,19,64,55,0,0,123,8,0,0,238,
+89,112,0,0,191,171,255,0,19,230,1,16,247,48,3,18,111,46,39,18,3,174,5,6,200,3,2,24,0,0,14,41,4,40,2,1,241,40,5,119,20,2,
+87,20,1,8,1,37,87,219,24,0,4,87,20,4,255,19,6,183,20,16,171,14,4,15,7,21,6,12,8,0,4,56,0,5,143,20,3,96,0,102,0,159,143,3,
+227,75,72,0,4,152,64,8,144,0,2,4,0,2,112,0,9,234,21,0,168,0,1,76,6,29,199,200,0,6,16,0,4,221,1,2,47,21,4,248,0,4,48,1,1,
+1,0,16,155,0,6,2,32,1,1,232,0,17,251,224,73,6,127,21,37,87,219,184,0,242,0,127,183,31,31,31,191,123,0,0,203,79,31,31,155,
+139,156,0,64,243,255,0,115,24,0,17,211,117,41,3,129,1,2,117,0,4,178,41,4,24,0,49,67,243,27,54,26,5,241,40,6,119,20,2,87,
+20,0,43,8,0,32,28,3,24,0,5,223,20,3,255,19,6,183,20,33,3,159,3,46,15,7,21,4,12,8,0,4,56,0,5,143,20,3,96,0,0,113,47,16,135,
+148,83,3,40,0,83,67,239,27,0,139,248,0,2,144,0,64,79,3,127,255,104,6,3,112,0,7,128,1,0,168,0,4,151,21,12,200,0,4,16,0,50,
+7,247,111,232,65,3,47,21,4,248,0,4,48,1,118,91,143,39,0,43,207,131,56,1,0,71,84,0,183,44,7,127,21,0,104,0,4,184,0,16,219,
+251,5,64,99,215,0,27,205,19,19,43,7,31,33,107,255,50,25,34,0,107,117,44,2,73,0,3,245,1,1,178,41,2,96,9,1,24,0,68,147,239,
+191,211,47,91,0,233,6,5,119,20,2,87,20,0,192,3,0,72,73,4,24,0,5,223,20,3,255,19,6,183,20,95,0,0,143,211,23,7,21,6,12,8,0,
+4,56,0,5,143,20,3,96,0,103,143,143,0,0,39,251,72,0,48,151,243,231,98,42,6,144,0,66,215,255,191,231,77,48,1,112,0,5,128,1,
+2,168,0,4,151,21,12,200,0,5,192,0,18,83,57,87,4,47,21,4,248,0,4,48,1,96,23,159,247,255,251,175,111,25,3,32,1,0,71,84,39,
+55,0,127,21,2,104,0,6,71,21,13,1,0,56,3,31,79,6,42,14,189,61,10,225,20,20,11,58,41,4,41,0,4,215,40,15,26,62,17,15,1,0,79,
+65,115,127,127,187,252,43,5,40,5,15,1,0,11,15,151,21,68,15,127,21,24,16,31,167,46,6,1,0,14,189,61,15,224,41,4,4,41,0,4,215,
+40,15,26,62,17,15,1,0,79,71,179,179,183,243,121,84,15,143,21,159,15,189,61,22,12,41,0,15,246,61,115,63,15,63,63,84,87,32,
+15,1,0,255,216,79,235,103,231,223,186,60,36,15,1,0,3,15,228,82,13,27,23,151,4,7,147,83,8,1,0,12,70,63,15,86,63,6,6,64,0,
+15,226,20,2,11,56,0,10,158,0,15,142,4,9,15,166,41,31,15,98,21,5,15,1,0,10,63,31,3,15,111,6,43,18,11,97,93,5,1,0,15,5,42,
+13,13,166,83,5,147,83,11,71,0,11,192,20,15,86,63,6,4,64,0,15,112,41,3,11,56,0,2,158,0,19,23,141,81,15,172,0,10,2,52,101,
+3,194,105,2,65,84,4,56,0,9,65,1,4,196,1,15,128,0,1,49,107,83,155,198,1,9,58,63,2,84,0,49,35,155,83,240,19,81,127,0,0,95,
+191,39,2,17,215,72,10,6,184,20,2,8,0,11,120,14,11,39,41,64,0,143,243,231,95,27,12,152,20,5,45,52,0,29,9,20,15,12,101,0,224,
+12,2,32,0,21,79,122,2,5,128,21,9,1,0,14,63,41,3,40,0,15,167,41,4,5,128,0,4,103,39,11,136,0,2,7,3,5,150,0,1,7,3,5,14,0,6,
+144,21,5,150,0,6,131,77,2,7,3,3,38,24,3,63,3,3,116,1,16,23,64,10,8,68,0,12,7,0,65,0,19,207,75,196,0,10,58,63,2,84,0,144,
+163,79,211,23,0,63,247,239,15,128,1,32,3,31,151,40,0,135,41,5,184,20,3,8,0,10,224,0,12,39,41,87,0,151,23,0,131,40,0,8,135,
+41,0,31,0,83,39,243,7,0,95,72,46,17,23,199,75,2,32,0,21,195,234,0,4,200,20,4,28,2,93,59,0,0,83,167,63,41,4,40,0,15,167,41,
+5,14,128,1,10,136,0,2,7,3,4,14,0,4,124,104,15,14,0,2,3,65,1,4,14,0,2,7,3,5,38,25,7,70,3,32,0,131,113,16,3,171,77,15,128,
+1,3,64,0,55,27,79,253,12,11,104,3,1,84,0,144,19,63,43,39,0,63,191,199,139,128,1,1,1,0,18,111,32,22,4,40,20,5,192,20,7,224,
+0,12,39,41,0,1,0,19,87,216,18,8,152,20,5,201,55,36,239,11,128,1,32,3,191,226,23,3,32,0,3,124,98,6,48,0,64,143,3,31,143,192,
+3,64,83,239,59,83,244,64,4,63,41,48,0,11,167,3,0,4,40,0,15,167,41,5,13,128,1,11,136,0,17,39,202,104,15,14,0,37,4,174,21,
+11,7,0,16,239,7,0,3,249,83,13,128,1,4,85,3,38,231,79,35,0,10,7,0,148,139,239,255,0,63,191,59,247,23,128,1,17,39,24,14,4,
+40,20,5,48,20,9,224,0,11,39,41,0,234,0,21,215,157,56,6,216,19,0,16,0,48,251,187,39,180,83,18,171,72,1,48,0,155,191,96,1,
+12,32,0,3,16,0,81,11,203,203,43,203,41,36,34,83,239,115,66,3,111,41,102,47,219,183,47,219,183,48,20,15,167,41,4,5,112,19,
+34,255,143,129,1,9,15,42,53,0,0,207,202,104,15,14,0,33,2,13,105,15,7,0,3,3,249,83,13,128,1,1,244,2,0,14,105,0,175,62,3,35,
+0,10,7,0,148,175,43,31,0,63,191,0,171,151,128,1,1,168,20,4,240,19,6,48,20,10,248,24,10,39,41,66,0,27,139,239,4,62,3,151,
+41,7,135,41,145,43,163,211,0,39,239,131,95,199,34,42,18,107,42,39,11,32,0,5,200,20,80,3,207,235,3,207,127,38,34,59,239,112,
+18,2,152,20,80,19,247,179,19,247,100,21,5,119,41,15,167,41,3,4,8,0,50,95,255,115,79,28,7,104,0,33,31,31,41,107,1,46,6,15,
+14,0,35,3,46,20,15,7,0,2,5,249,83,15,128,4,1,1,14,105,10,28,84,6,7,0,0,94,5,99,63,191,0,35,243,131,128,1,16,99,240,17,4,
+40,20,2,8,0,12,120,20,1,1,0,7,39,41,102,0,79,127,39,127,223,88,25,12,135,41,32,123,199,0,22,66,23,0,0,67,231,41,12,32,0,
+4,16,0,96,7,175,227,67,175,227,234,3,41,239,83,112,18,103,79,239,151,79,239,151,119,41,15,167,41,3,5,160,0,3,128,4,9,104,
+0,0,183,4,3,147,104,15,14,0,35,0,254,23,18,39,197,24,13,7,0,3,82,21,15,128,1,2,0,14,105,25,67,35,0,10,7,0,1,128,1,49,0,139,
+239,128,1,20,3,101,62,4,184,20,1,248,19,12,143,41,12,39,41,1,236,0,6,8,7,8,135,41,181,11,139,223,0,115,223,11,0,79,251,11,
+231,41,12,32,0,5,16,0,64,183,19,31,183,74,81,80,211,83,0,0,111,49,6,5,250,28,16,203,3,0,5,40,0,15,167,41,4,5,8,0,3,128,1,
+8,104,0,0,1,0,66,219,155,11,35,77,42,15,14,0,33,2,13,105,15,7,0,3,15,128,1,9,0,14,105,31,155,128,1,14,34,15,239,128,10,0,
+231,61,6,40,20,3,248,19,11,120,20,13,39,41,0,26,20,2,184,25,1,5,0,9,135,41,97,227,59,0,15,211,223,186,50,4,231,41,12,32,
+0,4,16,0,0,37,8,2,78,0,4,5,0,6,96,0,0,3,0,5,40,0,4,128,0,1,149,113,7,111,42,4,8,0,106,255,227,223,223,223,27,104,0,1,244,
+21,63,255,247,115,14,0,21,16,255,88,25,8,28,0,0,174,21,0,178,9,15,7,0,1,5,79,1,7,53,49,5,63,0,17,163,224,63,15,128,1,8,15,
+1,0,31,4,215,20,3,8,0,50,3,83,211,91,85,15,1,0,5,2,126,52,4,96,6,15,1,0,47,3,95,21,5,61,62,15,1,0,56,3,217,21,15,192,63,
+0,65,3,31,35,159,125,31,15,7,0,0,15,32,1,4,15,60,1,9,15,1,0,41,4,215,20,2,8,0,63,47,235,199,231,55,6,11,1,0,51,39,159,203,
+173,28,15,1,0,42,3,95,21,15,61,62,65,3,217,21,15,224,21,0,35,31,255,137,115,15,7,0,0,15,32,1,4,15,60,1,9,15,1,0,41,4,215,
+20,2,8,0,31,19,98,100,19,1,215,0,47,63,63,58,107,159,15,1,0,31,15,247,21,9,15,9,84,255,207,47,167,251,204,46,13,15,1,0,184,
+15,233,84,36,15,55,0,9,4,225,19,48,43,179,95,71,38,3,183,19,9,200,104,3,18,20,70,163,251,123,111,184,49,3,56,0,49,27,255,
+107,91,0,1,63,0,10,176,40,3,111,40,1,154,54,0,183,8,63,95,95,95,219,125,12,40,143,251,167,0,47,3,31,248,111,0,47,71,87,54,
+70,8,15,43,71,8,15,1,0,9,10,180,126,15,14,0,10,15,233,84,35,15,55,0,2,4,149,1,3,225,19,3,250,106,3,183,19,10,35,44,1,190,
+19,66,23,255,107,179,251,40,8,56,0,4,188,65,1,63,0,12,153,18,1,119,0,0,140,32,0,1,0,70,99,159,159,171,167,9,19,95,39,14,
+8,179,1,49,11,251,67,148,118,2,172,0,49,51,243,231,104,21,7,205,1,87,255,0,99,215,195,161,99,10,1,0,81,43,227,239,239,227,
+243,13,4,51,0,0,6,0,64,35,207,255,187,29,31,2,103,0,81,103,227,255,199,55,7,0,1,63,31,33,0,119,81,2,5,232,126,1,36,0,2,172,
+20,34,3,135,45,73,6,28,0,1,88,101,1,85,0,70,103,231,255,223,216,5,69,71,227,255,183,21,2,15,84,21,3,4,107,46,8,130,10,4,
+149,1,3,120,55,2,139,65,4,238,19,11,35,44,0,134,14,49,3,31,7,168,65,10,56,0,3,188,65,2,63,0,15,146,12,2,20,215,116,0,1,175,
+104,3,77,41,16,19,51,102,3,91,58,7,130,20,1,7,0,128,255,171,159,123,23,0,0,23,43,18,0,119,13,2,146,0,164,171,215,35,31,31,
+0,63,239,231,255,40,96,12,1,0,80,35,71,0,3,163,46,101,2,1,0,18,115,85,118,83,183,171,43,195,151,133,78,224,0,31,199,71,39,
+155,223,0,31,187,59,39,135,239,209,53,18,203,48,0,3,232,126,3,139,0,1,116,15,54,123,231,71,14,21,0,182,0,0,139,80,2,51,46,
+85,19,255,99,31,127,177,32,85,3,239,131,35,155,109,22,15,84,21,3,4,107,46,0,6,0,1,141,19,18,79,238,124,0,198,12,9,7,0,95,
+115,227,255,227,99,7,0,3,15,83,12,6,8,7,0,48,159,251,215,65,55,16,43,176,68,3,14,0,18,59,7,0,2,251,125,4,104,1,55,15,243,
+75,114,13,5,32,20,162,95,247,215,39,0,255,115,103,187,227,122,4,0,168,54,80,123,235,255,219,87,25,5,2,205,45,1,51,0,65,111,
+223,223,223,106,63,68,231,223,223,167,14,0,1,224,2,3,128,13,80,63,0,15,251,107,142,3,80,3,251,43,0,75,178,1,2,2,44,17,3,
+156,37,178,3,3,0,7,103,227,0,0,27,211,31,242,42,2,179,20,2,52,1,3,10,1,1,226,83,5,189,37,0,145,56,0,112,0,1,14,0,80,11,243,
+67,0,99,100,19,3,245,0,52,3,0,35,155,101,8,124,2,7,114,13,2,98,0,4,0,84,1,141,19,1,204,19,27,187,7,0,111,23,255,83,31,67,
+203,7,0,3,15,128,1,18,33,155,39,65,58,16,199,62,6,0,190,125,1,14,0,1,7,0,33,67,243,151,41,5,128,4,8,30,25,80,31,255,155,
+35,139,32,20,16,143,42,0,80,255,31,0,19,255,24,18,16,143,120,119,80,31,183,59,31,111,106,6,38,11,203,175,46,0,58,4,0,85,
+66,35,159,179,241,5,17,119,106,21,1,42,86,5,9,16,24,87,62,41,6,251,3,17,155,147,62,128,255,251,63,0,3,191,67,0,199,2,4,179,
+20,48,247,247,183,87,57,1,10,1,82,27,255,175,251,215,149,22,2,58,0,38,87,215,77,0,17,95,63,0,3,14,0,94,7,247,99,3,127,21,
+15,8,14,0,3,98,0,4,0,84,2,172,43,2,167,40,10,7,0,111,3,195,203,147,75,3,7,0,3,15,128,1,18,98,19,0,43,247,0,143,186,42,1,
+208,123,0,176,39,1,91,0,0,218,26,0,123,2,3,106,63,54,231,151,39,30,25,0,42,0,1,138,21,1,42,0,192,255,31,0,47,255,51,0,91,
+255,187,107,55,179,2,48,87,151,215,79,21,22,31,146,2,64,0,15,127,139,139,6,50,0,3,179,129,29,17,75,27,125,66,195,227,255,
+231,208,39,0,1,0,64,131,251,255,191,150,41,11,128,1,33,119,231,16,4,129,43,175,199,0,143,115,0,15,207,5,1,140,6,0,244,125,
+36,179,199,10,1,82,31,255,127,35,151,141,38,2,58,0,37,191,119,128,1,101,3,227,127,35,151,199,28,0,71,103,247,255,203,3,1,
+5,164,126,6,14,0,3,98,0,6,0,84,1,87,25,1,167,40,10,7,0,111,0,3,75,151,231,175,7,0,3,3,160,25,15,7,0,11,16,11,82,24,20,95,
+132,3,18,7,96,24,1,91,0,0,22,62,2,105,106,4,181,3,10,42,6,1,21,0,1,42,0,112,255,199,191,239,179,0,0,187,130,0,99,1,48,203,
+223,139,218,17,39,11,211,189,101,64,11,147,243,99,76,9,48,23,127,251,182,28,64,43,243,239,191,86,1,16,171,163,4,50,31,255,
+159,239,64,160,39,255,143,235,0,7,255,35,0,67,81,92,3,107,0,3,10,82,1,175,0,3,193,24,3,179,20,2,51,0,4,10,1,33,7,251,61,
+64,5,141,46,1,98,39,5,231,0,10,28,0,38,11,23,217,84,7,210,0,6,14,0,3,98,0,6,0,84,0,4,0,3,167,40,9,7,0,48,31,143,31,116,5,
+15,7,0,2,3,8,42,15,7,0,9,80,31,255,131,7,151,137,65,3,132,0,33,123,3,14,0,1,7,0,2,175,104,4,157,0,55,7,239,123,82,27,5,128,
+1,1,42,0,48,255,95,247,85,1,16,171,212,41,182,71,0,27,255,55,0,39,167,0,0,171,119,45,49,0,0,31,16,20,82,0,31,231,171,127,
+248,5,16,7,202,30,32,155,195,84,0,16,15,118,66,0,247,28,162,31,255,83,247,0,0,195,147,11,175,151,28,6,127,1,115,31,139,19,
+11,151,215,0,143,108,3,179,20,0,73,1,37,151,215,17,1,32,187,103,150,88,5,175,84,16,139,134,10,3,14,0,16,11,114,4,22,227,
+28,0,38,0,55,217,84,5,114,1,8,14,0,4,98,0,3,0,84,2,4,0,3,167,40,9,7,0,101,3,159,251,255,243,115,7,0,0,235,111,5,14,0,4,186,
+83,15,7,0,8,80,31,255,191,255,239,244,3,3,4,5,3,14,0,1,7,0,2,251,125,5,18,5,39,79,231,108,136,5,128,1,1,42,0,33,255,31,215,
+45,219,51,231,219,191,227,235,0,0,139,247,255,247,135,58,31,129,155,243,191,191,191,47,0,131,249,50,144,0,3,111,183,239,
+191,15,0,59,142,7,2,208,8,34,119,207,111,27,16,115,71,0,21,255,68,69,4,7,0,36,3,155,200,17,1,78,0,4,179,20,2,21,0,3,17,1,
+48,47,227,255,166,68,3,224,0,17,7,7,106,4,14,0,33,103,247,178,88,4,245,0,32,255,251,80,107,5,14,0,1,168,0,4,14,0,2,53,2,
+2,98,0,4,0,84,63,3,31,87,47,82,19,15,114,20,59,2,23,52,9,1,0,22,111,32,52,8,160,21,1,237,3,0,120,125,15,108,13,0,20,27,247,
+47,0,103,1,128,215,7,0,0,23,0,91,211,14,86,4,21,0,0,52,0,21,151,181,111,15,1,0,129,11,239,41,15,1,0,7,15,175,82,78,22,247,
+175,76,9,32,23,17,171,81,136,15,1,0,3,17,211,213,31,1,1,0,197,19,211,227,191,203,219,0,47,239,187,167,223,116,11,65,127,
+219,191,211,191,68,15,249,41,159,15,1,0,118,47,3,59,109,83,7,38,7,63,228,14,130,3,55,95,71,15,0,0,11,76,136,5,20,0,15,102,
+66,89,15,1,0,255,255,81,15,98,21,16,4,18,42,15,144,41,22,9,224,18,15,199,84,46,15,189,0,43,15,1,0,6,4,150,0,63,127,75,171,
+240,123,6,15,24,0,11,15,1,0,9,9,29,62,24,11,16,126,16,59,184,141,5,1,0,4,98,21,15,1,0,10,2,18,42,3,144,41,35,147,255,113,
+142,0,1,0,56,79,131,107,238,40,69,67,243,211,15,224,18,49,103,95,131,107,19,3,158,17,54,87,247,199,113,21,32,103,243,227,
+8,2,41,73,81,0,0,55,155,83,188,21,3,31,22,49,67,239,215,75,34,9,238,126,39,211,119,185,104,9,189,0,9,31,1,10,44,1,11,38,
+62,9,170,22,4,42,0,36,11,223,95,18,15,128,1,13,15,32,23,24,2,29,62,2,1,0,66,255,135,247,255,76,78,3,78,1,3,39,81,32,155,
+243,188,15,1,98,21,50,31,255,239,52,8,3,107,0,113,75,227,247,123,0,0,91,247,135,11,2,31,32,7,251,176,16,5,251,15,33,199,
+75,4,76,3,191,10,48,171,151,215,115,41,2,14,0,72,15,199,63,175,35,42,17,135,125,146,1,96,0,64,7,243,99,115,228,52,19,171,
+160,74,48,175,87,207,156,1,3,31,22,16,163,70,0,11,70,3,50,27,207,175,118,9,9,229,20,3,189,0,15,128,1,8,3,254,103,3,48,0,
+8,170,22,5,42,0,20,19,23,2,15,128,1,13,15,32,23,24,8,171,23,88,255,215,47,3,159,107,9,0,183,96,0,183,12,1,144,22,3,118,21,
+18,95,52,11,3,107,0,145,231,123,39,179,0,7,247,255,255,89,79,3,244,15,8,109,20,5,137,20,50,31,51,67,237,62,1,14,0,48,23,
+11,23,139,55,3,14,0,16,43,172,41,7,28,0,16,27,28,0,1,145,2,0,89,35,2,28,18,3,146,0,32,63,55,30,127,3,14,0,1,70,0,11,38,22,
+50,3,23,7,132,139,2,37,0,4,60,11,7,145,23,13,172,2,3,246,19,7,165,32,3,169,19,4,28,0,2,186,20,10,4,41,11,32,41,1,46,20,4,
+11,125,15,14,0,3,9,70,0,3,84,21,2,14,0,3,121,13,33,255,47,18,56,101,163,71,0,0,99,163,63,0,5,240,38,1,147,0,4,62,35,1,184,
+13,1,10,37,0,58,1,5,73,98,15,217,0,2,0,1,0,15,235,41,9,4,161,0,10,14,0,1,145,2,48,31,255,15,232,79,7,77,0,2,4,0,14,14,0,
+4,210,0,9,59,1,66,71,215,191,235,21,62,4,14,42,0,145,54,7,0,105,6,246,19,1,254,103,7,0,3,0,169,19,4,28,0,1,186,20,4,253,
+40,3,192,62,14,32,41,0,41,142,8,84,21,12,14,0,2,70,0,2,63,0,3,77,21,5,74,41,2,128,1,176,31,0,3,199,127,0,11,199,55,79,195,
+29,20,2,63,0,16,0,63,16,5,147,0,0,250,125,0,51,68,17,151,228,25,2,197,0,35,3,231,128,1,9,128,4,4,189,0,15,235,41,15,4,161,
+0,10,14,0,3,186,17,18,23,99,0,4,38,1,1,4,0,15,14,0,1,4,210,0,9,59,1,18,51,132,61,8,14,42,25,87,0,105,6,169,40,9,254,103,
+2,21,0,5,28,0,1,70,0,3,246,40,3,192,62,10,32,41,5,46,20,8,84,21,12,14,0,6,98,21,20,255,77,21,5,74,41,3,128,1,32,11,175,188,
+17,32,35,219,42,104,5,46,41,1,113,100,4,147,0,1,197,15,1,255,125,6,219,28,33,0,55,148,121,11,128,4,4,189,0,15,235,41,16,
+3,161,0,10,14,0,1,145,2,87,31,255,0,139,187,77,0,3,235,20,15,14,0,0,3,210,0,10,59,1,0,193,25,0,169,27,7,14,42,25,239,0,105,
+6,169,40,8,254,103,3,21,0,5,28,0,3,28,21,3,253,40,3,132,42,10,32,41,1,35,0,10,84,21,12,14,0,6,98,21,0,53,2,1,77,21,7,74,
+41,0,137,20,48,79,211,187,60,5,19,51,217,43,3,78,44,1,5,3,5,158,20,48,11,247,107,100,1,1,68,21,0,155,63,2,102,5,14,128,4,
+7,130,41,15,235,41,14,5,175,0,8,14,0,1,145,2,0,36,20,40,151,219,77,0,23,35,24,1,8,14,0,3,210,0,10,59,1,92,0,63,179,251,63,
+14,42,8,0,105,8,169,40,6,1,0,3,21,0,5,28,0,1,144,20,4,253,40,3,192,62,14,32,41,6,11,23,15,14,0,3,2,70,0,2,63,0,3,77,21,3,
+63,0,3,39,20,33,255,239,84,132,82,15,219,75,103,207,17,69,6,179,23,5,158,20,2,170,0,17,235,41,114,7,236,5,13,128,1,11,217,
+0,15,235,41,9,6,175,0,8,14,0,1,145,2,0,21,0,16,63,182,3,1,77,0,3,168,0,15,14,0,2,3,210,0,10,59,1,80,0,131,55,87,235,8,151,
+8,14,42,8,0,105,8,169,40,7,1,0,3,169,19,4,28,0,1,144,20,7,253,40,0,65,28,11,32,41,33,239,255,124,66,5,84,21,10,14,0,21,231,
+0,21,3,63,0,4,77,21,3,63,0,2,39,20,0,128,7,0,228,9,64,99,0,0,131,128,7,9,51,25,3,147,0,3,14,0,16,95,194,107,8,14,21,14,0,
+6,6,207,20,15,249,41,13,4,161,0,10,14,0,5,217,1,37,255,143,126,0,3,249,20,15,14,0,1,4,210,0,9,59,1,1,219,130,27,23,14,42,
+15,1,147,37,15,246,40,2,4,21,0,10,59,41,15,73,41,0,7,226,1,7,11,0,9,84,0,5,66,52,10,1,0,53,19,255,83,25,0,50,3,31,111,242,
+30,13,63,11,15,102,19,111,15,228,41,1,55,3,79,223,5,14,15,1,0,14,4,185,110,15,29,0,3,15,246,40,1,4,21,0,10,59,41,15,73,41,
+2,15,11,0,3,7,84,0,15,128,1,4,16,0,175,51,5,48,0,18,235,83,64,15,214,20,128,15,228,41,0,63,115,219,171,237,125,26,15,236,
+77,8,15,1,0,80,15,38,42,172,15,228,41,0,31,51,130,21,255,182,15,209,39,13,15,242,17,23,15,37,126,187,15,1,0,41,1,192,62,
+16,3,69,136,1,1,0,2,212,19,15,186,146,1,52,55,251,107,109,138,14,1,0,48,187,227,67,49,33,2,115,17,5,77,0,9,84,0,3,1,0,2,
+91,0,4,28,18,8,39,20,15,133,0,9,11,233,5,15,137,62,1,11,1,0,1,62,0,49,7,155,147,106,62,1,66,80,15,191,125,5,16,115,217,19,
+15,1,0,16,17,127,159,0,8,4,42,25,131,5,43,7,1,0,33,15,211,48,75,0,114,0,9,240,63,7,61,0,2,142,0,49,255,115,247,16,10,5,219,
+19,2,212,19,35,199,79,189,60,7,154,0,49,71,231,251,179,157,19,159,203,16,8,194,2,3,63,149,3,49,0,5,77,0,3,1,0,2,84,0,3,76,
+0,8,21,147,11,39,20,11,133,0,2,42,0,4,19,143,11,240,1,15,102,66,6,4,3,12,2,62,0,16,147,76,12,48,163,79,203,57,2,1,86,0,52,
+31,255,255,63,108,3,1,0,64,11,251,79,31,253,105,2,181,10,1,27,103,7,201,36,49,123,247,243,207,17,5,128,1,3,18,42,1,18,0,
+18,247,5,43,19,47,41,163,6,57,8,49,83,219,147,165,44,5,27,147,4,246,66,0,61,0,17,219,87,2,2,228,0,80,255,219,39,11,179,3,
+1,9,218,61,33,3,23,204,19,10,20,87,65,119,75,119,207,19,58,2,56,15,9,35,9,3,63,149,8,218,40,7,245,1,9,91,0,9,74,62,11,39,
+20,15,42,0,1,4,193,20,4,46,1,32,31,15,194,23,9,98,0,24,3,182,15,3,56,1,4,54,150,0,205,7,1,106,62,3,51,0,0,253,166,13,177,
+1,65,0,0,255,91,11,168,50,31,31,103,169,17,1,4,0,0,214,0,1,173,161,2,60,0,3,128,1,1,4,42,98,163,51,255,31,167,0,5,43,48,
+31,111,231,52,8,8,128,1,32,11,23,78,129,6,226,167,6,192,0,64,27,0,0,131,190,97,3,193,0,0,181,85,37,71,251,200,20,15,7,0,
+1,4,81,41,0,176,19,2,34,66,15,81,20,0,8,228,20,15,7,0,37,15,77,42,16,0,111,84,17,247,85,2,8,154,21,71,227,219,211,215,7,
+42,1,52,0,3,94,20,1,181,10,2,98,1,3,170,18,36,67,107,24,0,3,195,3,1,6,0,49,163,223,135,231,25,35,3,171,98,166,3,72,0,2,173,
+161,2,42,0,83,127,195,203,219,11,12,0,48,39,195,255,17,18,1,90,0,65,95,207,247,191,170,18,1,17,0,0,90,0,10,6,0,1,81,4,16,
+255,100,98,2,150,0,16,55,143,103,4,95,44,18,35,137,38,3,200,20,15,7,0,2,48,0,0,119,140,151,95,215,159,35,147,195,81,20,5,
+15,70,42,7,15,7,0,23,15,128,1,11,1,56,21,80,59,247,43,59,187,167,58,8,95,20,0,205,40,2,100,73,0,168,0,3,52,0,3,94,20,0,100,
+62,3,64,15,1,116,168,34,3,215,31,40,0,24,0,3,158,168,1,62,18,49,239,91,187,130,126,17,159,227,6,18,55,182,147,0,56,0,0,178,
+167,3,42,0,83,127,243,79,47,135,12,0,68,19,183,255,171,231,88,160,0,63,243,127,11,0,191,199,255,199,72,58,1,90,0,9,6,0,7,
+0,3,2,245,167,0,205,101,4,128,1,2,159,0,3,11,20,15,7,0,2,0,159,146,0,2,46,32,255,15,193,41,15,81,20,4,15,70,42,7,15,7,0,
+23,15,128,1,11,2,56,42,33,179,35,245,168,9,95,20,65,71,247,159,95,224,24,1,168,0,4,184,2,2,38,5,6,101,167,2,116,168,2,207,
+4,3,24,0,2,18,0,2,30,3,17,67,53,103,16,19,144,2,70,0,23,207,151,72,6,17,23,219,1,0,42,0,0,76,84,0,3,37,0,12,0,65,175,71,
+255,55,241,6,1,110,7,128,71,195,175,0,95,115,255,115,48,90,6,120,0,4,6,0,6,131,0,3,245,167,20,143,187,142,5,128,1,5,200,
+20,15,7,0,0,33,0,55,130,29,3,18,20,15,81,20,6,15,70,42,5,15,7,0,23,15,77,42,13,0,56,42,17,187,170,125,11,95,20,84,43,115,
+203,231,11,168,0,2,56,1,9,94,20,2,7,0,17,83,151,43,0,125,165,4,24,0,2,18,0,1,13,0,67,131,251,159,103,212,44,0,15,132,2,116,
+19,0,14,0,17,223,243,154,1,42,0,0,0,6,4,12,0,16,3,148,21,6,215,5,115,51,255,0,127,143,255,143,48,81,11,6,0,2,150,147,0,6,
+0,3,2,130,20,59,49,70,5,128,1,4,200,20,15,7,0,1,16,31,208,84,0,80,103,79,123,3,151,191,81,20,7,15,70,42,5,15,7,0,23,15,77,
+42,11,1,56,21,16,67,130,6,27,7,95,20,100,19,0,0,7,255,39,168,0,3,56,1,5,94,41,4,9,1,18,83,133,174,22,23,115,22,3,18,0,2,
+13,0,67,55,155,239,127,22,7,17,27,2,20,3,72,0,67,27,31,31,23,42,0,2,128,1,3,54,0,3,88,28,0,60,0,16,7,229,110,15,128,1,8,
+0,150,147,84,31,255,239,175,159,245,167,60,0,231,47,128,1,3,200,20,15,7,0,1,3,95,41,64,0,59,239,255,73,106,11,81,20,18,223,
+67,20,15,70,42,7,15,7,0,24,15,77,42,15,34,127,191,111,84,6,95,20,193,187,255,0,123,219,171,215,191,3,0,155,243,250,15,1,
+133,66,3,94,20,8,128,1,1,64,158,8,243,8,4,18,0,4,30,6,36,99,251,25,0,19,167,36,3,5,181,8,2,42,0,2,128,1,8,72,0,3,128,42,
+32,199,195,87,135,3,128,7,12,128,1,17,15,150,147,48,11,247,227,130,65,3,244,20,17,155,161,85,9,69,0,15,1,0,11,30,223,198,
+101,33,11,151,130,11,47,27,191,237,125,79,7,233,32,6,111,84,2,1,0,1,99,21,48,15,171,203,216,3,18,63,33,54,14,196,147,13,
+1,0,8,164,20,32,27,95,215,52,0,111,43,13,191,160,15,14,127,14,3,1,0,17,23,255,10,8,128,10,7,1,0,2,150,147,55,47,183,35,184,
+0,23,67,10,95,15,128,1,16,62,159,179,235,252,42,18,55,176,162,47,115,255,51,126,40,15,1,0,23,15,164,0,5,2,99,21,48,3,179,
+207,15,30,49,39,243,139,31,55,15,91,146,14,8,164,20,40,223,243,38,119,9,116,0,15,14,127,27,15,128,1,4,15,1,0,15,15,163,104,
+14,47,63,63,238,124,141,33,3,115,134,3,47,43,147,50,1,19,15,136,62,66,31,7,223,63,210,15,1,0,198,1,48,104,67,7,191,83,139,
+57,41,21,51,125,136,15,1,0,10,15,102,123,7,15,1,0,99,0,25,18,15,92,21,33,15,202,25,110,1,48,104,68,7,15,0,23,83,1,10,152,
+83,6,61,20,36,127,247,26,8,0,57,20,15,184,0,1,15,247,188,3,0,1,0,47,131,247,176,59,5,4,3,1,1,119,41,11,85,0,4,120,41,0,1,
+0,19,175,91,0,4,1,21,0,28,0,16,7,152,18,18,15,149,57,1,45,18,7,154,18,0,7,21,0,52,0,15,77,21,8,3,255,0,15,137,1,12,15,161,
+1,67,7,219,30,3,9,14,8,50,15,1,182,19,17,255,89,6,2,203,19,0,182,74,33,251,63,94,35,18,255,57,20,3,65,0,16,255,44,32,32,
+255,179,227,43,18,135,230,19,3,234,140,2,146,35,3,168,1,58,15,251,67,12,110,1,9,8,21,191,70,0,0,145,126,5,119,41,6,20,0,
+4,24,21,1,227,10,1,91,0,2,232,2,1,112,1,0,28,0,82,163,75,0,0,107,212,9,7,143,38,1,8,3,49,171,71,163,52,0,0,8,0,1,192,0,3,
+140,0,0,88,0,2,236,0,5,3,0,5,254,0,11,21,0,8,12,0,8,137,1,0,66,0,15,128,1,75,3,18,0,0,146,38,1,119,41,0,55,62,6,23,1,6,60,
+0,1,56,188,1,33,182,48,27,255,107,17,23,1,30,41,1,81,20,1,238,15,9,45,0,8,1,0,16,155,85,37,6,128,1,36,3,31,119,41,9,128,
+1,9,24,21,20,27,111,38,4,124,0,0,165,143,0,69,125,1,220,117,5,4,0,0,172,0,0,130,0,1,7,21,16,27,33,18,0,228,121,2,53,0,1,
+36,0,17,3,188,127,15,128,1,2,1,180,0,3,1,21,15,128,1,81,8,205,54,9,128,1,1,182,19,2,0,3,5,46,0,3,43,0,0,191,0,6,203,15,0,
+56,188,1,33,182,34,3,207,18,182,8,1,0,2,32,128,5,5,0,8,1,0,16,231,106,14,21,191,75,0,6,168,1,3,226,128,10,254,23,10,224,
+2,7,10,1,82,59,215,0,0,247,181,78,8,176,34,15,48,0,2,1,24,0,2,65,59,14,238,2,12,146,1,1,251,38,14,3,0,15,128,1,60,8,42,67,
+15,0,3,4,3,45,0,34,255,255,58,85,6,55,0,4,128,4,0,133,16,2,112,41,13,100,0,1,40,0,6,5,0,8,26,0,1,136,12,19,191,25,0,8,128,
+1,19,3,20,0,9,254,23,15,128,1,6,4,84,4,7,15,40,15,128,1,9,63,103,255,35,128,1,19,17,27,149,18,5,3,0,2,18,3,5,31,1,0,131,
+2,15,128,1,50,15,128,4,16,1,1,0,1,83,4,8,28,4,5,128,4,0,126,140,15,111,46,6,13,50,0,3,31,37,2,9,20,4,0,3,13,213,4,14,162,
+15,12,76,1,5,78,3,3,56,0,0,192,59,15,128,1,17,20,143,64,0,15,128,1,13,15,247,2,2,8,43,26,15,128,1,48,11,167,18,15,128,1,
+9,15,78,1,3,15,228,1,24,3,173,1,2,106,26,3,9,23,4,0,3,15,128,1,32,2,147,105,0,140,15,49,223,0,3,108,129,15,128,4,21,15,128,
+1,26,5,134,4,9,141,0,1,1,0,15,206,9,8,15,1,0,19,16,3,182,144,2,85,89,15,0,9,1,0,176,22,15,128,1,46,1,95,0,6,5,0,6,1,0,1,
+9,26,3,128,7,1,196,109,9,128,1,7,45,0,15,128,4,13,111,99,171,0,0,203,67,128,1,70,1,90,6,15,128,1,2,15,218,119,47,32,107,
+247,242,107,15,128,7,4,57,0,187,235,128,7,15,128,1,35,2,95,0,6,5,0,5,1,0,1,9,29,32,0,0,247,89,27,207,128,7,5,55,0,4,116,
+0,0,146,152,0,137,0,2,60,1,7,104,4,0,1,0,82,155,87,0,0,119,237,68,15,128,1,14,7,74,192,15,128,4,29,14,140,4,15,181,13,78,
+1,148,0,15,89,18,37,10,1,0,14,25,41,1,9,32,32,15,63,248,115,1,1,0,11,113,20,9,113,63,0,13,0,0,237,20,0,35,0,12,88,42,4,128,
+13,9,61,0,3,160,85,8,83,0,1,184,1,13,29,21,8,66,2,2,78,138,8,52,0,10,64,0,12,48,0,15,1,0,77,63,39,203,191,128,1,54,15,253,
+82,4,37,127,247,52,19,11,113,20,9,113,63,0,13,0,0,237,20,0,35,0,15,97,147,17,4,127,121,8,83,0,1,148,13,13,29,21,11,128,1,
+41,91,191,52,0,15,18,148,41,15,1,0,47,95,15,59,7,0,63,217,19,52,15,253,82,133,8,128,1,47,63,7,173,167,255,221,15,1,0,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,155,0
+};
 static int dejavu_char_data[] = {32,382,112,1,13,0,0,4,33,292,126,2,13,0,0,3,34,160,126,4,13,0,0,5,35,347,0,9,13,0,0,9,36,231,84,6,13,0,0,7,37,367,0,9,13,0,0,10,38,314,0,10,13,0,0,10,39,316,126,2,13,0,0,3,40,201,126,3,13,0,0,4,41,197,126,3,13,0,0,4,42,312,112,5,13,0,0,6,43,255,14,8,13,0,0,9,44,381,14,2,13,0,0,4,45,120,126,4,13,0,0,4,46,310,126,2,13,0,0,4,47,125,126,4,13,0,0,4,48,238,84,6,13,0,0,7,49,245,84,6,13,0,0,7,50,252,84,6,13,0,0,7,51,259,84,6,13,0,0,7,52,266,84,6,13,0,0,7,53,280,84,6,13,0,0,7,54,294,84,6,13,0,0,7,55,308,84,6,13,0,0,7,56,322,84,6,13,0,0,7,57,336,84,6,13,0,0,7,58,304,126,2,13,0,0,4,59,301,126,2,13,0,0,4,60,18,28,8,13,0,0,9,61,210,14,8,13,0,0,9,62,36,28,8,13,0,0,9,63,270,112,5,13,0,0,6,64,100,0,11,13,0,0,12,65,201,42,7,13,0,0,7,66,209,42,7,13,0,0,8,67,217,42,7,13,0,0,8,68,225,42,7,13,0,0,8,69,350,84,6,13,0,0,7,70,364,84,6,13,0,0,6,71,108,28,8,13,0,0,9,72,241,42,7,13,0,0,8,73,295,126,2,13,0,0,3,74,241,126,3,13,-1,0,3,75,135,28,8,13,0,0,7,76,0,98,6,13,0,0,6,77,144,28,8,13,0,0,9,78,249,42,7,13,0,0,8,79,162,28,8,13,0,0,9,80,14,98,6,13,0,0,7,81,180,28,8,13,0,0,9,82,257,42,7,13,0,0,7,83,265,42,7,13,0,0,8,84,273,42,7,13,0,0,7,85,281,42,7,13,0,0,8,86,357,0,9,13,-1,0,7,87,0,14,9,13,0,0,9,88,289,42,7,13,0,0,7,89,297,42,7,13,0,0,7,90,27,28,8,13,0,0,9,91,237,126,3,13,0,0,4,92,372,112,4,13,0,0,4,93,217,126,3,13,0,0,4,94,279,28,8,13,0,0,9,95,21,98,6,13,0,0,6,96,193,126,3,13,0,0,6,97,35,98,6,13,0,0,7,98,42,98,6,13,0,0,7,99,378,98,5,13,0,0,6,100,56,98,6,13,0,0,7,101,63,98,6,13,0,0,7,102,60,126,4,13,0,0,4,103,70,98,6,13,0,0,7,104,84,98,6,13,0,0,7,105,283,126,2,13,0,0,3,106,277,126,2,13,0,0,3,107,344,56,7,13,0,0,6,108,298,126,2,13,0,0,3,109,171,0,10,13,0,0,11,110,98,98,6,13,0,0,7,111,105,98,6,13,0,0,7,112,112,98,6,13,0,0,7,113,119,98,6,13,0,0,7,114,336,112,5,13,0,0,5,115,126,98,6,13,0,0,7,116,5,126,4,13,0,0,4,117,140,98,6,13,0,0,7,118,351,28,8,13,-1,0,6,119,110,14,9,13,0,0,9,120,154,98,6,13,0,0,6,121,36,42,8,13,-1,0,6,122,252,112,5,13,0,0,5,123,168,98,6,13,0,0,7,124,259,126,2,13,0,0,4,125,182,98,6,13,0,0,7,126,360,28,8,13,0,0,9,160,321,126,1,13,0,0,7,161,286,126,2,13,0,0,3,162,189,98,6,13,0,0,7,163,196,98,6,13,0,0,7,164,361,42,7,13,0,0,7,165,20,14,9,13,-1,0,7,166,307,126,2,13,0,0,4,167,264,112,5,13,0,0,6,168,95,126,4,13,0,0,6,169,80,14,9,13,1,0,11,170,240,112,5,13,0,0,5,171,160,70,7,13,0,0,7,172,18,42,8,13,0,0,9,173,115,126,4,13,0,0,4,174,190,14,9,13,1,0,11,175,90,126,4,13,0,0,6,176,80,126,4,13,0,0,6,177,27,42,8,13,0,0,9,178,75,126,4,13,0,0,4,179,70,126,4,13,0,0,4,180,40,126,4,13,1,0,6,181,240,56,7,13,0,0,7,182,203,98,6,13,0,0,7,183,313,126,2,13,0,0,4,184,169,126,3,13,1,0,6,185,45,126,4,13,0,0,4,186,288,112,5,13,0,0,5,187,136,70,7,13,0,0,7,188,237,0,10,13,0,0,11,189,292,0,10,13,0,0,11,190,270,0,10,13,0,0,11,191,276,112,5,13,0,0,6,192,128,70,7,13,0,0,7,193,305,42,7,13,0,0,7,194,219,14,8,13,-1,0,7,195,0,56,7,13,-2,0,7,196,8,56,7,13,0,0,7,197,24,56,7,13,0,0,7,198,248,0,10,13,0,0,11,199,80,56,7,13,0,0,8,200,210,98,6,13,0,0,7,201,217,98,6,13,0,0,7,202,259,98,6,13,0,0,7,203,273,98,6,13,0,0,7,204,25,126,4,13,-1,0,3,205,20,126,4,13,0,0,3,206,15,126,4,13,0,0,3,207,10,126,4,13,0,0,3,208,368,56,7,13,0,0,8,209,0,70,7,13,-1,0,8,210,237,14,8,13,0,0,9,211,246,14,8,13,0,0,9,212,62,0,13,13,1,0,9,213,264,14,8,13,2,0,9,214,273,14,8,13,1,0,9,215,144,70,7,13,1,0,9,216,140,14,9,13,0,0,9,217,192,70,7,13,0,0,8,218,200,70,7,13,0,0,8,219,329,42,7,13,0,0,8,220,337,42,7,13,0,0,8,221,345,42,7,13,0,0,7,222,287,98,6,13,0,0,7,223,294,98,6,13,0,0,7,224,301,98,6,13,0,0,7,225,315,98,6,13,0,0,7,226,329,98,6,13,0,0,7,227,343,98,6,13,0,0,7,228,350,98,6,13,0,0,7,229,364,98,6,13,0,0,7,230,226,0,10,13,0,0,11,231,378,28,5,13,0,0,6,232,7,112,6,13,0,0,7,233,14,112,6,13,0,0,7,234,21,112,6,13,0,0,7,235,28,112,6,13,0,0,7,236,165,126,3,13,-1,0,3,237,377,112,4,13,0,0,3,238,233,126,3,13,0,0,3,239,249,126,3,13,0,0,3,240,42,112,6,13,0,0,7,241,70,112,6,13,0,0,7,242,84,112,6,13,0,0,7,243,98,112,6,13,0,0,7,244,112,112,6,13,0,0,7,245,126,112,6,13,0,0,7,246,133,112,6,13,0,0,7,247,90,28,8,13,0,0,9,248,233,42,7,13,0,0,7,249,140,112,6,13,0,0,7,250,147,112,6,13,0,0,7,251,154,112,6,13,0,0,7,252,161,112,6,13,0,0,7,253,297,28,8,13,-1,0,6,254,168,112,6,13,0,0,7,255,315,28,8,13,-1,0,6,256,168,70,7,13,0,0,7,257,28,98,6,13,0,0,7,258,80,70,7,13,0,0,7,259,182,112,6,13,0,0,7,260,333,28,8,13,0,0,7,261,189,112,6,13,0,0,7,262,296,56,7,13,0,0,8,263,377,0,6,13,0,0,6,264,280,56,7,13,0,0,8,265,216,112,5,13,0,0,6,266,200,56,7,13,0,0,8,267,378,84,5,13,0,0,6,268,104,56,7,13,0,0,8,269,366,112,5,13,0,0,6,270,369,42,7,13,0,0,8,271,377,42,6,13,0,0,7,272,96,56,7,13,0,0,9,273,120,56,7,13,0,0,7,274,224,70,6,13,0,0,7,275,231,70,6,13,0,0,7,276,238,70,6,13,0,0,7,277,245,70,6,13,0,0,7,278,252,70,6,13,0,0,7,279,259,70,6,13,0,0,7,280,266,70,6,13,0,0,7,281,273,70,6,13,0,0,7,282,280,70,6,13,0,0,7,283,287,70,6,13,0,0,7,284,345,14,8,13,0,0,9,285,294,70,6,13,0,0,7,286,363,14,8,13,0,0,9,287,301,70,6,13,0,0,7,288,336,14,8,13,0,0,9,289,308,70,6,13,0,0,7,290,354,14,8,13,0,0,9,291,315,70,6,13,0,0,7,292,177,42,7,13,0,0,8,293,300,112,5,13,1,0,7,294,120,14,9,13,0,0,10,295,322,70,6,13,0,0,8,296,253,126,2,13,1,0,3,297,318,112,5,13,-1,0,3,298,213,126,3,13,0,0,3,299,221,126,3,13,0,0,3,300,209,126,3,13,0,0,3,301,185,126,3,13,0,0,3,302,181,126,3,13,0,0,3,303,173,126,3,13,0,0,3,304,265,126,2,13,0,0,3,305,268,126,2,13,0,0,3,306,210,112,5,13,0,0,6,307,282,112,5,13,0,0,6,308,130,126,4,13,-3,0,3,309,225,126,3,13,0,0,3,310,318,14,8,13,0,0,7,311,32,56,7,13,0,0,6,312,56,56,7,13,0,0,6,313,329,70,6,13,0,0,6,314,65,126,4,13,0,0,3,315,336,70,6,13,0,0,6,316,274,126,2,13,0,0,3,317,171,28,8,13,0,0,6,318,55,126,4,13,0,0,3,319,343,70,6,13,0,0,6,320,150,126,4,13,0,0,4,321,98,84,6,13,0,0,6,322,245,126,3,13,0,0,3,323,161,42,7,13,0,0,8,324,357,70,6,13,0,0,7,325,72,56,7,13,0,0,8,326,364,70,6,13,0,0,7,327,169,42,7,13,0,0,8,328,371,70,6,13,0,0,7,329,327,14,8,13,0,0,9,330,16,56,7,13,0,0,8,331,0,84,6,13,0,0,7,332,309,14,8,13,0,0,9,333,7,84,6,13,0,0,7,334,300,14,8,13,0,0,9,335,14,84,6,13,0,0,7,336,282,14,8,13,0,0,9,337,21,84,6,13,0,0,7,338,148,0,11,13,0,0,12,339,281,0,10,13,0,0,11,340,232,56,7,13,0,0,7,341,348,112,5,13,0,0,5,342,88,56,7,13,0,0,7,343,246,112,5,13,0,0,5,344,288,56,7,13,0,0,7,345,222,112,5,13,0,0,5,346,312,56,7,13,0,0,8,347,28,84,6,13,0,0,7,348,336,56,7,13,-4,0,8,349,35,84,6,13,0,0,7,350,176,70,7,13,0,0,8,351,42,84,6,13,0,0,7,352,288,28,8,13,1,0,8,353,49,84,6,13,0,0,7,354,184,70,7,13,0,0,7,355,155,126,4,13,0,0,4,356,185,42,7,13,-2,0,7,357,100,126,4,13,0,0,4,358,40,56,7,13,0,0,7,359,135,126,4,13,0,0,4,360,112,56,7,13,0,0,8,361,56,84,6,13,0,0,7,362,216,56,7,13,0,0,8,363,63,84,6,13,0,0,7,364,153,42,7,13,0,0,8,365,70,84,6,13,0,0,7,366,145,42,7,13,0,0,8,367,77,84,6,13,0,0,7,368,137,42,7,13,0,0,8,369,84,84,6,13,0,0,7,370,81,42,7,13,0,0,8,371,48,56,7,13,0,0,7,372,160,14,9,13,0,0,9,373,90,14,9,13,0,0,9,374,256,56,7,13,0,0,7,375,228,14,8,13,-1,0,6,376,72,42,8,13,-2,0,7,377,63,42,8,13,0,0,9,378,234,112,5,13,0,0,5,379,54,42,8,13,0,0,9,380,294,112,5,13,0,0,5,381,45,42,8,13,0,0,9,382,306,112,5,13,0,0,5,383,50,126,4,13,0,0,4,384,91,84,6,13,0,0,7,385,40,14,9,13,-2,0,8,386,88,70,7,13,0,0,8,387,105,84,6,13,0,0,7,388,120,70,7,13,0,0,8,389,112,84,6,13,0,0,7,390,8,70,7,13,0,0,8,391,30,14,9,13,0,0,8,392,64,56,7,13,0,0,6,393,264,56,7,13,0,0,9,394,50,14,9,13,-2,0,9,395,304,56,7,13,0,0,8,396,119,84,6,13,0,0,7,397,353,42,7,13,0,0,7,398,126,84,6,13,0,0,7,399,9,42,8,13,0,0,9,400,133,84,6,13,0,0,7,401,140,84,6,13,0,0,6,402,258,112,5,13,-1,0,4,403,259,0,10,13,0,0,9,404,0,42,8,13,0,0,8,405,160,0,10,13,0,0,11,406,0,126,4,13,0,0,4,407,189,126,3,13,0,0,3,408,369,28,8,13,1,0,8,409,136,56,7,13,0,0,6,410,205,126,3,13,0,0,3,411,208,56,7,13,0,0,7,412,193,0,10,13,0,0,11,413,342,28,8,13,-1,0,8,414,147,84,6,13,0,0,7,415,324,28,8,13,0,0,9,416,325,0,10,13,0,0,10,417,352,56,7,13,0,0,7,418,303,0,10,13,0,0,10,419,306,28,8,13,0,0,8,420,270,28,8,13,-2,0,7,421,154,84,6,13,0,0,7,422,161,84,6,13,1,0,7,423,168,84,6,13,0,0,7,424,175,84,6,13,0,0,7,425,182,84,6,13,0,0,7,426,189,84,6,13,-2,0,4,427,30,126,4,13,0,0,4,428,321,42,7,13,0,0,7,429,110,126,4,13,0,0,4,430,313,42,7,13,0,0,7,431,100,14,9,13,0,0,9,432,126,28,8,13,0,0,7,433,45,28,8,13,0,0,8,434,193,42,7,13,1,0,8,435,150,14,9,13,0,0,8,436,291,14,8,13,0,0,9,437,129,42,7,13,0,0,8,438,196,84,6,13,0,0,6,439,121,42,7,13,0,0,7,440,113,42,7,13,0,0,7,441,203,84,6,13,0,0,6,442,210,84,6,13,0,0,6,443,217,84,6,13,0,0,7,444,105,42,7,13,0,0,7,445,224,84,6,13,0,0,6,446,324,112,5,13,0,0,6,447,97,42,7,13,0,0,7,448,271,126,2,13,1,0,3,449,35,126,4,13,1,0,5,450,330,112,5,13,0,0,5,451,319,126,1,13,0,0,3,452,0,0,16,13,0,0,16,453,34,0,13,13,0,0,14,454,88,0,11,13,0,0,13,455,372,14,8,13,0,0,9,456,0,28,8,13,0,0,9,457,140,126,4,13,0,0,5,458,10,14,9,13,0,0,10,459,180,14,9,13,0,0,10,460,9,28,8,13,0,0,9,461,128,56,7,13,0,0,7,462,273,84,6,13,0,0,7,463,280,126,2,13,0,0,3,464,229,126,3,13,0,0,3,465,117,28,8,13,0,0,9,466,287,84,6,13,0,0,7,467,144,56,7,13,0,0,8,468,301,84,6,13,0,0,7,469,152,56,7,13,0,0,8,470,315,84,6,13,0,0,7,471,160,56,7,13,0,0,8,472,329,84,6,13,0,0,7,473,168,56,7,13,0,0,8,474,343,84,6,13,0,0,7,475,176,56,7,13,0,0,8,476,357,84,6,13,0,0,7,477,323,126,1,13,0,0,7,478,184,56,7,13,0,0,7,479,371,84,6,13,0,0,7,480,192,56,7,13,0,0,7,481,7,98,6,13,0,0,7,482,215,0,10,13,0,0,11,483,204,0,10,13,0,0,11,484,130,14,9,13,0,0,9,485,224,56,7,13,0,0,7,486,54,28,8,13,0,0,9,487,49,98,6,13,0,0,7,488,63,28,8,13,0,0,7,489,248,56,7,13,0,0,6,490,72,28,8,13,0,0,9,491,77,98,6,13,0,0,7,492,81,28,8,13,0,0,9,493,91,98,6,13,0,0,7,494,272,56,7,13,0,0,7,495,85,126,4,13,0,0,6,496,177,126,3,13,0,0,3,497,17,0,16,13,0,0,16,498,48,0,13,13,0,0,14,499,112,0,11,13,0,0,13,500,99,28,8,13,0,0,9,501,133,98,6,13,0,0,7,502,136,0,11,13,1,0,12,503,147,98,6,13,1,0,8,504,320,56,7,13,0,0,8,505,161,98,6,13,0,0,7,506,328,56,7,13,0,0,8,507,175,98,6,13,0,0,7,508,182,0,10,13,0,0,11,509,336,0,10,13,0,0,11,510,70,14,9,13,0,0,9,511,360,56,7,13,0,0,7,512,216,70,7,13,0,0,7,513,350,70,6,13,0,0,7,514,376,56,7,13,0,0,7,515,224,98,6,13,0,0,7,516,231,98,6,13,0,0,7,517,238,98,6,13,0,0,7,518,245,98,6,13,0,0,7,519,252,98,6,13,0,0,7,520,262,126,2,13,0,0,3,521,228,112,5,13,-1,0,3,522,256,126,2,13,0,0,3,523,145,126,4,13,0,0,3,524,153,28,8,13,0,0,9,525,266,98,6,13,0,0,7,526,189,28,8,13,0,0,9,527,280,98,6,13,0,0,7,528,16,70,7,13,0,0,7,529,378,70,5,13,0,0,5,530,24,70,7,13,0,0,7,531,342,112,5,13,0,0,5,532,32,70,7,13,0,0,8,533,308,98,6,13,0,0,7,534,40,70,7,13,0,0,8,535,322,98,6,13,0,0,7,536,48,70,7,13,0,0,8,537,336,98,6,13,0,0,7,538,56,70,7,13,0,0,7,539,105,126,4,13,0,0,4,540,64,70,7,13,0,0,7,541,357,98,6,13,0,0,6,542,72,70,7,13,0,0,8,543,371,98,6,13,0,0,7,544,0,112,6,13,1,0,8,545,200,14,9,13,0,0,9,546,198,28,8,13,0,0,8,547,96,70,7,13,0,0,7,548,104,70,7,13,0,0,8,549,35,112,6,13,0,0,6,550,112,70,7,13,0,0,7,551,49,112,6,13,0,0,7,552,56,112,6,13,0,0,7,553,63,112,6,13,0,0,7,554,207,28,8,13,0,0,9,555,77,112,6,13,0,0,7,556,216,28,8,13,0,0,9,557,91,112,6,13,0,0,7,558,225,28,8,13,0,0,9,559,105,112,6,13,0,0,7,560,234,28,8,13,0,0,9,561,119,112,6,13,0,0,7,562,152,70,7,13,0,0,7,563,243,28,8,13,-1,0,6,564,354,112,5,13,0,0,5,565,60,14,9,13,0,0,9,566,360,112,5,13,0,0,5,567,289,126,2,13,0,0,3,568,76,0,11,13,0,0,11,569,124,0,11,13,0,0,11,570,252,28,8,13,0,0,8,571,261,28,8,13,0,0,8,572,175,112,6,13,0,0,6,573,208,70,7,13,0,0,6,574,170,14,9,13,-1,0,7,575,196,112,6,13,0,0,6,576,203,112,6,13,0,0,6,577,89,42,7,13,0,0,7};
 
 class DejaVu : public BitmapFont {
@@ -15,6 +408,10 @@ public:
        return false;
     }
 
+    if(setupShared(&dejavu_pixel_data[0])) {
+      return true;
+    }
+
     line_height = 13;
     scale_w = 384;
     scale_h = 256;
@@ -38,9 +435,7 @@ public:
       chars[c.id] = c;
     }
 
-    setupTexture(scale_w, scale_h, (unsigned char*)&dejavu_pixel_data[0]);
-
-    return true;
+    return setupTexture(scale_w, scale_h, dejavu_pixel_data, sizeof(dejavu_pixel_data));
   }
 };
 
@@ -0,0 +1,94 @@
+/*
+
+  FontAtlas
+  ---------
+
+  Packs the baked DejaVu and FontAwesome glyphs into one texture so
+  that labels, numbers and icons can be written into the same vertex
+  buffer and drawn with one draw call. DejaVu is stored in the top
+  half of the texture and FontAwesome in the bottom half; the y
+  coordinates of the icon glyphs are offset accordingly.
+
+  The code points of both fonts are stored in the same `chars` map.
+  A couple of code points exist in both fonts (e.g. the space); for
+  those we use the DejaVu glyph, the icons all use the private use
+  area (see GUI_ICON_* in Types.h).
+
+ */
+#ifndef REMOXLY_FONT_ATLAS_H
+#define REMOXLY_FONT_ATLAS_H
+
+#include <vector>
+#include <stdio.h>
+#include <gui/bitmapfont/BitmapFont.h>
+#include <gui/fonts/FontAwesome.h>
+#include <gui/fonts/DejaVu.h>
+
+namespace rx {
+
+class FontAtlas : public BitmapFont {
+public:
+
+  bool setup() {
+
+    if(!setupGraphics()) {
+       return false;
+    }
+
+    /* the first atlas builds the texture, the others share it. */
+    if(setupShared(&fontawesome_char_data[0])) {
+      return true;
+    }
+
+    int page_w = 384;
+    int page_h = 256;
+
+    line_height = 13;
+    scale_w = page_w;
+    scale_h = page_h * 2;
+    pages = 1;
+    base = 10;
+
+    /* icons first so the DejaVu glyphs win when a code point exists in both. */
+    addChars(fontawesome_char_data, sizeof(fontawesome_char_data) / (sizeof(int) * 8), page_h);
+    addChars(dejavu_char_data, sizeof(dejavu_char_data) / (sizeof(int) * 8), 0);
+
+    /* the baked pixels are compressed; decompress each page into its half */
+    std::vector<unsigned char> pix(scale_w * scale_h);
+
+    if(!decompress(dejavu_pixel_data, sizeof(dejavu_pixel_data), &pix[0], page_w * page_h)
+       || !decompress(fontawesome_pixel_data, sizeof(fontawesome_pixel_data), &pix[page_w * page_h], page_w * page_h))
+      {
+        printf("Error: cannot decompress the pixels of the font atlas.\n");
+        return false;
+      }
+
+    setupTexture(scale_w, scale_h, &pix[0]);
+
+    return true;
+  }
+
+private:
+
+  void addChars(int* data, int num_chars, int offset_y) {
+
+    int max_els = num_chars * 8;
+    int i = 0;
+
+    while(i < max_els) {
+      Character c;
+      c.id       = data[i++];
+      c.x        = data[i++];
+      c.y        = data[i++] + offset_y;
+      c.width    = data[i++];
+      c.height   = data[i++];
+      c.xoffset  = data[i++];
+      c.yoffset  = data[i++];
+      c.xadvance = data[i++];
+      chars[c.id] = c;
+    }
+  }
+};
+
+} // namespace rx
+#endif
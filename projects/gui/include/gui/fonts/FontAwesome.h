@@ -1,10 +1,526 @@
 #ifndef FONTAWESOME_BAKED_H
 #define FONTAWESOME_BAKED_H
 
+namespace rx {
 
-namespace rx { 
-
-static uint64_t fontawesome_pixel_data[] = {0x0,0x0,0x0,0x0,0x8c00000000000000,0xffffffffffffffff,0xb3ffffffffffff,0xe622000000000000,0x43f3ffffffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5e5e229b0000,0x8cffe622000000,0xe6ff5e0000000000,0x22,0xffffffffffff8c00,0xffffffffffffffff,0x8c,0x0,0xce22000000000000,0x22,0x22ce220000000000,0xffb3000000000000,0x13ceffffffffff,0xfff3430000000000,0x8cffff,0x0,0xe622b3ffffffffb3,0x13ce,0xffffffff8c000000,0xffffffffffffffff,0x8cffff,0x0,0x0,0x0,0x0,0x0,0x22e6fff343,0x0,0x22e6fff343000000,0x0,0x0,0x0,0x0,0x0,0x0,0xffffffffffffff8c,0x8cffffffffffffff,0x0,0x0,0x0,0x22e6fff3430000,0x0,0x0,0x0,0xffffff8c00000000,0xffffffffffffffff,0x8cffffff,0x0,0x13cefffff34300,0x43f3ffffce130000,0xfffff34300000000,0x13ce,0x5ece1343da22,0x4322e65e00000000,0x22da,0x0,0xce22000000000000,0x22,0x22ce220000000000,0xffffffffce130000,0xffffffffffffffff,0x5ece13000013ce,0x5ece1300,0x2200000000000000,0x22e6ffffffffffe6,0x43f3b3,0x22ce220000,0x0,0x22ce2200,0x0,0x0,0xffffffff5e000000,0x5effffffffffff,0xb300000000000000,0x8cffffffffff,0x0,0xffffffffffb30000,0x8c,0xffffffffffce1300,0xffffffffffffffff,0x22e6ff,0x0,0x2200000000000000,0x22ce,0xce22000000000000,0x22,0xffffffffe6220000,0xb3ffff,0x8cffffffffffb300,0x0,0x0,0x0,0x22ce22000000,0x0,0x22ce220000,0x5effb3000000,0x13ce8c43e74300,0x5effffffce130000,0xffffff5e43f3f343,0x22e6,0x5ece1322ce22,0x2213c24300000000,0x22ce,0x0,0xce22000000000000,0x22,0x22ce220000000000,0xffffffffffce1300,0xffffffffffffffff,0x22ce220013ceff,0xffffffffffb30000,0x22000000000000b3,0xe6ffffff5e00b3e6,0x43f3b322,0x22ce220000,0x0,0x22ce2200,0xffffffffb3008043,0x13ceffffff,0x43c2130000,0x13c2430000000000,0xff5e000000000000,0xe665f3ffffffffff,0x8c,0xffffffffffff5e00,0x8ce665f3,0x43f3ffe62200,0xf343000000000000,0x22e6ff,0x0,0x2200000000000000,0x22ce,0xce44e6f343000000,0x22,0xffffffffffe62200,0x22e6ffff,0xf3ffffffffffff5e,0x8ce665,0xffffffffffff8c00,0xffffffffffffffff,0xe62222ce2200008c,0x8c,0x22ce220000,0xc2438cffce26b522,0x22e6f34313ceff72,0xa9e6ffff8c000000,0xffffce9bffffffff,0xb3,0x5effffffe622,0xfffff34300000000,0x5effffe6220022e6,0x5effffff8c00,0xce220022e6ffffb3,0x22,0x22ce220000000000,0xffffffffffe62200,0xfffffffff34343f3,0x22ce220022e6ff,0x0,0x220000000000b3b3,0xffffffff8c13cee6,0x43f3b322e6,0xffffffffe6220000,0xffffffffffffffff,0x2200000022e6ffff,0xffffffe6225effe6,0x22e6ffffff,0x43c2130000,0x22da430000000000,0xffce130000000000,0xffffffe644e6ffff,0xb3ff,0x8c008cffffffce13,0xb3ffffffff,0x13ceffe62200,0xce13000043f3f343,0x22e6ff,0xffffffffffffff8c,0x220000000000b3ff,0x8cffb300000022ce,0xce44e6f343000000,0x22,0xffffffffffffce13,0x13000000005effff,0xffffffffffffffce,0xb3ffffff,0x22ce22,0x2200000000000000,0xffce35ce220022ce,0x5eff,0x22000022ce220000,0xffffffffffffffe6,0xb3ffffe622b3,0xe622000043520000,0x43f3ffffffff,0x5243,0x5effffffe622,0xfffff34300000000,0xceffffb3000022e6,0x43005effffb30013,0xce220013cefffff3,0x22,0x22ce220000000000,0x5effffffffe62200,0xffffff5e00000000,0x22ce220022e6ff,0x0,0x220000000013c243,0xffffffffffffffe6,0x43f3b322e6ff,0xffffffffe6220000,0xffffffffffffffff,0xce13000022e6ffff,0xffffe62243f3ffff,0x22e6ffffff,0x43c2130000,0x22da430000000000,0xffce130000000000,0xffffe6220022e6ff,0x22e6ff,0x8c008cffffffce13,0x22e6ffffffff,0x2200000022ce2200,0x43f38c5ee6,0xff8c00000022ce22,0xffffffffffffffff,0x22000000b3ffffff,0x8cffb300000022ce,0xce44e6f343000000,0x22,0xffffffffffffffb3,0x1300000000008cff,0xffffffffffffffce,0x22e6ffffff,0x8c4380229b22ce22,0x35b522a7438c5e5e,0xffce35ce220022ce,0x5eff5e0000005eff,0x22ce220000,0xf3ffffffffffff8c,0x22e6cec1f34343,0xf39cffffffce1300,0xfff39cffffffffff,0x13ceff,0x5ece1322ce22,0x2213c24300000000,0xfffff343000022ce,0xb3005effffb3005e,0xce22000043f3ffff,0x22,0x22ce220000000000,0xb3ffffffe62200,0xffffb313ceffffb3,0x22ce220022e6ff,0x0,0x130000000013c243,0xffffffffffffffce,0x43f3b322e6ffff,0xffffffffe6220000,0xffffffffffffffff,0xffb3000022e6ffff,0x22e6ffffff,0x22e6f34300,0x43c2130000,0x22da430000000000,0xffffce1300000000,0xffe62200000022e6,0x130000000000b3ff,0x8c008cffffffffce,0xb3ffffffff,0x8c00000022ce2200,0x8cff8c008c,0xffff5e000022ce22,0xffffffffffce138c,0x2200008cffffffff,0x8cffb300000022ce,0xce44e6f343000000,0xb300000000000022,0xffffffffffffffff,0xce130000000000b3,0xffffffffffffffff,0xb3ffffff,0x8c5eb343c235ce22,0x44da56ce5eb35e8c,0xce1322ce220022ce,0xffffff5e0000005e,0x43000022ce22005e,0xffce1300008cfff3,0xb3,0xe6a9ffffffe62200,0xffff9cf3ffffffff,0x22e6ff,0x8ce6225ee622,0x4322e65e00000000,0xffffb300000022da,0xff5e5effffb313ce,0xce220000005effff,0x22,0x22ce220000000000,0x5e5effffffe62200,0xffff5e5effffffff,0x22ce220022e6ff,0xffffffffffffffb3,0x13ceffffffff,0xffffffffffffff5e,0x43f3b322e6ffffff,0xffffffffe6220000,0xffffffffffffffff,0xffce130022e6ffff,0x43f3ffffff,0x22e6f34300,0x43c2130000,0x22da430000000000,0xffffff8c00000000,0xff5e00000000005e,0x8c00000043f3ffff,0x8c008cffffffffff,0x43f3ffffffffff,0xb300000022ce2200,0xb3ff8c8cff,0xffffce130022ce22,0xffffffffffce138c,0x220013cef34313ce,0x8cffb300000022ce,0xce44e6f343b3ff8c,0xff8c000000000022,0xceffffffffffffff,0xff8c000000000013,0xffffffffffffffff,0x43f3ffffffff,0x22ce22,0x44da430000000000,0x22ce220022ce,0xffffffff5e000000,0xe6220022ce225eff,0xff8c00000043f3ff,0xb3ff,0x9bceffffffe62200,0xffffce9bffffffff,0x22e6ff,0xffffffffffffe622,0xffffffffffffffff,0xffe62200000022e6,0xffffffffffffffff,0xce2200000000b3ff,0x22,0x22ce220000000000,0x5e5effffffe62200,0xfff3438cffffffff,0x8c22ce220022e6ff,0x13ce,0x13ce8c000000,0xffffffffffff5e00,0xcee622b3ffffffff,0x22ce220013,0x0,0x1300000022ce2200,0x5effce,0x22e6f34300,0x43c2130000,0x22da430000000000,0xffffffe622000000,0xffffff8c008cffff,0xe6220013ceffffff,0x13ceffffff,0x13ceffffffffce13,0x8c00000022ce2200,0xb3ff8c8cff,0xb3e6220022ce22,0xffffffe622000000,0x220022e6ff8c43f3,0x8cffb300000022ce,0xce44e6f343b3ff8c,0xffff5e0000000022,0x13ceffffffffffff,0xffe6220000000000,0xffffffffffffffff,0x13ceffffffffff,0x8cb35effce35ce22,0x44e6f343b35e8c8c,0x220022ce220022ce,0xffffffffff5eb3e6,0xe6220022ce44e6ff,0xffb30000005effff,0xb3ff,0xb3f365e6ff5e0000,0xce72ff8c43f3f343,0x5eff,0x5ece1322ce22,0x2213c24300000000,0xff5e0000000022ce,0xffffffffffffffff,0xe62200000000b3ff,0xffffffffffffffff,0x22e6ffffffffffff,0x228cffffffe62200,0xffff8c22e6ffffe6,0xe680ce220022e6ff,0x22,0x43e7430000,0xffffffffff5e0000,0x8cff5e5effffffff,0x22ce220000,0x0,0x1300000022ce2200,0x5e000000005effce,0x22e6ffffffffff,0x43c2130000,0x22da430000000000,0xffffffe622000000,0xffffff8c008cffff,0xe6220022e6ffffff,0x130013ceffffffff,0x22e6ffffffffffce,0x4300000022ce2200,0x5e5e000080,0x13cee6220022ce22,0xb3fff343000000,0x220022e6ffffff5e,0x8cffb35effce35ce,0xce44e6f343b3ff8c,0x43e74300000022,0x22e65e00000000,0xffe6220000000000,0xffffffffffffffff,0x22e6ffffffffff,0x22ce22,0x2200000000000000,0xe62222ce220022ce,0xffffffffffffffff,0x22ce44e6ff,0xe6ff8c005effff5e,0x22e6b35eff5e22,0xfffff34300000000,0x43f3ffffffffffff,0x0,0x5ece1343da22,0x2213c24300000000,0xb3000000000022ce,0xffffffffffffffff,0xe622000000b3ffff,0xffffffffffffffff,0x22e6ffffffffffff,0x43f3ffffffe62200,0xffffe62200b3b300,0x43f3e6220022e6ff,0x0,0x5ee62200,0xffffffff5e000000,0x8cff5e5effffff,0x22ce220000,0x0,0x1300000022ce2200,0x5effce,0x43f3ffffff8c,0xffffffff5e000000,0x8cffffffffffff,0xffffffce13000000,0xffffff8c008cffff,0xce130022e6ffffff,0xce26ceffffffffff,0x22e6ffffffffffff,0xb3ffe62200,0xb3000000b3ffff8c,0xffffb3000022e6ff,0x13ceffffffce138c,0x220000b3ffffff8c,0x8cffb35effce35ce,0xce44e6f343b3ff8c,0x5ef343000022,0x43f35e000000,0xffce130000000000,0xffffffffffffffff,0x22e6ffffffffff,0xffffb343c235ce22,0x44da56ceffffffff,0xffce35ce220022ce,0xffffffffffffffff,0x22000022ce44e6ff,0xffffffffffffffe6,0xb3ffffe622b3,0xffffff8c00000000,0xb3ffffffffffffff,0x0,0x5effffffe622,0xfffff34300000000,0x13000000000022e6,0xe6228cffffffffce,0xb30000008cffffff,0xffffffffffffffff,0xb3ffffffffffff,0xffffffffffe62200,0xfffffff34300005e,0x8ce6220022e6ff,0x0,0x8cce13,0xffffff5e00000000,0x8cff5e5effff,0x5effce35ce220000,0x8cffffb3,0x1300000022ce2200,0xceffffffffffffce,0x5effffb313,0xffffffffffffe622,0xffffffffffffffff,0xfffff343000022e6,0xffffffffffffffff,0x430000008cffffff,0xfffffffffffffff3,0x8cffffffffffff,0x43f3ffe62200,0xf343000000000000,0xffe622000022e6ff,0xffffffffffffffff,0x22000022e6ffffff,0x8cffb35effce35ce,0xce44e6f343b3ff8c,0x8cce130022,0x5ef3430000,0xf343000000000000,0xffffffffffffffff,0x8cffffffffff,0x22ce22,0x2200000000000000,0xffce35ce220022ce,0xffffffffffffffff,0x22ce44e6ff,0xe68c8cffce56f35e,0x22e6f34313ceff80,0xffffffce13000000,0xceffffffffffffff,0x13,0x5ece1322ce22,0x2213c24300000000,0x22ce,0x22005efffff34300,0x22e6ffffe6,0xfffff34300000000,0x5eff,0xffffffffffe62200,0xffffffffffffffff,0xffff5e000022e6ff,0xffffffffffffffff,0x8cff,0xffff5e0000000000,0x8cff5e5eff,0x22ce220000,0x0,0x1300000022ce2200,0xffffffffffffffce,0x8cce13b3,0xffffffffffffce13,0xffffffffffffffff,0xfff34300000022e6,0xffffffffffffffff,0x8cffff,0xfffffffffffff343,0x8cffffffffff,0xffffffffffe62200,0xffffffffffffffff,0xb30000000022e6ff,0xf34300005effffff,0x2200000013ceffff,0x22ce,0xce22000000000000,0xffffffffce130022,0x5effffff,0x4300000000000000,0xfffffffffffffff3,0x8cffffffff,0xffffffffffffce13,0xffffffffffffffff,0x22ce220013ce,0x0,0x22ce220000,0x8cffb3000000,0x22e6f34322e6ff5e,0xffffffce13000000,0xceffffffffffffff,0x13,0x5ece1322ce22,0x2213c24300000000,0x22ce,0x0,0x0,0xffffffb300000000,0xb3ff,0xffffffffff5e0000,0xffffffffffffffff,0x5eff,0x0,0x0,0xff5e000000000000,0x8cf3435e,0xffffffffce130000,0xffffffffffffffff,0x13ceffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1300000000000000,0xffffffffffffffce,0xceffffffffffffff,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0xffffffce13000000,0xffffffffffffffff,0x13ceffffff,0x0,0xb3ffffe62200,0xffffffce13000000,0xceffffffffffffff,0x13,0xffffffffffffce13,0xffffffffffffffff,0x13ce,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x13ce8c5ef34300,0xffffff5e00000000,0x5effffffffffffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2200000000000000,0x22ce,0x0,0x5243000000000000,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xb300000000000000,0xb3ffffffffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xb300000000000000,0x8cffffffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5ece130000000000,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe622000000000000,0x22e6ff,0x0,0xf343000000000000,0x5e,0x0,0xe622000000000000,0x73220000000022e6,0x22730000000000,0xffffffffffffe622,0xe6ffffffffffffff,0xb300000000000022,0xb35e0000005e,0x0,0x8cffffffffff8c00,0x0,0x0,0x0,0x8cfffffff34300,0x0,0xffce130000000000,0xb38c00005e,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x735748668e220000,0x82c29c9c65824857,0x5eff8c0000228eb5,0x0,0x0,0x0,0x0,0xff5e000000000000,0xb3ffff,0xf343000000000000,0x5e,0x0,0x0,0x0,0x5effffb300,0xb3ffff5e,0x0,0x0,0x8cfffff3430000,0xffe6220000000000,0x22e6ffff,0x8cffffe6220000,0xffffffffb3000000,0x5eff,0xb3ffffffb30000,0xe622000000000000,0x8ce62200000043f3,0x22e68c00000000,0xffffffffffffe622,0xce220000b3ffffff,0xffffffff5e000022,0xffffffffffffffff,0x5eff,0xb35e0000005eb300,0x0,0x13ceffb3,0x0,0x5effffffffffce13,0x0,0xb3b3ce1300000000,0xb38c00005e,0x0,0x0,0x0,0xffffffffffffb300,0x8cffffffff,0xffffb322e6ffce13,0xe6ffffffffffffff,0x735748668e220022,0x82c29c9c65824857,0x5eb3000000228eb5,0xffffffffffffb300,0x22e6ffffff,0x13ceffffe6220000,0x0,0x13cece1300000000,0xb3ff8c00,0xfff3430000000000,0x5e,0xf343000000000000,0xffffffffffffffff,0x430000000043f3ff,0xe644e6e62200b3f3,0x43f3b30022e6,0xffffffffffff8c00,0x5effffffffffffff,0x8cfffff3430000,0x8c00000000000000,0x8cff,0xe6ffffffe6220000,0xfffffffffff34322,0x5e0000000022e6ff,0xffffffffffffffff,0xe622000000005eff,0x8cffe622000043f3,0x22e6ff8c000000,0xffffffffffffe622,0xe6ffffffffffffff,0xffffffffe6220022,0xffffffffffffffff,0x72ce13000022e6ff,0xffffffffffffffce,0xce13000013ce72ce,0x8cffffffff,0x13b522000000,0xffffffffffffe622,0xb3ffffffff,0xb300b3ce13000000,0xffffe6ce8c00005e,0xb3ff,0x0,0x0,0xffffffffffffce13,0x13ceffffffffff,0xffffb343f3ffe622,0xe6ffffffffffffff,0x735748668e220022,0x82c29c9c65824857,0x5eb3000000228eb5,0xffffffffffffb300,0x22e6ffffff,0xfffffffffffff343,0x22e6,0x43f38c00000000,0x13ceb30000,0xfffff34300000000,0xb3ffffffff,0xffff8c0000000000,0xffffffffffffffff,0xb30000008cffffff,0x8cff8c000000008c,0xb38c00000000,0xffffffffffffe622,0xe6ffffffffffffff,0x8cfffff3430022,0x8c00000000000000,0x8cff,0xffff5e0000000000,0xf3430022e6ffe680,0xff8c0000000022e6,0xffffffffffffffff,0xe6220000008cffff,0x8cffffe6220043f3,0x22e6ffff8c0000,0x0,0x0,0xffffffffe6220000,0xffffffffffffffff,0x72ffce130022e6ff,0xffffffffffffffce,0xe6220013ceff72ce,0x43f35e00005e,0x229b005ece1300,0xffffffffffffe622,0xb3ffffffffff,0xffffffffb3000000,0xb3ff8c00005e,0x22ce22,0x0,0x0,0xffffffffffffce13,0x5eff8c13ceffff,0x13ceff8c00,0x0,0x735748668e220000,0x82c29c9c65824857,0x228eb5,0x0,0x5e00000000000000,0xffffffffffffffff,0x22e6ff,0x5effce13000000,0x13c2430000,0xfffffff343000000,0xb3ffffffffffffff,0xffffce1300000000,0xffffffffcec1ffff,0xda220013ceffffff,0x43,0x22da4300000000,0xffffffffffffce13,0xceffffffffffffff,0x8cffffe6220013,0x8c000043da220000,0x22da4300008cff,0xc243000000000000,0xda43000013ceff9b,0xffff5e0000000022,0xffffffffffffffff,0xe62200005effffff,0x8cffffffe62243f3,0x22e6ffffff8c00,0xffffffffffff8c00,0x8cffffffffffffff,0xffffffffe6220000,0xffffffffffffffff,0x72ffe6220022e6ff,0xffffffffffffffce,0xce130022e6ff72ce,0x8cce130013ce,0x22b513008c8c,0xffffffffffffe622,0x13ceffffffffff,0x8cffffffe6220000,0xb3b6f3430000,0xda2200000022ce22,0x43,0x22da43,0xffffffffffffce13,0x8ce62213ceffff,0x0,0x0,0x735748668e220000,0x82c29c9c65824857,0x228eb5,0x0,0xce13000000000000,0xffffffffffffffff,0x2244b3ffff,0x5effffb300000000,0x0,0xffffffffe6220000,0xffffffffffffffff,0xffffe622000013ce,0xfffff343005effff,0xda220022e6ffffff,0x43,0x22da4300000000,0xffffffffffe62200,0x22e6ffffffffffff,0x5effffe6220000,0x8c000043f3e62200,0x22e6f34300008cff,0x2200000000000000,0x5effe6,0xffffce1300000000,0xffffffffffffffff,0xe6220013ceffffff,0x8cffffffffe665f3,0x22e6ffffffff8c,0xffffffffffffe622,0xe6ffffffffffffff,0xffffffffe6220022,0xffffffffffffffff,0x72ffe6220022e6ff,0xffffffffffffffce,0x22000022e6ff72ce,0xb39cf3ffffffffe6,0xa7430000,0xffffffffffffe622,0x13ceffffffffff,0x22ce220000,0xb35e5ef34300,0xf3e622000022ce22,0x43,0x22e6f343,0xffffffffffffce13,0x5eff8c13ceffff,0x13ceff8c00,0x0,0x735748668e220000,0x82c29c9c65824857,0xda82a70000228eb5,0x22,0xe622000000000000,0xffffffffffffffff,0x43e756ceffff,0xffffff5e00000000,0x22e6ff,0xfffffff343000000,0xffffffffffffffff,0xffffe62200008cff,0xffb30000005effff,0xb3000022e6ffffff,0x8c,0xb38c00000000,0xffffffffb3007322,0x7300b3ffffffffff,0x5effffe6220022,0xffffffffffffe622,0xe6ffffffffffffff,0x8c00000000000022,0x13ceff,0xffffe62200000000,0xffffffffffffffff,0xe6220022e6ffffff,0xffffffffffffffff,0x22e6ffffffffff,0x5effffffffe622,0xce22000000000000,0x22,0x0,0x72ffe62200000000,0xffffffffffffffce,0x22e6ff72ce,0x22c2c1cef34300,0x5e8c00,0x5effffe622,0x0,0x22ce220000,0xb35e005ef343,0xffffe6220022ce22,0xffffffffffffffff,0x22e6ffffff,0xffffffffffffce13,0x13ceffffffffff,0xffffb343f3ffe622,0xe6ffffffffffffff,0x735748668e220022,0x82c29c9c65824857,0xce8c000000228eb5,0xffffffffffffb313,0xce130022e6ffffff,0xffffffffffffffff,0x13cef343b3ffff,0x0,0x0,0xfffff34300000000,0xffffffffffffffff,0xffffe6220013ceff,0x5e000000005effff,0x43000022e6ffffff,0x43e7,0x43e743000000,0xffffff5e13cee622,0xe6ce135effffffff,0x5effffe6220022,0xffffffffffff5e00,0x5effffffffffffff,0xe622000000000000,0xc243000013b5a9ff,0xffffce1300000013,0xffffffffffffffff,0xe6220013ceffffff,0x9bffffffffff9cf3,0x22e6ffffffffce,0xffffffffffffce13,0xceffffffffffffff,0xffffffffe6220013,0xffffffb38cff8cb3,0x72ffe6220022e6ff,0xffffffffffffffce,0x22e6ff72ce,0x8c72c24300000000,0x22e6b3,0xfffff3438cffe622,0xffffffffffffffff,0x22ce2200b3,0x8cffffffffb3,0xffff5e000022ce22,0xffffffffffffffff,0x5effffff,0xffffffffffffce13,0x8cffffffff,0xffffb322e6ffce13,0xe6ffffffffffffff,0x735748668e220022,0x82c29c9c65824857,0xa78cb30000228eb5,0xffffffffffffb343,0x5e000022e6ffffff,0xffffffffffffffff,0x22e6ffb343f3ff,0xffffffffffffe622,0xe6ffffffffffffff,0xfff3430000000022,0xff5e00000000005e,0xffffe6220022e6ff,0xf3430000005effff,0x22e6ffffff,0x22e68c,0x8ce6220000,0xffce135effffe622,0xe6ffff5e13ceffff,0x43f3ffce130022,0x8c000043f35e0000,0x5ef34300008cff,0xffce130000000000,0xf3430000b3ffa9e6,0xffff8c00000013ce,0xffffffffffffffff,0xe62200008cffffff,0x8cffffffff5e43f3,0x22e6ffffffce13,0x0,0x0,0xffffffffe6220000,0xffffffe6220022e6,0x72ffe6220022e6ff,0xffffffffffffffce,0x22e6ff72ce,0xceff72ceffffff8c,0x43a70013,0xffffffe6228ce622,0xceffffffffffffff,0x22ce220013,0x8cb3,0xf35e00000022ce22,0x43,0x5ef343,0xffffffffffffce13,0xb3ffff,0x0,0x0,0x735748668e220000,0x82c29c9c65824857,0xf3ffce1300228eb5,0x43,0x0,0xffffffffffffff5e,0x13ceffff5e43f3,0x0,0x13cefff34300,0xf343000000000000,0x8c0000000000005e,0xffffe6220022e6ff,0xffffce13005effff,0x22e6ffffff,0x22e68c00,0x8ce62200,0x5e00b3ffffffe622,0xe6ffffffb3005eff,0x22,0x8c00000000000000,0x8cff,0xf3ffffffe6220000,0xffffffffffff8c43,0xffce13000013ceff,0xffffffffffffffff,0xe622000013ceffff,0x8cffffff5e0043f3,0x22e6ffffce1300,0xffffffffffffe622,0xe6ffffffffffffff,0xffffffffe6220022,0xffffffffffffffff,0x72ffe6220022e6ff,0xffffffffffffffce,0x8c000022e6ff72ce,0x43005ee622005eff,0x8c5e0013c2,0xffffffffce139b22,0x13ceffffffffffff,0x22ce220000,0x8cb3,0x22ce22,0x0,0x0,0xffffffffffe62200,0x22e6ff,0x5ef34300,0x0,0x735748668e220000,0x82c29c9c65824857,0x228eb5,0x0,0x0,0x5effffffffffe622,0x8cffffff5e00,0x5e8c00000000,0x13cee6220000,0x0,0x2200000000000000,0xffffce130013cee6,0xffffffff5e5effff,0x13ceffffff,0x43f35e0000,0x5ef343,0x43f3ffffffffe622,0xe6fffffffff34300,0x5effffce130022,0x8c00000000000000,0x8cff,0x22e6ffffe6220000,0xfffffffff3430000,0xb300000000008cff,0xffffffffffffffff,0xe62200000000b3ff,0x8cffff5e000043f3,0x22e6ffce130000,0xffffffffffffe622,0xce22000000008cff,0xffffffffe6220022,0xffffffffffffffff,0x72ffe6220022e6ff,0xffffffffffffffce,0xe6220022e6ff72ce,0x5ef34300005e,0x13b52200b35e00,0xffffffffffb30000,0x22e6ffffffffff,0xffffffffce130000,0x8cff,0x22ce22,0x0,0x0,0x0,0x0,0xffffb343f3ffe622,0xe6ffffffffffffff,0x735748668e220022,0x82c29c9c65824857,0xe6ffb30000228eb5,0xffffffffffffb322,0x13000022e6ffffff,0x5e0000000022e6ce,0xb3ffffffff,0x13ce8c00000000,0x8ce6220000,0x0,0x1300000000000000,0xffffb3000000b3ce,0xffffffffffffffff,0xb3ffffff,0x430043f35e000000,0x5ef3,0xffffffffffffe622,0xe6ffffffffffffff,0x5effffe6220022,0xfff3430000000000,0x43f3ffff,0x0,0xf343000000000000,0x5e0000000000008c,0xb3ffffffffffffff,0xe622000000000000,0x8cff5e00000043f3,0x22e6ce13000000,0xffffffffffffe622,0xe6ffffffffffffff,0xffffffffb3000022,0xffffffffffffffff,0x72ffe6220000b3ff,0xffffffffffffffce,0xce130022e6ff72ce,0x13ceff5e00b3,0x8cffb3000000,0xffffffffffff5e00,0x22e6ffffffff,0x0,0x8cb3,0x22ce22,0x0,0xe622000000000000,0xffffffffffffffff,0x22e6ffffffffff,0xffffb343f3ffce13,0xe6ffffffffffffff,0x735748668e220022,0x82c29c9c65824857,0x5eb3000000228eb5,0xffffffffffffb300,0x22e6ffffff,0xffffb30000000000,0x22e6ffffff,0x8cff8c00000000,0x22e68c0000,0x0,0x1300000000000000,0xffce130000005ece,0xffffffffffffffff,0x13ceffff,0xf382f35e00000000,0x5e,0xffffffffffffe622,0xe6ffffffffffffff,0x5effffe6220022,0xff5e000000000000,0x5effff,0x0,0x8043000000000000,0xe622000000000000,0x8cffff,0xe622000000000000,0x8c5e0000000043f3,0x22b51300000000,0x0,0x0,0x0,0x0,0x72ff8c0000000000,0xffffffffffffffce,0x430000008cff72ce,0xb3fffff3,0x0,0x0,0x0,0x0,0x8cb3,0x22ce22,0x0,0x5e00000000000000,0xffffffffffffffff,0x5effffffffff,0x229b0000,0x0,0x0,0x0,0xda22000000000000,0x43,0x0,0x0,0x13ceff5e0000,0xffffe62200000000,0xb3ffff,0x0,0x1300000000000000,0x139c,0x0,0x0,0x5eff5e0000000000,0x0,0xffffffffffffce13,0xceffffffffffffff,0x13,0x5e00000000000000,0x5eff,0x0,0x0,0xffce130000000000,0x13ce,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffffffffffffffb3,0x22e6ff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe6ffce1300000000,0x22,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x22e6ffffffff5e,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5e00000000000000,0x5eff,0x0,0x0,0x0,0x0,0x0,0xb3ffb30000000000,0x0,0x0,0x0,0x0,0x0,0x0,0x73220000,0x2200000000227300,0x22e6e6,0x0,0x0,0x5effffb300,0xb3ffff5e,0x0,0x43f35e0000,0x8c00000000000000,0xffffffffffffffff,0x22e6ff,0x8cffffffffff8c00,0xb300000000000000,0xffffffffffffffff,0xb3ffffffffff,0x225ef34300000000,0x8ce6,0x43f3ffffce130000,0xfff3438cffffff8c,0xffffce130013ceff,0xffffffffff8c43f3,0x13ceffffff,0x8cffffffffffffb3,0x22e6ffffffce13,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x22e6f343000000,0xce13000000000000,0x13ceff,0x0,0x0,0x43f38c0000000000,0x5eff5e000000,0x8cf34300,0xffffff8c00000000,0x8c,0x0,0x0,0x22e6ffce130000,0x0,0x0,0x8ce6220000,0x4300000022e68c00,0xffff5e000022e6f3,0xffffffffffffffff,0x430000005effffff,0xe644e6fffffffff3,0x43f3ffffffff,0x0,0x43f3ff5e0000,0xb300000000000000,0xfff34300b3ffffff,0x22e6ff,0xb35e0000005eb300,0xe622000000000000,0x13ceb3000043f3,0x22ce2200000000,0xe622b3f343000000,0x8cff,0x5effffffe6220000,0xffff5eb3ffffffb3,0xffffe6220022e6ff,0xffffffffffb35eff,0xb3000022e6ffffff,0xb3,0x22e6ffffce1300,0x0,0xb3fffff3430000,0x0,0x0,0x0,0x0,0x0,0x0,0x22e6f343000000,0xff8c000000000000,0x8cffff,0x0,0x5effffff5e,0x5eff5e0000000000,0x8cffb3000000,0x5eff5e00,0xe644e6b300000000,0xb3,0xffb3000000000000,0xb3ffff,0x43f3ffe6220000,0xe6ffff5e00000000,0x22,0x8cffe6220000,0x43000022e6ff8c00,0x43da220022e6f3,0x0,0xb3000022da430000,0xffffffffffffffff,0xb3ffffffffff,0xff5e000000000000,0x43f3ffffffffff,0xb300000000000000,0xfff34300b3ffffff,0x65c213000022e6ff,0xffffffffffffffe6,0xce22000013c265e6,0x22,0x22ce2200000000,0xffe622b3f3430000,0x8cffff,0x5effffffe6220000,0xffff5eb3ffffffb3,0xffffe6220022e6ff,0xffffffffffb35eff,0xda220022e6ffffff,0x43,0x22e6ffffffb300,0xe6ce130000000000,0x8ce6220000000022,0x0,0x22e6ffe622,0x0,0xceffffffe6220000,0x13,0x0,0x22e6f343000000,0xffe6220000000000,0x22e6ffff,0xffb3000000000000,0xb3ffffe644e6ff,0xb3e6220000000000,0x13ceffce130000,0x22e6b300,0xffffff5e00000000,0x5e,0x13ceffff5e000000,0x5effffce1300,0x43f3ffe6220000,0x8cffb30000000000,0x0,0x8cffffe6220000,0x430022e6ffff8c00,0x43da220022e6f3,0x0,0xe6220022da430000,0xffffffffffffffff,0x22e6ffffffffff,0xffffffffb3000000,0x43f3ffffffffffff,0xffff5e0000000000,0x4300000000008cff,0x65f3ce130022e6f3,0xffffffffffffffe6,0xe6220013cef365e6,0xffffffffffffffff,0x22e6ffffffffff,0xffffe622b3f34300,0xb3ffffffffff,0x0,0x0,0x0,0x0,0xce22000000000000,0x22,0x22e6ce35e6ffb3,0xffffffb300000000,0xce5eb3ffb300008c,0xffb3000000000013,0xb3ffffffffffff,0x0,0x5effffffffffffb3,0x0,0x0,0x22e6f343000000,0x5eff8c0000000000,0x8cff5e00,0xffffce1300000000,0xceffffff8c008cff,0xffffe62200000013,0xffffffffffffffff,0x22e6ffffff,0x8cff8c0000000000,0x0,0x43f38c0000,0x8cf34300000000,0x0,0xffffb300008cb300,0x5e,0x8cffffffe6220000,0x4322e6ffffff8c00,0x13cee6220022e6f3,0x0,0xe6220022e6ce1300,0xffffffffffffffff,0x22e6ffffffffff,0xffffffffffce1300,0xe6ffffffffffffff,0xffffff8c00000022,0x2200000000008cff,0x65f3e6220022e6e6,0xffffffffffffffe6,0xe6220022e6f365e6,0xb3ffffffff,0x22e6ffffffffb3,0xffffffce26cee622,0x13ceffffffffffff,0x8cfff343000000,0xff8c0013ceffce13,0xfff34300000043f3,0xffffffffce13008c,0xce22000043f3ffff,0xb300000000000022,0x22e6ff,0xffffffffb3000000,0xda65ce44e6fff39c,0xdadae62200000022,0xe6dadafffff3438c,0xe622000000000022,0x13cefff3438cdada,0x22e65e,0x0,0x22e6f3438cf343,0x5effe62200000000,0x22e6ff5e00,0x5e13ceb300000000,0xce135effffffffff,0xffffb300000000b3,0xffffffffffffffff,0xb3ffffff,0xfffffff343000000,0x43f3,0x22e65e00,0x5ee6220000000000,0x5ef343000000,0xffffb3008cffb300,0x43f3,0xffffffffe6220000,0x65e6ffffffff8c8c,0xe6cece220022e6f3,0x22,0xb3000022cecee622,0xffffffffffffffff,0xb3ffffffffff,0xffffffffffff8c00,0x43f3ffffffffffff,0xb30022e68c000000,0x4300000000008cff,0x65f3e6220022e6f3,0xffff8c008cffffe6,0xe6220022e6f365e6,0xceffce26ceffffff,0x22e6ffffffce26,0xffffe622b3f34300,0x8cffffffffffffff,0x5effffffe6220000,0xffff5eb3ffffffb3,0xffffe6220022e6ff,0xffffffffffb35eff,0xce220022e6ffffff,0xffb3000000000022,0x22e6,0xffffffffffb30000,0xce5e0043f3ffffff,0xda438ce622000013,0x8c43f3fffffff365,0x8ce62200000022e6,0x43f3fff365da43,0x22e68c00,0x0,0x22e6f356ceff5e,0x5effffb300000000,0xb3ffff5e00,0x5e13cef343000000,0xce135ece56f3ffff,0xff5e0000000043f3,0xb3e635ceb3005e,0x5eff8c,0xffffffffb3000000,0xb3ff,0x5ece13,0xce5e000000000000,0x43f3ffe6220013,0xffffffffffce1300,0x43f3ffffffffffff,0xffffffffe6220000,0xffffffffffffffff,0x8c22ce220022e6ff,0x43000000000043f3,0x43000022ce228cf3,0xfffffffffffffff3,0x43f3ffffffff,0xffffffffffffce13,0x43f3ffffffffff,0xb3000043da220000,0xfff34300b3ffffff,0x65f3e6220022e6ff,0xffff8c008cffffe6,0xe6220022e6f365e6,0xffe6808c5effffff,0x22e6ffffff5e8c,0xffe622b3f3430000,0xceffffffffffffff,0x5effffffe6220013,0xffff5eb3ffffffb3,0xffffe6220022e6ff,0xffffffffffb35eff,0xce220022e6ffffff,0xe6ffb30000000022,0x22,0x8cffff5e00,0x8cffe62200,0xe743008cce130000,0x43f3ffffffffc2,0x8cce130013ce8c,0x8000b3ffffc2e743,0x13ce8c0043,0x0,0x22e6f356ceff5e,0x5efffff343000000,0x43f3ffff5e00,0xffffffffb3000000,0xffffffe644e6ffff,0xffffe6220000b3ff,0xffffffffffffffff,0x22e6ffffff,0xffffffff8c000000,0x8cff,0x22ce22,0xce22000000000000,0x43f3ffe6220022,0xffffffffffffe622,0xffffffffffffffff,0xffffffffe622008c,0x9cffffffffff9bce,0x22ce220022e6f3,0xf38c0000008cf343,0x22ce220043,0xffffffffffffff8c,0x8cffffffff,0x5effffe622,0x43f3ff5e0000,0xffffffffe6220000,0xfff34300b3ffffff,0x65f3e6220022e6ff,0x5e00000000005ee6,0xe6220022e6f365e6,0xffffffb35effffff,0x22e6ffffff5eb3,0xe622b3f343000000,0xe6ffff8c00008cff,0x22e6ffffb3000022,0xffe6225effffff5e,0xffffb3000000b3ff,0xffffffffff5e22e6,0xce220000b3ffffff,0x22e6e62200000022,0x13ce5e00,0xffff8c0043f3ce13,0x13ceffce13005e,0xe622005ee6220000,0x22e6ffffffffff,0x5ee6220022e65e,0xce2243f3ffffe622,0x22e65e0022,0x0,0x22e6f356ceff5e,0x8cffffffb3000000,0xb3ffffff8c00,0xffffffffce130000,0xfffffff343b3ffff,0xce1300000013ceff,0x65f38c005eff72ce,0xb3e6,0x8cff8c0000000000,0x0,0x43c213,0xc243000000000000,0x22e6ffb3000013,0xffffb300b3ffb300,0x13ceffff,0xceffffffe6220000,0x435effffffff8c13,0x22ce220022e6f3,0x22e6b300b3e62200,0x22ce220000,0xffffffffffff8c00,0x8cffffff,0x8cffe622,0x43f35e0000,0xffffffffe6220000,0xffffffffffffffff,0x65f3e6220022e6ff,0x5e00000000005ee6,0xe6220022e6f365e6,0xf3fff3438cffffff,0x22e6ffffff8c43,0x225ef34300000000,0xe6ff8c0000008ce6,0x22,0x0,0x0,0x0,0xce22000000000000,0x22,0x13ce5e00,0xcee6ff8c00b3e622,0x22e6ff8c0022e6,0x5e0043f35e000000,0x43005effffffffff,0x43f35e0000005ef3,0x5e8c008cffff5e00,0x5ef34300,0x8cff8c0000000000,0x22e6f356ceff5e,0xfffffffff3430000,0x43f3ffffffffff,0xffce1343da220000,0x13ceffff8c8cffff,0x8c0000000022da43,0xc2f3430043f3c2f3,0x8cf3,0x8cff8c0000000000,0x0,0xb38c00,0x8cb3000000000000,0x0,0xffffb30013ceb300,0xb3,0x13ceffffe6220000,0x43005effffff8c00,0x22ce220022e6f3,0xb3ffb3000000,0x22ce220000,0xffffffffff5e0000,0x5effff,0x22e6ce13,0x0,0xffffffffe6220000,0xffffffffffffffff,0x65f3e6220022e6ff,0xffff8c008cffffe6,0xe6220022e6f365e6,0x5effffffff,0x22e6ffffffff5e,0x0,0xcee6220000000000,0x5effffffe6220013,0xffff5eb3ffffffb3,0xffffe6220022e6ff,0xffffffffffb35eff,0xce220022e6ffffff,0x22,0x13ce5e00,0xf34343a7008cce13,0x13ceffb30022e6,0x5eff8c00000000,0xff5e0043f3fff343,0xf35e00000000008c,0x353522e6ce1343,0x8cf343,0x8cff8c0000000000,0x22e6f356ceff5e,0x8cffffffffce1300,0x13ceffffffff8c00,0xffe6225ee6220000,0x22e6fff3430043f3,0x430000000022e65e,0xffce130013cefff3,0xe6220000000043f3,0x8cff8c000043f3ff,0x22e6fff3430000,0xb3ce1300,0x13ceb30000000000,0x43f3ffe6220000,0xceffb30000000000,0x13,0x13ceffe6220000,0x4300005effff8c00,0x22ce220022e6f3,0x0,0x22ce220000,0xffffffff5e000000,0x5eff,0x13ceb300,0x0,0xb3005effff8c0000,0xf34313ceffffffff,0x65f3e6220022e6ff,0xffff8c008cffffe6,0xe6220022e6f365e6,0xffffffffffffffff,0x22e6ffffffffff,0x0,0xb3ce130000000000,0x5effffffe6220000,0xffff5eb3ffffffb3,0xffffe6220022e6ff,0xffffffffffb35eff,0xce130022e6ffffff,0x8c,0xb3b300,0xffffff5e22e65e00,0x43f3ff8c005e,0xf3f3430000000000,0x43f3f34300000043,0x4300000000000000,0xe62200008cfffff3,0x43f3,0x8cff8c5effce1300,0x22e6f356ceff5e,0x8cffffffffff5e00,0x5effffffffff8c00,0xffffffffce130000,0xffffffce130013ce,0x220000000013ceff,0xffb30000008cffe6,0xe6220000000022e6,0x8cff8c000022e6ff,0x22e6ffe6220000,0x22e6b3000000,0xb3ffb3000000,0x43f3ffe6220000,0x22e6b30000000000,0x0,0x13cee6220000,0x430000005eff8c00,0x22ce220022e6f3,0x0,0x22ce220000,0xffffff5e00000000,0x5e,0x13ce5e00,0x0,0xce135ece13000000,0xce5e13ce5e00005e,0x65f3e62200000013,0xffffffffffffffe6,0xce220022e6f365e6,0x22,0x22ce2200000000,0x0,0x5ece130000000000,0x43f3ffffe6220000,0xfff343b3ffffffb3,0xffffe6220022e6ff,0xffffffffffb343f3,0x22000022e6ffffff,0xffffffffffffffe6,0x13ceff,0x8cff5e0000,0x13cefff343,0x5e00000000000000,0x5effffffffff,0x0,0x5efff34313cee622,0xe622000000000000,0x8cff8c5effce56f3,0x22e6f356ceff5e,0xffffffffffffce13,0xceffffffffffffff,0xffffffff8c000013,0xffffffff5e005eff,0x8cff,0xff5e0000005effb3,0xda220000000000b3,0x8cff8c008cffffe7,0x22dae7ffff8c00,0xffce13b35e000000,0xb3ffffff,0x43f3ffe6220000,0x0,0x0,0x13b5220000,0x43000000005e8c00,0xffffce130022e6f3,0xffffffffffffffff,0x13ceffffff,0x5eff5e0000000000,0x0,0x139c1300,0x0,0xb3fff34300000000,0x43f3ffb300000000,0x65f38c0000000000,0xffffffffffffffe6,0xce1300008cf365e6,0xffffffffffffffff,0x13ceffffffffff,0x0,0x139c130000000000,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffffb30000000000,0x5eff,0x0,0x0,0x0,0x5eb300,0xe622000000000000,0x8cff8c5effce56f3,0x22e6f356ceff5e,0xffffffffffffce13,0xceffffffffffffff,0xffffffe622000013,0xffffffffffffffff,0x22e6,0x0,0x0,0xffffffffffff8c00,0x8cffffff,0x8cffffe6220000,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffffffffb3000000,0xb3ff,0x13ceffce1300,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffffffffffffce13,0xb3ffffff,0x0,0x0,0x0,0x0,0x0,0x22000022e6ff8c00,0x5effe6,0x0,0x0,0x0,0x0,0x0,0xffffffff8c000000,0xffffffffffffffff,0x8cff,0x0,0x8c8c00,0x0,0x5ee622000000,0x0,0x0,0x0,0x8cffffff8c,0x0,0x13ceff5e000000,0x0,0x5effce1300000000,0x0,0xffffffffffffe622,0x13b52200b3ffffff,0xffffffffe6220000,0xb3ffffffffff,0x0,0xb3ffffffffffb300,0x0,0xffffffffb3000000,0x22e6ffffffffff,0xffffffffffffe622,0xe6ffffffffffffff,0xffce56f3e6220022,0xffffffffffffffff,0xffffe6220022e6ff,0xffffffffffffffff,0xe6220022e6ffffff,0xffffffffffffffff,0x22e6ffffffffff,0x43f3e622,0xb3ff8c00,0x0,0x0,0xffb3000000000000,0x8cffffffffffffff,0x5eb300,0x8c00005eb343c213,0x13ce5eb3,0x0,0x0,0x22e6b30000,0xffffe62200000000,0x13ce,0xffffffffe6220000,0xffffffffffffffff,0x22e6ff,0x1300000000000000,0x22e6ffce,0x0,0xb3ffffb30000,0xffffffffffb30000,0x5effff,0x0,0xb3ffffffb3,0x0,0x13ce8c5ee6220000,0x0,0xda438cce13000000,0x22,0xffffffffffffe622,0xb3ffce13b3ffffff,0xffffffffe6220000,0xb3ffffffffff,0x0,0xb3ffffffffffb300,0x0,0xffffffffb3000000,0x22e6ffffffffff,0xffffffffffffe622,0xe6ffffffffffffff,0xffce56f3e6220022,0xffffffffffffffff,0xffffe6220022e6ff,0xffffffffffffffff,0xe6220022e6ffffff,0xffffffffffffffff,0x22e6ffffffffff,0xffffffffffffe622,0xb3ffffff,0x0,0x0,0xb3b30000000000,0x0,0x8c0000008cffff5e,0xffffffffb343f3ff,0x8cffff5eb3,0x1300000000000000,0x82,0x22e6ffffb300,0x8cfff3430000,0x22e6ffb3,0xffffffffe6220000,0xffffffffffffffff,0x22e6ff,0xffb3000000000000,0x22da438c,0xffffffff5e000000,0x22e6ffffffffff,0xffffffffffffb300,0xe6b300005effffff,0x22,0xb3ffffffb3,0x0,0x13c24300b38c0000,0x0,0xb30043c213000000,0x8c,0x5effce130022ce22,0x22da4300b38c0000,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffffffffffffe622,0xb3ffffff,0x0,0xe743000000000000,0x43da2200000043,0xb300000000000000,0xe6220022e6ff5eb3,0xffffffffb343f3ff,0x22e6ffff5eb3,0x4300000000000000,0x22da,0x22e6ffffffff8c,0x43f35e00,0x22e68c0000,0x43da220000,0x0,0xfff343000022da43,0xb3ffffffffffff,0x22da4300,0xffffffffffce1300,0x22e6ffffffffff,0xffffffffffffe622,0xe6ffb300b3ffffff,0x22,0xb3ffffffb3,0x0,0xffff8c0043f35e00,0x8cffff,0x43008cffffffff8c,0x5ef3,0x5effce130013b522,0x22da4300a7430000,0xffffffffb3000000,0xffffffffffffffff,0xffb30000000000b3,0xffffffffffffffff,0xb3ffff,0xffffffffffffffb3,0xb3ffffffffff,0xffffffffffffb300,0xb3ffffffffffffff,0xffb322e6e6220000,0xffffffffffffffff,0x520000000022e6ff,0xffffffffff8c0043,0x73220022e6ffffff,0xffffff8c00000000,0x22e6ffffffffff,0x8cffffffffffe622,0xb3ff5e0000,0xffffffffe6220000,0xffffffffffffffff,0x22ce22000043f3,0x9cb3000000000000,0xe62200004352b3f3,0xffffffffffffffff,0x22e6ffffffff,0x8c000043da220000,0x43e743b3,0x5effce1300,0x5ece13,0x2244b38c000000,0x8c229b22ce220000,0xb3ffffffffffffff,0xffffe6220022ce22,0x8cffffff,0x22da4300,0xffffffffffffb300,0x13ceffffffffff,0xffffffffffffe622,0xe6ffffb3b3ffffff,0x22,0x13ceffce13,0xffe6220000000000,0xffffe6220043f3ff,0xb3000000b3ffffff,0x22e6ffffffffff,0x22e6ffffff5e,0x5effb30000000000,0x22da430000000000,0xffffffffe6220000,0xffffffffffffffff,0xffe62200000022e6,0xffffffffffffffff,0x2200000022e6ffff,0xffffffffffffffe6,0x22e6ffffffffff,0xffffffffffffe622,0xe6ffffffffffffff,0xffce56f3e6220022,0xffffffffffffffff,0xe74300000022e6ff,0xffffffffffb30043,0xe6220022e6ffffff,0xffffffb30000008c,0x22e6ffffffffff,0x8cffffffffffe622,0xb3e6ce5e0000,0xffffffffe6220000,0xffffffffffffffff,0x22ce220022e6ff,0xf39cb30000000000,0xe62200000043f3ff,0xffffffffffffffff,0x22e6ffffffff,0xce1300008ce62200,0x43f38c005e,0x5effce1300,0x22ce22,0x43e756ce5e000000,0xb343c235ce220000,0xceffffffffffffff,0xffffe6220022ce35,0x8cffffff,0x22e6f34300,0x43f3ffffff5e,0xb3ffffff8c00,0xffffffffffffe622,0xe6ffffffffffffff,0x22,0x22ce2200,0xffffe62200000000,0x22e6,0xce220022ce220000,0x22,0x22e6ffffe62200,0x5effb30000000000,0x22da430000000000,0xffffffffb3000000,0xffffffffffffffff,0xffb30000000000b3,0xffffffffffffffff,0xb3ffff,0xffffffffffffffb3,0xb3ffffffffff,0xffffffffffffb300,0xb3ffffffffffffff,0xffb322e6ce130000,0xffffffffffffffff,0xf3f343000013ceff,0xffffffffff8c0043,0xe6220013ceffffff,0xffffff8c00008cff,0x13ceffffffffff,0x8cffffffffffe622,0xb3e622b35e0000,0xffffffffce130000,0xffffffffffffffff,0x22ce22000043f3,0xfff39cb300000000,0xce220000000043f3,0x43520022730022,0x22da43008043,0xce220000008ce622,0x43f38c000022,0x5effce1300,0x5ece13,0xcef343b38c000000,0x22ce220013,0x0,0xffffe6220022ce22,0x8cffffff,0x8cf34300,0xffff8c13ceffffb3,0x5effffffffff,0xffffffffffffe622,0xe6ffffffffffffff,0xfffff34300000022,0xf3ffffffffffffff,0xf3ffe62200000043,0x43,0xce130013ceb30000,0xb3,0x22e6fff3430000,0x5effb30000000000,0x22da430000000000,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xf3ff8c0000000000,0x43,0xe622000000000000,0xb3ff,0x0,0x8cffffffffffe622,0x8ce62200b35e0000,0x0,0xe743000000000000,0x22ce2200000043,0xf3ffffffb3000000,0xce22000000000043,0x43520022730022,0x220022da43008043,0xce5e000000008ce6,0x43f38c00000013,0x5effce1300,0x22e65e00,0xe6ffb343f35e0000,0xb343c235ce220022,0xceffffffffffffff,0xffff5e000022ce35,0x8cffffffffffff,0x22da4300,0xffffffb300b3ffb3,0x13ceffffffff,0xffffffffffffe622,0xe6ffffffffffffff,0xb35e00000022,0xb300000022ce2200,0xf3ffe6220000005e,0xb300000000000043,0x1300000013ceffff,0xb3ffffce,0x22e6fff3430000,0x5effb30000000000,0x22da430000000000,0xffffffffe6220000,0x13ceffffffffffff,0x1300000000000000,0xffffffffffffffce,0x13ce,0xffffffffffce1300,0x22e6ffffffffff,0xffffffffffffe622,0xe6ffffffffffffff,0xffce56f3e6220022,0xffffffffffffffff,0xf38c00000022e6ff,0xffffffffffb30043,0xe6220022e6ffffff,0xffffffb3000000b3,0x22e6ffffffffff,0x8cffffffffffe622,0xe6fffffff3430000,0x43c21300000022,0x0,0x22ce2200000000,0x43f3f3438cb30000,0xce22000000000000,0x43520022730022,0x8c0022da43008043,0x8cb30000000043f3,0x8cf34300000000,0x5effce1300,0x8cff5e0000,0xceffff5e43f3f343,0x22ce220013,0x0,0xce1300000022ce22,0xffe622000043f3ff,0x22da435e,0xffffffffb35eff8c,0x22e6ffffff,0xffffffffffffe622,0xe6ffffe6ceffffff,0xb35e00000022,0xb300000022ce2200,0xf3ffe6220000005e,0xda22000000000043,0x43,0x22da430000,0x22e6fff3430000,0x5effb30000000000,0x22da430000000000,0xffffffffe6220000,0xb3ffffffffffff,0x0,0xffffffffffffffb3,0xb3,0xffffffffffb30000,0x22e6ffffffffff,0xffffffffffffe622,0xe6ffffffffffffff,0xffce56f3e6220022,0xffffffffffffffff,0x800000000022e6ff,0xffffffffffb30043,0x9b220022e6ffffff,0xffffffb300000000,0x22e6ffffffffff,0x8cffffffffffe622,0xce22000000000000,0x43f3ce13000022,0x0,0x22ce2200000000,0x5e43da44e6b30000,0xce220000000013ce,0x43520022730022,0x22da43008043,0x43c213000043f38c,0x8cf343000000,0x5effce1300,0xffffffffe6220000,0x8cffffff5e005eff,0xb343c235ce220000,0xceffffffffffffff,0xce1300000022ce35,0x430000000043f3ff,0x1300000022e6fff3,0xffffffffffffffce,0x13ceffff,0xffffffffffffe622,0xe6ffe622b3ffffff,0x5effffffe6220022,0xffff5eb3ffffffb3,0xf3ffe6220022e6ff,0xda22000000000043,0x43,0x22da430000,0x22e6fff3430000,0x5effb30000000000,0x22da430000000000,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8cffffffffffe622,0xce22000000000000,0xffffffffce130022,0xffffffffffffffff,0x22ce220022e6ff,0x5e0043f3ffb30000,0xce220000000013ce,0x43520022730022,0x22da43008043,0x22da430043f35e00,0x8cf3430000,0x5effce1300,0x22e6ce1300,0xb3ffffffff5e00,0x22ce220000,0x0,0xb30000000022ce22,0x43f3ff,0xce13000000b3b300,0xffffffffffb35eff,0x43f3,0xffffffffffffce13,0xe6e622008cffffff,0x5effffffe6220022,0xffff5eb3ffffffb3,0xc256da220022e6ff,0xb38c000000000043,0x0,0x8cb3000000,0x22da56c2430000,0x5effb30000000000,0x22da430000000000,0xffffffffe6220000,0xffffffffffffffff,0xffffe6220022e6ff,0xffffffffffffffff,0xe6220022e6ffffff,0xffffffffffffffff,0x22e6ffffffffff,0xffffffffffffe622,0xe6ffffffffffffff,0xffce56f3e6220022,0xffffffffffffffff,0xffffe6220022e6ff,0xffffffffffffffff,0xe6220022e6ffffff,0xffffffffffffffff,0x22e6ffffffffff,0x8cffffffffffe622,0xce22000000000000,0xffffffff8c000022,0xffffffffffffffff,0x8cce130022e6ff,0xb300000000000000,0xe6220000000000b3,0xffffffffffffffff,0x22e6ffffffff,0xb38c43f35e0000,0x8cf34300,0x5effce1300,0xb300000000000000,0x22e6ffffffffff,0xffffffffb3000000,0xffffffffffffffff,0x5e0000000000b3ff,0xb3ffff,0xce13000000000000,0x13ce,0x0,0xffffffffffe62200,0xb522000013ceffff,0x5effffffe6220013,0xffff5eb3ffffffb3,0xffffce130022e6ff,0x8cb3000013ceffff,0x0,0x130000b38c000000,0x13ceffffffffce,0x8cffce1300000000,0xceffe62200000000,0xffffffffe6220013,0xffffffffffffffff,0xffffe6220022e6ff,0xffffffffffffffff,0xe6220022e6ffffff,0xffffffffffffffff,0x22e6ffffffffff,0xffffffffffffe622,0xe6ffffffffffffff,0xffce56f3e6220022,0xffffffffffffffff,0xffffe6220022e6ff,0xffffffffffffffff,0xe6220022e6ffffff,0xffffffffffffffff,0x22e6ffffffffff,0x8cffffffffffe622,0xce22000000000000,0x43f38c00000022,0x0,0xffe6220000000000,0xceffffffffffffff,0xce22000000000013,0x43520022730022,0x22da43008043,0x5ece1300000000,0x0,0x5effce1300,0x0,0x13ceff5e00000000,0x0,0x0,0x2200000000000000,0x5effffe6,0x0,0x0,0x0,0x0,0x0,0x5effffffe6220000,0xffff5eb3ffffffb3,0x22e6ff,0x13ceffffffb30000,0x0,0xffffffce13000000,0xb3,0xffffffffce130000,0x22e65e0000008cff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8cb3000000000000,0xce22000000000000,0x43800000000022,0x0,0x0,0x0,0xce22000000000000,0x43520022730022,0x22da43008043,0x22ce2200000000,0x0,0x5effce1300,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffb3000000000000,0xe6ffffffffffffff,0x22,0x0,0x0,0x0,0xce13000000000000,0xffffffffffffffff,0x13ceffffffff,0x0,0x0,0x5effce1300,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x43520000,0x0,0x4352000000,0xce13000000000000,0xffffff8c00005eff,0x22e6ffffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xff5e000000000000,0x13ce,0x0,0x8cffffb30000,0x0,0x0,0x0,0x0,0x0,0x22e6f34300000000,0x0,0x0,0x0,0x0,0xfffff34300000000,0x8cff,0x0,0x0,0xff8c000000000000,0xffffffffffffffff,0x5effffff,0x0,0x0,0x13cefff343000000,0x0,0x5ef343,0x0,0x5ef34300,0x0,0xe622000000000000,0xb3ffff,0x0,0xb3ce1300,0x0,0xb3ce130000,0xce13000000000000,0xffffff8c00005eff,0xb3000022e6ffffff,0xf34322e6ffffffff,0x8cffffffff,0xb3ffffe622000000,0x0,0xffffe62200000000,0xb3,0xffff5e0000000000,0x43f3ffffff,0x0,0x22e6e622,0xffff8c0000000000,0x22e6ff,0x0,0x8cffffb30000,0x0,0x0,0x0,0x0,0xb3b38c0000000000,0x22e6ffffffffffff,0x0,0x0,0x43f3ffce130000,0x0,0xffffffce13000000,0x5effff,0x0,0x0,0xffe6220000000000,0xffffffffffffffff,0x22e6ffffff,0x0,0x0,0xe6ffffffffce1300,0x22,0xffff5e0000b3ff8c,0x13b52200000013ce,0xff5e0000b3ff8c00,0xb52200000013ceff,0xffffce1300000013,0xb3ffffffff,0x0,0x43f3ff5e00,0x0,0x43e7e75e0000,0xce13000000000000,0x5eff,0xe622000000000000,0xff8c8cffffffffff,0x22e6ffffffff,0xffffffffffce1300,0xb3ff,0xffffffffce130000,0xb3ffff,0xffffce1300000000,0xb3ffffffff,0x2200000000000000,0x22e6ffffe6,0x13ceff8c00000000,0x22e6ff5e,0x0,0x8cffffb30000,0x0,0xfff34343f3ffce13,0x13ce,0x5effb300,0xb3b3ffffffffe622,0x22e6ffffffffffff,0x0,0x0,0xffffb30000000000,0xffffffffffffffff,0xffffffe6220000b3,0xffffffffffffffff,0x13ce,0x0,0x22ce220000000000,0x8c8c00000000,0x22da430000,0x0,0x0,0xff5e0022e6ffce13,0x8c,0xe644e6ffce56da22,0x22e6ffffffffffff,0x22e6ffce56da2200,0xe6ffffffffffb300,0xceffffce13000022,0x8cffffe62213,0x0,0xb3ffffce13,0x0,0xb38c5ece1300,0xce13000000000000,0x5eff,0xe622000000000000,0xff8c8cffffffffff,0x22e6ffffffff,0xe62213ceffffce13,0x8cffff,0x2213ceffffce1300,0x8cffffe6,0xffffffffffb30000,0x8cffffffffffffff,0xe622000000000000,0x22e6ffffffff,0x13cece13000000,0xb3ff5e00,0x0,0x8cffffb30000,0x0,0xffe62243f3fff343,0x5eff,0x5effffffb3,0xb3b3ffffffffe622,0x22e6ffffffffffff,0x0,0x353500000000,0xffff8c0000000000,0xffffffffffffffff,0xffffffe6220022e6,0xffffffffffffffff,0x350000000013ceff,0x35,0x22ce220000000000,0x8c8c00000000,0xce130022da430000,0x8c,0x0,0xe6220013ceffff8c,0x8c,0xe6220013ce9cda22,0x22ce220000b3ffff,0x13ce9cda2200,0xce22000000000000,0x43f3ff5e000022,0x43f3ff5e000000,0x0,0x43f3ffffff5e,0x0,0x43da2213ce5e00,0xce13000000000000,0xffffff8c00005eff,0xe6220000005effff,0xff8c8cffffffffff,0x22e6ffffffff,0x5e8c0043f3ff5e,0x43f3ff5e,0x43f3ff5e00,0x43f3ff5e00,0xffffce1322ce2200,0xda4300b3ffffffff,0xffe6220000000022,0x22e6ffffffffff,0x22e6ce13000000,0x13ceb38c5e,0x2200000000000000,0xe6ffffffffffffe6,0x22,0xffffffffffffffb3,0xb30000000000b3ff,0x5effffffffff,0xb3b3ffffffffe622,0x22e6ffffffffffff,0x0,0x5eff5e00000000,0xffff5e0000000000,0xffffffffffffffff,0xffffffe6220022e6,0xffffffffffffffff,0xff5e00000022e6ff,0x5e,0x22ce220000000000,0x8c8c00000000,0x43000022da430000,0x5ef3,0x1300000000000000,0xff8c00000022e6ce,0x5e,0x22e6f356ce9cda22,0x22e68c0000b38c00,0x13ce9cda2200,0xce22000000000000,0x8cffce130022,0x8cffb300000000,0xffffffe622000000,0xffffffffffffffff,0xffffe6220022e6ff,0xffff8c00005effff,0xce13000022e6ffff,0xffffff8c00005eff,0xe6220000005effff,0xff8c8cffffffffff,0x130022e6ffffffff,0x8cb300008cffce,0x8cffb300,0x8cffce13,0x8cffb30000,0xffffb30043da2200,0xc24300b3ffffffff,0xffce130000000013,0xb3ffffffffff,0x22e6f34300000000,0xb3ffffb3,0x2200000000000000,0xe6ffffffffffffe6,0x2200000000000022,0xffffffffffffffe6,0xffb300000022e6ff,0x5effffffffffff,0xb3b3ffffffffe622,0x22e6ffffffffffff,0x0,0x5effff5e00000000,0xffe6220000000000,0xffffffffffffffff,0xffffffe6220022e6,0xffffffffffffffff,0xffff5e000022e6ff,0x5e,0x22ce220000000000,0x8c8c00000000,0x22da430000,0x5ef343,0x2200000000000000,0xe6fff3430000b3e6,0x22,0x22e6ffffff9cda22,0x22e6ffffff5e0000,0x13ce9cda2200,0xce22000000000000,0x43f3e6220022,0x13ceff5e00000000,0xfffff34300000000,0xffffffffffffffff,0x5ef34300000043f3,0x0,0xce1300000043f35e,0xffffff8c00005eff,0x5e000000005effff,0xce1313ceffffffff,0x2200005effffffff,0x8cb3000043f3e6,0x13ceff5e00,0x43f3e622,0x13ceff5e0000,0xffff8c13ceb30000,0x8cce138cffffffff,0x0,0x8cffffb3,0xffff5e0000000000,0x13ceffb38cffffff,0x0,0x22e6ffffffffe622,0x5e00000000000000,0xffce1313ceffffff,0xffb30000008cffff,0x5effffffffffff,0xb3b3ffffffffe622,0x22e6ffffffffffff,0xffffffffffe62200,0xffffffffffffffff,0xffce13000000008c,0xffffffffffffffff,0xffffffe6220022e6,0xffffffffffffffff,0xffffff5e0022e6ff,0xffffffffffffffff,0x22ce220022e6ffff,0x8c8c00000000,0x22da430000,0x5ef34300,0x2200000000000000,0xb3ffff8c0013cee6,0x26130000,0xe62200b3ff9cda22,0x22ceceffff5eb3ff,0x13ce9cda2200,0xce22000000000000,0x43f3e6220022,0x13ceff5e00000000,0xfff3430000000000,0xf3ffffffffffffff,0xf343000000000043,0x5e0000000000005e,0xce130000000043f3,0x5eff,0x0,0x0,0x2200000000000000,0xffffffffce56f3e6,0x13ceff5e8c,0xffffffce56f3e622,0x13ceff5e8cff,0xfff3e7ffb3000000,0xb3ffffffffffff,0x0,0x8cffffb3,0xff5e000000000000,0xe6ffffffffdadaff,0x22,0x22e6ffffe62200,0xce13000000000000,0xffce1313ceffffff,0x13ceffff,0x0,0x0,0x0,0xffffffffffe62200,0xb3ffffffffffffff,0xffb3000000000000,0xffffffffffffffff,0xffffffe6220013ce,0xffffffffffffffff,0xffffb3000022e6ff,0xffffffffffffffff,0x22ce220022e6ffff,0x8c8c00000000,0x22da430000,0x13cece1300,0x0,0xffffffffffffff8c,0x5effb300b3,0xe6220013ce9cda22,0x22ce220000b3ffff,0x220013ce9cda2200,0xce220000000013b5,0x5effce130022,0xb3ffb300000000,0xf343000000000000,0x43f3ffffffffffff,0x4300000000000000,0xf38c000000005ef3,0xce13000000000043,0x5eff,0xe622000000000000,0xff8c5effffffffff,0x130013ceffffffff,0x8cb300005effce,0xb3ffb300,0x5effce13,0xb3ffb30000,0xffffb30000000000,0xb3ffffffff,0x0,0x8cffffb3,0x0,0xff5e8cffffb30000,0x22e6,0x22e6e6220000,0xf343000000000000,0xffb30013ceffffff,0x5effffff,0x0,0xb3b3ffffffffe622,0x22e6ffffffffffff,0x0,0x8cff5e00000000,0xff8c000000000000,0xb3ff,0xffffffe622000000,0xffffffffffffffff,0xffb300000022e6ff,0x5e,0x22ce220000000000,0x8c8c00000000,0x22da430000,0x13cece13,0x0,0xe62200b3ffff5e00,0x5effce13b3ff,0xffffffffff9cda22,0x22e6ff8c00b3ffff,0xffffffff9cda2200,0xe6ff8c00b3ffffff,0x22e6ff8c000022,0x5efff343000000,0xce13000000000000,0x13ceffffffffffff,0x1300000000000000,0xce5e0000000043c2,0xce13000000000013,0xffffff8c00005eff,0xe6220000000013ce,0xff8c8cffffffffff,0x22e6ffffffff,0x8cb30022e6ff8c,0x5efff343,0x22e6ff8c00,0x5efff34300,0xb300000000000000,0xb3ffff,0x0,0x8cffff8c,0x0,0x5e008ccec1e62200,0xffffe6220000b3ff,0xffff8c00008cffff,0xffb3000022e6ffff,0xffffffffffffffff,0xb3ffffff,0x0,0xb3b3ffffffffe622,0x22e6ffffffffffff,0x0,0x8c5e00000000,0xce5e000000000000,0x13,0xffffffe622000000,0xffffffffffffffff,0x8c0000000022e6ff,0x5e,0x22ce220000000000,0x8c8c00000000,0x13000022da430000,0x13cece,0x0,0x2200000000000000,0x22e6dadaffffe6,0x22e69cda22,0x13ceffb30000,0x22e69cda2200,0x13ceffb3000000,0x5effffe622000000,0x13ceffff8c0000,0xe622000000000000,0x22e6ffffffffffff,0x2200000000000000,0xda430035350022ce,0xce13000000000022,0xffffff8c00005eff,0xe6220000000013ce,0xff8c8cffffffffff,0x22e6ffffffff,0x8c00005effffe622,0x13ceffff,0x5effffe62200,0x13ceffff8c,0x4300000000000000,0x22e6f3,0xceffffffe6220000,0xffffffe622000013,0x22e6,0x13000022e6ce1300,0xffffe6220013cece,0xffffffffffffffff,0xffe6220022e6ffff,0xff8c0000b3ffffff,0x22e6ffffff,0x0,0xb3b3ffffffffe622,0x22e6ffffffffffff,0x0,0x0,0xffce130000000000,0xceffffffffffffff,0xffffffe622000013,0xffffffffffffffff,0x13ceff,0x0,0x22ce220000000000,0x8c8c00000000,0xce130022da430000,0x13ce,0x0,0x0,0xb3ffe622,0x43da22,0x0,0x43da2200,0x0,0xffffe62200000000,0x13ceffffffffffff,0xf343000000000000,0x43f3ffffffffffff,0x4300000000000000,0xda44e6fffff356c2,0xce13000000000043,0x5eff,0xe622000000000000,0xff8c8cffffffffff,0x22e6ffffffff,0xffffffffffe62200,0x13ceffffff,0xffffffffe6220000,0x13ceffffffff,0x5e00000000000000,0x43f3ff,0xffffffffe6220000,0xffffffffffffffff,0x22e6,0xb30022e6ff5e0000,0xffffe62200008cff,0x5eb3ffffffffffff,0xffff5e0022da56ce,0xff8c00008cffffff,0x8cffffffff,0x0,0xb3b3ffffffffe622,0x22e6ffffffffffff,0x0,0x0,0xf3b3000000000000,0xb3f3430000000043,0xffffff5e00000000,0xffffffffffffffff,0x5eff,0x0,0x22ce220000000000,0x8c8c00000000,0x22da430000,0xffffffb300000000,0x22e6ffffffff,0x0,0xb3ffe62200,0x43da22,0x0,0x43da2200,0x0,0xff8c000000000000,0xcefff3435effffff,0xff5e000000000013,0x5effff5e00005eff,0x5e00000000000000,0xffff5e00005effff,0xffff8c000000005e,0x22e6ffff,0xce13000000000000,0xff5e5effffffffff,0x13ceffffffff,0xffffffff8c000000,0x13cefff3435e,0xffffff8c00000000,0x13cefff3435eff,0xffff8c0000000000,0x8cffffffff,0xffffffffe6220000,0x56ce5eb3ffffffff,0x22da,0xffffffff5e000000,0xffffe622000000b3,0xffffffffffffffff,0xffff8c0013ceffff,0xff5e00008cffffff,0xb3ffffffff,0x0,0xb3b3ffffe6220000,0x22e6ffffffffffff,0x0,0x0,0xf3b3000000000000,0xb3f3430000000043,0x0,0x0,0x0,0x0,0xffce130000000000,0xffffffffffffffff,0xb3ffffff,0x0,0x0,0x0,0x5effe6220000,0x43da22,0x0,0x43da2200,0x0,0x0,0xfff3430000000000,0x5e8c0000000013ce,0x5e8c000000000000,0x8c00000000000000,0x8c0000000000005e,0xff8c00000000005e,0x43f3ff8c0022e6ff,0x0,0x0,0x0,0x0,0x13cefff3430000,0x0,0x13cefff343000000,0xffffce1300000000,0xb3ffffffff,0xffffffffe6220000,0xffffffffffffffff,0x13ce,0x8cfff34300000000,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x22e6ffffffb30000,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x9b22000000,0x0,0x0,0x0,0x0,0x0,0xf343000000000000,0x13ce,0x0,0x0,0x0,0x8c00000000000000,0x43f3ff8c000022e6,0x0,0x0,0x0,0x0,0x13cef343000000,0x0,0x13cef34300000000,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xceff5e0000000000,0x5243000013,0x0,0xb3b30000,0x0,0xb3b3000000,0x0,0x0,0x0,0x0,0x13ce5e,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5effce13000000,0x43f3ff8c00,0x0,0x0,0x0,0x4352000000,0x0,0x22e6ff5e00,0x0,0x22440000000000,0xffffffffb3000000,0x8cffff,0xe622000000000000,0x22e6ffff,0xffffff8c00000000,0x9c130052430022e6,0x13,0x13ceffffce13,0x0,0x13ceffffce1300,0x0,0x0,0x0,0x13ceffffb3,0x13ceff5e,0xffffffffffffb300,0x8cffff,0xce13000000000000,0x8c,0x5ef34300,0x0,0xff5e000000000000,0x43f3ffffffffffff,0xffffff5e00000000,0xffffffce1300b3ff,0x43f3,0x0,0x0,0xff5e000000000000,0xb3ff,0x5effff5e00,0x13ceffce13,0x8cfffffff343,0x0,0x0,0x0,0xffffce1300000000,0x13ce5e005effff,0x5effce13000000,0x43f3ff8c00,0xffce130000000000,0x5e,0x229b00,0xb3ce130000,0x0,0x8cffffce13,0x0,0x22b51300000000,0x43c2130000,0xb3ff8c00,0xfffff34300000000,0x43f3ffffffff,0x5e13ceff8c000000,0x22b513524322e6ff,0x4300000000000000,0x43f3fffffffff3,0x0,0x43f3b300008cf343,0xce13000000000000,0xb3,0xb300000000b3b300,0xfffff343000000b3,0x13ceffffff,0xb3b3,0x5effb3000000,0xf343000000000000,0x22e6,0xff5e0000b3ff8c00,0xb52200000000b3ff,0xffce130000000013,0xb3ffffffffffffff,0xffffffe622000000,0xffffffff8c5effff,0x13ceff,0xffffffffffff8c00,0x13ceffff,0xffffb30000000000,0x1300000022e6ffff,0x5e00005effffffce,0x13000013ceffffff,0x5ece1300005ece,0x0,0x0,0x5effb30000,0x8c0013c243000000,0x13ce5e00005eff,0x5effce13000000,0x0,0xffce130000000000,0x5e,0x229b,0x43f3ff5e0000,0x0,0x43f3ff8c00,0x0,0x22e65e00000000,0x43c2130000,0x8cffff8c00,0x5effff5e000000,0x5effff5e000000,0x13cece130000,0x22b51322e6ff5e,0xb300000000000000,0xb3ffffffffffff,0x0,0xb38c000000008cb3,0xe622000000000000,0x72ceffffb35effff,0xda22000022e6ffff,0xffffffffff8c0043,0x220013ceffffffff,0x43da,0x13ceffffb30000,0xff8c000000000000,0x5eff,0xffffffce56da2200,0xe6ffffffffffffff,0xe6f3430000000022,0x5eff5e0000000022,0xffffffe622000000,0xffffffff8c8cffff,0x22e6ff,0xffffffffffffb300,0x22e6ffff,0xb3ff5e00000000,0x8c000000b3ff5e00,0xe6220000008cffff,0x220000000022e6ff,0xffffb300000022ce,0x13ceffffffff,0x8cff5e0000000000,0x5ef343000000,0x2200008cce130000,0xe6ffffffff9bcee6,0x5effce13000022,0x0,0xffffffe622000000,0xe6ffffffffffffff,0x22,0xb3a9e6ce1300,0x0,0xb3e62200,0x0,0x22e6ce13000000,0x43c2130000,0x13ce5e000000,0x22e6f3430000,0x22e6e62200000000,0x22e6ce130000,0x0,0xce13000000000000,0xb3ffffffffffff,0x1300000000000000,0xb35e000000005ece,0xe622000000000000,0xffffffffffffffff,0xce22000022e6ffff,0xffffffffffff5e22,0x2200008cffffffff,0x22ce,0x22e6ffffb300,0xffe6220000000000,0x13ceff,0xffffffff9cda2200,0xe6ffffffffffffff,0xffff8c0000000022,0x35e6ffffffffffff,0xffffffe62200139c,0xffffffff8c8cffff,0x5e0000000022e6ff,0xffffffffffffffff,0x22e6ffff,0x22e68c00000000,0xce130013ceb30000,0xff5e000000005eff,0x22000000000013ce,0x22ce,0x13ceb300000000,0x8cffff5e00000000,0x43e7438cff8c00,0x8cf3430000,0x13ce5e0013ceb3,0x5effce13000000,0xb3ffffff8c00,0xffffffe622000000,0xceffffffffffffff,0x13,0x43da44e6ff5e00,0x73220000000000,0xb35e0022e6ff8c00,0x0,0x22e6ff5e000000,0x43c2130000,0x13ce5e000000,0x43f3b30000,0x8cf3430000000000,0x22e6f343000000,0x0,0xce13000000000000,0x13ceffffffffffff,0x1300000000000000,0xce5e0000000043c2,0xce13000000000013,0xffffffffffffffff,0xce22000013ceffff,0xffffffffffffb322,0x220000008cffffff,0x8ce62222ce,0x22e6ffffb3,0xc1ce5e0000000000,0x5effff,0xffffffff9cda2200,0xe6ffffffffffffff,0xfffff34300000022,0x43b3ffffffffffff,0xffffffe6220013c2,0xffffffff8c8cffff,0xff8c00000022e6ff,0xffffffffffffffff,0x22e6ffff,0x22e68c00000000,0xe6220022e6b30000,0xff8c0000000043f3,0x22000000000000b3,0x22ce,0x22da4300000000,0x8cffffffffff8c00,0x8cb343e7430000,0x13cee6220000,0x13ce5e0000b3b3,0x5effce13000000,0x13ceffffff8c00,0xffffffb300000000,0xceffffffffffffff,0xffffe62200000013,0xffff8c22e6ffffff,0xffe6220022e6ffff,0x8cffffffffffffff,0xe622000000000000,0x22e6ffffffffff,0x43c2130000,0x13ce5e000000,0xb3ce1300,0xcece130000000000,0x22e6ff5e00000013,0x22e65e00000000,0xe622000000000000,0x13ceffffffffffff,0x2200000000000000,0xc2430000000043da,0xff8c000000000013,0xffffffffffffffff,0xce2200008cffffff,0xb3ffce35,0x22000000008cff5e,0xb3008cffffce35ce,0x22e6ffff,0x438cb30000000000,0xb3fff3,0xffffffff9cda2200,0xe6ffffffffffffff,0x43f3f34300000022,0x8c8cff5e00000000,0xffffffe62200008c,0xffffffff8c8cffff,0x22e68c000022e6ff,0xffffffffffffb300,0x22e6ffff,0x22e68c00000000,0xe6220022e6b30000,0xff8c00000000b3ff,0x22000000000043f3,0x22ce,0x22da4300000000,0x8cffffffffffe622,0x13ce5eb38c5eff5e,0x22008cff5e000000,0x13ce5e000022ce,0x5effce13000000,0xb3ffffff8c00,0xffce130000000000,0xceff809b0000005e,0xfff3430000000013,0x22e6ffffff,0xffe622000043f35e,0x5effffffffffffff,0x4300000000000000,0x22e6fffffffff3,0x43f3ffce13,0x13ceffff5e000000,0xb3e62200,0xe6b3000000000000,0x43f35e0000000022,0x22e6ff5e00000000,0xf343000000000000,0x43f3ffffffffffff,0x4300000000000000,0xda220000000013c2,0xffce130000000043,0xffffffffffffffff,0xce220013ceffffff,0x43f3ce35,0x2200000000008043,0xfffffffff34322ce,0x22e6ff,0x1322da4300000000,0x43f3ffce,0xffffffff9cda2200,0xe6ffffffffffffff,0xffffffb300000022,0xc256f3ffffffffff,0xffffe62200000043,0xffffff8c008cffff,0x43da220022e6ff,0xffffffffffffb300,0xffe6220022e6ffff,0xb3ffffffffffffff,0xe6220000b38c0000,0xff8c5effffffffff,0x220013ceffffffff,0x22ce,0x22da4300000000,0x8cffffffffffe622,0x22da56ce5eb38c00,0xe6ffb30000000000,0x22,0x5effce13000000,0x0,0xffce130000000000,0xceff5e229b00005e,0xf343000000000013,0x5e000022e6ffffff,0xffe62200000043f3,0x5effffffffffffff,0x0,0x22e6fffffff343,0xffffffffffffe622,0x22e672ceffffffff,0x5effce13b3e62200,0xcece26ceff8c0000,0x3535000000000013,0xe6ff5e0000000000,0xff8c000000000022,0x8cffffffffffffff,0x8c00000000000000,0xb30000000000008c,0xffe622000000008c,0x8c,0xce220013ceffb300,0x22e6b322,0x2200000013b52200,0xfffffff3430022ce,0x13ce5e22e6,0xb38c00000000,0x8cffff8c,0xffffffff9cda2200,0xe6ffffffffffffff,0xffffffe622000022,0xc256ceffffffffff,0x13,0x43000000008cffb3,0xffffe6220022e6f3,0xffffffffffffffff,0xffe6220022e6ffff,0xb3ffffffffffffff,0xe622000000000000,0xff8c8cffffffffff,0x220022e6ffffffff,0x22ce,0x22da4300000000,0x8cffffffffffe622,0x13c243b35e8cce13,0xffb3000000000000,0x5e,0x5effce13000000,0x0,0xffce130000000000,0xceff5e00229b005e,0x4300000000000013,0xf38c0022e6fffff3,0xffe6220000000043,0xffffffffffffffff,0x13ceffffff,0x22e6fffff34300,0xffffffffffffe622,0x22e6ffffffffffff,0x5effffffffb30000,0xb3ffffffff8c0000,0x22e6ffce130000,0xff5e000000000000,0xffe62200000000b3,0xe6ffffffffffffff,0xda22000000000022,0x4300000000000043,0xe6e62200000022da,0xff5e000043f3b322,0xce220013cee6228c,0x22da4322,0x2200000013ce5e00,0xe6fff343000022ce,0x13ce5e0022,0xffffffce13000000,0x13ceffffff,0xffffffff9cda2200,0xe6ffffffffffffff,0xffffffff5e000022,0x8c5e8cffffffffff,0x1300000000000000,0x5e000000005effce,0xffffe6220013ceff,0xffffffffffffffff,0xffe6220022e6ffff,0xb3ffffffffffffff,0xe622000000000000,0xff8c8cffffffffff,0x220022e6ffffffff,0x22ce,0x22da4300000000,0x8cffffffffffe622,0xb38c5ece138043,0xffb3000000000000,0x8cff,0x5effce13000000,0x5effffffffff8c00,0xffce130000000000,0xceff5e0000229b5e,0x1300000000000013,0xce5e0022e6ffffce,0xffe6220000000013,0xffffffb300005eff,0x13ceffffff,0x22e6ffffce1300,0xffffffffffffe622,0x22e6ffffffffffff,0x5effffffff5e0000,0x5effffffff8c0000,0x82130000000000,0xce13000022e6ff5e,0xffffb300000013ce,0xffffffffffffffff,0xb3b30000000000b3,0x0,0xcece13000000b3b3,0xff5e00005effce26,0xce220013cee622b3,0x229b0022,0x2200000013ce5e00,0x22da4300000022ce,0x13ce5e0000,0x13c243000000,0x5effffb300,0x22e69cda2200,0x13ceffb3000000,0xffffffffce130000,0x5eb343f3ffffffff,0xb300000000000000,0xf34300000022e6ff,0xffffe62200008cff,0xffffffffffffffff,0xffe6220022e6ffff,0xb3ffffffffffffff,0xe622000000000000,0xff8c8cffffffffff,0x220022e6ffffffff,0x22ce,0x22da4300000000,0x8cffff8c00000000,0x43da22b3e62200,0x1300008ce6220000,0x5effce,0x5effce13000000,0x5effffffffff8c00,0xffce130000000000,0xceff5e00000022e6,0x2200000000000013,0xda430043f3ffffe6,0xffe6220000000022,0x8cffff8c000043f3,0x8cff8c00,0x22e6ffffe62200,0x43f3ffe622,0x22e6ffff5e000000,0x5effff8c00000000,0x8cffff8c0000,0x8022b51300000000,0xffb30022e6ff5e43,0xffffff8c0000008c,0xffffffffffffffff,0x13ce8c0000008cff,0x0,0xf38c0000008ce622,0xe622000022e68c43,0xce1300008cf3435e,0x8c,0x1300000000b3b300,0x8cce,0xb3b30000,0x8cb3000000,0xb3fff34300,0x43da2200,0x0,0xffffffffe6220000,0x22ce35ceffffffff,0xffffe62200000000,0xffffff8c00005eff,0x5effff8c000013ce,0x13ceffffffffb300,0xffe6220022e6f343,0xb3ffffffffffffff,0xe622000000000000,0xff8c8cffffffffff,0x220022e6ffffffff,0x43da,0x13c24300000000,0x8cff8c0000000000,0xb3ce135e5e00,0xb3b30000,0x8cce13,0x5effce13000000,0x0,0xffce130000000000,0xffffffffffffffff,0x430000000022e6ff,0xda44e6fffffffff3,0xffe6220000000043,0x8cfffff34300b3ff,0x0,0x22e6fffff34300,0x43c2130000,0x13ce5e000000,0x5eb3000000000000,0xb38c0000,0x800022b513000000,0xb3ffffffff5e0043,0xffffffce13000000,0xffffffffffffffff,0xffffce130013ceff,0xffffffffffffffff,0xce13000013ceffff,0x13ce,0x2200000013cee622,0xffffffffffffffe6,0x13ceff,0xffffffffffffe622,0x13ceffff,0x43da220000,0x43f3ffce1300,0x43da2200,0x0,0x22b5130000,0xb35e0000000000,0xf3ffe62200000000,0xb3ffff8c00000043,0x5ece130000000000,0x13ce5e00005ece13,0xffe622000013ce5e,0xb3ffffffffffffff,0x8c00000000000000,0xe62222e6ffffffff,0x8cffffffff,0xffffffffffffff5e,0x5effffffffff,0x5e8c000000000000,0xb3ff5e0000,0x8ce62200,0x5eb300,0xe6ffffffff8c0000,0x22,0xffce130000000000,0xffffffffffffffff,0x5e0000000022e6ff,0xffff5e00005effff,0xffe622000000005e,0xb3ffffff8c22e6ff,0x0,0x5effff5e00,0xffffffffce130000,0x13ceffffffff,0x0,0x0,0x8000000000000000,0x8cfff343000043,0x0,0x22e6fff3b643,0x0,0x22e6fff3b64300,0x0,0xfffffffffffff343,0x43f3,0x0,0x0,0x0,0x0,0x13ceffffffe622,0x13ceffffffffff8c,0x43da2200,0x0,0xfffffff343000000,0x43f3ffffffffff,0x0,0x0,0xf343000000000000,0xffb300000000b3ff,0x43f3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x43800000,0x43f3ce1300,0x13b522,0x22e6ffff8c000000,0xffffffffffff8c00,0x22e6,0xceff5e0000000000,0x8c00000000000013,0x8c0000000000005e,0x5e,0x0,0x0,0x5e8c00,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8cffff8c00,0x0,0x8cffff8c0000,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffffffffce130000,0xb3,0x22e68c00000000,0xffffffffffff8c00,0x22e6,0xceff5e0000000000,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe6ff8c0000000000,0x5effe622000022,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8c00000000000000,0x8c,0x0,0x0,0xb343c21300000000,0x13ce5eb38c00005e,0xffffce1300000000,0xffffffffffffffff,0xffff8c000013ceff,0xffffffffffffffff,0xb3000000005effff,0xffffffffffffffff,0xb3ff,0x8cfff34300000000,0x0,0x5effffff8c0000,0x0,0x43f3ffb3000000,0x0,0x5effffff8c0000,0x0,0x5effffff8c0000,0x0,0x5effffff8c0000,0x0,0x5effffff8c0000,0x0,0x2200000000000000,0x8ce6,0x0,0x0,0x2200000000000000,0x22e6ffe6,0x5effffff8c0000,0x0,0x5effffff8c0000,0x0,0x5effffff8c0000,0x0,0x5effffff8c0000,0x0,0x5effffff8c0000,0xb300000000000000,0xffffffffffffffff,0xb3ff,0x5effffff8c0000,0x0,0x43f38c00,0xffe6220000000000,0x13ceff,0xffffffffff8c0000,0x5effffffffffff,0xb343f3ff8c000000,0xffff5eb3ffffffff,0xffffe6220000008c,0xffffffffffffffff,0xffffe6220000b3ff,0xffffffffffffffff,0xffb3000022e6ffff,0xffffffffffffffff,0xb3ffff,0x8cfffff343000000,0x0,0xffffffffffffff8c,0x5e,0x5effffce138c8c,0x0,0xffffffffffffff8c,0x5e,0xffe6220013ceff8c,0x5e,0xffe6220013ceff8c,0x5e,0xffe6220013ceff8c,0x5e,0xff5e000000000000,0xb3ffff,0x0,0x0,0xfff3430000000000,0x13ceffff,0xffffffffffffff8c,0x5e,0xffffffffffffff8c,0x5e,0xffffffffffffff8c,0x5e,0xffffffffffffff8c,0x5e,0xffe6220013ceff8c,0xffb300000000005e,0xffffffffffffffff,0xb3ffff,0xffffffffffffff8c,0x5e,0x8cffe622,0xffffffff5e000000,0x43f3ffffff,0xffffffffe6220000,0xceffffffffffffff,0xb343f3ffe6220013,0xffff5eb3ffffffff,0xfffff343000022e6,0xffffffffffffffff,0x43da2200008cff,0xb38c00005eb300,0xffe6220022da4300,0xffffb3008cffffff,0x13ceffff,0x8cb313cef3430000,0x8c00000000000000,0xffb30000008cffff,0x8c00000000005eff,0x4300b3ff5e5effff,0x8c000000000022da,0xffffffffffffffff,0x8c00000000005eff,0x43000000000022e6,0x8c00000000005ef3,0x43000000000022e6,0x8c00000000005ef3,0x43000000000022e6,0x5ef3,0x0,0xb3b300,0x0,0x0,0x8cffff8c00000000,0x8c00000013cee622,0xffff72ceffffffff,0x8c00000000005eff,0xffffffe665f3ffff,0x8c00000000005eff,0xffffffffffffffff,0x8c00000000005eff,0xffffffffffffffff,0x8c00000000005eff,0x43008cffb30022e6,0xffe6220000005ef3,0xffffffffffffffff,0x8c00000013ceffff,0xffffffffffffffff,0x5eff,0x22e6ffff8c,0xffffffffff8c0000,0x8cffffffffff,0xffffffff8c000000,0xffffffffffffffff,0xffffffffe622008c,0xffffffffffffffff,0x22e6,0xf343000000000000,0x22ce22000043f3,0xb38c00005eb300,0xffe6220022da4300,0xffff8c005effffff,0x13ceffff,0xb343da35cef34300,0xf34300000080435e,0x5e000000000043f3,0x5e0000000022e6ff,0x13000000005effff,0xf343000000000082,0xffffffffffffffff,0xe74300000022e6ff,0x22b5130000a74343,0xe74300000022da43,0x22b5130000a74343,0xe74300000022da43,0x22b5130000a74343,0x22da43,0x0,0x43f3b3,0x0,0x0,0xb3ffffff8c000000,0xf3430000008cf343,0xff5e0013ceffffff,0xf34300000022e6ff,0xffffe622005effff,0xf34300000022e6ff,0xffffe635ceffffff,0xf34300000022e6ff,0xffffffffffffffff,0xe74300000022e6ff,0x5effce13b3ff8c43,0xf3e622000022da43,0xfffffff343000043,0xf343000013ceffff,0xffffffffce9bffff,0x220000000022e6ff,0xb3ffffffe6,0xffffffffffff5e00,0x43f3ffffffffff,0x5effff5e000000,0xfff34300b3fff343,0xffffffffe62200b3,0xffffffffffffffff,0xffffff8c000022e6,0xffffffffffffffff,0xffffe622000022e6,0xffffffffffffffff,0xffe6220022e6ffff,0xffff8c005effffff,0x13ceffff,0x43f3ffe635cef343,0xffb300008cffffb3,0x5e,0x8cff8c,0x0,0xffb3000000000000,0xffffffffffffffff,0x8cb30000008cffff,0xb3ff8c005effce13,0x8cb30000008cb300,0xb3ff8c005effce13,0x8cb30000008cb300,0xb3ff8c005effce13,0xffe62200008cb300,0xe6228cffb300005e,0xffe62200000013ce,0x8cffb300005e,0x0,0xffffffffff5e0000,0xffb300000043f3ff,0xffe6220013ceffff,0xffb30000008cffff,0xffe6220013ceffff,0xffb30000008cffff,0xffe6220013ceffff,0xffb30000008cffff,0x9cf3ffffffffb6ff,0x8cb30000008cffff,0xe74300000022e65e,0xffe62200008cb343,0xffffb3000022e6ff,0xffb3000013ceffff,0xfffff343005effff,0xb3000000008cffff,0x5effffffffff,0xffffffffffffce13,0xb3ffffffffffff,0x43f3ffb3000000,0xfff343005effff8c,0x22ce2200b3,0x4300000000000000,0xffffffce130022da,0xffffffffffffffff,0xffffe622000013ce,0xffffffffffffffff,0xffe6220022e6ffff,0xffff8c005effffff,0x4300000013ceffff,0xf3ffffffe635cef3,0xe6ce13008cffce56,0x22,0xe65e000013cef343,0x22,0xffce130000000000,0xffffffffffffffff,0x43c2130013ceffff,0x22b5130000a74300,0x43c2130013ce5e00,0x22b5130000a74300,0x43c2130013ce5e00,0x22b5130000a74300,0xffe6220013ce5e00,0xce8c8cffff5e22e6,0xffe6220013c24313,0x8cffff5e22e6,0xf343000000000000,0xffffffffffffffff,0xffce130000008cff,0xffffe6220013ceff,0xffce130013ceffff,0xe6220013ceffffff,0xffce130013ceffff,0xe62200000013ceff,0xf3ce130013ceffff,0x43f3ffff5e0043,0x43c2130013ceff5e,0x8c5effffff5e5eb3,0xffe6220013ce5e8c,0xffb30022e6ffffff,0xffce130013ceffff,0xff8c0000005effff,0xff5e000013ceffff,0x22e6ffffffffff,0x8c5ef34300005713,0x1357000043f35e8c,0x22e6ffce130000,0xffff5e0043f3ffb3,0x22ce22008c,0x4300000000000000,0xffffffe6220022da,0xffffffffffffffff,0x22ce22000000b3,0xb38c00005eb300,0xf3e6220022da4300,0x43,0xf343000013ceff5e,0x5effffffffe635ce,0xcee62200008cff8c,0x13,0xffe6220013cee622,0xb3,0xffe6220013ceb300,0xffffffffffffffff,0x22ce220013ceffff,0x0,0x22ce220013c24300,0x0,0x22ce220013c24300,0x0,0x5e00000013c24300,0xff8c0022e6cec1ff,0x5e00000013ceffff,0x22e6cec1ff,0xffce130000000000,0xffffffffffffffff,0xffe62200000000b3,0xffffffe6220013ce,0xffe6220013ceffff,0x220013ceffffffff,0xffe6220013ceffe6,0x220013b5220013ce,0xffe6220013ceffe6,0x43f35e00008c,0x35ce220013ceffb3,0x5e8cffffffb343c2,0xf3e6220013c243b3,0xce1343f3ff5e0043,0xffe6220013ceffff,0x43000000005effff,0xffce130013cefff3,0x5effffffffffff,0x8c00000000000000,0x8c,0x1313ceffe6220000,0xf3ffb30022e6ffce,0x22ce220043,0x4300000000000000,0x22da,0xffe6220000000000,0x22ce220000008c,0xb38c00005eb300,0xffe6220022da4300,0x5e,0xcef3430013ceff5e,0x8c5effffffffe635,0xe6e6220000008cff,0x22,0xffb3000013cef343,0x5e,0xffe6220000000000,0xffffffffffffffff,0x43da220013ceffff,0x4352000000435200,0x43da220013ce5e00,0x13ceffe6220000,0x43da220013ce5e00,0x0,0x13ce5e00,0x5effffb3,0x0,0x5effffb3,0xffff5e0000000000,0xceffffffffffffff,0xffe6220000000013,0xffffff5e00008cff,0xffe6220013ceffff,0xb3000043f3ffffff,0xf3e6220013ceffff,0x13ceffe6220043,0xffe6220013cef343,0xb300000000008cff,0x56da220013ceffff,0x8c5effffff8c5ece,0xffe6220013ce5eb3,0x5e13cef3430013ce,0xffe6220013ceffff,0xe6220000005effff,0xffe6220013ceffff,0x8cffffffff72ce,0x8c00000000000000,0x8c,0x22008cffff5e0000,0xe6ffce1300b3ffe6,0x22ce220022,0x4300000000000000,0x43f3ff5e0022da,0xf3f3430000000000,0xffffe62200000043,0xffffffffffffffff,0xffe6220022e6ffff,0xffff8c005effffff,0xffff8c0013ceffff,0xff8c5effffff8c8c,0xffb300000000008c,0x5e,0xb3ff5e,0x0,0xffb3000000000000,0xffffffffffffffff,0x5eb3000000b3ffff,0x5ece130000b38c00,0x5eb3000000b38c00,0x22e68c005ef34300,0x5eb3000000b38c00,0x8cffffffffffb300,0xb38c00,0x43f3ff8c,0x0,0xe622000043f3ff8c,0xceffb300005effff,0xb3ffffffffff72,0xffb3000000000000,0xffff5e00008cffff,0xffb3000000b3ffff,0xffb3000043f3ffff,0xffb3000000b3ffff,0x35ceffffffe644e6,0xffb3000000b3ffe6,0xffb30000008cffff,0x5eb3000000b3ffff,0xe6228cffb313ce8c,0xffe6220000b38c5e,0x225eff5e00b3ffff,0xffb3000013ceffe6,0xffffb300005effff,0xf3e6220000b3ffff,0x8cffffffce1343,0x8c00000000000000,0x8c,0x5e005effff8c0000,0xceffe622008cffff,0x22ce220013,0x4300000000000000,0x22e6ff8c0022da,0xe6ff8c0000000000,0x22ce2200000022,0xb38c00005eb300,0xffe6220022da4300,0xffff8c005effffff,0xffb3000013ceffff,0x8cff8c5eff8c8cff,0xff5e000000000000,0x22000000000013ce,0x130000000043f3e6,0x130000000013cece,0xff5e000000000082,0xffffffffffffffff,0xce5e00000043f3ff,0xb3ffffffce1313,0xce5e00000043da22,0x8cb30000008cb313,0xce5e00000043da22,0x13,0x430000000043da22,0x13cef3e7f3,0x4300000000000000,0x82130013cef3e7f3,0xb3b300,0x8cffffffff5e00,0xff5e000000000000,0xff5e00008cffffff,0xff5e00000043f3ff,0xffffb3000043f3ff,0xff5e00000043f3ff,0xffffffffffffffff,0xff5e00000043f3ff,0xffffb3008cffffff,0xce5e00000043f3ff,0xb3e6220022e6ce26,0xf3e622000043da22,0xb3e6225ece1343,0xff5e000013ceffb3,0xffffffff8c5effff,0xffb300000043f3ff,0x43f3ffffe6225e,0x8c00227300000000,0x8c,0x8c0043f3ffb30000,0x8cfff343005effff,0x22ce220000,0x4300000000000000,0xf3ffffffb30022da,0xcefffffff3430043,0x22ce2200000013,0xb38c00005eb300,0xffe6220022da4300,0xffff8c005effffff,0x13ceffff,0x8cff8c008cb300,0xb300000000000000,0xf34300000022e6ff,0x5e00000000008cff,0x8c0000000043f3ff,0xb300000000005eff,0xffffffffffffffff,0xb300000000008cff,0x13000000000000b3,0xb300000000008cce,0x13000000000000b3,0xb300000000008cce,0x13000000000000b3,0xce13000000008cce,0x8cff8c43f3,0xce13000000000000,0x8cff8c43f3,0x8cce13,0x8cffffff5e0000,0xb300000000000000,0xffe6228cffffffff,0xb300000000008cff,0xffffffb322e6ffff,0xb300000000008cff,0xffffffffffffffff,0xb300000000008cff,0xffffffffffffffff,0xb300000000008cff,0x135effffff8c00b3,0xffe6220000008cce,0x13cece13b3e6225e,0xb300000013ceff8c,0xffffffffffffffff,0xe622000000008cff,0x8cffffffffff,0xce138cb300000000,0x8c,0xb30013ceffce1300,0x5effff8c0043f3ff,0x22ce220000,0x4300000000000000,0xffffffff8c0022da,0x5effffffffffffff,0xffffb30000000000,0xffffffffffffffff,0xffce130000b3ffff,0xffffffffffffffff,0xb3ffff,0x8cffffff8c00,0x1300000000000000,0xffffffffffffffce,0xb3,0xb3ff5e005e8c,0x1300000000000000,0xffffffffffffffce,0x13000000000000b3,0xff5e00000043f3ce,0x13000000000000b3,0xff5e00000043f3ce,0x13000000000000b3,0xff5e00000043f3ce,0xffe62200000000b3,0x8cffce13008c,0xffe6220000000000,0x5e008cffce13008c,0xb3ff,0x5effffff8c0000,0x1300000000000000,0xffffffffffffffce,0x13000000000000b3,0xffffffffffffffce,0x13000000000000b3,0xffffffffffffffce,0x13000000000000b3,0xffffffffffffffce,0x13000000000000b3,0xff5e00000043f3ce,0xffce1300000000b3,0xffffffffffffffff,0x1300000000b3ffff,0xffffffffffffffce,0xb3,0x5effffffb3,0xcefff34300000000,0x13,0x0,0x0,0x22ce220000,0x4300000000000000,0xffe62200000022da,0x5effffffff,0x0,0x0,0xf343000000000000,0xffffffffffffffff,0x22e6ff,0x8cffffce13,0x0,0x43f3fffffff34300,0x0,0xb3ff5e000000,0x0,0x43f3fffffff34300,0x0,0x43f3fffffff34300,0x0,0x43f3fffffff34300,0x0,0x43f3fffffff34300,0x0,0x0,0x0,0xf35e000000000000,0x13c24343,0x5effffce1300,0x0,0x43f3fffffff34300,0x0,0x43f3fffffff34300,0x0,0x43f3fffffff34300,0x0,0x43f3fffffff34300,0x0,0x43f3fffffff34300,0xf343000000000000,0xffffffffffffffff,0x22e6ff,0x43f3fffffff34300,0x0,0x0,0x0,0x0,0x0,0x0,0xffffffffce130000,0xffffffffffffffff,0x13ce,0x5e5e,0x0,0x0,0x0,0x0,0x0,0x8cb30000,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xff8c000000000000,0x13ceffff,0xb3b30000,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xf35e000000000000,0x43,0x0,0x0,0x0,0x0,0x0,0x0,0x5effce1300,0x8cf34300,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5effce1300,0x22e6ffffffb3,0x0,0x0,0xffffffffffb30000,0xb3ffffffff,0xffffffffffb30000,0xb3ffffffff,0xffffffffffb30000,0xb3ffffffff,0xffffffffffb30000,0xb3ffffffff,0xffffffffffb30000,0xb3ffffffff,0xfffffffffffff343,0x43f3ffffffffff,0x0,0xb3e622000000,0xffff8c0000000000,0x5eff,0x0,0x0,0xffffffffffb30000,0xb3ffffffff,0xffb3000000000000,0x8c,0xffce130000000000,0xb3,0xffffffffffb30000,0xb3ffffffff,0xffffffffffb30000,0xb3ffffffff,0x5effce1300,0x13c2e78c00,0xffff8c0000000000,0x5eff,0xffff8c0000000000,0x5eff,0xffff8c0000000000,0x5eff,0x0,0x0,0xffff8c0000000000,0x5eff,0xffff8c0000000000,0x5eff,0xffff8c0000000000,0x5eff,0x5effce1300,0xb3b3005eb3,0x0,0x8cf343,0xffffffffffffb300,0xb3ffffffffff,0xffffffffffffb300,0xb3ffffffffff,0xffffffffffffb300,0xb3ffffffffff,0xffffffffffffb300,0xb3ffffffffff,0xffffffffffffb300,0xb3ffffffffff,0xffffffffffffb300,0xb3ffffffffff,0x0,0x13cefffffff343,0xffffffff8c000000,0x5effffff,0x0,0x0,0xffffffffffffb300,0xb3ffffffffff,0xffb313ce5e000000,0x5ee6228c,0xffe6224380000000,0x5e5e13ce,0xffffffffffffb300,0xb3ffffffffff,0xffffffffffffb300,0xb3ffffffffff,0x5effce1300,0x43c272ce13,0xffffffff8c000000,0x5effffff,0xffffffff8c000000,0x5effffff,0xffffffff8c000000,0x5effffff,0xffffffffb3000000,0x8cffffff,0xffffffff8c000000,0x5effffff,0xffffffff8c000000,0x13ceb35effffff,0xffffffff8c000000,0x13ceb35effffff,0x5effce1300,0x22e68c0000,0x0,0x43f3ff8c,0xffffffffffffe622,0x13ceffffffffff,0xffffffffffffe622,0x13ceffffffffff,0xffffffffffffe622,0x13ceffffe665f3,0x13ceffffffffe622,0x13ceff8c000000,0xffffffffffffe622,0x13ceffffce138c,0xffffffffffb30000,0xb3ffffffff,0xffff5e0000000000,0x13ceffffffffff,0x8cffff8c0000,0x5effffb300,0x0,0x22e6ce130000,0x43f3e622,0x13ceff5e000000,0xffb35effff8c0000,0x5effff8c8c,0xffffffffff8c0000,0x5effffffff,0x43f3e622,0x13ceff5e000000,0x43f3e622,0x13ceff5e000000,0x5effce1300,0x8c8c22da43,0x8cffff8c0000,0x5effffb300,0x8cffff8c0000,0x5effffb300,0x8cffff8c0000,0x5effffb300,0xfffffffff3430000,0x22e6ffffff,0x8cffff8c0000,0x5effffb300,0x5effffff8c0000,0x13ceffffffff8c,0x5effffff8c0000,0x13ceffffffff8c,0x5effce1300,0x43e74300,0x1300000000000000,0x43f3ffce,0xffffffffffffe622,0x13ceffffffffff,0xffffffffffffe622,0x13ceffce35e6ff,0xffffffffffffe622,0x13ceffe622005e,0x22e6ffffffffe622,0x13ceff5e000000,0x43f3ffffffffe622,0x13ceffce130000,0xffffffffb3000000,0xb3ffffff,0xffffb30000000000,0x13ceffffffffff,0x43f3f34300,0x22e6ff5e5713,0x0,0x13ceffffce1300,0x43f3e622,0x13ceff5e000000,0xffb3008cfff34300,0x22e6ffb3008c,0xffffffffff8c0000,0x8cffffffff,0x43f3e622,0x13ceff5e000000,0x22730043f3e622,0x13ceff5e000000,0x5effce1300,0x13ce5e00b38c,0x8c000043f3f34300,0x22e6ff5e008c,0xff8c0043f3f34300,0x22e6ff5e008c,0x82130043f3f34300,0x22e6ff5e0000,0x43f38c0000,0x5eff5e0000,0x438043f3f34300,0x22e6ff5e0000,0x8cfff34300,0x13ceffffb30000,0x8cfff34300,0x13ceffffb30000,0x5effce1300,0x8cce13,0x8c00000000000000,0x22e6ffff,0xffffffffffffe622,0x13ceffffffffff,0xffffffffffffe622,0x13cee6220022e6,0x56f3ffffffffe622,0x13ceff5e005ece,0xe6ffffffffffe622,0x13ceff5e000022,0x8cffffe622,0x13cece13000000,0xffffffb300000000,0xb3ffff,0xffffb30000000000,0x13ceffffffffff,0xce1300005effb300,0x8cff8c008cff,0x0,0xb3ffffffce13,0xffffff5e43f3e622,0x13ceff5e43f3ff,0xffb30000b3ffb300,0x8cffce13008c,0xffffffffe6220000,0x13ceffffff,0xe743000043f3e622,0x13ceff5e000043,0x8cffb30043f3e622,0x13ceff5e000000,0x1300005effce1300,0x43da22005ece,0x8c0000005effb300,0x8cff8c00008c,0xffb300005effb300,0x8cff8c00008c,0xffce13005effb300,0x8cff8c0000b3,0x13cee62200,0x13cee6220000,0xceffb3005effb300,0x8cff8c000013,0xb3ffb300,0x13ceffffffb300,0xb3ffb300,0x13ceffffffb300,0x5effce1300,0x43c21313ce8c,0xff5e000000000000,0x13ceffffffff,0xffffffffffffe622,0x13ceffffffffff,0xe6ffff72ceffe622,0x13ceffce130022,0x6643f3ffffffe622,0x13ceffe680ce13,0x22e6ffffffffe622,0x13ceff5e000000,0xb3ffe622,0x13ceb300000000,0xffffb30000000000,0xb3ff,0xffffb30000000000,0x13c2430013ceff,0xffffb30022e6ce13,0x13cef343008cff,0x13000013cece1300,0xb3ffffffce,0xffffff8c43f3e622,0x13ceff5e8cffff,0xffb300005effce13,0x13ceff8c00008c,0xb3ffffffe622,0x13ceffffffb300,0xffe6220043f3e622,0x13ceff5e0013ce,0xffffb30043f3e622,0x13ceff5e0013ce,0x8c00005effce1300,0x13ceff8c22e6ff,0x8c00000022e6ce13,0x13cef34300008c,0xffb3000022e6ce13,0x13cef34300008c,0xffffce1322e6ce13,0x13cef34300b3ff,0x5eff5e00,0x5eff8c000000,0xffffb30022e6ce13,0x13cef343008cff,0x5effce13,0xb3ffffffb300,0x5effce13,0xb3ffffffb300,0x5effce1300,0x43f3ffffffb3,0xffff5e0000000000,0x5effffffffffff,0x43f3e622,0x13ceff5e000000,0x22e65e0013cee622,0x13ceffffce1300,0x6643f3ffffe622,0x13ceffffe62200,0x22e6ffffffe622,0x13ceff5e22b513,0x5effe622,0x13ceffb3000000,0xffb3000000000000,0xb3,0xb3b30000000000,0x13c24300000000,0xce72b30013cee622,0x13cee622008cff,0xce1313ceffffce13,0xb3ffffff,0xffffce1343f3e622,0x13ceff5e00b3ff,0xda43000043f3e622,0x13ceff5e000022,0x5effffffe622,0x13ceffffff8c00,0xffffb30043f3e622,0x13ceff5e008cff,0xffffb30043f3e622,0x13ceff5e43f3ff,0x5effce1300,0x0,0x8c00000013cee622,0x13cee62200008c,0xffb3000013cee622,0x13cee62200008c,0xffffff8c13cee622,0x13cee6225effff,0x22e6ce13,0xb3e622000000,0xffffb30013cee622,0x13cee635ceffff,0x43f3e622,0x0,0x0,0x0,0x5effce1300,0x0,0xffffe6a9ffffe622,0x5effffffffffff,0x5effe622,0x13ceff5e000000,0x8cffe622,0x13ceffffffce13,0x6643f3ffe622,0x13ceffffffe622,0x130022e6ffffe622,0x13ceffffffffce,0xffff8c0043f3e622,0x13ceffffb3008c,0xff8c000000000000,0x8c,0x5eb30000000000,0x13c24300000000,0x435eb30022e6e622,0x13cef343008cf3,0xffdadaffffffb300,0xb3ffff,0xfff3430043f3e622,0x13ceff5e0022e6,0x43f3e622,0x13ceff5e000000,0x8cffffffe622,0x13ceffffffb300,0xffffff5e43f3e622,0x13ceff5e43f3ff,0xffffb30043f3e622,0x13ceff5e005eff,0x5effce1300,0x0,0xffffb30022e6e622,0x13cef34300008c,0xffffe62222e6e622,0x13cef34313ceff,0xffb3000022e6e622,0x13cef34300008c,0x8cffffffe622,0x13ceffffffb300,0xffffb30022e6e622,0x13cef34322e6ff,0x43f3e622,0x0,0x0,0x0,0x5effce1300,0x0,0xffffe6a9ffffe622,0x22e6ffffffffff,0xffffffffffffe622,0x13ceffffffffff,0x1300008cffffe622,0x13ceffffffffce,0x2200003a43f3e622,0x13ceffffffffe6,0xce130022e6ffe622,0x13ceffffffffff,0xffffe62243f3e622,0x13ceffffffe7f3,0xff8c000000000000,0x8c,0x5eb30000000000,0x13c24300000000,0xffffb3005effb300,0xb3ff5e00005e,0xffffffffffb30000,0xb3ff,0xff8c000043f3e622,0x13ceff5e00005e,0x8cffb300,0xb3ffb3000000,0x5effffe6220000,0x22e6ffff8c,0xffffffb343f3e622,0x13ceff5e8cffff,0xceffb30043f3e622,0x13ceff5e000013,0x5effce1300,0x22e6ffffffb3,0x5effb300,0xb3ff5e000000,0xffe622005effb300,0xb3ff5e0013ce,0xffb300005effb300,0xb3ff5e00008c,0x22e6ffffffe622,0x13cefffffff343,0xffffb3005effb300,0xb3ff5e00005e,0x8cffb300,0x0,0x13ceffffffe622,0x8cffb3000000,0x5effce1300,0xb3f34300,0xffffe6a9ffffe622,0x22e6ffffffffff,0xffffffffffffe622,0x13ceffffffffff,0xce138cffffffe622,0x13ceffffffffff,0xe6228c5e43f3e622,0x13ceffffffffff,0xffce13005effe622,0x13ceffffffffff,0xffffe6225effe622,0x13ceffffffffff,0xff8c000000000000,0x8c,0x5eb30000000000,0x13ceffffffe622,0x5eb313ceff5e00,0x43f3e6220000,0xffffffffb3000000,0xb3,0x43f3e622,0x13ceff5e000000,0x43f3ff5e00,0x43f3ff5e0000,0xffffffffff5e0000,0x43f3ffffff,0x43f3e622,0x13ceff5e000000,0x8cb30043f3e622,0x13ceff5e000000,0x5effce1300,0x5ee6225eb3,0x13ceff5e00,0x43f3e6220000,0xb5220013ceff5e00,0x43f3e6220013,0xffb30013ceff5e00,0x43f3e622008c,0xffffffffffffe622,0x13ceffffffffff,0x8cb313ceff5e00,0x43f3e6220000,0x43f3ff5e00,0x8c5e0000,0x13ceffffe622,0x43f3ff5e0000,0x5effce1300,0x22dac2b300,0xffffe6a9ffffe622,0x13ceffffffffff,0xffffffffffffe622,0x13ceffffffffff,0xffffffffffffe622,0x13ceffffffffff,0xffe6220043f3e622,0x13ceffffffffff,0xffffce72ffffe622,0x13ceffffffffff,0xffffe635ceffe622,0x13ceffffffffff,0xff8c000000000000,0x8c,0x5eb30000000000,0x13ceffffffff8c,0x22e6ffb30000,0x8cfff34300,0xb3ffffb300000000,0x0,0x43f3e622,0x13ceff5e000000,0xb3ffffb30000,0x8cffffb300,0xffffffffffb30000,0xb3ffffffff,0x43f3e622,0x13ceff5e000000,0x43f3e622,0x13ceff5e000000,0x5effce1300,0xb3b30000,0x22e6ffb30000,0x8cfff34300,0x22e6ffb30000,0x8cfff34300,0x22e6ffb30000,0x8cfff34300,0xffffffffffffe622,0x13ceffffffffff,0x22e6ffb30000,0x8cfff34300,0xb3ffffb30000,0x8cffffb300,0x8cffffffe622,0x8cffffb300,0x5effce1300,0x5ece56da22,0xffffe6a9ce56da22,0x8cffffffffff,0xffffffffffffce13,0xb3ffffffffff,0xffffffffffffce13,0xb3ffffffffff,0xffffffffffffce13,0xb3ffffffffff,0xffffffffffffce13,0xb3ffffffffff,0xffffe6a9ffffce13,0xb3ffffffffff,0xff8c000000000000,0x8c,0x5effffffff5e00,0x43f3ffffce13,0xffffffffce130000,0xb3ffffff,0xb3b30000000000,0x0,0xffffffffffffce13,0xb3ffffffffff,0xffffffffce130000,0xb3ffffff,0xffe6228cce130000,0xb3b313ce,0xffffffffffffce13,0xb3ffffffffff,0xffffffffffffce13,0xb3ffffffffff,0x22e6ffffffff8c,0x22e65e00,0xffffffffce130000,0xb3ffffff,0xffffffffce130000,0xb3ffffff,0xffffffffce130000,0xb3ffffff,0xffffffffffffe622,0x13ceffffffffff,0xffffffffce130000,0xb3ffffff,0xffffffffce130000,0xb3ffffff,0xffffffffdadae622,0xb3ffffff,0x22e6ffffffff8c,0xb3ffffff5e,0xffffe6a9ffffe622,0x43f3ffffffff,0xfffffffffff34300,0x22e6ffffffff,0xfffffffffff34300,0x22e6ffffffff,0xfffffffffff34300,0x22e6ffffffff,0xfffffffffff34300,0x22e6ffffffff,0xfffffffffff34300,0x22e6ffffffff,0xff8c000000000000,0x8c,0x5effffffffe622,0x0,0xfffff34300000000,0x43f3ff,0x0,0x0,0xfffffffffff34300,0x22e6ffffffff,0xfffff34300000000,0x22e6ff,0xffce130000000000,0xb3,0xfffffffffff34300,0x22e6ffffffff,0xfffffffffff34300,0x22e6ffffffff,0x22e6ffff8c00,0x43c21343e743,0xfffff34300000000,0x43f3ff,0xfffff34300000000,0x43f3ff,0xfffff34300000000,0x43f3ff,0x0,0x0,0xfffff34300000000,0x43f3ff,0xfffff34300000000,0x43f3ff,0xfffff34300006600,0x43f3ff,0x22e6ffff8c00,0x22da43008cb3,0xce13000000000000,0x13ceffffffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffffffffce130000,0x13ceffffff,0x13ceffffff8c00,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x22e68c0000,0x43f3ffffffb3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8c000022e68c0000,0x13ceff8c22e6ff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffffffffffb30000,0xb3ffffffff,0xffffffffffb30000,0xb3ffffffff,0x43da22000000,0x22ce2200,0xffffffffffff5e00,0x43f3ffffffff,0xffffffffffb30000,0xb3ffffffff,0xffffffffffffe622,0x13ceffffffffff,0xffff8c0000000000,0x5eff,0xffffffffffb30000,0xb3ffffffff,0xffff8c0000000000,0x5eff,0xffffffffffb30000,0xb3ffffffff,0xffff8c0000000000,0x5eff,0x7322000000000000,0x229b0000000000,0x8cfff3430000,0x0,0x5effffffffe622,0x13ceffffffff8c,0xffffffffffffe622,0x13ceffffffffff,0x7300000000007322,0x22,0xff8c000000000000,0x5e,0x0,0x0,0xffffffffffffe622,0x13ceffffffffff,0xffff8c0000000000,0x5eff,0xffff8c0000000000,0x5eff,0xffff8c0000000000,0x5eff,0xffff8c0000000000,0x5eff,0x0,0x5effffff8c,0xffb3829bffffb300,0xb3ffffffffff,0xffffffffffffb300,0xb3e62213ceff,0x5effffff8c0000,0x8cffffff5e,0xffffffffffffe622,0x13ceffffffffff,0xffffffffffffb300,0xb3ffffffffff,0xffffffffffffe622,0x13ceffffffffff,0xffffffff8c000000,0x5effffff,0xffffffffffffb300,0xb3ffffffffff,0xffffffff8c000000,0x5effffff,0xffffffffffffb300,0xb3ffffffffff,0x5effff8c000000,0x5effb300,0x8ce6220000000000,0x22e6b300000000,0xffffffffffff5e00,0x5effff,0x5effffffffe622,0x13ceffffffff8c,0xffffffffffffe622,0x13ceffffffffff,0x8c000000008ce622,0x22e6,0xffff8c0000000000,0x5eff,0xce22000000000000,0x22,0xffffffffffffe622,0x13ceffffffffff,0xffffffff8c000000,0x5effffff,0xffffffff8c000000,0x5effffff,0xffffffff8c000000,0x5effffff,0xffffffff8c000000,0x5effffff,0xffffce72ffffce13,0x43f3ffffffff,0x227365ceffffe622,0x13ceffffce90a9,0xffffffffffffe622,0x13ceff8c005eff,0xffffffffffffe622,0x22e6ffffffffff,0xffffffffffffe622,0x13ceb30013ceff,0xffffffffffffe622,0x13ceffffffffff,0xffb300000022ce22,0x13ce5e0000008c,0xffffffffff8c0000,0x5effffffff,0xffe62200b3ffe622,0x13ceffce1313ce,0x8c008cffff8c0000,0x5effffffff,0x435effffffffe622,0x13cefffffffff3,0x22e65e13ce8c0000,0x5ee6220000,0x8cffe62200000000,0x22e6ffb3000000,0xffffffffffffce13,0xb3ffffff,0x5effffffffe622,0x13ceffffffff8c,0xffffffffffffe622,0x13ceffffffffff,0x8c0000008cffe622,0x22e6ff,0xffffff8c00000000,0x139c135effff,0xffe6220000000000,0x22e6,0xda430000005ee622,0x13ce8c00000022,0xffffffffff8c0000,0x5effffffff,0xffffffffff8c0000,0x5effffffff,0xffffffffff8c0000,0x5effffffff,0xffffffffff8c0000,0x5effffffff,0xffffe6a9f39ce622,0x5effffffffff,0x82a99cf3ffffe622,0x13ceffffce9090,0xffff8c008cffe622,0x13cefff34300b3,0x13ceffffffb300,0xb3ffffffce13,0xffffffffffffe622,0x13ceb30013ceff,0xffffffffffffe622,0x13ceffffffffff,0xffb300000013b522,0x13b5220000008c,0x82f3fffffff34300,0x22e6fffffff3,0xffe6220043f3e622,0x13ceff5e0013ce,0x8c000043f3f34300,0x22e6ffffffff,0x4313ceffffffe622,0x13cefffffffff3,0xb3b3000022da4300,0x22ce80e62200,0x8cffffe622000000,0x22e6ffffb30000,0x13ceffffe622,0x5effe62200,0x5effffffffe622,0x13ceffffffff8c,0xffffffffffffe622,0x13ceffffffffff,0x8c00008cffffe622,0x22e6ffff,0xffffffff8c000000,0x13ceffce56f3ff,0xffffe62200000000,0x13ceff,0xda430000005ee622,0x13ce8c00000022,0xfffffffffff34300,0x22e6ffffffff,0x5efffffff34300,0x22e6ffffff8c,0xfffffffffff34300,0x22e6ffffffff,0xfff39cfffff34300,0x22e6ffffc2f3,0xffffe6a9ffffe622,0x13ceffffffffff,0x82a99cf3ffffe622,0x13ceffffce9090,0xf3ce1322e6ffe622,0x13ceffffb30043,0x5eff5e0000,0x5eff5e0000,0x22e6ffffffe622,0x13cefffffff343,0xffffffffffffe622,0x13ceffffffffff,0xffb3000000000000,0x8c,0x3a8cffffffffb300,0x8cffffffff8c,0x5effe622,0x13ceff8c000000,0x8c0000005effb300,0x8cffffffffff,0x8cffffe622,0x13ceffffe62200,0xe6220000005eb300,0x8c8c0043f3ff,0x8cffffffe6220000,0x22e6ffffffb300,0xffb30043f3ffce13,0x22e6ff8c008c,0x5effffffffe622,0x13ceffffffff8c,0xffffffffffffe622,0x13ceffffffffff,0x8c008cffffffe622,0x22e6ffffff,0xffff5e5eff8c0000,0x5effffce56f3,0xffffffe622000000,0x13ceffff,0xda430000005ee622,0x13ce8c00000022,0xff5e00b3ffffb300,0x8cffffb3005e,0x5effffffffb300,0x8cffffffff8c,0xffffffffffffb300,0x8cffffffffff,0xda43005effffb300,0x8cffff8c0022,0xffffe6a9ffffe622,0x13ceffffffffff,0xffffffffffffe622,0x13ceffffffffff,0x8c5e008cffffe622,0x13cefffff34300,0x22da430000,0x43da220000,0x43f3ffffe622,0x13cefffff34300,0xff8c0000b3ffe622,0x13ceffce13008c,0xffb3000000000000,0x8c,0xf372ceffffffce13,0x13ceffffffce56,0xff8c00008cffe622,0x13ceffb300005e,0x8c00000022e6ce13,0x13ceffffffffff,0x8cffffe622,0x13ceffffe62200,0xfffffffff365b513,0x13c243000000b3,0x8cffffffffe62200,0x22e6ffffffffb3,0xf3430043f3ff5e00,0x43f3ffffffff,0x5effffffffe622,0x13ceffffffff8c,0xffffffffffffe622,0x13ceffffffffff,0x8c8cffffffffe622,0x22e6ffffffff,0xf35e8cb35eff8c00,0x5effffce56,0xffffffffe6220000,0x13ceffffff,0xda430000005ee622,0x13ce8c00000022,0x5effffce13,0x13ceffff5e0000,0x5effffffffce13,0x13ceffffffff8c,0xffffffffffffce13,0x13ceffffffffff,0x13ceffffce13,0x13ceffffe62200,0xffffe6a9ffffe622,0x22e6ffffffffff,0x43f3e622,0x13cef343000000,0x22b51322e6ffe622,0x13ceffffffce13,0xb3ffffff8c00,0x8cffffffb300,0x13ce8c8ce622,0x13ceb38ce62200,0xda4300005effe622,0x13ceff8c000022,0xffb3000000000000,0x8c,0xffe665f3ffffe622,0x13ceffffff72ce,0x26b52200b3ffe622,0x13ceffce13139c,0x8c00000013cee622,0x13ceffffffffff,0x43008cffffffe622,0x13cefffffffff3,0x220000000022ce22,0x13b580ffffffe6,0xffffffffffffe622,0x22e6ffffffffff,0xb3ffff8c00,0x5effffe62200,0x5effffffffe622,0x13ceffffffff8c,0xffffffffffffe622,0x13ceffffffffff,0xffffffffffffe622,0x13ceffffffffff,0x138cffff9bcee622,0x13ce8c5effffce,0xffffffffffe62200,0x13ceffffffff,0xda430000005ee622,0x13ce8c00000022,0x13ceffffe622,0x13ceffffce1300,0xb3ffe622,0x13ceffce130000,0xb3ffe622,0x13ceffce130000,0x13ceffffffe622,0x13ceffffffe622,0xffffe6a9ffffe622,0x5effffffffffff,0x5200139c26cee622,0x13cee622000043,0x8c5e008cffe622,0x13ceffffffff5e,0xb6fffffffffff343,0x43f3ffffffffff,0x22e68c8ce622,0x13ceb35ef34300,0xf35e00008cffe622,0x13ceffb3000043,0xffb3000000000000,0x8c,0xffffce9bffffe622,0x13ceffffb3b3ff,0xff5e0013ceffe622,0x13ceffe622005e,0x8c00000022e6e622,0x13ceffffffffff,0x43008cffffffe622,0x13cefffffffff3,0xffce13000022ce22,0x13c24300008cff,0x9bffffffffff5e00,0x22e6ffffffffce,0x8cffffffffff5e00,0x5effff5e0000,0x5effffffffe622,0x13ceffffffff8c,0xffffffffffffe622,0x13ceffffffffff,0x9bceffffffffe622,0x5effffffffff,0xffffffb35effb300,0xb3ff8c5effff,0xffffffffffffe622,0x13ceffffffffff,0xf3430000005ee622,0x13ceffffffffff,0xb3ffffffe622,0x13ceffffffb300,0x13ceffe622,0x13ceffe6220000,0x13ceffe622,0x13ceffe6220000,0x22e6ffffe622,0x13cefffff34300,0xffffe6a9ffffe622,0x5effffffffffff,0x90b68e9c26cee622,0x13cee680b69c90,0x13cee62213cee622,0x13ceffffffe622,0xcea9ffffffb30000,0xb3ffffffa9,0xb3f3438ce622,0x13ceb322e6ce13,0xffffffffffffe622,0x13ceffffffffff,0xffce130000000000,0x8c,0xffffff9bceffb300,0xb3ffe680ffff,0x8cffffffe622,0x13ceffffff8c00,0x8c0000005effb300,0xb3ffffffffff,0x43008cffffffe622,0x13cefffffffff3,0x8cf343005eb300,0xb35e0013c243,0x8cffffffff5e0000,0x22e6ffffffce13,0xffce1343f3f34300,0x8cfff34300b3,0x5effffffffe622,0x13ceffffffff8c,0xffffffffffffe622,0x13ceffffffffff,0x8c13ceffffffe622,0x5effffffff,0xffffb35effce1300,0xb3ff8c5eff,0x0,0x0,0xf3430000005ee622,0x13ceffffffffff,0x5effffffffb300,0xb3ffffffff5e,0x5effffffffb300,0xb3ffffffff8c,0xffffffffffffb300,0xb3ffffffffff,0xb5220043f3ffb300,0xb3ffff5e0013,0xffb3000000000000,0x13ceffffffffff,0x90b68e9c26cee622,0x13cee62243a99c,0x5effffffffffe622,0x13ceffffff8c00,0xfff382e743000000,0x43e782f3,0xffffff5e008ce622,0x13ceb3005effff,0xffffffffffffe622,0x13ceffffffffff,0xffffffce13000000,0xb3ffff,0xffffffffffff5e00,0x43f3ffffffff,0xb522005effffe622,0x13ceffff8c0013,0x8c000013ceff5e00,0x43f3ffffffff,0x22008cffffffe622,0x13ceffffffffe6,0x43e743b35e00,0x43c21343da22,0x8cffffff5e000000,0x22e6ffffce1300,0x8cffb30000,0x13ceffffb30000,0x5effffffffe622,0x13ceffffffff8c,0xffffffffffffe622,0x13ceffffffffff,0x8c0013ceffffe622,0x5effffff,0xffb35effce130000,0xb3ff8c5e,0xffffffffffffe622,0x13ceffffffffff,0xf3430000005ee622,0x13ceffffffffff,0x65e6ffffffff5e00,0x43f3fffffff3,0x5effffffff5e00,0x43f3ffffff8c,0xffffffffffff5e00,0x43f3ffffffff,0xffe644e6ffff5e00,0x43f3fff356ce,0xce13000000000000,0x13ceffff,0x9cf39b9c26cee622,0x13cee680f382f3,0xceffffffffffe622,0x13ceffffe62213,0xffffffffb3000000,0xb3ffffff,0xffb30000008ce622,0x13ceb30000008c,0xffffffffffffe622,0x13ceffffffffff,0x43da2200,0x13ce5e000000,0xffffffffffb30000,0x8cffffffff,0x8cffffe622,0x13ceffffb30000,0x8c0022e6ffb30000,0x8cffffffff,0x13ceffffffe622,0x13ceffffb30000,0x5effb30000,0x8cb35eb300,0x8cffff5e00000000,0x22e6ffce130000,0x35e6ffffe6220000,0x13ceffffffffce,0x5effffffffe622,0x13ceffffffff8c,0xffffffffffffe622,0x13ceffffffffff,0x8c000013ceffe622,0x5effff,0x5effce13000000,0xb3ff8c,0xffffffffffffe622,0x13ceffffffffff,0xf3430000005ee622,0x13ceffffffffff,0xffffffffffb30000,0x8cffffffff,0xffffffffffb30000,0x8cffffffff,0xffffffffffb30000,0x8cffffffff,0xffffffffffb30000,0x8cffffffff,0x2200000000000000,0x43f3ffe6,0x43f3ce13,0xb3ff5e000000,0xffffffffffffce13,0xb3ffff5e008c,0xfffff34300000000,0x43f3ff,0xb3e622,0x13cece13000000,0xffffffffffffce13,0xb3ffffffffff,0xffffffffffffe622,0x13ceffffffffff,0xffffffffce130000,0xb3ffffff,0xb3ffffffffce13,0xb3ffffffffb3,0xffffffffce130000,0xb3ffffff,0xffffffffffffce13,0xb3ffffffffff,0x13cece130000,0xb3ff8c00,0x8cff5e0000000000,0x22e6e622000000,0xffffffce13000000,0x5effffffffff,0x5effffffffe622,0x13ceffffffff8c,0xffffffffffffe622,0x13ceffffffffff,0x8c00000013cee622,0x5eff,0xffffce1300000000,0xb3ff,0xffffffffffffe622,0x13ceffffffffff,0xffffffffffffe622,0x13ceffffffffff,0xffffffffce130000,0xb3ffffff,0xffffffffce130000,0xb3ffffff,0xffffffffce130000,0xb3ffffff,0xffffffffce130000,0xb3ffffff,0x0,0x43f3ffb3,0xfffffffffff34300,0x22e6ffffffff,0xfffffffffff34300,0x22e6ffffffff,0xff8c000000000000,0x8c,0xffffffffffffb300,0x8cffffffffff,0xfffffffffff34300,0x22e6ffffffff,0x43da2200,0x13ce5e000000,0xfffff34300000000,0x43f3ff,0xfffffffffff34300,0x22e6ffffffff,0xfffff34300000000,0x43f3ff,0xfffffffffff34300,0x22e6ffffffff,0xfffff34300000000,0x43f3ff,0x8c5e000000000000,0x22ce2200000000,0xda43000000000000,0x8cfffff365,0x5effffffffe622,0x13ceffffffff8c,0xffffffffffffe622,0x13ceffffffffff,0x8c0000000013b522,0x5e,0xffce130000000000,0xb3,0x0,0x0,0xffffffffffffe622,0x13ceffffffffff,0xfffff34300000000,0x43f3ff,0xfffff34300000000,0x43f3ff,0xfffff34300000000,0x43f3ff,0xfffff34300000000,0x43f3ff,0x0,0x13ceff5e,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x9c13000000000000,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5eb30000000000,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8c00000000000000,0xb3ff,0x0,0x0,0xffff8c0000000000,0x5eff,0xffff8c0000000000,0x5eff,0xffff8c0000000000,0x5eff,0xff8c000000000000,0x8c,0xffff8c0000000000,0x5eff,0xffff8c0000000000,0x5eff,0xffffb30000000000,0x8cff,0xffb3000000000000,0xb3,0xffffffffffffff5e,0x5effffffffffff,0x5e5e0000000000,0x5e8c,0xffff8c0000000000,0x5eff,0x0,0x13ceffffffce13,0xffff8c0000000000,0x5eff,0xffffffffffb30000,0xb3ffffffff,0xffff8c0000000000,0x5eff,0x43f3ff8c00000000,0x0,0xffff8c0000000000,0x5eff,0x0,0x0,0xffffffffffb30000,0xb3ffffffff,0x43f3ffffe622,0x13ceffffff5e00,0xffffffffffb30000,0xb3ffffffff,0xffffffffffb30000,0xb3ffffffff,0xda43000000000000,0x8cce35,0xe622000000000000,0x8cffffff,0xffffffff8c000000,0x5effffff,0xffffffff8c000000,0x5effffff,0xffffffff8c000000,0x5effffff,0xffb3000000000000,0x8c,0xffffffff8c000000,0x5effffff,0xffffffff8c000000,0x5effffff,0xffffffff8c000000,0x5effffff,0xffffffffe6220000,0x22e6ffffff,0xffffffffffffff8c,0x8cffffffffffff,0x5effff8c000000,0x5effff8c,0xffffffff8c000000,0x5effffff,0x0,0x13ceffffff8c00,0xffffffff8c000000,0x5effffff,0xffffffffffffb300,0xb3ffffffffff,0xffffffff8c000000,0x5effffff,0x22e6ff8c00000000,0x0,0xffffffff8c000000,0x5effffff,0x8cffff8c000000,0x5effffb3,0xffffffffffffb300,0xb3ffffffffff,0x5effffffe622,0x13ceffffff8c00,0xffffffffffffb300,0xb3ffffffffff,0xffffffffffffb300,0xb3ffffffffff,0xce5e000000000000,0xb38c13,0x8cffffffffff8c00,0x8ce6220000,0xffffffffff8c0000,0x5effffffff,0x8cffffff8c0000,0x5effffff8c,0x5effffff8c0000,0x5effffff8c,0xffffe62200000000,0x13ceff,0x8cffff8c0000,0x5effffb300,0x8cffff8c0000,0x5effffb300,0x8cffff8c0000,0x5effffb300,0x22e6e6220000,0x22e6e62200,0xffffffffffffff8c,0x8cffffffffffff,0x5effffff8c0000,0x5effffff8c,0x8cffff8c0000,0x5effffb300,0x0,0x13ceffffce1300,0x8cffff8c0000,0x5effffb300,0x43f3e622,0x13ceff5e000000,0x8cffff8c0000,0x5effffb300,0x13ce5e00000000,0x0,0x43f3ffff8c0000,0x5effffff5e,0x9ce74343da220000,0x13ce5e22e6,0xffffffffffffe622,0x13ceffffffffff,0x5effffffe622,0x13ceffffff8c00,0xffffffffffffe622,0x13ceffffffffff,0xffffffffffffe622,0x13cece1300008c,0x8ce6220000000000,0x8c8c00,0x43da80e622,0xb35e000000,0xfffffffffff34300,0x22e6ffffffff,0x22e6fff34300,0x22e6ffe62200,0xfffffffffff34300,0x22e6ffffffff,0xffb35ef343000000,0x22e68c8c,0x43f3f34300,0x22e6ff5e0000,0x43f3f34300,0x22e6ff5e0000,0x22e6f34300,0x22e6ffffce13,0x13ce8c0000,0x8cce130000,0x0,0x0,0x5efffffff34300,0x22e6ffffff8c,0x43f3f34300,0x22e6ff5e0000,0x0,0x13ceffffffce13,0x43f3f34300,0x22e6ff5e0000,0x43f3e622,0x13ceff5e005243,0x43f3f34300,0x22e6ff5e0000,0x13c24300000000,0x0,0x43f3fffff34300,0x22e6ffffff5e,0xffffffffb3000000,0x8cffffff,0xffff5e43f3ffe622,0x13ceffb30000b3,0x5effffffe622,0x13ceffffff8c00,0xffffffffffffe622,0x13ceffffff5e8c,0xffffffffffffe622,0x13ceffff5e005e,0xb3b30000000000,0x5effffe622,0x43f3ffe622,0x43da22000000,0xffffffffffffb300,0x8cffce13b3ff,0xe743008cffffb300,0x8cffff8c0043,0xffffffffffffb300,0x8cffffffffff,0xda43005ece130000,0xb38c0022,0x35ceb3005effb300,0x8cff8c008ce6,0x5effb300,0x8cff8c43da22,0x130000005effb300,0x8cff9bceffce,0x43f3ffb3,0xb3fff343000000,0xffffffffffffe622,0x22e6ffffffffff,0x5effffffffb300,0x8cffffffff8c,0x8c0000005effb300,0x8cff8c0000b3,0x1300000000000000,0x13ce8c13ceffce,0x8cce13005effb300,0x8cff8c000000,0xb300000043f3e622,0x13ceff5e008cff,0x5effb300,0x8cff8c000000,0xffffe62200000000,0x8cff,0x5effffffffb300,0x8cffffffff8c,0xffffffffffffb300,0xb3ffffffffff,0xcece130013cee622,0x13ceff8c000013,0x13ceffff8c00,0x5effffce1300,0x8cffff8c8cffe622,0x13ceff8c000000,0xffffffffffffe622,0x13ceffff8c005e,0x13ceffffe62200,0x8cfffffff343,0x43f3ffe622,0x43c213000000,0xffffffffffffce13,0x13ceff5e0000b3,0xffffffffffffce13,0x13ceffff5e005e,0x5effffffce13,0x13ceffffffff8c,0x13c2430000,0x43da220000,0xffffff5e22e6ce13,0x13cef34343f3ff,0x2213c24322e6ce13,0x13cef365e6ffe6,0xce13000022e6ce13,0x13cef34313ceff,0x13cee622,0x22e6ce13000000,0xffffffffffffe622,0x22e6ffffffffff,0x5effffffffce13,0x13ceffffffff5e,0x8c00000022e6ce13,0x13cef34300b3ff,0x5e00000000000000,0x13ceff,0x8cffce1322e6ce13,0x13cef343000000,0xffe6220043f3e622,0x13ceff5e008cff,0xffff5e0022e6ce13,0x13cef343005eff,0xffffe680f3430000,0x8cff,0x5effffffffce13,0x13ceffffffff8c,0x43f3ffffffe622,0x13cefffffff343,0xffb300005772e622,0x13ceffce1300b3,0x0,0x0,0x5e5e0000b3ffe622,0x13cefff3430000,0x43f3ffffffffe622,0x13cece13000000,0x13ceffffe622,0x13c24300000000,0x43f3ffe622,0x8c8c00000000,0xb3ff5e0043f3e622,0x13ceffff5e0000,0x13ceffffffffe622,0x13ceffffe62200,0x5effffffffe622,0x13ceffffffff8c,0x5effffffe622,0x13ceffffff8c00,0xffff5e0013cee622,0x13cee6220043f3,0xf3e7fff356cee622,0x13cee6225effff,0xffce130013cee622,0x13cee6220013ce,0xa74300,0x43a700000000,0x22e6ffffffe622,0x22e6ffffffe622,0x22e6ffffffe622,0x13cefffffff343,0xffffffce26cee622,0x13cee622b3ffff,0x0,0x1326,0xffffffb313cee622,0x13cee622b3ffff,0xfffff34343f3e622,0x13ceff5e008cff,0xffffb30013cee622,0x13cee622008cff,0x5ece135ee62200,0x0,0x5effffffffe622,0x13ceffffffff8c,0x43f3ffffffe622,0x13cefffffff343,0xff8c0022e6ffe622,0x13ceffff5e00b3,0x5effffffe622,0x13ceffffff8c00,0x8cffe622,0x13ceffff5e0000,0x43f3ffffffffe622,0x13cee622000000,0x43f3ffe622,0xb38c00000000,0x43f3ffe622,0x8cb300000000,0xb3ffe622,0x13ceffffff5e00,0x5effffffffe622,0x13ceffffffff5e,0x5effffffffe622,0x13ceffffffff8c,0x43f3ffffce13,0xb3ffffff5e00,0xffffe62222e6e622,0x13cef34313ceff,0xffffff8c22e6e622,0x13cef343005eff,0xceffce1322e6e622,0x13cef343000013,0xb3b300,0xb3b300000000,0xffffffffffffe622,0x22e6ffffffffff,0xb3ffffffe622,0x13ceffffffce13,0xffffffce35e6e622,0x13cef34313ceff,0x22e6ce1300000000,0x0,0xffffe62222e6e622,0x13cef343b3ffff,0xffff8c0043f3e622,0x13ceff5e008cff,0xffff8c0022e6e622,0x13cef343005eff,0xffffb300008cb300,0x13ceffff,0x5effffffffe622,0x13ceffffffff8c,0x43f3ffffffe622,0x13cefffffff343,0xf35e005effffe622,0x13ceffffce1343,0x5effffffe622,0x13ceffffff8c00,0x8cffffe622,0x13ceffffb30000,0xffffffffffffe622,0x13ceffff8c005e,0x43f3ffe622,0x8c8c00000000,0x43f3ffe622,0x13c24300000000,0xb3ffffb300,0xb3ffffffff5e,0xffffffffffffb300,0xb3ffffffffff,0x5effffffffb300,0xb3ffffffff8c,0x43da220000,0x13ce5e0000,0x9cf3e6225effb300,0xb3ff5e13ceff,0xffff8c005effb300,0xb3ff5e00005e,0x13ceffce72ffb300,0x8cff8c000000,0x22e6ff8c,0x8cffe622000000,0xffffffffffffe622,0x22e6ffffffffff,0x3a0043f3ffffb300,0xb3ffffff5e00,0x8c0000005effb300,0xb3ff5e0013ce,0x13ceffce1322ce22,0x0,0x8ce622005effb300,0xb3ff5e000000,0xe622000043f3e622,0x13ceff5e008cff,0xffb300005effb300,0xb3ff5e00008c,0x43da22,0x5ece1300,0xffffffffffffb300,0xb3ffffffffff,0x43f3ffffe62200,0x13cefffff343,0xb3ffffe622,0x13ceffffff5e00,0x43f3ffffffce13,0xb3fffffff343,0xb3ffffe622,0x13cefffff34300,0xffffffffffffe622,0x13ceffff8c005e,0x43f3ffe622,0x5ee622000000,0xb3ffffffb300,0xb3b300000000,0x5e00b3ffffff5e00,0x43f3ffffffff,0x5effffffff5e00,0x43f3ffffff8c,0x5effffff5e00,0x43f3ffff8c00,0xffb322e68c000000,0x5ef3438c,0x13ceff5e00,0x43f3e6220000,0x43800013ceff5e00,0x43f3e6220000,0x13ceffffff5e00,0x43f3e6220000,0xb3ff5e00,0x5effb3000000,0xffffffffffffe622,0x22e6ffffffffff,0xb522005effff5e00,0x43f3ff8c0013,0x57000013ceff5e00,0x43f3e6220013,0x13ceffe7f3e622,0x0,0x44220013ceff5e00,0x43f3e6220000,0x43f3e622,0x13ceff5e008cb3,0x13ceff5e00,0x43f3e6220000,0x22ce22,0x13ce725700,0x5effffffff5e00,0x43f3ffffff8c,0x43f3ffffe62200,0x13cefffff343,0x13ceffffe622,0x13cefffffff343,0xffffffffffff8c00,0x5effffffffff,0x8cffffe622,0x13ceffffffff5e,0xffffffffffffe622,0x13ceffff8c005e,0x43f3ffe622,0x43c213000000,0x8ce62200000000,0x13cefffff343,0xffffffffffb30000,0x8cffffffff,0x5effffffb30000,0x8cffffff8c,0x5effffb30000,0x8cffff8c00,0xffffff8c00000000,0x5effff,0x22e6ffb30000,0x8cfff34300,0x22e6ffb30000,0x8cfff34300,0x22e6ffb30000,0x8cfff34300,0xb3e6220000,0x22e6b30000,0xffffffffffffe622,0x22e6ffffffffff,0xffb30000229b0000,0x804300008c,0x22e6ffb30000,0x8cfff34300,0x13ceffffe622,0x0,0x22e6ffb30000,0x8cfff34300,0x43f3e622,0x13ceff5e000000,0x22e6ffb30000,0x8cfff34300,0x5ece13,0x8ce680ce72b300,0x5effffffb30000,0x8cffffff8c,0x43f3ffffe62200,0x13cefffff343,0x5e005effffffe622,0x13ceffffffffff,0xffffffffffe62200,0x13ceffffffff,0xffffffffffffe622,0x13ceffffffffff,0xffffffffffffe622,0x13ceffff8c005e,0x43c256da22,0x13ce5e000000,0x5ef3430000000000,0x8cb300,0xffffffffce130000,0xb3ffffff,0xffffffffce130000,0xb3ffffff,0xffffffffce130000,0xb3ffffff,0xffb3000000000000,0x8c,0xffffffffce130000,0xb3ffffff,0xffffffffce130000,0xb3ffffff,0xffffffffce130000,0xb3ffffff,0xffffffffe6220000,0x22e6ffffff,0xffffffffffffe622,0x22e6ffffffffff,0xffffb30000000000,0x8cff,0xffffffffce130000,0xb3ffffff,0x22e6ffffe622,0x0,0xffffffffce130000,0xb3ffffff,0xffffffffffffce13,0xb3ffffffffff,0xffffffffce130000,0xb3ffffff,0x13ce8c00,0x5eff5e43e743,0xffffffffce130000,0xb3ffffff,0xffffffffffce1300,0xb3ffffffff,0xffffffffffffce13,0xb3ffffffffff,0xfffffffff3430000,0x22e6ffffff,0xffffffffffffce13,0xb3ffffffffff,0xffffffffffffce13,0xb3ffff8c005e,0x8cffffffffce13,0xb3b3000000,0xb35e000000000000,0xb38c00,0xfffff34300000000,0x43f3ff,0xfffff34300000000,0x43f3ff,0xfffff34300000000,0x43f3ff,0xffb3000000000000,0x8c,0xfffff34300000000,0x43f3ff,0xfffff34300000000,0x43f3ff,0xfffff34300000000,0x22e6ff,0xffce1343da220000,0x22da4313ce,0xffffffffffffe622,0x22e6ffffffffff,0xfffff34300000000,0x22e6ff,0xfffff34300000000,0x43f3ff,0x13ceffffffe622,0x0,0xfffff34300000000,0x43f3ff,0xfffffffffff34300,0x22e6ffffffff,0xfffff34300000000,0x43f3ff,0x43000013cece1300,0x8cf3,0xfffff34300000000,0x43f3ff,0x0,0x0,0xfffffffffff34300,0x22e6ffffffff,0xffffff8c00000000,0x5effff,0xfffffffffff34300,0x22e6ffffffff,0xfffffffffff34300,0x22e6ffffffff,0xffce130000000000,0x13ceffffff,0xda43000000000000,0x8cb322,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe743000000000000,0x43,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xf3ffffff8c000000,0x43,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xce13000000000000,0x22e6ff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8cffce1300000000,0x0,0xffff8c0000000000,0x8cffffffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x26130000,0x139c13000066,0x0,0x0,0x0,0x0,0xffffffffffb30000,0xb3ffffffff,0x0,0x0,0xffffffffffb30000,0xb3ffffffff,0xff5e000000000000,0x43f3ff,0xffffffffffb30000,0xb3ffffffff,0xffff8c0000000000,0x5eff,0x0,0x0,0x5eb30000000000,0x8c8c,0xe622b3b300000000,0x5e,0xffffb30000000000,0x13ce5eb3ffff,0xffff8c0000000000,0x5eff,0xffff8c0000000000,0x5eff,0xffff8c0000000000,0x5eff,0xffff8c0000000000,0x5eff,0xffff8c0000000000,0x5eff,0x0,0xb3ffff5e,0x13ceffffffe622,0x13ceffffffce13,0xffffffffffffce13,0x8cffff,0xffffffffffb30000,0xb3ffffffff,0x0,0x0,0x22e6ffffffffe622,0x13ceffffff5e00,0x22730052430000,0x13ceffce130066,0xffff8c0000000000,0x5eff,0x5effffffb30000,0x0,0xffffffffffffb300,0xb3ffffffffff,0x0,0x8cffffff8c,0xffffffffffffb300,0xb3ffffffffff,0x22e6ffb300000000,0x5efffff34300,0xffffffffffffb300,0xb3ffffffffff,0xffffffff8c000000,0x5effffff,0xffffffffb3000000,0x8cffffff,0xdbffe62200000000,0x13ceff,0x8c005ece13000000,0x8c,0xffffb30000000000,0x13ceffffffff,0xffffffff8c000000,0x5effffff,0xffffffff8c000000,0x5effffff,0xffffffff8c000000,0x5effffff,0xffffffff8c000000,0x5effffff,0xe6ceffff8c000000,0x5effffff,0xb300000000000000,0x8cffffff,0x5effffffe622,0x13ceffffff8c00,0x5effffce35ce22,0xb3ce9b8c,0xffffffffffffb300,0xb3ffffffffff,0xffffffffffffce13,0x13ceffffffffff,0x43f3ff5e0000,0x5eb3000000,0x22e6ff5e00000000,0xb3b300b3ce1300,0xffffffff8c000000,0x5effffff,0x13ceb300,0x43f38c,0xffffff8c5effe622,0x13ceffffffffff,0x22e6b30000000000,0x8ce622000000,0xffffffffffffe622,0x13ceffffffffff,0xb3e6220000,0x8cb300000000,0xffffce56f3ffe622,0x13ceffffffffff,0xffffffffff8c0000,0x5effffffff,0x13ce5e0000,0x43da220000,0xffffffffff8c0000,0x5effffffff,0x8c005ece13000000,0x8c,0x5eb30000000000,0x13ce5e000000,0x65e6ffffff8c0000,0x5efffffff3,0x65e6ffffff8c0000,0x5efffffff3,0x65e6ffffff8c0000,0x5efffffff3,0x8cffffff8c0000,0x5effffffb3,0x8c000022e68c0000,0x5effffffff,0xff5e000000000000,0x13ceff,0xb3ffffe622,0x13ceffffce1300,0x5effffce35ce22,0xb3ce138c8c,0xffffffffffffe622,0x13ceffffffffff,0xffffffffffffe622,0x13ceffffffffff,0x43f3f3430000,0x5eb3000000,0x5eb30000000000,0x22e68c00b3ce13,0x8cffffff8c0000,0x5efffff343,0x43da22,0x43f3ff8c,0xffffe62213cee622,0x13ceffffffffff,0xe6ffb30000000000,0x13c24300000022,0x132613ceffe622,0x13ceffe6223535,0x8cce1300,0x8cb300000000,0xfff343005effe622,0x13ceffffffffff,0x132613cef34300,0x22e6e6223535,0x8cb30000,0x8cb3000000,0xfffffffff3430000,0x22e6ffffff,0x8c005ece13000000,0xb3ffffff,0x43f35e00000000,0x22da43000000,0x22e6fffff34300,0x22e6ffffff5e,0x43f3fffff34300,0x22e6fffff343,0x22e6fffff34300,0x22e6fffff343,0x5efffffff34300,0x22e6ffffff8c,0x5e00000043e74300,0x22e6ff8c13ce,0xff8c000000000000,0xb3ff,0xb3ffffffe622,0x13ceffffffce13,0x5effffce35ce22,0x8cce13008c8c,0xffffffffffffe622,0x13ceffffffffff,0x0,0x0,0x43f3f3430000,0x8c8c000000,0x1322440000000000,0x22e68c8cffce,0xce22008cfff34300,0x22e6ff5e0022,0xffffff5e0022ce22,0x43f3ffffff,0xffffffffffffe622,0x13ceffffffffff,0xffffffffffff8c00,0x13c243000022e6,0x22e6ffe622,0x13cefff3430000,0x13ce5e00,0xb35e00000000,0xffce130043f3e622,0x13ceffffffffff,0x22e6ffb300,0x8cfff3430000,0x43da2200,0x13ce5e000000,0xffffffffffff8c00,0x5effffffffff,0x5effffe62200,0x8cfff3430000,0x43f38c000000,0x5ece13000000,0x220022e6ffffb300,0x8cffffffffe6,0x13ceffffffffb300,0x8cfffff34300,0x22e6ffffb300,0x8cfffff34300,0x5effffffffb300,0x8cffffffff8c,0xb3ffb300,0x8cffffda3500,0xff8c000000000000,0x13ce5e0000b3ff,0x13b3ffe6225ee622,0x13ce8c13ceffce,0xffffffffce35ce22,0x13c24300008cff,0xffffffffffffe622,0x13ceffffffffff,0x0,0x0,0x43f3f3430000,0x8c5e000000,0xce13000000000000,0x22e6ffffff,0xffffce13b3ffb300,0x8cffb313ceff,0xffffffce1322ce22,0x43f3ffffffff,0x2222ce2222e6e622,0x13ceffe6220044,0xffffffffffffe622,0x13c2430022e6ff,0x8cffe622,0x13ceffb3000000,0x8cb300,0x13c24300000000,0xffffce135effe622,0x13ceffffffffff,0x8cffce13,0x13ceffb3000000,0x13ce5e00,0x43da22000000,0xffffffffffffce13,0xb3ffffffffff,0x5ee6228cce13,0x13ce5e00000000,0x13ceff5e00,0xb38c00000000,0xe6220022e6ffce13,0x13ceffffffffff,0xceffffffffffce13,0x13cefff3430013,0x22e6ffce13,0x13cefff3430000,0x5ef365e6ffce13,0x13cefff382f38c,0x8cffce13,0x13ceffffffb300,0xff5e000000000000,0xb3ffffffffff,0xffffe62200000000,0x13ceff,0xffffffff5e22ce22,0x13c243000043f3,0xffffffffffffe622,0x13ceffffffffff,0x0,0x0,0x5efff3430000,0x8c5e000000,0xffce130000000000,0xb3e62222e6ffff,0x5e13ce8c43f3ce13,0x13ceff5e43f3ff,0xffffffce1322ce22,0x43f3ffffffffff,0x22ce2222e6e622,0x13ceff5e000000,0xffffffffffffe622,0x13c24313ceffff,0x5effe622,0x13ceff8c000000,0x43c213,0x13c24300000000,0xffff8c13ceffe622,0x13ceffffffffff,0x5effe622,0x13ceff8c000000,0x8c8c00,0x8cb300000000,0xffffffffffce1300,0xb3ffffffff,0x22ce22,0x13c24300000000,0x43da22,0x13ce5e00000000,0x43f3e622,0x13ceff5e000000,0x43f3e622,0x13ceff5e000000,0x44220043f3e622,0x13ceff5e001357,0x52430043f3e622,0x13ceff5e004380,0x43f3ffe622,0x13ceffffffff5e,0x8cb3ce1300000000,0x22e6ffffffff,0xffe6220000000000,0x13ce,0x22ce22,0x13c24300000000,0xffffffffffffe622,0x13ceffffffffff,0xffffffffffffe622,0x13ceffffffffff,0x5efff3430000,0x8c5e000000,0xffffce1300000000,0x22e6ff,0x5e008cb322e6e622,0x13ceff5e43f3ff,0xffffffce1322ce22,0x8cffffffffff,0x2222ce2222e6e622,0x13cef34313cee6,0xffffffffffffe622,0x13c243005effff,0x8cffe622,0x13ceffb3000000,0x43da22,0xb35e00000000,0xffb3005effffe622,0x13ceffffffffff,0x8cffe622,0x13ceffb3000000,0xffffffffffffce13,0x13ceffffffffff,0xffffffffffff8c00,0x5effffffffff,0x8cffb300,0xb38c00000000,0x5e8c005ece13,0x13c24300000000,0xb3ffe622,0x13ceff5e000000,0x5effe622,0x13ceffce130000,0x5ee635ceffe622,0x13ceffce26ce8c,0xb3ffe622,0x13ceffce130000,0xf38c35daffffe622,0x13ceffffffffc2,0xceffffce13000000,0x8cfff356,0xffffce1300000000,0xb3ff,0x22ce22,0x13c24300000000,0xffffffffffffe622,0x13ceffffffffff,0xffffffffffffce13,0xb3ffffffffff,0x5efff3430000,0x8c8c000000,0xffffffce13000000,0x22e6,0xb313ce8c43f3e622,0x13ceff5e22e6ff,0xffffffb30022ce22,0x8cffffffff,0x2222ce2222e6e622,0x13cef34322e6e6,0xffffffffffffe622,0x13c24300005eff,0x22e6ffe622,0x13cefff3430000,0x22ce22,0x5ece13000000,0x8c0043f3ffffe622,0x13ceffe62213ce,0x22e6ffb300,0xb3fff3430000,0x22ce22,0x13c24300000000,0xffffffffffffe622,0x13ceffffffffff,0x13cee6220000,0x5ece13000000,0x5effffff5e00,0x8cce13000000,0x430000b3ffffb300,0xb3fffffffff3,0x43f3ffffffffb300,0xb3ffffce1300,0x5effffffffb300,0xb3ffffffff8c,0xb3ffffb300,0xb3ffffce1300,0xc252b3ffffffb300,0xb3ffffffffff,0xe6ffffffce130000,0x22,0x35ceffce1322ce22,0x13c24300b3ffe6,0xffffffffce35ce22,0x13c243b3ffffff,0xffffffffffffe622,0x13ceffffffffff,0x0,0x0,0xb3ffe6220000,0x5ece130000,0xe6ffffffce130000,0x22,0xce138056ceffb300,0xb3ffce138cff,0x22ce22,0x8cffff8c,0x2222ce2222e6e622,0x13cef34322e6e6,0xffffb30000000000,0x13c2430000005e,0x43f3ff72cee622,0x13ceffffffff5e,0x43c213,0x13ce5e000000,0x5effffffffe622,0x13ceff5e000000,0x43f3ff72ce5e00,0x43f3ffffff5e,0x22ce22,0x13c256ce8cb3b3,0xffffffffe6220000,0x22e6ffffff,0x13ceb300000000,0x22da43000000,0x73005ece13000000,0xb3ffffffa9,0xb3ffffff5e00,0x43f3ffffff5e,0x43f3ffffff5e00,0x43f3ffffce13,0x5effffffff5e00,0x43f3ffffff8c,0xb3ffffff5e00,0x43f3ffffce13,0xceffffffffff5e00,0x43f3ffffffe6,0x22e6ffffffce1300,0x0,0x13ceffe7f3e622,0x13cef3e7ffe622,0x43c235ce22,0x13c243b35e0000,0xffffffffffffe622,0x13ceffffffffff,0x0,0x0,0x8cffff5e000000,0xb3ce1300,0x22e6ffffffce1300,0x0,0x5effffff5e00,0x43f3ff8c0000,0x8cce13,0x8cff8c,0x2222ce2222e6e622,0x13cef34322e6e6,0x5effb30000000000,0xb38c00000000,0x5243b3ffe622,0x13ceffffffe622,0x5ece13,0x43e7430000,0xe6ffffffffffe622,0x13ceffe6220022,0x5243b3b30000,0x8cffffe622,0x22ce22,0x13c24300000000,0xffffffffff5e0000,0x43f3ffffff,0x5ece1300000000,0x13ce5e000000,0x8c005ece13000000,0x22e6,0x13b3ffffffb30000,0x8cffffffce,0x26ceffffffb30000,0x8cffffffce,0x5effffffb30000,0x8cffffff8c,0x13b3ffffffb30000,0x8cffffffce,0xffffffffffb30000,0x8cce1300b3,0x22e6ffffffce13,0x0,0x13ceffffe622,0x13ceffffe62200,0x43c235ce22,0x13c243b35e0000,0xffffffffffffe622,0x13ceffffffffff,0xffffffffffffe622,0x13ceffffffffff,0xffffe62200000000,0x22e6ff,0x22e6ffffffce13,0x0,0xff8c22e6ffb30000,0x8cffffffff,0x5effffffe62200,0x8c5e,0xffffffffffffce13,0xb3ffffffffff,0x5eb30000000000,0x13ceffffff8c,0x13ceffffffce13,0xb3ffffffe622,0x43da22,0x5effb300,0xffffffffffffce13,0xb3ffffffffff,0x13ceffce130000,0xb3ffe622,0xffffffffffffb300,0x8cffffffffff,0xffffe62244220000,0x132613ceff,0xffffb30000000000,0x13ceffffffff,0x8c005ece13000000,0x8c,0xffffffffce130000,0xb3ffffff,0xffffffffce130000,0xb3ffffff,0xffffffffce130000,0xb3ffffff,0xffffffffce130000,0xb3ffffff,0xffffffffce130000,0xb3ff5e8c,0x22e6ce56f3b3,0x0,0x22e6ffffe622,0x13cefffff34300,0x43c235ce22,0x13c243b35e0000,0xffffffffffffce13,0xb3ffffffffff,0xffffffffffffe622,0x13ceffffffffff,0x0,0x0,0x22e6fff34300,0x0,0xffce26cece130000,0xb3ffffff,0x0,0x0,0xfffffffffff34300,0x22e6ffffffff,0x0,0x0,0x13cefffff34300,0x22e6ffffe622,0xffffffffffffb300,0x13ceff,0xfffffffffff34300,0x22e6ffffffff,0x13c24300000000,0x43da22,0x0,0x0,0x13b3b30000000000,0xb3ce,0xffffb30000000000,0x13ce5eb3ffff,0xb3005eb300000000,0x8c,0xfffff34300000000,0x43f3ff,0xfffff34300000000,0x43f3ff,0xfffff34300000000,0x43f3ff,0xfffff34300000000,0x43f3ff,0xfffff34300000000,0x43f3ff,0x22e6ffffb3,0x0,0x13ceffffffe622,0x13ceffffffe622,0xffffffffffffe622,0x13ceffffffffff,0xfffffffffff34300,0x22e6ffffffff,0x0,0x0,0xffffffffffffe622,0x13ceffffffffff,0x22da430000,0x0,0xfff3430000000000,0x43f3ff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffffb30000000000,0xb3ffffffff,0xcefff34300000000,0x13,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x22e6ce13,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1357000000000000,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4380000000,0xffffe62200000000,0xffffffffffffffff,0x13ce,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xb343c235ce220000,0x13cefffff343005e,0x0,0x0,0x0,0x0,0x0,0x0,0xffffffffffb30000,0xb3ffffffff,0xffffffffffce1300,0xb3ffffffff,0x43e74300,0x0,0xffff8c0000000000,0x5eff,0xe6ff8c0000000000,0x22,0xffffe62200000000,0x43f3ffffffff,0xffffffffffb30000,0xb3ffffffff,0x8c5effffffffe622,0x13ceffffffff,0x0,0x0,0x43f3ff5e000000,0x0,0xb3f343000000,0x22ce2200000000,0x5e00000000000000,0x13ce,0xb3ff8c,0xffffffffe6220000,0x13ceffffffffffff,0x0,0x0,0xffffffffffb30000,0x8cffffff,0x0,0x1300000000000000,0x13cece,0x0,0x0,0x0,0x0,0x0,0x0,0xb343c235ce220000,0x13cefffffff3435e,0xff5e000000000000,0x43f3,0x0,0x139c13000000,0xffffffffffffb300,0x8cffff,0xffffffffffffb300,0xb3ffffffffff,0x4300000013ceb300,0xb3ff5eb3fff3,0x22e6ffe622,0x0,0xffffffff8c8ce622,0x5effffff,0xffff8c0000000000,0x22e6,0xffffffffffffff5e,0x5effffffffff,0xffffffffffffb300,0xb3ffffffffff,0x8c5eb3000022ce22,0x13ce5e00008c,0x0,0x0,0x8cffffb3000000,0x0,0xb3fff343000000,0xc235ce2200000000,0x5eb38c8c8c5eb343,0xff8c0000000013ce,0x43f3ff,0xffffffffce130000,0xb3ffffffffffff,0x0,0xb3ffb300,0xb3b300,0x8cce130000,0x0,0x8c00000000000000,0x8cffff,0x0,0x0,0x0,0x43f3ff8c00,0x0,0x43f3f343,0xb343c235ce220000,0x13ceffffffff8c5e,0xffb3000000000000,0x8cff,0x0,0xb3ffce130000,0xb3b3,0x8cce1300,0x5effffffffe622,0x13cefffffff343,0xff5e00b3ffce3a13,0x13ceff5eb3ffff,0x22e6ffce13,0x0,0x5effffffffe622,0x5effffff8c,0xffffffb300000000,0x22e6ff,0xffffffffffffff5e,0x13ceffffffff,0xffffce135effe622,0x13ceff8c13ceff,0x8c5eb343c235ce22,0x13ce5eb38c8c,0x0,0x1300000000000000,0x8cffffb30022b5,0x9b22,0x43f3ffffce130000,0x22ce2200000000,0x5e00000000000000,0x22e68c00000013ce,0x8cb3,0xffffffffce130000,0x8cffffffffffff,0x1300000022ce2200,0xb3ffffffffce,0x5eb300000043da22,0x13ce5e000000,0x0,0xe622000000000000,0x22e6ffff,0x0,0x0,0x0,0x43f3ffffce13,0x4300000000000000,0x43f3fffff3,0xb343c235ce220000,0x13ceffffffff8c5e,0xffb3000000000000,0x8cff,0x8c00000000000000,0x220022e6ffce26ce,0x43da,0x13ce5e0000,0xe743008cffffe622,0x13ceffff5e0043,0xce135efffff34300,0x8c,0x0,0x0,0x8cffffe622,0x22e6ffb30000,0xffffffffb3000000,0x13ceffff,0xffffb30043f3e622,0x13ceffffffff,0xffffb30043f3e622,0x13ceff5e008cff,0x8c5eb3000022ce22,0x13ce5e00008c,0x0,0xb300000000000000,0xce9bffffb3b3ffff,0x8cffff,0x8cfffffffff34300,0xc235ce2200000000,0x5e8c5e8c8c5eb343,0x1322da43000013ce,0x43c2,0x5effb3000000,0x8cff8c00000000,0x43000043f3e62200,0x13cefffffffff3,0x8cb300000022ce22,0x13ce5e000000,0xb38c,0xe62200005ece1300,0x22e6ffff,0x0,0x0,0x0,0x43f3fffff34300,0xf343000000000000,0x43f3ffffffff,0xce72e665da220000,0x13ceffffffff8c5e,0xffb3000000000000,0x8cff,0x8c00000000000000,0x22000022e6ffffff,0x22ce,0x13ce5e0000,0xffffce13b3ffe622,0x13ceffb313ceff,0xce13b3fffff34300,0x13ceff5eb3ffff,0xf3ff8c22e6ffce13,0x43f3ffb343,0x8cffffffe622,0x8cffce130000,0xffffffffffb30000,0x8cffff,0xffffb30043f3e622,0x13ceffffffff,0xffffb30043f3e622,0x13ceff5e008cff,0x8c5effffffffe622,0x13ceffffffff,0xfffffffffffff343,0xe622000022e6ffff,0xffffffffffffffff,0x22e6ffff,0xb3fffffffffff343,0x9b22ce2200000000,0x5e52434352438022,0x22008cb3000013ce,0x43da,0xf3435effb3000000,0x5effffffffffff,0x56ceffffffb30000,0x43f3fffffff3,0x8cb300000022ce22,0x5e0013ce5e000000,0x13ceffff,0xb300005effffce13,0x13ceff,0xf343000000000000,0xb30000b3ce13005e,0x22e6,0x43f3fffff3430000,0xfff3430000000000,0x43f3ffffffffff,0xffffffffe6220000,0x13ceffffffff8c5e,0xffb30000b35e0000,0x43a700008cff,0x8c00000000000000,0x2200000022e6ffff,0x22ce,0x13ce5e0000,0x5e13ce8c43f3e622,0x13ceff5e43f3ff,0xe622b3ffffce1300,0x13ceff5eb3ffff,0xffff8c22e6ffce13,0x5effffffffff,0x8cffffffb300,0x13ceff8c000000,0xffffffffffffffb3,0x5e,0xffffb30043f3e622,0x13ceffffffff,0xffffb30043f3e622,0x13ceff5e008cff,0x8c5effffffffe622,0x220013ceffffffff,0xffffffffffffffe6,0x43000013ceffffff,0xfffffffffffffff3,0x43f3ff,0x8cffffffffffffb3,0x22ce2200000000,0x5e00000000000000,0x130043c2130013ce,0x43c2,0xe6228cff8c000000,0x5effffffffffff,0xffffffffffe62200,0x43f3ffffffff,0x8cb300000022ce22,0x8c0013ce5e000000,0x13000013ceffffff,0x5e00005effffffce,0x43f3ff,0xffe6220000000000,0xff8c8cffffb343f3,0x13ceff,0xf3fffff343000000,0xfffff34300000043,0x43f3ffffffffffff,0xffffffffe6220000,0x13ceffffffff8c5e,0xffb300b3ffff5e00,0x5effffce138cff,0x8c00000000000000,0x22000013ceffffff,0x22ce,0x13ce5e0000,0x5e00b3b343f3e622,0x13ceff5e43f3ff,0xffb35efff3430000,0x13ceff5eb3ffff,0xffff8c22e6ffce13,0xb3ffffb322e6,0x0,0x13ceff5e000000,0xf3ffffffffffff5e,0x43,0xffffb313ceffce13,0x13ceffffffff,0x43f3e622,0x13ceff5e000000,0x0,0x2200000000000000,0xffffffffffffffe6,0x13ceffffff,0xffffffffffff8c00,0x130000000000008c,0x22e6ffffffffffce,0xc235ce2200000000,0x5eb35e8c8c5eb343,0x22ce220013ce,0x8cb3,0x8cff8c000000,0x43f3b300000000,0xffffffffffb30000,0x13ceffffffff,0xffffffffce35ce22,0x13ce5eb3ffff,0xce1313ceffffff8c,0x130000008cffffff,0xb3ffce,0xffe6220000000000,0xff8c8cffffb343f3,0xffffe6220013ceff,0xffffffffffffffff,0xe6fffff3430043f3,0xf3fffff3c2ffffce,0x5effffe622000043,0x13ceffffffff8c00,0xffb3b3ffffff8c00,0x5effffffce9bff,0x5e00000000000000,0x22000022e6ffffff,0xffffffffffce35ce,0x13ce5eb3ff,0xb313ce5e5effe622,0x13ceff8c22e6ff,0xffff8c00005ee622,0x13ceffffffffff,0xffff8c22e6ffce13,0x13ceffe622005e,0x0,0x13ceff5e000000,0x8c5effffffff5e00,0x43f3,0xffffffffffff5e00,0x13ceffffffff,0x43f3e622,0x13ceff5e000000,0x8c5effffffffe622,0x13ce5eb3ffff,0xffffffffffffffb3,0x8cffffff,0xffffffffffffffb3,0x130000000000b3ff,0x22e6ffffffffce,0x22ce2200000000,0x5e00000000000000,0x43da220013ce,0x43e743,0xffffffff5e000000,0x43f3ce13b3ffff,0xffffffffb3000000,0x8cffffffff,0x8cb300000022ce22,0x13ce5e000000,0xffdadaffffff8c00,0x8cffff,0xb3fff343,0xffb3000000000000,0xf34343f3ff8c22e6,0xffffe62200008cff,0xffffffffffffffff,0x22e6ffff8c005eff,0xfffff3438cffffb3,0x5effffe62200008c,0x13ceffffffff8c00,0xffffffffffb30000,0x8cffffffffff,0x8cffffffff5e0000,0x2200000000000000,0x22ce,0x13ce5e0000,0xce13a765e6ffe622,0x13ceffce138cff,0xffff5e00b3ffe622,0x13ceffffffffff,0xf3ff8c22e6ffce13,0x13ceffce130043,0x0,0xb3ffb3000000,0x13ceffff5e0000,0x13ceffff8c,0xffffffffe6220000,0x13ceffffffff,0xffffb30043f3e622,0x13ceff5e008cff,0x8c5eb3000022ce22,0x13ceffffffff,0x0,0xe622000000000000,0xffffffffffffffff,0x13ceffff,0x13ceffffff8c,0xc235ce2200000000,0x5eb38c8c8c5eb343,0x5eb3000013ce,0x8cff5e00,0xce13b3ff5e000000,0x22e6e6228cffff,0xffffffffce130000,0x22e6ffffff,0x8cb300000022ce22,0x13ce5e000000,0xffffffffff8c0000,0x8cff,0xe62213ceffff5e00,0x5eff,0x0,0xffffb30000000000,0xffffffffffffffff,0x22e6ce1300008c,0xb3f343008cffffb3,0x5effffe622000000,0x13ceffffffff8c00,0xffffffffb3000000,0x8cffffffff,0x8cffffff5e000000,0x2200000000000000,0x22ce,0x13ce5e0000,0x5effffffe622,0x13ceffff8c0000,0xf3430043f3ffe622,0x13ceffffffffff,0xf3ff8c22e6ffce13,0x13ceffce130043,0x43a7000000,0x43f3ff5e0000,0x8cff5e000000,0x13cefffff343,0xfffff34300000000,0x5effffffffff,0xffffb30043f3e622,0x13ceff5e008cff,0x8c5eb343c235ce22,0x13ceffff8c8c,0x0,0xce13000000000000,0xffdbffffe7f3ffff,0xb3ffff,0x22e6ffe622,0x22ce2200000000,0x5e00000000000000,0x13ce5e000013ce,0xf3ffffffe6220000,0x13cef343000043,0x22e6e622000000,0xffffff8c00000000,0x43f3ffff,0x8cb300000022ce22,0x13ce5e000000,0xffffffff8c000000,0x8c,0xffffffffff5e0000,0x13ceffff,0x0,0x0,0x8cffffffce130000,0x0,0x8cffffb3,0x5effffe622000000,0x13ceffff8c000000,0xffffffb300000000,0x8cffffff,0x8cffffffce130000,0x2200000000000000,0x22ce,0x13ce5e0000,0xff8c43f3ffffe622,0x13ceffffffffff,0x8c005effffe62200,0x13ceffffffffff,0xf3ff8c22e6ffce13,0x13ceffce130043,0x8cffff8c0000,0x8cffffb300,0x0,0x13ceffffffe622,0xffffffb300000000,0x22e6ffffffffff,0xffffb30043f3e622,0x13ceff5e00b3ff,0x8c5eb3000022ce22,0x8c,0x0,0x4300000000000000,0x8cffffb3008cf3,0x43f38c,0x22e6e62200,0xc235ce2200000000,0x5eb38c0000000043,0xb3b300000013ce,0x8cce130000000000,0x13ceffe622000000,0x13cefff3430000,0xfffffff343000000,0x43f3ff,0x8cce13,0xb3b3000000,0x8cffff8c00000000,0x0,0xffffffe622000000,0xb3ffff,0x0,0x0,0x8cffffffce1300,0x0,0x8cffffb3,0x5effffe622000000,0x13ceffff8c000000,0xffffb30000000000,0x8cffff,0x8cff72ceffce1300,0x1300000000000000,0x8cce,0xb3b30000,0xffce26ceffffce13,0xb3ffffffffff,0x435effffffffce13,0xb3fffffffff3,0xf3ff8c22e6ffce13,0x13ceffce130043,0xffffffffce130000,0xb3ffffff,0x0,0xb3ffffffe62200,0xffffffb300000000,0x22e6ffffffffff,0xffffffffffffce13,0xb3ffffffffff,0x8c5effffffffe622,0x13ce5eb38c8c,0x0,0x0,0x8cffffb3000000,0x0,0x4380000000,0x22ce2200000000,0x5e00008cffffb300,0xf3ce1300000013ce,0xb3ff5e00000043,0xffffffe622000000,0x13ceffffffffff,0xfffffffff3430000,0x5e,0xffffffffffe62200,0x13ceffffff,0x5e5e0000000000,0x0,0xffe6220000000000,0xb3ff,0x0,0x0,0x8cffffffce13,0x0,0x8cffffb3,0x5effffe622000000,0x13ceffff8c000000,0xffb3000000000000,0x8cff,0x13ceffce13,0x0,0xffffffffffffe622,0x13ceffff,0xfff356cefff34300,0x22e6ffffffff,0x43b3fffffff34300,0x22e6fffffff3,0xf3ff8c22e6ffce13,0x13ceffce130043,0xfffff34300000000,0x22e6ff,0x0,0xb3ffffe6220000,0x0,0x0,0xfffffffffff34300,0x22e6ffffffff,0x0,0x0,0x0,0x0,0x8cffff8c000000,0x0,0x0,0x22ce2200000000,0x5e00008cffffb300,0x43000000000013ce,0x22e6fffffff3,0xffffe62200000000,0x13ceffffffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8cffffce13,0x0,0x8cffff8c,0x5effffe622000000,0x13ceffff8c000000,0x8c00000000000000,0x8c,0x13c24300,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x13cee622000000,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffe6220000000000,0xffffffffffffffff,0xffffe6220013ceff,0xffffffffffffffff,0x13ce,0x0,0x0,0x5e8c,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8cce1300,0x0,0x0,0x43f3ffce13000000,0xb3ffff5e000000,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xb3ffe6220000,0xa700000000000000,0x22b556,0x0,0x0,0x0,0x13ceffe622000000,0x0,0x0,0x0,0x0,0xffffffffb3000000,0x8c,0x5ece1300,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8c8c00000000,0x5effce13000000,0x13ceb3000000,0x5effce1300,0x5efff343,0x0,0x0,0xce8c000000000000,0x13,0x0,0x0,0x0,0x220000003a000000,0x44,0x43f3ff8c000000,0x0,0x8cffffffb30000,0x5e00000000000000,0x9ba9,0x0,0x43f3ff8c,0x0,0x5effff8c000000,0xfff3430000000000,0x22e6ff,0x0,0x0,0x8c8cb35ece130000,0x8c,0x22b5728c00,0x13cece13,0x13ceffffe62200,0xffffb30000000000,0xb3ffff,0xb3ffe622000000,0x0,0xffffffffe6220000,0x13ceffffff,0xffffb30000000000,0x8cffff,0x0,0x43c21300,0x5effff8c00000000,0x0,0xffffffffffffffb3,0x8cff,0x0,0x0,0x5effb3000000,0x5effce13000000,0x13ceffb30000,0x2200005effce1300,0x43000043e7435ee6,0xb3ce13005ef3,0x0,0xe65e001326000000,0x8cffe62200000022,0x0,0x0,0x0,0xceffffe622000000,0x13,0x8cffffffffb30000,0x0,0x13ce8c8cc19c1300,0x2200000000000000,0x438eb580a9b59be6,0xb300000000000000,0x8cffffffff,0x0,0xb3fff3430000,0x5ece1300000000,0x8cb300,0xb3b3000000000000,0x13ceff5e00,0x8c00005ece130000,0x8c,0xffffffffffff8c00,0x13ceffff,0x8cffffffffb300,0xffffe62200000000,0x22e6ffffff,0xffffffe622000000,0x5eff,0x8cffff5e00000000,0x8cffffb30000,0x8cb3000000000000,0x8c8c,0x0,0x43f3ffce13,0x8cffffb300000000,0xb300000000000000,0xb3,0x8cce13,0x5efff3430000,0x0,0xb3f3430000,0x5effce13000000,0x13ce5e000000,0x2200005effce1300,0xe622005eb30043da,0x8cfff34300b3ff,0x0,0xe74300b3ce130000,0xce135eff5e000043,0x13ce,0x0,0x0,0xfffffffff3430000,0x22e6,0xe6fffffffff34300,0x22,0x13ceb6a765b51300,0x0,0x438eb580729c56a7,0xf343000000000000,0x22e6ffffffff,0xb3fff343000000,0x43f3ffb30000,0xffffffffffe62200,0x13ceffffffffff,0xffffce1300000000,0x13000013ceff72ce,0x8c8cb35effffffce,0x22000000b3ffffff,0xff8c005ee635cee6,0x8cce130013ceffff,0x0,0xb3e6220013ce8c,0x22e6ffffff5e,0xfffff34300000000,0x22e6ffff,0x8cfff34300000000,0x22e6ffb3000000,0x8cb3000000000000,0x8c8c,0x0,0x43f3fffff343,0x8cffffb300000000,0xda22000000000000,0x43,0x13ce5e00,0xb3fffff34300,0xb300000000000000,0x13ceffb322445eff,0x5effce13000000,0x13ce5e000000,0x5effce1300,0xce22005effffffb3,0x8c8c0000000022,0x0,0xe6225ef343000000,0x5ece13005e,0x13ceb3,0xf3f3430000000000,0x43,0xffffffffffce1300,0xb3ff,0xf3ffffffffff5e00,0x43,0x22e69b2213820000,0x0,0x438eb580729c56a7,0xff5e000000000000,0x43f3ffffffff,0x5effff8c00000000,0x8cffff5e00,0x43da220000,0xb35e000000,0x3548e6f343000000,0x22000013ceffffe6,0xffffffffce1322ce,0xce130013ce5e008c,0x43f3ff8c008c,0xe622000000000000,0xffffffffffffffff,0x13cee622000022e6,0x22e6ffffffff8c,0x0,0x43f3ffffb3,0x8cfff34300000000,0x43f3ffb3000000,0x8cb3000000000000,0x8c8c,0xce13000000000000,0xb3fffff356ce,0x8cffffb300000000,0xce22000000000000,0x22,0x13ce5e00,0x22e6fffff343,0xffe6220000000000,0xf3ffffffffffffff,0x5effce13000043,0x13ce5e000000,0x5effce1300,0xce220043da220000,0x8c8c0000000022,0xb35e,0xce56f38c00008c5e,0xce130043da22008c,0x13ceb38c,0xfffff34300000000,0x43f3,0xffffffffffe62200,0x13ceff,0xe6fffffffff34300,0x22,0x8cf3438ce69c1300,0x0,0x43b6da44e68c43a7,0xf343000000000000,0x22e6ffffffff,0xceffe62200000000,0x22e6ffce26,0x43da220000,0xb35e000000,0xffff72ceff5e0000,0x22000013ceffce72,0xceffffe6220022ce,0x13ce5e0013,0x43f3ffffff8c00,0x5e00000000000000,0xffffffffffffffff,0xffffe6220000005e,0x22e6ffffffffffff,0x0,0x43f3fff34300,0x8cfff34300000000,0x13ceffce130000,0x8cb3000000000000,0x8c8c,0xc1ce130000000000,0x22e6f356cece,0xfffffffffffff343,0xce22000022e6ffff,0x22,0x4300000013ce5e00,0x22e6fffff3,0xffffb30000000000,0x5effffffffffffff,0x5effce13000000,0x13ce5e000000,0x5effce1300,0xce220000b3e64473,0x5e8c8c0000000022,0xb3ffff,0xc1ceb30043f3f343,0xa9ce135ece1300b3,0x13ceb3b3e6,0xfffffff343000000,0x220000000043f3ff,0xffffffffffe6cee6,0x13cee6ceff,0x5effffffff8c0000,0x0,0xf3b3000000438000,0x43,0x0,0x8c00000000000000,0x5effffffff,0x8cffff5e00000000,0x8cffff5e,0xb35ece56da220000,0xb35e8c8c8c,0xffffff8cb3ff8c00,0x2200008cffb38cff,0x22ce,0x13ce5e0000,0x8cffffffffce13,0x5e00000000000000,0xffffff8c8cffffff,0xffffce130000005e,0xe6ffffffffffffff,0xceffffe622000022,0x13ceffe6220013,0x8cfff34300000000,0xb3fff34300,0x22da430000000000,0x43e743,0xcec1ce1300000000,0x220000133aceffff,0xffffffffffffffe6,0xce220013ceffffff,0x22,0xf343000013ce5e00,0x22e6ffff,0xffffce1300000000,0x13ceffffffffffff,0x5effce13000000,0x43f3ffffb30000,0x5effce1300,0xce2200000043e743,0x5e8c8c0000000022,0xb39bce,0x22ce44e6ff8c0000,0x8cce72f343000000,0x13ceb3b3ce13,0xfffffffff3430000,0x2200000043f3ffff,0xffffffffffe6cee6,0x13cee6ceff,0x5726cee6223a4380,0x4380,0xce4300000022c235,0xffff5e00000013ce,0xffffffffffffffff,0x8cff8c0000005eff,0x5effce26cee622,0x44e6ffce13000000,0x13ceffe6,0xb35ece56da220000,0xb35e8c8c8c,0xffffffffce72ffb3,0x2200b3ff8cb3ffff,0x8c8c5eb343c235ce,0x13ce5eb35e,0x8cffffffffce13,0x5e00000000000000,0xffffff8c8cffffff,0xffff5e000000005e,0xffffffffffffffff,0xffffffce130022e6,0x8cfff3430043f3,0xfffff34300000000,0x5effffffffff,0x8cce1300000000,0x13ce8c00,0xffcec1ce13000000,0x2200000022e6ffff,0xffffffffffffffe6,0xce220013ceffffff,0x22,0xfff3430013ce5e00,0xffffffffffffffff,0xffffe6220013ceff,0x13ceffffffffffff,0x5effce13000000,0x0,0x5effce1300,0xce13000000000000,0x5ece130000005e,0x8c0000000013ce8c,0x13cece130043f3,0xe680f34300000000,0xb3b3b3ce138c,0x4343f3fffff34300,0x22000043f3fffff3,0xffffffffffe6cee6,0x5e000013cee6ceff,0x8cffffffffce56f3,0x43f35e,0xe622000000008cb3,0x43a70000005eff,0xffffff8cb3fff343,0xffffff5e00008cff,0x43f3ffffffffffff,0x8c8cffff5e000000,0x5effff,0xb35ece56da220000,0xb35e8c8c8c,0xffffffffffce4835,0x22004365ceffffff,0x22ce,0x13ce5e0000,0x8cffffffffce13,0xffffb30000000000,0xffffff8c8cffffff,0xff5e0000008cffff,0xffffffffffffffff,0xf34300000000b3ff,0x13ceffb30022e6ff,0x8cfff34300000000,0x5effffb3000000,0x13ce8c00000000,0x5ece1300,0xffffcec1ce130000,0x22e6ff,0xffffffffffffffb3,0xce2200008cffffff,0x22,0xffff8c0013ce5e00,0xffffffffffffffff,0xffffe6220013ceff,0x22e6ffffffffffff,0x5effce13000000,0x0,0x5effce1300,0x4300000000000000,0xb3e622008cf3,0x220000000000b35e,0x22e6ffffffe6,0x80f3430000000000,0xb3ce138ce6,0x43f3fffff343,0x220043f3fffff343,0xffffffffffe6cee6,0xb3000013cee6ceff,0x13ceffffce56f3,0x22000000008cce13,0xc213000000005ec2,0x65e6ce1300008ce7,0x35e65e3a9b8072c2,0xffffffb30000b3ce,0x8cffffffffffffff,0x2213ceffe6220000,0x13ceffe6,0xb35ece56da220000,0xb35e8c8c8c,0xffffffffffce1300,0x22000013ceffffff,0x8c8c5eb343c235ce,0x13ce5eb38c,0x8cffffffffce13,0x5e00000000000000,0xf3ffff8c8cffffff,0x5e00000000000043,0xffffffffffffffff,0x2200000000005eff,0x5efff34300b3ffe6,0x8cfff34300000000,0xb3fff343000000,0x43e743000000,0x22da430000,0xffffffcec1ce1300,0x22e6,0x8cffffb300000000,0xce22000000000000,0x22,0xffb3000013ce5e00,0xffffffffffffffff,0xffffce1300008cff,0x8cffffffffffffff,0x5effce13000000,0x13ceffffb30000,0x5effce1300,0x13cee622,0x5effffce13,0x22ce220000b35e,0x13c265da43000000,0xf343000000000000,0xb3ce138ce680,0x43f3ffff8c,0x22008cfffff34300,0xffffffffffe6cee6,0xe6220000b3cec1ff,0xff8c8cffe622005e,0x2600000000b35e8c,0xce13000000002282,0x65e6ce1300008cff,0xb58e82809b8072c2,0xffffffce1300b380,0xb3ffffffffffffff,0x0,0x8cffff5e,0xb35ece56da220000,0xb35e8c8c8c,0x2213ceffffce1300,0x22000013ceffffe6,0x22ce,0x13ce5e0000,0x8cffffffffce13,0x2200000000000000,0xe6ffff8c8cffffe6,0x22,0xffffffffffffff5e,0x22e6ffb30000005e,0x8cffce1343f3ff5e,0x8cfff34300000000,0x13ceffe622000000,0xffffffffb3000000,0xb3ffffffff,0xe6ffffffe6cece13,0x22,0x8cffffb300000000,0xce22000000000000,0x22,0xb300000013ce5e00,0xb3ffffff,0xffff8c0000000000,0xffffffffffffffff,0x5effce130000b3,0x5ece1343da2200,0x5effce1300,0x13ceb6b3,0x5ece1300,0xe644ce220000b35e,0x13c256ceffffffff,0x4300000000000000,0x8cce13009b80f3,0x43f3ce13,0x13cef3430000,0xffffffffffe62200,0xce2200000000b3ff,0xff8c8cffb343c235,0x8213000013ce5eb3,0x8c3a00000043a700,0x65e6ce1300003a8c,0x8082809b8072c2,0xffffffe62200b35e,0xceffffffffffffff,0x13,0x22e6ffce13,0x43da220000,0xb35e000000,0x2213ceffffce1300,0x22000013ceffffe6,0x43c235ce,0x13ce5eb38c,0x8cffffffffce13,0x5e00000000000000,0xe6ffff8c8cffffff,0x22,0x5effffffffff5e00,0x43f3ffe622000000,0xb3ffb3005effce13,0x8cfff34300000000,0x8cfff343000000,0xffffffffff5e0000,0x5effffffffff,0x22e6ffe62222ce22,0x0,0x8cffffb300000000,0xce13000000000000,0x8c,0xb3b300,0xb3ffffffb3,0xffe6220000000000,0xf3ffffffffffffff,0x5effce13000043,0x8cce135ee62200,0x5effce1300,0x13ce5e00,0x5eb30000,0x22ce220000b38c,0x13c2562600000000,0x0,0xb35e00005ef343,0x0,0x0,0xf38c5eff5e000000,0xe622000000000043,0xff5e43f3f343008c,0x571300009b228c,0x1357000022ce2200,0x65e6b30000732200,0xb58e82809b8072c2,0xffffffe622008c80,0xb3ffffffffffffff,0x0,0x8cffff5e00,0x43da220000,0xb35e000000,0x2213ceffffce1300,0x22000013ceffffe6,0x8cffffb3000022ce,0x13ce5e0000,0x8cffffffffce13,0xf343000000000000,0x8c5eff8c8cff5e5e,0x22e6,0x5effffff5e0000,0x13ceff8c00000000,0xceff8c008cffb300,0x8cfff34300000013,0x13ceffce130000,0xffffffffffe62200,0x13ceffffffffff,0x22e68c43f3e622,0x0,0x8cffffb300000000,0x2200000000000000,0xffffffffffffffe6,0x13ceff,0xb3ffffffb300,0xff5e000000000000,0x8cffffffffffffff,0xe6ffffffff8c0000,0x5efffff3430022,0x22e6ffffffff8c,0x13ce5e00,0x5e000043f35e0000,0xf365ce22000043f3,0x13c256ceffffffff,0x0,0xb38c005ef34300,0x0,0x0,0xf38c5eff5e000000,0x5e00000000000043,0xffffffffffffffff,0x2613000043f3ff,0x13a7ff5ea7720000,0xffffb30000442200,0x65f39bceffff9cf3,0xffffff5e00008ce6,0x43f3ffffffffffff,0x0,0x22e6ffce1300,0xffffffffb3000000,0x5effffffff,0x0,0x2200000000000000,0x8cffffb3000022ce,0x13ce5e0000,0x8cffffffffce13,0x5eb3000000000000,0x0,0x8c8c,0x5eff5e000000,0x0,0x0,0xffffffffe6220000,0x5effffffff,0xffffffffffe62200,0x22e6ffffffffff,0x22e6ffffe622,0x0,0x0,0x0,0x0,0x0,0xb3ffffb30000,0x8c00000000000000,0xb3ffffffffffff,0x22e6ffff8c000000,0x22e65e00000000,0x22e6ffff8c00,0x13ce5e00,0xf3fffff343000000,0x22ce2200000043,0x13c2430000000000,0x0,0x22e6fff3430000,0x0,0x0,0xf38c5eff5e000000,0x43,0x0,0x4300000000000000,0x26820000438000a7,0xfff3430000000082,0xffffffffffffffff,0x22e6,0x0,0x0,0x0,0x0,0x0,0x0,0x2200000000000000,0xffffffffffffffe6,0x13ceffffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xb38c000000,0x0,0x0,0x22e68c00000000,0x5effffb30000,0x22e68c0000,0x43f3ffffb3,0x0,0xffffe62200000000,0x13ceffffffffffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x43f3ff8c00,0x0,0x0,0x43c2130000000000,0x0,0x0,0x0,0x0,0x0,0x0,0x22da43000000,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1300000000000000,0x8cffffce,0x43f3ff8c00000000,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffffffffffffff8c,0x5eff,0x43f3ffffff8c,0x22ce220000,0x0,0xffff5e0000000000,0x5e,0x0,0xffffce1300000000,0x43805effff,0x5effffffffce1300,0x4380,0x22e6ffff5e0000,0xffffffb300000000,0x8cffffffffffff,0xffffffffffffb300,0xffce13008cffffff,0x43f3ffffffff,0x0,0x22008ce622000000,0xffffffffffffffe6,0xce13000000b3ffff,0x8cffffffffff,0x0,0x0,0x0,0xffffffce13000000,0x43f3ffff,0x0,0xe622000000000000,0xb3b35e,0xffffffffff8c0000,0xe6220000000043f3,0xb3ffffffff,0xf3ffffff8c000000,0xffff8c0000000043,0x43f3ffffffffff,0x5effffb300000000,0xce13000000000000,0x22e6,0x0,0x0,0x0,0x13ceffff5e00,0xc243000000000000,0x13,0x0,0xe62200b35e000000,0x43f3,0x1300000000b3ff5e,0xe62213ceffffffce,0x13ceffe622008c,0x0,0xffff5e0000000000,0xce130000000000b3,0xffffffffffffffff,0xffffe62200b3ffff,0x5eff8c5effff,0x5effffffffe62200,0x5eff8c,0x43f3ffff8c0000,0xffffffe622000000,0xb3ffffffffffff,0x22ce22,0x22ce2200b35e0000,0x5effdbb3000000,0x13ce8c000000,0x2200b3ffff5e0000,0xffffffffffffffe6,0xce13000000b3ffff,0x13ceffffffffffff,0xffffffffe6220000,0xb3ffffff,0x0,0x22ce22000000,0x5effdbb300,0x0,0xe622000000000000,0xb3b35e,0xffffffffffce1300,0xf3b3000000008cff,0x5eff8c000043,0xffffffffce130000,0x22ce220000008c,0xb38c0000000000,0xffffffffe6220000,0xce130000000000b3,0x8cff5e22e6,0x0,0xb300000000000000,0x2200000000005eff,0x8cff8c0022e6e6,0xffe6220000000000,0xb3,0x0,0xce13008cffff5e00,0xffffffffffffffff,0x1300000000b3ffff,0xf3e62213ceffffce,0xb3ffffffe6220043,0x0,0xffe6220000000000,0x8c000000000000b3,0xffffffffffffffff,0xffffe622005effff,0x5effff8c5effff,0x5effffffffe62200,0x5effff8c,0x13ceffe6220000,0xffffffe622000000,0xb3ffffffffffff,0x22ce22,0x22ce2200b35e0000,0x5eff5e8cb3000000,0xffffffffff8c0000,0x220043f3ffff80e6,0x5effffffffe6,0xce13000000b3ce13,0x8cffce13000022e6,0xffffffffffce1300,0x1300008cffffffff,0x8cb3000000008cce,0x22ce22000000,0x5eff5e8cb300,0x8cff5e0000000000,0xffffff8c00000000,0x13ceffffff,0xffffe6a9ce130000,0xb3ce13000000008c,0x8ce622000000,0xffffffffce130000,0x22ce220000008c,0xb38c0000000000,0xb300005effb30000,0xce13000000005eff,0x8cffffffff,0x0,0xffb3000000000000,0xb3000000005effff,0x43da2200000000b3,0xffffce1300000000,0x8cff,0x5e00000000000000,0xce130022e6ffffff,0xffffffffffffffff,0x13000000008cffff,0x43f3e62213ceffce,0xffffffffe6220000,0x5eff,0xf343b3fff3430000,0x8cfff3438c,0xffffffffffffff8c,0xffffe62200005eff,0x43f3ffff8c5effff,0x5effffffffe62200,0x43f3ffff8c,0x8cffffffb30000,0xffffffe622000000,0xb3ffffffffffff,0x22ce22,0x22ce2200b35e0000,0xf35e008cb3000000,0xfffffff343000043,0x2200005effffffff,0x5effffffffe6,0xce13000000b3ce13,0xb3ff5e00000022e6,0xffffffffffce1300,0xce13008cffffffff,0xffffb300008cffff,0x22ce2200008c,0x43f35e008cb300,0x8cffff5e00000000,0xffffff8c00000000,0x8cffffffffff,0xffffe6a9ce130000,0xb3e622000000008c,0x0,0xffffffffce130000,0x22ce220000008c,0xb38c0000000000,0x22000000b3ce1300,0xffffe62200008ce6,0x7322008cff,0x0,0xffffb30000000000,0xda2200005effffff,0x8c8c229b00000043,0xffffffb300000000,0x5effff,0xffff5e0000000000,0xb30000008cffffff,0xffffffffffffffff,0x13000000005effff,0x43f3e62213cece,0xffffffffe6220000,0x43f3ffff,0x9bceffffe6220000,0x5effffffb6,0xffffffffffff8c00,0xffffe6220000005e,0xb3ffffff8c5effff,0x5effffffffe62200,0xb3ffffff8c,0x8cffffffffffce13,0xffffffe622000000,0xb3ffffffffffff,0x22ce22,0x22ce2200b35e0000,0xffffffffb3000000,0xffff5e00000000b3,0x220000005effffff,0x5effffffffe6,0xce13000000b3ce13,0xb3ff5e00000022e6,0xffffffffffce1300,0xe622008cffffffff,0xffffffb38cffffff,0x22ce220013ce,0xb3ffffffffb300,0x8cffffffffff8c00,0xffce130000000000,0x13ceffce13005e,0xffffe6a9ce130000,0xb3e622000000008c,0x0,0xffffffffce130000,0x22ce220000008c,0xb38c0000000000,0x22000000b3e62200,0xce56da2200008ce6,0x8cffffffff,0x0,0xffffffb300000000,0xda22005effffffff,0x8c8c000000000043,0xffffff5e00000000,0x22e6ff,0xffffffff5e000000,0x5e00000022e6ffff,0xff8c43525effffff,0x56da22000043f3ff,0xb35e8cffe622139c,0xffffffffe6220000,0x22e6ffffffff,0xdbffffff5e000000,0x13ceffffff,0x5effffffff8c0000,0xffffe62200000000,0x13ceffff,0xceffffffffe62200,0x13,0xf3ffffffffffff8c,0xffffffe622000043,0xb3ffffffffffff,0x22ce22,0x22ce2200b35e0000,0xfffffff343000000,0xff5e0000000000b3,0x22000000b3ffffff,0x5effffffffe6,0xce13000000b3ce13,0x5efff343000022e6,0xffffffffffce1300,0x2200008cffffffff,0xceffffffffffffe6,0x22ce22000013,0xb3fffffff34300,0x8cffffffffffe622,0xffce1300005eff5e,0xb3ffb300005e,0xffffe6a9ce130000,0xb3e622000000008c,0x0,0xffffffffce35ce22,0x22ce2200b38c8c,0xb38c0000000000,0x22000000b3e62200,0xffff8c0000008ce6,0x13ceffff,0x0,0xffffffb300000000,0xb300005effffffff,0x43e74300000000b3,0xffb3000000000000,0x8c,0xffffffffffff5e00,0x43000000008cffff,0xf356cee644e6fff3,0x43c213000022e6ff,0xb35e8cffffe62200,0xffffffffe6220000,0xb3ffffffffffff,0xe7da220000000000,0x5effff,0x8cffffb3000000,0xffffe62200000000,0xb3ffffffffffffff,0xffffffffffe62200,0x430000b3ffffffff,0xe644e6ffff72cef3,0xffffffe6220013ce,0xb3ffffffffffff,0x22ce22,0x22ce2200b35e0000,0x5e00000000000000,0xffff5e00000000b3,0x22000013ceffffff,0x5effffffffe6,0xffffe62200b3ce13,0xb3ffffffffffff,0x0,0x0,0x13ceffffffffe622,0x22ce22000000,0xb35e0000000000,0x8cffffffffffe622,0xffce130000b38c00,0x22e6ffffffff,0xffffe6a9ce130000,0xffffe6220000008c,0xb3ffffffffffff,0xffffffffce56da22,0x22ce2200b38c8c,0xb38c0000000000,0xffffffffffffe622,0xffffe62200b3ffff,0xb3ff5e000022e6,0x0,0x0,0x1300000000000000,0x8ce62200008cce,0xffb3000000000000,0x8c,0xffffffffffffce13,0x220000000022e6ff,0xffb300005effffe6,0x138200000013ceff,0x8cb343f3ffffe622,0xffffffffe6220000,0x8cffffffffff,0xb5135effffffb300,0x22,0x8cffffb3000000,0xffffe62200000000,0xb3ffffffffffffff,0xffffffffffe62200,0xce1300b3ffffffff,0x5e8cffffffb343f3,0xffffffe622008cff,0xb3ffffffffffff,0x22ce22,0x35ce2200b35e0000,0x5e8cffffffffffce,0xffffffffffb300b3,0x22000022e6ffe680,0x5effffffffe6,0xffffce1300b3ce13,0x8cffffffff,0xffffffffffce1300,0x8cffffffff,0x8cffffffffb300,0x22ce22000000,0xb35e0000000000,0x8cffffffffffe622,0xffce1300008cce13,0x43f3ffffffffff,0xffffffffffff5e00,0xffffe6220022e6ff,0xb3ffffffffffff,0xf3ffffff8c5ece13,0x22ce22008cb343,0xb38c0000000000,0xffffffffffffe622,0xce13000000b3ffff,0x8cff8c000022e6,0x0,0x0,0x0,0xb38c0022da43,0xffb3000000000000,0x8c,0xffb3000000000000,0x8cff,0xffffffffffffff8c,0x2200000000005eff,0x43e74343f3ffffe6,0xffffffffe6220000,0xb3ffffff,0xc2c2ffffffff5e00,0xb3ffffffe6,0x8cffffb3000000,0xffffe62200000000,0xb3ffffffffffffff,0x43f3e62200,0xce1300b3ff8c0000,0x22e6ffffffff5e5e,0xffffffe622008cb3,0xb3ffffffffffff,0x5effb3000022ce22,0x22ce2200b35e0000,0x5e00000000000000,0x5effffffff8c00b3,0x1300005effff5e00,0x5effffffffce,0xce130000008cff5e,0x22e6,0xffffffffffce1300,0x8cffffffff,0x8cffffffffffffb3,0x22ce22000000,0xb35e0000000000,0x8cffffffffffe622,0xffce130000008043,0x8cfff34300005e,0xffffffffffffce13,0xffffe622008cffff,0xb3ffffffffffff,0x22e6ff5e22e65e00,0x22ce220022e65e,0xb38c0000000000,0xffffffffffffe622,0xce13000000b3ffff,0x43f3e6220022e6,0xffffffffffffe622,0xffffffe622008cff,0x8cffffffff,0x5ece135ece13,0xffb3000000000000,0x8c,0xffb3000000000000,0x22e6,0x5effff8c001357,0xe622000000004422,0x5eff8c00005eff,0xffffffffe6220000,0x13ceff,0xffffffffff8c0000,0x43f3ffffff,0x8cffffb3000000,0xffffe62200000000,0xb3ffffffffffffff,0xffffffffffe62200,0xb3ffffffff,0xb3ffffffffffe622,0xffffffe622000000,0xb3fffffff356ce,0xf356ceb30022ce22,0x35ce2200b35e005e,0x5e8cffffffffffce,0xb3fff3430000b3,0x8cffce1300,0x22005effffffff5e,0xffffe6220022e6e6,0x8cffffffffff,0x0,0xb300000000000000,0xfffffff3e7ffffff,0x22ce2200008c,0xb35e0000000000,0x8cffff8c00000000,0xffce130000000000,0x8cfff34300005e,0xffffffffffffe622,0xffffe62200b3ffff,0xb3ffffffffffff,0x8c000043f3b30000,0x22ce22000043f3,0xb38c0000000000,0xffffffffffffe622,0xce13000000b3ffff,0x8cfff34322e6,0xffffffffffe62200,0xffffe6220000008c,0x8cffffff,0xb3fffffff343,0xffb3000000000000,0x8c,0xffb3000000000000,0x8c,0xff8c00005effff5e,0xf3e62200000043f3,0x13ceffffe665,0xf3ffffffe6220000,0x43,0x35c2430000000000,0x22e6ffe6,0x8cffffb3000000,0xffffe62200000000,0xb3ffffffffffffff,0x43f3e62200,0xb3ff8c0000,0xf3ffffffffffff5e,0xceffffe622000043,0xb3fffff3430013,0x430013ceb322ce22,0x22ce2200b35e5ef3,0x5e00000000000000,0x22e6f343000000b3,0xb3ff5e0000,0xff5e5effffff8c00,0xce130000000043f3,0x22e6,0xffffffffffce1300,0xe622008cffffffff,0xffffe62213ceffff,0x22ce220013ce,0xb35e0000000000,0x8cff8c0000000000,0xffffff5e00000000,0x43f3ffffffffff,0x8ce62200000000,0xffffe62200000000,0xb3ffffffffffff,0xcefffff343000000,0xffffe62200000013,0xb3ffffffce9bff,0xffffffffffffe622,0xce13000000b3ffff,0xb3ffffffff,0x8cffffffe6220000,0xffe6220000000000,0x8cffff,0xb3fffffff343,0xffffffffe6220000,0x8c,0xe6b3000000000000,0x22,0xfffffffffffff343,0x43f3ce13000022e6,0x8cb30000,0x5effffe6220000,0x0,0x43c21300000000,0x0,0x8cffce13000000,0xffffe62200000000,0xb3ffffffffffffff,0xffffffffffe62200,0xb3ffffffff,0x22e6ffff5e0000,0x13ceffe622000000,0xb3fff343000000,0x13cecece22,0x22ce2200b3dbf343,0x5e00000000000000,0xb38c00000000b3,0x0,0xe6ffffffff5e0000,0xce13000000000022,0x22e6,0xfffffffff3430000,0x43000022e6ffffff,0xcee622000013cef3,0x22ce22000013,0xb35e0000000000,0x5e8c000000000000,0xffffff8c00000000,0x43f3ffffffff,0x5ece1300000000,0xffffe62200000000,0xb3ffffffffffff,0x5eb30000000000,0xffffb30000000000,0x5effffffffffff,0xffffffffffffe622,0xce13000000b3ffff,0x43f3ffff,0x8cffe622000000,0xe622000000000000,0x8cff,0x8cffffffce13,0xffffffffffce1300,0x8c,0x8cb3000000000000,0x0,0xffffffffffffb300,0x5e0000000000008c,0x43f3ffffffffff,0x8ce6220000,0x0,0x43da22000000,0x0,0x8cce1300000000,0xffffe62200000000,0xb3ffffffffffffff,0xffffffffffe62200,0xb3ffffffff,0x22e6ffff5e0000,0x13cece13000000,0x8ce62200000000,0x13cece13,0xffe622008ce62200,0xffffffffffffffff,0xb3,0x0,0x8cffce13000000,0x0,0x0,0x1300000000000000,0x13cece,0x0,0xffffffe622000000,0xb3ffffffffffff,0x0,0xe622000000000000,0xb3b35e,0x43a70000000000,0x0,0x0,0xffffffffff5e0000,0x22e6,0x0,0x0,0x0,0x0,0x571300000000,0x1300000000000000,0x57,0x5effce1300,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x13ceffce13,0x0,0x0,0x0,0x0,0x0,0x0,0x22e6fff3430000,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1300000000000000,0x139c,0x0,0x0,0x0,0x0,0xe622000000000000,0xb3b35e,0x43800000000000,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x13ce5e00000000,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8c00000000000000,0x43f3,0x0,0x0,0x0,0xffce130000000000,0x220000000000005e,0x5effffe6,0x0,0x0,0x0,0x13ce5e,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x43f3ffff5e,0x0,0x8cff5e0000,0x0,0x0,0xffffffffff5e0000,0x22e6ffb300008c,0x73220000000000,0x8cff8c00000000,0x22e6ffff8c000000,0xff5e000000000000,0xe62200000013ceff,0x73220000000022e6,0x0,0x0,0x0,0x0,0xffce130000000000,0xf3e6220000005eff,0xb3ff8c00000043,0x0,0x43f3ce1300000000,0x0,0x0,0x0,0x43f3ffff5e0000,0x5e00000000000000,0x8c000000005effff,0xe6220000000043f3,0x8cffffffffffff,0x0,0x0,0xffce130000000000,0xf34300000000005e,0x5effffff,0x1300000000000000,0x43f3ffce,0x5e00000000000000,0x13ceffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xf343000000000000,0x43f3ffffff,0x0,0x130043a713b52200,0x13cece,0x0,0xb3ffe622000000,0x22e6ffffe6220000,0x8ce6220000000000,0x8cff8c00000000,0x43f3ffff8c000000,0xffffce1300000000,0xe62200005effffff,0x8ce62200000043f3,0xffffffffffe62200,0x5e,0x0,0x0,0xfffff34300000000,0xff8c000000b3ffff,0x22e6e6220000b3,0x0,0x43f3e62200000000,0xb300000000000000,0x22e6ff,0x0,0x13ceffff8c0000,0xff5e000000000000,0xffe6220000b3ffff,0xe622000043f3ffff,0x8cffffffffffff,0x0,0x0,0xffce130000000000,0xff8c00000000005e,0xff8c00005effffff,0x22000022e6ffffff,0x5effffe6,0xff5e000000000000,0x13ceffffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xfff3430000000000,0x13ce,0x0,0xb30022ce65c21300,0x5713008c5e5e,0x5713000000,0x5efff343000000,0xe6ffffff5e000000,0xffe6220000000022,0x8cff8c0000008c,0xb3fff343000000,0x8cffff8c00000000,0xe6220043f3ffe622,0x8cffe622000043f3,0xffffffffff5e0000,0x8c,0x0,0x0,0xb3ffce13000000,0xe62200000013b522,0x8cff8c0043f3,0x0,0x43f3ffb300000000,0xffff5e0000000000,0xb3ffffff,0x0,0x8cffffce1300,0xffff5e0000000000,0xffffe6220013ceff,0x13ceffffff,0xb3ff8c0000,0x0,0x5e00000000000000,0xffce130000008cff,0xff8c00000000005e,0xffe6220000005eff,0x1300008cffe6225e,0x5effffce,0x1300000000000000,0x9c130000005effce,0x13,0x0,0x438000,0x0,0x0,0x0,0x0,0x0,0xb3ffb30000000000,0x0,0x0,0x8c00005ef3430000,0x8cf343008c8c8c,0x13cece130000,0x43f3ff5e000000,0xffffff5e00000000,0xffe62200000022e6,0x8cff8c00008cff,0xffffffffffce1300,0x5effce1300008c,0xe622008cffce1300,0x8cffffe6220043f3,0xffb3000000000000,0x8c,0x1300000000000000,0xb3b3008cce,0x43f3e622000000,0x5e00000000000000,0x22e6e622b3ff,0x0,0xffffffffe6220000,0xfffff3430043f3ff,0x5effffffff,0x5ece1343da2200,0x43f3ffe62200,0xffffff5e00000000,0x13ceff5e000013ce,0xe622000043520000,0x8cffffffffffff,0xb3e622000000,0xff5e000000000000,0xffce130000008cff,0xff8c00000000005e,0x13b5220000005eff,0x8c8c000000,0xce13000000000000,0x130000000000008c,0xe6220000005effce,0x13ce,0x43da2200,0x5eff8c,0x0,0x0,0x0,0x0,0x0,0xffffffe622000000,0x8c0000008cffffff,0x22e6ffffffffffff,0x1300005ef3430000,0x8cf343000013cece,0x13cece1300,0x22e6ff8c000000,0xffff5e0000000000,0xffe622000022e6ff,0x8cff8c008cffff,0xffffffffffffce13,0x43f3e622008cff,0xe622008cff8c0000,0x8cffffffe62243f3,0xffb3000000000000,0x8c,0x0,0xb3e6225ef343,0x43f3e622000000,0x1300000000000000,0x8cff9cf3ce,0x0,0xffffffffff5e0000,0x43f35e000043f3ff,0x8cfff34300,0x13cece138ce622,0xffffe6ceffff5e00,0xceffffff5e00005e,0x13ceff5e00000013,0x0,0x13ceff5e0000,0xb3ce9be6220000,0xffffffff8c000000,0xffce130000008cff,0xffffe6220000005e,0x13b522005effffff,0x8c00008c5e000000,0x4300000013ceffff,0x1300000000005ef3,0xe6220000005effce,0x13ceff,0x8c000000008ce622,0x5effff,0x0,0x0,0x0,0x0,0x22e65e00000000,0xffffffe622000000,0xce13000043f3ffff,0x5effffffffffffff,0x2200005ef3430000,0xf34300000000b3e6,0x13cece9b,0x13ceffb3000000,0xff5e000000000000,0xffe6220022e6ffff,0x8cff8c8cffffff,0xffffffffffffe622,0x5effce13008cff,0xe622008cffce1300,0x8cffffffffe665f3,0xffb3000000000000,0x5eff5e0000008c,0x22e6b3000000,0xb3e6225ef34300,0xffffffffe6220000,0xf3430000000022e6,0x13ceffffffffff,0x8ce622000000,0x43f3ffe622000000,0x0,0x2200005effffb300,0x13cece138ce6,0xceffffffffff8c00,0x13ceffffff5e0013,0xf3ffe62200000000,0x43,0x5effffb300,0xb3ce13008ce62200,0xffffffffe6220000,0xffce130000008cff,0xffffe6220000005e,0x13b5220043f3ffff,0xe622008c5e000000,0x5effffff,0x13000000005ef343,0xe6220000005effce,0x2200000013ceffff,0xff8c000000008ce6,0x5effff,0x0,0x0,0x0,0x0,0x22e6ffff5e000000,0xffffffce13000000,0x1300000013ceffff,0x5effffffffffce,0xf343005ef3430000,0x435eff5e000043f3,0x22e6b313cef3,0xb3ffe6220000,0xe622000000000000,0xffe6220043f3ffff,0x8cffffffffffff,0xa9ffffffcec1e622,0x8cffff8c00008ce6,0xe6220022e6ffe622,0x8cffffffffffffff,0xffb3000000000000,0x5eff5e000000008c,0x22e6b30000,0xb3e6225ef3430000,0xffffffffe6220000,0xff5e0000000022e6,0x22e6ffffffffff,0x8ce6cece130000,0x43f3ffe622000000,0x4300000000000000,0xe6220013cefffff3,0x13cece138c,0x8cffffffffffce13,0xb3ffffff8c0000,0xfff3430000000000,0xe6220000008cffff,0x5effffff,0xce138cce138ce622,0xffffffffe62200b3,0xffce130000008cff,0xff8c00000000005e,0x13b5220000005eff,0xce13008c5e000000,0x5effffff,0x130000005ef34300,0xe6220000005effce,0xe6220013ceffffff,0xffff8c000000008c,0x5effff,0x0,0x0,0x0,0x0,0xe6ffffffff5e0000,0xffffffe622000022,0x13ceffff,0x5effffffce13,0xfffffffff3430000,0x5eff5e000000005e,0x22e6b30000,0x5efff3430000,0xffe6220000000000,0xffe62200005effff,0x8cff9bceffffff,0xa9ffffffcec1e622,0xffffe62200008ce6,0xe6220000b3ffffff,0x8cffffffffff9cf3,0xffb3000000000000,0xff5e00000000008c,0x13ceb35e,0xe6b313cece130000,0x43f3e622000022,0x0,0x5effb300,0x8ce62200b3ce1300,0x43f3ffe622000000,0xb300000000000000,0xf38c0000005effff,0x8cf34343,0x22e6ff5e00b3e622,0xb3ffffffb3000000,0x2200000000000000,0x8c000000b3ffffe6,0x13ceff,0x138cffffce135713,0xffffffffe6220057,0xffce130000008cff,0xff8c00000000005e,0x13b5220000005eff,0x2200008c5e000000,0x5effffe6,0x13000013cece1300,0xe6220000005effce,0xf38c000043f3ffff,0xffce130000000043,0x5effff,0x0,0x0,0x0,0x0,0xffffffffffff5e00,0xb3ffce13000022e6,0x0,0x5effce1300,0x22e6fff3430000,0xff5e000000000000,0x22e6b35e,0x43f3ff5e0000,0xffffe62200000000,0xffe6220000005eff,0x8cff8c13ceffff,0xa9ffffffcec1e622,0xffff8c0000008ce6,0xe622000043f3ffff,0x8cffffffff5e43f3,0xffb3000000000000,0x5e0000000000008c,0x13ceff,0x22e6b313cece1300,0x43f3e622000000,0xff5e00008cff5e00,0x22e6ffffffffff,0xe622000000b3ce13,0x43f3ffe62200008c,0xce13000000000000,0x8c0000000013ceff,0x5ef34343f3,0x8cff8c00000000,0xffffffb300000000,0xb3,0x43f3f34300,0xb3ffb3,0x8cf34313cece1300,0xffffffffe6220000,0xffce130000008cff,0xff8c00000000005e,0x13b5220000005eff,0x2200008c5e000000,0x5effffe6,0x1300000013cece13,0xe6220000005effce,0x8c0000000043f3ff,0xce130000000043f3,0x5effff,0x0,0x0,0x0,0x0,0xffffffffffffe622,0xffff5e0000008cff,0x8c,0x0,0x8cf3430000,0x5e00000000000000,0x22e6ff,0x22e6ffb30000,0xffffffe622000000,0xffe622000000005e,0x8cff8c0013ceff,0x8cffa9e6ce130000,0xffe6220000000000,0xe622000000b3ffff,0x8cffffff5e0043f3,0xffffffce13000000,0x8cffff,0x0,0x22e6b313cece13,0x43f3e622000000,0x8cff5e00,0x5effb300,0x2200000000009b22,0x43f3ffe62200009b,0xb300000000000000,0x13ceff,0x5ef34343f35e,0x22e6b300000000,0xffffb30000000000,0x139c130000b3ff,0x43f3e62200,0xb3ffce13,0xf343000013cece13,0xff8c00000000008c,0xffce130000008cff,0xff8c00000000005e,0x13b5220000005eff,0x2200008c5e000000,0x130000005effffe6,0x130000000013cece,0xe6220000005effce,0x43f3,0x130000000043f35e,0x5effce,0x0,0x0,0x0,0x0,0x0,0xff8c000000000000,0x5effffffff,0x0,0x13ceffb30000,0x0,0x2244,0x13ceffce1300,0x5effffffe6220000,0xffe6220000000000,0x8cff8c000013ce,0x8cffa9e6ce130000,0xffb3000000000000,0xe62200000043f3ff,0x8cffff5e000043f3,0xffffe62200000000,0x13ceff,0x1300000000000000,0x22e6b313cece,0xffffffffe6220000,0x8cffffff,0x5effb300,0x0,0x5effffce13000000,0xce130000003a0000,0x13ceff,0x5ef34343f35e00,0x8ce622000000,0xffb3000000000000,0xceffff8c008cffff,0x13cefff356,0x8cffe62200,0x430000000013c243,0x8c000000000000a7,0xffffffce13008cff,0xff8c00000043f3ff,0xffe6220000005eff,0xe622008cffff5eb3,0xce13005effffffff,0x13000000000013ce,0xda220000005effce,0x43,0x43f35e00,0x5ece13,0x0,0x0,0x0,0x0,0x0,0x2200000000000000,0x8cffffffe6,0x0,0x43a713b52200,0x0,0x0,0x8cffe62200,0x5effffce130000,0xcee6220000000000,0x8cff8c00000013,0x8cffa9e6ce130000,0xf343000000000000,0xe62200000000b3ff,0x8cff5e00000043f3,0xfff3430000000000,0x22e6,0x0,0x0,0xffffffffe6220000,0x8cffffff,0x5effb300,0x0,0xffffffb300000000,0xce130000008cffff,0x13ceff,0x0,0x43e743000000,0xb300000000000000,0xffffce13008cffff,0x43f3ffff,0x43f3f3430000,0x0,0x0,0xffffce1300005e8c,0xff8c000000005eff,0xffce130000005eff,0xe622005effff9bce,0x5effffffff,0xff8c000000000000,0x13ceffffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x13ceffb30000,0x0,0x1300000000000000,0x22e6ffffffffce,0x43c213000000,0x13b5220000000000,0x8cff8c00000000,0x8cffa9e6ce130000,0xb300000000000000,0xe6220000000043f3,0x8c5e0000000043f3,0xf35e000000000000,0x43,0x0,0x0,0x0,0x0,0x0,0x0,0xffffb30000000000,0x5effff,0x0,0x0,0xb38c000000,0x0,0x8c00000000008c8c,0x43f3,0x0,0x0,0x0,0xffe6220000000000,0xff8c00000000005e,0x5eff,0x0,0x0,0xb300000000000000,0x22e6ffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5eff80e6ce130000,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x43a7000000,0x0,0x8c00000000000000,0x43f3,0x0,0x0,0x0,0x7322000000000000,0x0,0x0,0x0,0x0,0x0,0x22e6b3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0};
+static const unsigned char fontawesome_pixel_data[] = {
+31,0,1,0,19,41,140,255,1,0,19,179,23,0,32,34,230,14,0,47,243,67,70,0,20,15,1,0,226,65,155,34,94,94,9,0,66,34,230,255,140,
+19,0,68,94,255,230,34,31,0,11,90,1,3,34,0,11,1,0,37,34,206,48,0,9,15,0,18,179,53,0,34,206,19,15,0,45,67,243,66,0,1,34,0,
+52,179,34,230,35,0,15,114,0,21,15,1,0,5,39,67,243,188,0,15,19,0,6,15,1,0,15,15,133,0,23,15,95,0,15,15,76,0,10,0,20,1,1,253,
+0,36,19,206,170,2,5,19,0,0,75,1,66,218,67,19,206,160,1,111,0,94,230,34,67,218,107,0,2,15,128,1,1,0,80,0,6,1,0,0,80,0,1,73,
+0,5,78,0,4,244,1,0,1,0,53,230,34,179,37,3,15,204,1,5,13,1,0,22,94,94,0,5,83,0,2,241,1,9,226,0,11,19,0,10,151,0,0,123,0,15,
+209,0,21,10,179,0,4,228,3,15,114,0,0,15,76,0,20,17,179,183,0,69,67,231,67,140,128,1,96,255,94,67,243,243,67,217,0,4,151,
+0,53,34,206,34,50,1,63,67,194,19,14,1,4,15,99,0,0,12,232,0,35,206,19,38,0,2,177,0,3,190,0,49,34,230,179,72,1,7,129,1,15,
+175,0,3,36,67,128,77,3,4,27,2,37,19,194,215,4,35,67,194,46,2,3,147,1,53,243,101,230,17,1,12,19,0,39,34,230,16,5,15,188,2,
+6,8,133,0,70,67,243,230,68,15,0,4,127,1,3,57,0,13,114,0,14,237,2,70,34,206,34,34,144,0,3,91,0,225,34,181,38,206,255,140,
+67,194,114,255,206,19,67,243,76,0,80,140,255,255,230,169,52,0,43,155,206,194,5,4,128,1,17,243,118,0,0,19,0,17,94,104,0,17,
+94,78,1,0,19,0,14,52,1,3,168,0,33,243,67,117,4,13,38,0,18,179,97,0,0,121,4,1,178,0,6,129,1,5,225,0,8,232,0,68,34,230,255,
+94,25,0,3,50,1,8,128,1,3,150,3,1,244,1,33,230,68,40,0,3,193,0,1,19,0,18,140,22,1,1,19,0,33,34,230,193,1,0,104,2,1,30,0,3,
+78,0,5,55,1,3,152,0,3,43,2,0,55,1,9,128,1,6,87,2,1,21,1,8,102,2,2,95,0,15,10,1,0,55,206,53,206,163,3,1,34,0,5,229,0,16,179,
+10,0,1,58,0,40,82,67,48,7,47,67,82,128,1,6,0,116,1,32,206,19,6,0,20,94,171,4,15,128,1,6,1,58,0,1,36,2,11,128,1,3,179,2,6,
+109,1,5,129,1,15,128,1,1,2,28,5,5,173,4,15,128,1,9,3,33,2,5,38,0,7,128,1,2,202,1,2,127,2,49,230,94,140,111,0,2,15,0,9,181,
+2,0,14,1,15,128,1,6,4,133,3,3,114,4,8,128,1,4,95,0,217,155,34,128,67,140,94,94,140,67,167,34,181,53,128,1,16,94,6,0,9,114,
+0,0,159,2,36,193,206,227,0,34,255,156,172,2,0,7,0,3,230,3,15,128,4,1,0,117,1,18,94,128,1,18,179,174,1,15,128,1,5,18,179,
+172,1,0,181,0,15,128,1,3,7,192,0,4,129,1,15,128,1,1,1,246,0,2,82,1,3,173,3,15,128,1,1,3,127,1,2,67,0,2,200,2,2,96,0,9,0,
+3,2,255,0,0,19,0,0,67,1,1,15,0,71,94,255,255,140,138,0,2,52,4,15,128,1,2,5,127,1,8,95,0,10,0,3,208,53,194,67,179,94,140,
+140,94,179,94,206,86,218,57,0,5,67,1,0,136,2,18,94,91,0,32,67,243,91,0,37,19,206,104,4,2,247,0,18,169,0,3,22,156,64,2,53,
+34,230,94,189,4,5,128,7,4,85,1,18,94,82,0,15,128,1,7,1,33,0,2,6,0,3,128,1,5,193,0,3,201,5,7,69,7,3,129,1,15,128,1,0,2,231,
+0,4,29,8,15,128,1,6,3,19,5,3,234,0,1,47,0,2,103,2,3,128,1,7,43,2,69,179,255,140,140,233,2,0,95,0,4,128,1,0,142,5,7,171,6,
+0,38,0,7,128,1,5,40,3,3,158,2,10,237,5,13,138,2,20,67,128,1,7,138,6,19,94,29,1,4,159,0,9,233,5,36,206,155,0,6,6,128,1,15,
+142,5,3,15,246,4,15,6,128,1,20,140,57,6,34,206,34,235,7,3,170,6,1,12,0,7,129,1,2,135,10,15,128,7,2,38,19,206,5,5,15,128,
+1,5,3,150,0,4,109,1,1,24,5,1,213,0,5,94,8,6,43,5,24,140,128,1,0,5,8,4,64,0,54,243,67,140,171,3,12,128,1,5,172,0,4,29,4,11,
+29,1,1,95,0,96,53,206,255,94,179,140,1,3,3,57,0,3,99,0,3,61,0,2,19,0,1,67,7,1,201,2,5,1,3,96,94,255,230,101,243,179,152,
+6,53,140,255,114,239,0,15,0,9,3,8,53,1,15,166,1,4,1,19,0,16,140,6,0,32,230,34,17,1,1,213,0,23,128,110,8,34,67,231,64,1,6,
+76,0,38,94,94,251,3,15,128,1,4,2,45,0,1,70,0,15,128,1,14,4,133,0,0,23,1,3,222,2,5,90,1,65,67,128,0,0,247,12,2,29,1,1,80,
+1,52,67,243,255,141,9,4,71,1,10,128,1,5,178,0,5,29,10,15,247,0,0,15,128,7,1,23,34,41,0,3,76,0,18,94,196,8,99,230,34,94,255,
+94,179,80,0,3,170,8,9,178,14,8,0,12,7,128,10,7,71,4,1,70,2,15,128,1,4,32,243,67,233,8,4,16,7,39,34,230,10,15,36,34,230,18,
+8,4,129,1,2,127,1,15,0,3,12,0,92,1,3,70,0,7,5,2,1,33,5,3,100,1,8,128,1,4,85,4,19,38,168,5,2,152,0,0,178,0,3,250,3,20,179,
+95,6,2,128,4,2,141,9,17,179,199,5,13,128,1,35,67,243,221,4,5,198,0,15,76,12,0,2,0,6,3,15,3,4,0,6,0,128,7,10,128,1,15,0,9,
+0,9,206,4,10,23,6,11,0,9,6,216,6,2,229,2,10,144,1,3,63,0,3,98,0,20,94,215,1,1,251,0,6,6,11,38,19,206,12,0,3,25,5,2,127,1,
+5,251,0,3,98,8,5,128,1,3,226,3,1,247,7,15,24,5,3,6,64,2,5,149,1,14,19,0,15,0,12,1,10,77,0,1,18,0,14,128,1,4,178,0,4,135,
+1,10,178,2,5,95,0,15,128,10,5,12,0,3,134,243,86,206,255,140,140,230,128,0,12,8,206,1,5,167,5,15,128,13,6,2,5,9,2,96,4,8,
+142,0,4,157,0,15,33,1,1,7,178,2,9,50,14,1,199,7,3,127,1,15,0,3,6,3,218,1,3,7,1,15,199,14,2,9,15,1,4,46,1,11,19,0,15,209,
+6,2,1,64,2,3,43,2,1,251,0,15,81,14,9,8,192,15,13,95,0,15,119,14,6,11,209,0,4,94,9,0,235,17,15,128,1,34,15,1,0,0,2,204,17,
+10,214,2,5,1,0,8,182,0,13,1,0,16,94,121,15,3,146,1,15,194,0,0,15,1,0,95,15,133,0,57,15,76,0,11,12,44,11,11,36,0,15,14,1,
+114,15,1,0,201,52,67,243,94,21,10,15,209,18,1,15,1,0,255,117,15,120,4,4,4,166,16,15,1,0,38,9,141,19,15,72,0,45,15,170,22,
+27,15,1,0,16,10,172,21,15,1,0,104,47,34,230,40,20,3,8,12,8,10,48,0,2,47,0,33,34,115,15,0,21,115,143,19,10,246,6,49,0,0,179,
+152,15,8,128,1,4,178,14,15,1,0,5,15,68,24,0,3,158,10,31,140,199,1,43,240,2,34,142,102,72,87,115,87,72,130,101,156,156,194,
+130,181,142,34,140,0,15,128,1,20,0,58,4,8,126,0,15,24,1,5,7,1,0,3,200,9,31,94,126,2,6,0,233,0,3,232,0,8,209,18,1,13,0,1,
+24,0,2,188,2,9,123,23,6,77,15,3,203,17,1,41,0,21,140,10,13,5,157,10,3,118,17,15,160,7,0,11,146,1,27,179,114,6,3,144,6,9,
+223,0,48,19,206,179,54,0,15,128,1,11,7,34,11,3,168,8,38,230,34,20,0,0,162,0,14,128,1,0,141,0,9,36,0,4,0,1,12,148,0,50,206,
+19,0,79,15,5,59,1,10,128,1,7,39,9,4,70,17,0,23,13,32,230,68,168,2,2,247,18,10,203,16,3,140,9,5,104,2,2,173,18,8,141,1,4,
+83,0,9,7,23,4,26,1,2,128,1,3,81,27,2,209,15,13,0,3,15,18,3,0,52,19,206,114,239,7,34,206,114,178,25,7,13,3,63,34,181,19,251,
+16,0,1,127,1,1,182,1,34,140,206,243,19,15,1,0,2,9,72,8,2,154,16,20,243,40,13,15,128,1,25,10,247,0,3,29,1,1,65,1,21,179,149,
+1,4,36,0,5,139,0,10,92,1,1,48,13,2,153,2,2,219,0,0,57,2,14,14,1,15,128,1,5,2,110,1,17,128,146,4,4,141,17,8,97,0,2,101,11,
+36,243,67,41,3,0,87,24,15,188,4,1,14,114,0,32,19,206,249,16,4,128,1,2,38,1,20,94,112,14,0,140,5,27,155,182,1,2,225,0,1,34,
+1,0,128,1,5,90,3,15,128,1,10,0,228,14,1,46,0,11,203,9,15,128,1,1,13,1,0,6,104,2,6,212,0,3,156,15,5,5,26,8,20,12,1,162,0,
+2,124,0,21,193,219,0,16,19,86,16,8,30,3,29,218,175,26,3,188,18,1,76,1,0,44,0,1,128,1,6,125,28,50,67,194,155,198,24,2,18,
+0,13,74,4,0,128,1,3,28,15,3,252,17,14,4,2,15,18,3,2,8,128,1,1,146,1,1,188,17,0,198,1,76,140,0,19,181,171,14,2,43,13,3,132,
+15,53,67,243,182,128,1,6,224,0,9,155,25,3,53,0,8,136,15,15,128,1,27,9,111,25,23,68,20,24,7,111,4,10,216,0,0,163,0,4,11,25,
+7,138,26,13,128,1,10,55,0,4,149,15,3,75,1,4,128,1,4,123,20,2,144,26,15,220,3,3,3,188,1,33,243,101,80,0,20,140,249,24,15,
+128,4,17,14,128,1,4,17,26,109,156,179,0,0,67,167,222,0,8,171,14,48,67,243,94,54,6,3,94,26,5,99,16,4,180,0,15,0,3,34,43,167,
+130,239,30,8,126,0,35,206,86,143,19,5,96,26,11,127,4,11,106,2,3,240,20,3,209,24,8,2,2,1,128,4,23,115,234,4,20,179,178,8,
+2,97,16,11,153,1,2,113,4,7,190,0,15,92,1,20,8,157,16,15,38,4,2,15,128,1,0,0,206,0,48,206,193,194,64,3,5,165,33,11,220,6,
+3,209,20,33,243,94,182,7,7,251,28,9,180,0,15,0,6,35,18,140,60,26,5,36,0,9,0,3,1,41,24,15,1,0,1,9,129,1,4,6,23,6,192,21,1,
+171,18,4,188,1,4,87,21,0,132,21,5,137,20,16,19,18,27,3,234,0,15,166,8,2,64,34,230,255,169,14,7,2,244,4,15,0,3,2,0,196,25,
+3,75,24,12,186,0,8,150,0,68,179,140,255,140,22,2,15,128,1,2,1,238,4,36,114,140,164,21,0,212,7,10,97,5,7,214,31,4,0,19,15,
+180,0,0,8,128,0,15,0,9,22,58,179,140,167,164,1,7,90,0,0,190,1,15,70,8,3,7,0,9,27,94,124,2,1,186,0,2,109,31,7,75,4,4,151,
+18,19,94,132,21,2,54,0,34,19,206,44,9,1,255,6,3,128,4,3,127,1,0,189,0,16,169,92,6,3,3,2,15,220,5,0,2,70,33,3,215,21,15,128,
+7,8,5,159,0,15,128,1,4,0,91,0,2,140,7,19,167,30,30,2,117,21,7,200,1,2,128,1,4,37,9,3,94,20,6,128,4,2,180,0,6,128,1,15,166,
+10,5,14,128,1,4,2,1,8,1,0,4,129,1,1,224,0,8,0,3,39,67,243,15,0,5,42,1,7,252,9,23,94,133,24,7,129,1,3,141,6,3,175,29,0,34,
+30,3,174,29,9,1,0,12,128,10,0,165,25,6,132,5,12,221,3,2,129,5,0,171,0,25,140,20,31,15,164,4,15,12,128,1,0,171,5,0,5,9,0,
+105,3,17,94,40,2,28,155,167,18,15,128,1,1,15,239,1,6,6,218,0,13,35,13,15,0,9,18,6,87,23,2,222,0,2,29,1,3,116,11,15,143,4,
+0,1,21,0,2,178,0,2,12,28,6,67,19,2,36,2,4,135,0,5,250,32,5,174,23,0,54,0,5,163,0,11,128,1,7,110,23,2,24,0,8,60,6,5,0,12,
+0,215,30,4,228,33,5,110,1,3,228,23,15,128,1,19,1,128,10,2,163,0,34,94,179,1,12,8,73,13,8,218,5,15,128,1,13,14,72,1,15,0,
+6,15,0,98,4,10,128,4,1,154,5,4,7,3,4,74,3,2,64,19,15,86,9,2,0,156,12,12,30,25,4,55,0,0,129,1,5,6,2,15,160,2,3,7,121,25,15,
+198,41,2,5,53,22,4,220,1,5,87,37,2,187,4,3,107,5,15,40,5,3,13,150,0,15,128,10,1,0,147,3,3,49,2,2,142,32,9,177,31,6,138,0,
+15,0,3,11,15,108,12,2,15,128,13,34,7,110,2,5,16,0,2,157,2,6,210,5,9,128,1,0,67,1,13,32,4,4,129,1,21,130,133,3,15,128,1,10,
+3,58,33,15,128,1,0,22,128,62,0,8,254,1,4,1,10,1,51,4,2,185,11,15,1,0,17,1,121,30,5,128,1,4,192,26,15,215,17,18,15,128,4,
+12,15,146,7,0,31,155,149,0,16,10,168,11,12,83,0,5,164,41,8,241,37,11,128,1,31,156,176,23,9,1,16,36,4,169,1,9,162,0,12,203,
+4,7,42,0,15,102,0,1,31,206,24,24,110,5,167,2,15,107,43,31,15,215,0,9,15,78,0,56,15,1,0,255,255,117,11,172,14,15,87,0,55,
+15,42,24,33,31,179,250,24,33,6,212,23,7,233,23,15,92,0,1,15,224,22,4,6,156,11,9,58,12,6,90,15,7,206,8,15,58,8,3,38,67,243,
+148,39,4,28,42,0,55,0,1,153,13,3,240,9,6,33,11,2,27,5,3,73,0,15,144,12,8,15,1,0,30,7,143,17,15,129,5,12,2,33,21,2,164,1,
+5,179,8,2,235,0,15,233,24,7,15,254,4,5,7,213,23,4,132,0,14,222,6,3,198,10,2,139,44,10,58,9,24,94,16,0,2,53,24,7,217,34,10,
+0,24,2,200,7,4,218,21,5,234,17,0,53,35,10,144,12,0,176,34,17,255,99,38,4,108,9,1,18,0,6,108,9,5,5,2,5,37,42,6,71,1,15,129,
+27,36,7,128,1,14,74,1,9,178,8,2,122,1,4,192,9,6,50,25,34,230,68,122,39,11,15,1,5,216,0,6,233,36,7,178,0,8,214,23,2,132,0,
+15,206,19,0,15,242,10,3,5,46,47,5,48,0,10,128,1,34,19,194,182,19,0,53,1,16,101,219,16,10,206,8,4,234,17,1,180,36,5,240,0,
+15,128,1,17,7,162,0,8,94,14,4,206,11,7,78,3,14,234,27,6,196,40,15,128,1,6,9,160,26,3,101,0,1,124,2,7,230,48,4,36,3,4,73,
+17,14,86,10,2,81,15,5,119,13,7,169,36,2,186,1,7,144,0,5,215,23,15,128,1,4,15,22,17,2,7,148,1,7,194,38,4,167,35,1,148,11,
+3,54,21,1,128,1,1,7,43,14,72,0,4,127,1,15,243,9,6,15,1,0,1,6,200,1,67,179,255,230,53,118,1,1,145,0,17,140,134,5,21,94,99,
+12,12,89,0,3,18,0,15,125,11,2,5,128,1,0,166,15,4,191,36,10,244,46,6,34,23,15,183,12,1,9,86,25,2,165,4,2,89,0,7,23,0,0,89,
+11,9,225,22,9,216,23,2,128,1,8,122,15,15,110,13,5,10,225,10,5,220,17,4,117,37,0,72,6,5,182,22,2,128,1,5,72,0,5,67,14,2,108,
+0,4,77,40,4,223,0,1,204,45,2,94,2,18,140,218,1,4,18,0,5,236,1,7,244,36,11,70,13,32,156,243,146,38,19,101,65,42,33,218,218,
+68,6,37,218,218,157,17,2,18,0,37,206,19,244,41,6,36,1,5,128,1,1,141,23,7,52,55,20,179,203,20,18,94,255,14,15,14,4,4,10,214,
+14,8,97,0,2,156,41,2,28,15,0,252,2,3,230,47,7,128,1,4,217,23,2,38,1,20,206,82,2,1,241,16,0,236,0,14,114,0,9,164,19,2,242,
+28,0,252,28,8,0,3,3,128,1,1,220,1,7,128,1,0,113,1,2,117,1,12,0,3,6,94,23,15,128,4,13,5,183,42,12,197,14,2,141,0,1,0,3,98,
+34,230,140,67,218,101,21,1,2,222,6,4,18,0,1,130,20,10,129,1,68,94,255,206,86,128,1,1,159,2,6,105,8,0,149,20,147,94,255,255,
+243,86,206,94,19,206,136,14,0,87,19,72,206,53,230,179,211,31,9,252,33,10,107,33,0,144,0,3,128,4,9,184,2,15,160,47,0,3,88,
+46,3,160,1,53,67,243,140,163,49,9,54,0,13,71,0,2,182,4,9,0,6,15,128,1,4,101,94,140,128,230,255,140,149,54,9,129,1,4,164,
+4,15,128,1,19,8,127,1,2,157,18,7,246,57,0,103,27,51,67,231,194,160,0,0,212,17,5,18,0,50,179,0,128,18,0,15,128,1,2,2,138,
+41,0,114,1,2,4,1,3,121,0,6,8,53,15,68,25,6,6,0,4,15,234,6,0,2,128,1,12,47,41,20,140,212,45,1,42,48,34,255,156,0,3,0,9,6,
+1,149,7,0,50,0,13,210,51,5,224,22,3,186,0,11,104,52,10,128,1,3,37,0,8,128,1,8,92,1,8,0,9,3,90,30,1,131,54,1,204,6,4,204,
+39,5,18,0,4,98,2,4,117,52,34,230,34,235,2,0,110,1,0,101,1,3,22,22,3,166,5,5,110,26,0,39,0,3,254,19,0,18,0,32,243,67,64,0,
+10,130,4,7,128,1,2,71,6,3,57,45,6,106,2,18,179,132,2,3,126,48,32,206,114,112,46,41,243,101,241,8,7,0,6,7,78,47,4,76,30,4,
+156,45,1,69,52,7,146,58,2,16,8,1,97,1,18,94,56,4,2,244,27,18,179,220,7,3,202,1,6,129,1,10,103,2,5,0,12,15,114,18,1,15,128,
+1,2,0,129,5,2,207,11,5,40,47,3,0,12,2,132,9,15,1,0,16,7,94,2,3,128,1,0,175,0,48,140,255,230,57,5,4,70,0,0,153,0,3,184,5,
+4,116,21,2,18,0,16,140,98,22,8,176,22,16,140,143,3,4,128,1,12,92,34,1,178,47,3,162,5,36,206,19,155,51,33,243,194,238,20,
+24,194,91,7,9,128,7,9,62,35,7,159,28,0,125,11,8,167,49,4,0,35,2,237,51,6,128,1,5,206,13,10,111,51,4,246,2,4,235,9,7,20,1,
+15,128,1,3,14,128,4,4,200,13,14,56,13,2,48,51,15,0,6,24,6,128,1,0,92,4,33,167,67,191,0,5,99,36,0,156,5,1,236,1,5,205,8,48,
+94,243,67,185,0,42,53,53,148,8,8,128,1,9,98,54,2,71,6,0,136,3,2,202,23,35,230,34,54,3,2,158,25,5,209,25,3,220,5,3,214,26,
+3,160,8,7,117,9,3,182,31,6,128,10,10,238,29,0,14,0,1,188,3,9,128,1,12,108,2,4,76,2,7,84,0,8,1,0,1,65,0,3,90,3,2,132,0,15,
+128,1,5,15,186,9,0,3,181,3,0,180,0,15,128,1,17,7,110,48,4,138,13,19,94,180,4,4,52,9,2,38,1,3,63,9,7,18,0,5,208,27,5,116,
+0,40,255,94,128,1,2,230,0,4,245,49,1,97,62,3,138,1,5,9,0,6,255,3,4,129,6,3,102,12,1,128,1,5,114,12,4,26,12,4,200,2,7,128,
+1,8,249,0,3,110,10,2,201,7,15,128,1,9,11,4,14,13,195,12,16,19,32,8,0,98,30,34,206,19,29,0,15,128,10,0,15,90,0,4,6,66,0,2,
+128,1,2,203,23,1,114,5,3,128,1,7,221,23,10,98,49,5,135,0,2,228,2,9,55,28,12,52,2,3,238,0,6,207,38,32,34,230,55,49,8,128,
+1,15,56,22,0,4,138,1,4,154,1,3,85,1,2,198,3,3,95,60,34,218,231,180,1,1,184,1,19,231,198,35,18,179,77,0,5,181,13,15,57,67,
+3,2,134,26,3,117,27,3,56,13,13,132,0,4,206,0,7,165,34,14,10,23,1,113,53,1,156,0,3,105,0,0,160,6,6,128,1,2,60,27,15,90,0,
+3,15,84,0,6,15,1,0,26,3,118,49,15,36,0,11,10,47,65,15,128,1,16,13,202,35,15,1,0,2,11,32,7,14,68,25,15,1,0,255,79,10,252,
+45,15,68,25,112,15,1,0,255,255,35,7,128,4,15,69,21,27,2,246,10,9,72,40,15,58,0,22,10,145,13,11,30,0,13,196,4,6,106,58,15,
+77,0,4,11,50,0,6,89,29,6,228,0,6,190,66,8,200,46,12,18,45,9,67,11,15,18,0,4,5,236,10,15,254,10,0,26,86,206,65,15,52,35,19,
+4,188,6,15,128,1,9,7,54,66,3,80,6,16,19,166,64,0,246,11,14,152,8,4,52,0,8,237,41,7,19,1,15,20,10,10,15,53,24,0,4,61,12,4,
+132,0,10,141,1,8,242,22,5,175,1,10,235,15,54,19,206,140,250,43,8,110,1,2,63,65,15,128,1,109,15,0,3,16,6,126,24,4,247,16,
+0,245,10,2,175,56,4,8,17,3,236,0,23,130,174,0,5,59,12,1,3,21,15,245,61,4,9,111,1,39,179,255,43,1,10,172,45,6,254,0,0,182,
+70,6,44,20,13,185,0,38,140,179,203,45,4,43,2,6,17,14,3,10,58,2,111,49,15,14,74,4,15,1,0,89,15,128,1,11,2,231,41,8,126,24,
+17,179,40,21,6,126,36,0,128,1,8,21,64,4,210,0,5,177,69,5,47,28,5,49,39,14,110,25,5,131,15,0,147,40,13,241,45,14,40,2,7,8,
+19,13,128,1,0,112,0,7,153,22,3,11,0,6,168,36,17,181,217,12,0,251,13,19,167,108,0,9,108,21,7,19,48,15,18,0,6,6,209,22,8,18,
+0,0,30,18,12,220,37,0,149,71,5,111,5,0,198,0,1,124,29,9,18,0,4,245,64,6,220,11,9,160,2,10,148,67,70,179,156,243,179,232,
+71,10,107,0,2,232,47,20,179,154,43,3,117,5,7,24,21,18,140,242,46,1,226,70,4,131,0,23,179,202,38,3,74,22,3,128,1,11,233,68,
+8,128,1,5,91,3,12,119,9,2,57,13,4,44,0,6,38,1,0,16,19,8,107,3,2,205,12,15,57,47,1,14,32,68,15,18,0,0,15,128,4,21,2,192,2,
+9,200,16,1,119,18,10,18,0,5,128,1,23,206,199,67,10,90,0,5,126,24,18,156,204,22,15,180,0,3,1,240,12,0,165,19,1,129,1,3,128,
+1,9,58,17,1,242,46,8,226,64,33,255,206,97,72,9,128,1,2,150,18,9,2,70,15,132,21,7,9,97,0,9,77,63,4,187,66,15,29,0,1,9,128,
+1,15,0,3,53,0,233,17,7,21,0,5,37,75,8,200,31,5,120,21,12,88,2,0,128,1,18,179,72,69,10,146,13,8,0,3,5,127,1,1,18,0,32,115,
+34,94,3,36,67,128,70,2,5,252,66,2,129,1,15,0,3,1,7,27,71,9,38,1,10,128,1,4,157,55,3,36,21,4,18,51,14,128,1,13,58,20,9,114,
+15,0,49,18,8,149,18,7,172,77,10,128,1,15,1,0,71,7,27,18,5,5,2,11,230,5,8,128,1,14,3,42,3,0,6,4,160,20,5,35,24,13,128,1,3,
+58,0,2,13,9,1,129,1,5,242,69,4,245,0,20,94,242,46,13,0,3,6,106,7,6,165,52,5,183,22,15,149,15,1,3,128,1,1,230,32,3,191,44,
+3,84,67,6,242,19,6,183,71,5,87,26,15,128,1,3,11,143,46,5,215,4,15,18,0,5,15,128,4,25,0,10,1,10,110,4,9,59,3,9,128,4,6,220,
+47,10,204,23,6,162,45,6,216,19,13,128,1,3,117,4,2,103,8,1,195,2,5,117,11,4,168,18,4,242,46,15,20,19,1,3,89,21,0,78,12,5,
+140,74,5,129,20,12,129,5,0,167,56,15,128,1,12,8,228,7,4,229,2,15,128,1,17,13,56,31,15,18,0,0,15,128,1,25,0,248,26,9,110,
+1,25,155,74,0,9,128,1,5,14,1,4,117,28,12,128,1,68,230,68,218,67,126,24,13,128,4,2,244,2,1,185,1,2,66,4,5,128,1,12,242,46,
+15,0,3,0,6,217,22,4,37,1,7,110,2,5,129,21,5,37,1,2,114,21,15,56,22,2,15,128,1,32,15,1,0,107,14,128,1,11,146,19,7,77,75,4,
+105,30,15,128,1,1,2,142,46,2,77,10,4,225,69,3,185,51,11,242,46,15,20,22,2,5,195,20,2,108,12,0,61,0,2,163,1,4,23,0,9,223,
+78,3,238,32,13,128,1,35,218,86,186,3,15,13,26,1,52,67,194,86,111,1,15,0,9,8,15,56,13,32,15,0,3,6,15,72,0,24,8,0,3,10,32,
+16,15,126,24,2,15,128,10,1,48,94,243,67,247,0,4,233,25,8,245,15,10,242,46,15,78,33,1,11,103,40,1,56,58,15,41,2,2,3,14,6,
+31,181,184,26,1,6,177,24,13,31,56,8,204,24,0,13,0,4,212,28,15,36,36,2,15,128,1,108,7,202,35,12,252,0,7,86,82,12,0,3,12,4,
+33,10,128,1,3,101,1,15,34,21,6,14,151,56,15,186,3,19,12,92,31,3,223,1,11,128,16,9,200,5,7,240,50,12,149,35,15,1,0,102,11,
+126,48,31,128,113,92,13,15,128,1,3,9,90,4,15,128,1,0,15,1,0,255,8,15,126,48,29,14,28,91,15,35,0,1,15,5,72,255,126,15,1,0,
+163,0,112,17,15,17,0,5,3,202,19,15,188,2,26,15,1,0,33,15,186,5,1,5,98,80,15,1,0,22,7,113,45,15,40,0,12,15,13,73,13,9,35,
+8,15,103,3,5,15,82,59,3,15,17,0,6,0,1,0,7,205,81,4,1,0,8,67,15,13,17,0,13,128,1,3,103,42,2,154,15,7,153,29,9,68,0,13,17,
+0,2,128,14,9,118,7,9,25,49,7,188,36,15,128,1,34,16,140,51,19,15,35,2,5,13,166,60,15,163,71,1,14,39,1,12,127,9,15,87,0,0,
+10,100,56,20,179,162,45,2,63,9,13,17,0,7,122,38,10,28,1,11,142,8,38,94,231,252,63,12,101,5,4,206,8,2,146,1,9,202,12,9,65,
+48,10,102,0,15,120,0,0,9,203,18,0,173,65,8,211,98,15,128,1,1,1,70,1,8,114,2,3,100,11,3,130,44,15,128,1,8,13,142,85,14,35,
+67,13,128,1,3,35,39,2,110,15,15,69,13,2,2,201,25,6,213,45,68,34,218,86,206,83,41,4,45,12,1,35,0,6,26,11,0,7,1,0,221,68,12,
+216,0,10,144,1,54,19,206,94,94,12,15,128,1,15,13,85,0,13,17,0,9,143,11,8,177,74,6,44,85,2,233,90,11,136,3,10,128,1,1,248,
+37,7,70,10,4,155,33,15,128,1,9,37,53,53,225,1,15,37,11,7,2,129,1,5,43,0,15,128,1,3,8,142,85,5,83,0,1,220,11,6,128,1,19,156,
+236,11,4,101,67,1,17,0,8,81,0,4,234,2,9,242,2,5,136,21,5,17,0,38,206,19,94,15,8,128,4,7,214,85,7,128,1,1,77,0,16,140,253,
+15,5,180,48,10,102,0,1,161,83,4,124,2,3,76,2,10,108,63,1,194,14,41,94,140,129,38,12,142,63,12,89,93,5,92,76,15,128,1,9,5,
+223,35,10,20,61,15,94,4,0,11,159,54,14,0,3,12,206,5,3,118,15,6,174,45,0,111,1,1,113,35,0,189,2,1,209,76,12,128,1,4,150,13,
+5,47,50,15,244,23,4,4,113,1,3,222,2,15,128,1,11,2,85,0,2,4,49,4,23,16,11,102,0,21,218,35,18,5,185,27,11,145,4,0,56,7,9,195,
+41,14,128,1,8,8,97,9,172,29,15,128,1,11,10,35,18,15,128,1,6,5,41,0,15,128,4,7,11,129,1,1,105,20,8,30,100,36,34,218,21,95,
+5,173,16,11,128,1,6,36,40,4,110,8,8,5,47,9,109,65,5,6,44,12,128,1,2,74,2,35,206,19,178,65,5,129,54,1,223,26,4,164,39,11,
+102,0,21,179,104,23,24,140,105,16,8,94,4,3,10,39,8,199,41,9,162,4,2,34,0,3,119,0,8,226,25,15,128,1,0,11,131,15,12,13,88,
+15,128,1,1,10,159,55,6,17,26,9,0,6,10,129,1,1,229,40,2,36,91,36,19,38,128,1,1,202,91,0,45,15,0,227,49,15,128,1,16,14,81,
+92,5,101,0,3,86,29,15,229,12,14,5,149,16,0,241,38,3,128,1,10,17,0,0,45,1,23,231,128,29,15,128,1,1,0,2,1,42,218,218,193,2,
+9,162,7,3,121,70,3,7,0,15,146,0,12,8,77,1,9,5,104,3,239,5,14,0,3,9,163,6,15,128,1,4,11,51,18,5,225,28,3,9,8,15,0,6,4,3,13,
+41,6,150,31,2,142,0,9,227,51,8,2,6,3,129,1,4,162,17,15,128,7,4,18,94,126,0,2,68,43,0,47,32,2,38,54,10,50,0,7,189,59,5,128,
+4,6,1,0,14,94,10,0,18,0,8,6,9,8,162,10,1,168,0,2,105,46,12,43,4,15,128,4,10,4,99,0,7,200,97,15,94,10,2,4,177,20,7,175,2,
+11,128,1,13,178,19,1,210,19,0,240,2,2,242,0,2,128,4,2,230,0,2,85,71,12,17,0,5,200,47,7,254,81,6,55,93,4,17,0,2,97,21,4,117,
+35,6,128,4,9,38,23,7,128,7,1,85,0,16,179,1,32,5,1,95,13,102,0,11,73,97,4,18,1,10,128,1,82,34,230,193,206,140,6,9,3,194,53,
+7,136,6,15,67,29,0,15,128,1,17,6,229,105,15,220,7,1,8,51,0,3,62,76,15,128,1,6,15,49,21,0,5,76,0,1,14,55,53,34,218,156,159,
+45,2,9,4,12,17,0,4,4,20,2,58,9,10,139,0,6,71,6,32,206,34,140,9,7,165,33,15,128,1,12,13,85,0,15,102,0,0,10,155,14,5,176,58,
+10,150,58,2,82,8,1,232,0,15,25,8,4,0,89,8,13,101,1,15,0,12,18,8,221,78,15,1,80,1,13,86,1,14,128,10,15,246,4,5,4,114,29,13,
+138,68,15,155,68,0,14,101,46,14,128,4,32,194,86,164,46,19,68,61,0,15,128,13,16,14,60,22,14,203,46,9,244,10,15,93,14,5,1,
+124,4,1,53,9,6,34,0,1,164,103,4,33,7,5,218,31,10,74,70,15,128,1,16,3,195,85,1,214,85,12,237,69,15,224,6,1,15,128,13,4,9,
+177,28,11,129,1,15,128,1,17,3,192,0,22,94,71,14,2,121,9,7,127,9,10,17,0,13,111,2,4,187,15,2,194,0,8,101,103,7,85,0,15,17,
+0,4,6,75,59,11,94,1,6,129,1,15,46,100,2,3,76,52,3,68,36,13,129,4,2,244,6,15,128,1,26,15,1,0,14,10,127,21,15,52,0,12,2,163,
+42,15,128,1,19,3,1,0,5,27,1,4,247,4,5,255,4,11,17,0,2,194,55,13,231,32,15,85,0,11,13,17,0,10,239,11,15,255,3,7,2,74,40,15,
+1,0,37,15,23,78,1,15,1,0,82,2,245,30,15,1,0,26,15,27,82,6,12,1,0,1,213,39,15,128,1,19,14,85,0,15,102,0,22,15,1,0,255,206,
+2,139,12,11,13,96,7,245,43,15,17,0,4,15,75,0,2,15,83,2,175,4,85,9,15,85,3,13,10,153,24,14,33,21,34,0,0,226,88,4,59,71,7,
+25,0,10,42,40,3,223,22,39,67,82,145,53,2,39,20,10,150,0,15,219,13,9,4,113,37,7,86,14,3,1,0,8,120,0,7,225,15,15,0,24,2,6,
+158,83,5,14,0,18,179,159,5,15,13,1,11,7,63,32,3,156,7,4,152,42,15,204,24,15,4,0,6,22,94,219,58,12,128,1,8,103,9,5,119,78,
+10,153,24,1,132,111,12,88,0,1,56,79,3,179,12,7,96,48,11,214,9,4,223,22,38,67,82,105,79,2,35,0,7,245,0,1,87,33,5,100,118,
+7,124,0,2,22,3,1,6,0,3,88,0,2,48,73,8,203,15,5,189,0,9,115,71,2,0,24,2,158,10,2,7,15,10,101,85,13,205,14,5,45,2,12,26,7,
+6,95,114,2,133,119,4,144,17,15,179,120,2,13,151,0,0,117,19,1,41,20,9,128,1,11,161,1,4,18,0,6,246,79,11,153,24,15,48,3,0,
+2,95,32,5,128,1,6,30,123,5,172,18,2,42,2,2,223,22,39,230,34,232,80,13,146,15,3,241,94,6,92,57,1,251,32,35,206,114,230,12,
+23,218,232,42,11,161,93,4,26,3,3,133,0,6,17,21,14,174,38,4,159,1,2,111,21,15,205,11,0,15,43,31,3,1,149,14,2,160,23,3,230,
+0,5,148,59,8,179,120,14,187,58,3,33,37,1,211,11,2,145,65,6,85,21,6,1,0,8,17,9,8,182,94,42,230,169,18,21,12,159,5,3,4,22,
+5,206,40,3,223,1,8,119,72,8,147,84,14,146,3,9,53,26,2,179,1,7,128,1,8,147,0,38,34,206,175,65,11,199,108,8,173,46,8,137,51,
+6,128,16,7,102,15,5,15,0,38,53,156,155,44,8,128,1,15,62,84,2,2,218,48,2,240,43,4,91,2,10,115,75,3,139,0,6,86,12,1,188,59,
+2,94,43,2,49,37,0,28,0,11,128,4,15,145,10,1,8,156,59,5,6,14,1,87,48,1,216,16,9,138,101,3,18,6,12,128,1,6,42,124,3,123,0,
+15,23,30,0,15,120,17,16,9,147,0,39,34,206,251,45,3,137,45,5,108,47,7,169,2,38,206,193,3,92,14,128,1,6,239,20,16,179,20,4,
+15,128,1,0,8,120,30,13,128,1,7,206,53,5,109,5,11,207,116,5,222,38,0,112,43,33,231,67,213,3,2,144,62,0,48,5,13,128,1,12,203,
+6,10,144,73,2,24,115,10,50,22,9,64,27,15,128,1,2,10,191,30,3,52,7,3,93,2,10,4,17,9,199,109,2,235,1,4,89,52,9,128,31,2,84,
+42,3,11,119,8,133,112,2,122,72,7,221,1,0,67,44,5,26,1,15,128,1,1,4,120,7,16,140,91,15,15,77,19,0,5,176,28,15,128,1,6,2,95,
+0,5,141,5,13,128,1,4,85,0,52,94,255,94,60,55,0,179,0,2,129,27,15,0,3,3,5,146,4,16,155,109,112,2,184,2,5,129,0,1,9,23,6,128,
+1,4,185,4,8,6,90,6,87,23,2,94,22,7,36,3,3,200,53,3,78,23,6,67,9,15,120,17,0,2,224,18,2,135,1,13,127,36,0,111,1,3,67,15,2,
+82,87,36,34,206,97,102,10,29,53,6,143,0,15,128,1,0,6,82,73,2,72,42,4,104,20,5,103,2,4,114,72,4,51,0,7,43,16,9,134,101,6,
+179,7,15,128,1,6,1,186,56,4,94,16,8,88,72,15,128,7,7,42,155,34,153,24,6,222,53,14,128,1,5,34,0,9,189,4,18,114,3,47,4,225,
+1,36,206,38,55,19,3,223,29,5,129,1,5,224,2,5,161,22,4,181,27,11,141,70,3,190,20,0,128,4,4,95,54,1,203,8,2,83,72,1,131,0,
+6,18,12,1,123,28,5,103,17,13,128,1,7,25,19,21,86,193,55,3,38,28,3,96,75,8,247,1,12,128,1,7,184,3,6,51,3,15,128,1,6,32,19,
+206,225,119,4,103,0,9,96,23,15,128,1,4,16,155,104,19,8,25,20,0,250,16,15,115,125,1,6,36,3,15,77,28,2,6,239,102,4,184,51,
+8,71,27,11,3,53,12,180,55,4,170,119,3,236,122,16,94,67,117,2,128,1,4,135,19,3,139,67,3,69,75,6,49,73,12,85,6,14,128,1,6,
+92,7,21,140,26,23,9,81,7,15,128,1,57,40,67,128,73,33,9,110,25,13,213,28,1,18,0,0,121,10,6,128,1,3,6,83,5,141,72,4,204,128,
+6,224,0,15,184,95,2,5,231,0,4,97,0,3,96,0,19,130,251,2,3,17,6,11,30,120,8,206,11,3,159,46,0,208,77,1,103,11,6,244,122,3,
+26,11,7,128,1,2,174,1,5,128,1,2,110,2,4,12,80,13,0,24,6,213,4,17,243,219,60,8,26,4,2,250,18,15,128,1,49,3,222,3,0,68,47,
+18,179,86,2,3,57,55,9,75,91,14,128,1,3,135,32,8,197,74,4,241,47,7,15,72,3,20,69,4,34,0,9,20,49,6,7,84,2,134,11,6,17,12,86,
+19,181,34,128,67,223,22,13,94,7,8,59,77,3,185,74,3,226,78,34,34,230,248,116,13,34,47,15,177,71,0,5,157,51,15,17,24,5,6,127,
+4,2,21,50,3,98,45,6,139,8,10,114,72,15,128,1,19,8,102,0,5,111,4,0,36,1,21,94,221,80,12,177,0,15,128,4,2,10,170,6,5,160,86,
+2,95,0,2,87,29,9,241,107,6,148,86,12,128,10,1,116,0,8,111,110,0,119,13,19,128,187,75,14,1,56,6,253,123,7,223,4,6,112,25,
+3,78,72,15,230,24,16,6,188,7,6,191,79,9,229,0,6,254,13,3,71,11,13,230,126,12,114,72,13,128,1,4,171,7,5,34,28,15,204,24,4,
+0,191,22,5,108,5,3,130,98,5,227,22,7,120,5,15,128,1,6,10,136,24,2,236,2,8,50,9,7,181,24,10,221,26,15,1,0,4,0,242,46,9,223,
+22,43,67,182,91,134,11,17,0,13,34,9,15,1,0,12,4,214,27,6,154,8,13,0,24,15,63,125,1,14,35,0,10,114,72,15,1,0,40,3,229,47,
+3,238,53,3,2,17,3,129,1,1,85,24,8,1,7,4,84,1,5,6,17,12,153,24,13,1,0,15,26,0,7,15,1,0,19,13,129,30,13,17,0,15,1,0,180,9,
+181,74,2,234,0,2,85,24,15,128,1,9,15,1,0,255,188,15,204,70,39,15,1,0,255,22,14,214,71,7,1,0,12,204,70,13,111,102,14,239,
+47,11,48,105,2,1,0,10,32,29,6,206,134,3,1,0,11,181,5,12,32,0,15,16,0,29,1,1,0,15,11,114,3,8,32,0,9,175,86,15,112,0,41,9,
+16,0,15,0,1,0,11,48,0,8,197,55,9,1,72,8,77,1,3,70,32,11,204,70,9,104,11,13,252,65,12,112,36,9,87,24,9,156,96,8,115,8,17,
+140,58,97,8,3,85,11,32,0,3,97,13,15,16,0,21,2,1,0,12,56,121,11,1,0,4,151,38,15,112,0,2,15,16,0,29,8,128,0,14,0,1,12,48,0,
+7,35,16,10,85,26,13,223,47,14,204,70,12,149,129,2,120,17,3,179,10,6,69,14,1,94,19,8,172,35,37,206,19,120,58,3,173,7,5,121,
+93,0,187,11,0,241,9,7,3,13,9,177,0,4,29,71,4,22,27,15,16,0,13,6,1,0,15,22,29,8,0,133,0,5,110,83,2,148,105,7,144,0,3,172,
+81,6,23,134,9,144,0,15,160,0,0,0,29,13,2,128,0,14,34,49,12,48,0,7,182,119,7,240,2,7,147,71,6,19,0,15,205,50,9,2,146,20,1,
+69,14,14,128,1,2,68,144,6,147,18,97,206,53,218,67,179,94,129,19,5,42,65,5,91,21,4,199,113,2,32,74,7,226,1,4,40,70,0,31,117,
+35,19,181,199,16,15,16,0,13,7,127,1,15,137,10,7,1,144,11,4,99,23,2,169,0,4,131,14,6,253,132,7,250,22,42,206,53,16,0,10,160,
+0,18,140,74,41,3,51,62,1,227,143,6,239,27,0,11,0,2,43,115,6,161,85,3,26,3,8,129,12,5,87,29,1,168,87,1,178,13,3,94,136,9,
+111,0,12,102,23,15,137,47,6,7,128,1,0,127,1,3,73,3,1,237,42,6,184,3,15,161,5,1,8,192,3,2,79,122,1,117,14,0,183,23,1,67,3,
+15,16,0,12,2,8,4,21,179,222,2,5,16,0,12,156,4,4,244,0,3,148,60,5,120,99,15,16,0,16,17,182,61,0,20,156,160,0,2,156,23,3,52,
+24,4,63,31,5,0,4,2,238,50,7,118,54,5,128,49,15,43,37,0,1,8,7,1,204,15,2,128,1,12,35,17,15,14,114,0,15,128,1,14,2,127,1,1,
+53,95,1,59,97,5,71,3,2,100,35,11,105,61,12,98,0,0,163,15,3,224,2,1,166,15,15,16,0,13,1,86,7,0,173,6,51,140,206,19,170,25,
+2,16,0,9,249,5,6,223,1,3,60,32,3,250,93,7,90,88,3,25,7,5,92,32,5,16,0,2,185,91,1,6,0,2,128,0,18,179,172,143,35,140,140,128,
+0,2,9,1,3,184,1,4,118,30,5,42,17,4,44,141,66,34,0,19,87,35,132,17,140,170,22,18,87,109,115,1,58,0,4,28,92,15,35,20,5,6,178,
+1,15,128,4,0,6,247,97,3,128,3,2,127,1,1,91,86,9,203,114,4,99,91,6,193,19,12,201,20,11,166,23,1,80,1,15,16,0,12,0,119,0,1,
+118,146,5,165,26,3,16,0,14,224,1,7,180,148,3,118,0,12,10,0,6,6,0,2,85,65,5,167,73,1,50,1,3,95,23,3,179,68,3,180,22,3,159,
+116,0,221,91,7,195,96,3,249,1,8,177,17,6,241,16,7,64,150,0,99,0,7,133,1,15,35,20,2,5,43,0,5,214,73,11,0,6,6,145,41,44,206,
+19,127,1,8,27,47,2,0,3,12,192,46,12,128,1,34,218,67,78,35,18,82,98,68,1,241,7,3,40,92,5,16,0,4,113,0,3,70,29,13,221,10,7,
+16,0,6,116,5,6,32,22,5,158,41,5,128,1,2,95,1,3,239,120,1,54,77,2,203,0,6,187,125,5,32,0,49,218,86,206,212,25,3,52,27,6,43,
+0,4,212,26,7,0,53,3,32,0,0,236,7,7,15,10,9,77,51,1,117,7,1,89,35,15,163,21,1,6,89,33,3,71,7,15,128,4,14,0,105,8,2,159,0,
+5,183,0,6,160,1,15,160,8,1,12,192,9,35,179,94,166,67,2,8,0,0,16,0,0,106,8,0,118,8,4,16,0,4,40,154,3,55,20,12,239,33,2,16,
+0,5,137,23,2,255,0,5,124,0,3,170,103,5,99,20,4,203,74,4,62,80,19,179,155,57,0,71,2,4,32,0,4,24,6,2,128,0,1,74,123,16,140,
+92,83,4,145,11,1,237,119,3,37,2,3,238,56,4,65,139,0,208,1,5,140,52,12,128,1,1,250,5,4,133,1,15,163,27,1,6,22,97,3,10,0,15,
+0,9,15,0,118,7,22,140,127,1,7,128,32,3,170,4,4,49,21,3,0,9,7,21,8,2,219,108,3,188,51,19,179,235,2,19,94,203,10,37,179,140,
+16,0,4,59,3,3,137,30,41,243,231,189,41,3,16,0,38,19,130,160,94,8,128,2,4,13,0,4,101,100,3,8,0,5,82,76,13,144,0,2,48,0,6,
+32,0,34,206,38,151,104,2,52,24,2,96,1,17,94,179,98,5,240,5,3,245,28,3,240,7,1,204,99,3,35,2,40,115,34,128,1,9,127,7,12,242,
+142,0,94,1,3,118,0,6,189,12,15,128,10,18,22,179,123,24,12,56,25,7,173,36,4,17,57,10,46,33,6,198,11,4,135,23,15,16,0,12,0,
+33,7,8,90,9,6,16,0,6,200,23,7,97,121,4,223,124,9,88,4,3,174,79,12,0,121,15,16,0,4,0,165,51,1,17,105,3,161,14,0,125,1,0,85,
+2,3,73,127,11,48,0,10,214,70,0,190,9,8,94,24,1,169,52,4,133,1,15,0,3,1,6,1,0,14,239,13,3,179,28,11,84,9,12,137,88,6,240,
+143,4,118,3,0,116,3,14,115,62,6,63,104,3,120,2,15,16,0,18,1,152,6,6,74,58,7,16,0,7,100,0,9,16,16,14,112,0,15,16,0,29,8,128,
+0,14,0,1,13,240,0,8,27,95,13,250,46,9,1,0,15,128,7,0,5,179,76,15,1,0,5,12,160,12,15,0,41,0,14,244,121,10,11,6,12,32,0,15,
+16,0,29,15,1,0,2,52,94,243,67,229,26,10,239,16,15,112,0,47,9,16,0,14,0,1,15,160,0,19,15,1,0,1,15,204,70,3,3,212,163,15,1,
+0,24,9,244,74,15,1,0,100,7,53,37,15,175,45,19,15,1,0,255,255,118,9,212,118,15,1,0,27,4,46,31,9,225,104,15,1,0,88,3,128,0,
+15,94,52,7,12,171,22,15,16,0,43,13,25,111,6,1,0,6,90,39,15,171,23,2,15,144,0,5,2,20,0,9,61,1,8,216,159,15,160,0,13,4,128,
+1,38,140,231,117,93,15,75,24,34,15,48,0,24,8,16,0,4,128,1,26,94,241,4,5,15,2,13,235,12,15,16,0,60,5,112,0,15,107,23,6,15,
+127,1,5,5,124,81,4,219,12,3,34,0,16,128,200,69,35,206,19,130,6,15,128,0,13,5,104,89,20,114,232,33,15,219,23,29,4,82,0,7,
+60,23,15,48,0,3,3,64,45,10,16,0,6,218,156,9,255,2,4,32,14,15,238,23,0,15,16,0,2,1,14,23,8,164,18,6,115,24,2,157,0,5,164,
+18,15,192,2,0,9,154,132,12,251,23,6,213,2,2,76,21,11,59,18,1,6,11,1,169,155,15,123,23,2,12,48,0,13,64,0,4,62,142,35,218,
+34,228,12,15,123,24,0,15,16,0,10,5,210,3,6,176,23,12,48,0,9,235,12,11,16,0,5,0,5,7,18,138,7,213,74,15,128,1,6,33,230,53,
+9,12,4,16,0,1,14,23,8,219,19,9,244,39,3,81,90,5,123,17,13,63,4,6,128,1,3,180,16,43,19,87,17,53,5,171,18,13,187,19,1,105,
+14,0,4,0,11,5,48,6,138,144,12,128,1,2,60,125,9,128,1,35,140,179,37,15,2,128,0,16,140,11,12,6,85,45,1,113,37,7,16,0,0,135,
+15,4,160,0,4,41,28,3,100,71,0,32,0,1,155,34,5,48,0,9,11,18,13,16,0,5,128,3,9,66,5,5,127,25,15,128,1,5,4,247,119,3,96,1,32,
+86,206,32,13,6,32,0,2,169,40,9,139,18,6,117,37,13,27,100,8,128,1,1,251,17,1,12,13,9,251,23,4,5,84,5,90,138,0,7,0,2,48,0,
+18,179,0,6,7,150,85,7,78,3,3,235,24,0,93,2,6,128,1,4,10,124,6,0,1,0,58,18,2,155,16,2,123,18,0,12,3,2,128,0,1,16,0,1,49,0,
+6,16,0,2,96,6,4,44,20,5,43,17,3,223,3,0,108,18,2,246,30,2,48,0,6,119,6,5,176,0,7,16,0,4,0,2,39,206,19,183,91,6,0,62,15,128,
+1,0,3,53,52,2,208,2,1,32,0,111,243,67,102,19,206,128,0,3,5,9,59,22,5,124,0,12,154,101,0,17,20,16,194,123,21,3,23,23,0,172,
+27,6,43,39,5,132,85,0,64,1,3,3,49,2,91,23,2,161,68,2,32,1,4,128,0,4,232,5,10,155,20,8,128,1,5,16,0,5,174,41,0,128,38,1,80,
+0,2,169,49,1,209,92,5,16,0,1,96,0,5,16,0,3,141,0,3,155,24,7,232,5,1,201,1,10,192,0,5,223,5,3,244,0,12,16,0,8,0,9,7,170,3,
+5,66,5,14,192,3,0,186,0,3,45,88,3,240,0,56,243,67,102,59,21,2,158,1,18,181,238,46,7,107,22,7,127,72,11,121,129,3,250,7,2,
+27,23,0,222,16,16,114,204,2,5,188,138,5,93,19,3,128,1,3,14,0,7,208,5,2,169,43,9,203,21,3,75,13,4,112,1,1,65,4,8,16,0,4,64,
+3,11,174,41,4,240,29,4,134,24,3,222,50,5,150,24,5,49,173,0,194,17,6,176,1,2,59,0,1,160,3,4,71,70,34,206,53,48,0,15,27,11,
+12,13,128,0,4,134,169,5,214,5,9,171,23,4,152,31,4,43,72,1,126,31,3,127,1,4,0,1,8,203,89,1,128,0,1,147,6,10,72,55,9,238,4,
+3,60,41,2,128,1,0,64,2,1,150,43,4,251,23,3,188,72,4,212,41,4,90,116,15,80,7,3,14,19,28,10,176,4,5,128,1,3,48,5,14,0,1,2,
+192,2,4,240,2,0,16,0,3,220,0,5,16,0,8,16,3,14,112,0,3,0,3,0,197,82,15,128,1,45,12,128,46,6,208,5,9,96,1,20,58,167,4,4,219,
+27,4,148,16,3,32,0,1,36,3,24,231,65,42,15,128,1,7,3,64,5,3,157,46,7,29,6,9,146,130,2,239,57,3,80,5,6,44,132,5,125,48,1,96,
+8,3,191,68,4,138,115,2,176,4,3,128,1,2,58,4,7,128,1,5,0,13,12,123,24,0,16,0,4,192,4,4,16,0,4,59,163,4,203,23,3,174,152,5,
+192,6,8,192,0,11,155,12,5,158,70,4,26,0,6,0,14,5,190,0,15,128,1,13,7,173,171,2,96,2,4,19,145,4,112,4,7,42,49,8,185,176,15,
+128,1,9,5,152,0,0,22,1,3,142,97,8,208,123,11,90,156,5,240,2,15,153,80,1,3,1,0,3,252,25,15,0,9,0,2,107,18,10,128,1,19,94,
+65,12,12,123,24,2,54,0,1,91,28,6,16,0,0,59,1,5,100,155,9,32,1,2,192,0,7,122,9,6,160,0,5,30,8,2,97,0,3,25,0,4,128,1,37,179,
+194,187,20,5,128,1,15,240,11,8,8,128,1,8,111,55,0,11,0,6,197,140,2,176,7,2,92,28,15,128,1,11,6,32,11,12,251,23,10,93,74,
+14,0,12,3,30,0,5,131,50,10,96,12,15,0,12,21,6,112,19,12,128,0,15,16,0,11,14,203,35,14,48,0,8,160,0,8,176,4,8,104,97,1,163,
+28,3,8,0,5,128,1,12,2,118,15,187,23,0,15,16,0,17,5,80,0,7,92,23,6,59,75,2,104,6,6,126,183,13,11,23,9,139,20,15,59,23,15,
+32,19,206,143,3,36,206,19,24,49,15,160,0,11,6,232,108,4,72,7,15,219,23,27,14,128,1,15,48,0,13,2,137,79,4,16,0,4,128,0,4,
+138,39,8,0,3,4,76,131,4,1,0,15,91,36,3,15,16,0,28,11,128,1,5,148,83,7,1,0,15,11,23,10,15,59,23,5,11,130,56,13,45,65,15,144,
+0,5,3,41,6,53,67,231,67,128,11,15,75,24,45,15,48,0,10,27,102,16,0,4,69,128,24,140,188,32,9,111,98,15,1,0,60,11,155,104,8,
+115,23,15,1,0,98,3,254,59,15,168,189,102,3,46,48,3,128,12,15,1,0,255,255,255,18,15,240,23,13,3,72,17,12,135,130,5,224,3,
+12,160,8,12,192,6,15,43,47,29,15,75,47,15,5,180,144,1,227,58,10,102,48,12,139,33,13,224,9,8,238,144,5,1,0,15,25,168,7,15,
+208,0,15,15,96,24,35,5,19,0,87,179,255,255,155,130,20,13,6,60,19,3,64,25,2,42,0,4,190,33,13,144,0,11,128,23,15,176,0,0,10,
+64,23,15,43,47,13,15,32,0,2,1,35,13,8,51,140,2,213,42,9,166,61,8,187,90,15,128,1,8,8,238,144,15,224,1,7,5,132,32,15,208,
+0,14,15,16,0,28,0,46,7,4,208,11,4,112,12,104,206,101,115,34,169,144,148,42,3,195,0,12,192,0,8,192,13,0,182,12,15,187,41,
+6,3,145,20,15,11,47,0,1,192,19,4,243,40,6,32,24,5,253,61,3,64,1,7,236,135,19,140,173,140,6,145,25,8,125,131,15,219,41,0,
+15,128,1,12,7,238,144,9,33,1,22,94,237,75,7,38,51,3,187,140,1,203,8,2,247,60,15,27,48,14,15,16,0,10,69,34,230,156,243,192,
+11,4,110,131,70,156,169,130,144,128,1,1,14,1,1,141,46,4,224,2,4,67,42,8,224,2,15,128,1,5,3,84,157,1,44,3,1,83,162,1,157,
+9,20,130,83,10,12,192,20,4,160,23,3,223,1,4,56,15,6,128,1,2,255,145,0,180,1,19,128,149,2,3,51,17,3,170,192,4,128,14,3,217,
+18,15,128,1,16,12,197,168,3,168,38,21,86,58,119,7,84,16,14,128,1,15,0,11,2,2,112,0,15,176,11,6,0,40,117,22,194,224,0,12,
+16,15,11,128,1,0,145,21,5,213,21,6,145,21,7,133,74,7,32,17,15,29,99,3,7,37,17,2,85,38,20,58,131,121,12,67,52,4,160,23,1,
+64,0,3,75,47,9,217,15,7,74,114,2,209,26,3,114,14,3,225,17,2,89,26,0,112,0,5,53,56,15,128,1,14,7,198,168,2,252,5,2,94,142,
+11,126,95,4,171,43,11,128,1,1,255,14,3,215,161,5,91,94,3,112,0,9,77,120,6,16,0,20,94,199,38,3,224,0,15,144,16,13,16,140,
+220,16,5,59,182,4,71,12,4,30,65,7,200,13,5,16,24,0,128,13,8,122,121,6,128,1,2,88,21,18,114,229,93,7,114,119,2,22,43,6,160,
+23,11,160,2,6,123,47,17,181,194,143,2,236,31,1,195,148,2,236,52,5,227,77,1,119,17,6,159,78,15,128,1,18,6,199,168,2,89,116,
+17,140,62,184,12,253,96,3,87,3,10,128,1,6,199,37,6,95,148,8,112,0,13,203,48,11,75,48,14,144,19,7,204,93,5,0,3,18,181,148,
+24,4,236,56,7,3,44,32,34,230,229,48,2,4,7,3,128,4,0,60,124,2,74,74,15,128,1,0,1,176,1,19,101,128,45,4,176,1,67,34,181,38,
+156,0,6,8,144,53,7,160,2,5,128,4,3,10,7,1,23,0,20,128,230,112,8,225,3,4,141,64,3,235,44,15,128,1,19,8,16,0,0,233,77,2,13,
+56,1,217,0,7,33,0,2,15,0,10,128,1,5,240,4,6,48,25,6,152,16,15,16,0,3,6,120,0,12,128,1,1,139,21,67,206,38,156,19,173,196,
+4,160,2,16,94,221,24,3,196,26,2,207,4,1,126,51,2,76,124,20,140,42,153,1,240,31,12,155,48,15,128,1,1,1,10,53,0,243,88,5,43,
+47,0,192,3,4,96,30,14,0,3,13,128,1,3,205,40,1,0,3,2,240,8,5,136,168,6,236,90,2,83,54,15,128,1,19,3,238,144,2,169,22,3,90,
+116,18,94,112,174,13,48,0,1,128,1,5,219,53,14,144,27,7,54,6,15,16,0,3,6,8,6,15,128,1,5,116,142,182,144,144,156,182,128,16,
+26,2,4,0,8,106,155,32,169,206,201,199,2,224,11,17,140,218,22,1,222,123,15,0,6,5,7,11,43,0,150,1,2,237,0,17,128,26,2,5,48,
+20,4,168,16,8,0,6,6,32,0,6,128,7,1,251,47,18,140,177,166,6,193,54,6,248,155,0,192,7,1,32,18,8,148,70,15,128,1,12,4,238,144,
+3,172,0,1,129,1,2,127,1,15,0,12,0,10,128,1,4,240,5,9,59,48,4,112,0,15,160,35,3,0,182,2,17,181,236,55,12,225,97,2,112,1,1,
+128,1,55,156,169,67,128,31,3,81,0,3,75,55,98,231,130,243,255,243,130,80,33,0,64,11,4,85,140,15,128,1,4,3,3,5,8,120,47,2,
+1,0,6,18,49,2,241,107,7,54,25,1,191,0,5,192,5,5,149,147,0,32,0,2,66,128,0,6,145,3,80,19,9,136,168,6,108,3,5,96,3,15,128,
+1,14,5,238,144,4,45,2,37,94,179,127,1,15,0,3,13,3,185,144,3,87,150,6,240,21,5,200,192,15,59,48,0,0,204,49,36,206,86,44,126,
+4,35,1,4,224,7,147,206,38,156,155,243,156,243,130,243,0,3,3,106,0,6,89,24,9,96,34,4,198,80,4,164,81,13,128,1,6,28,52,6,26,
+52,7,15,8,12,203,51,3,199,11,5,63,8,9,120,3,5,129,32,1,84,24,5,209,43,8,136,168,3,125,56,2,146,191,15,128,1,19,5,59,72,6,
+13,1,2,75,57,15,128,1,18,15,27,48,15,15,16,0,12,4,103,0,4,158,23,7,192,24,7,80,23,1,230,2,6,170,125,7,174,61,7,4,84,12,240,
+7,15,0,15,2,10,48,23,4,94,68,6,5,27,15,32,0,1,10,18,0,3,162,7,8,76,71,8,86,54,9,195,203,15,128,1,15,3,78,0,10,225,77,12,
+178,73,11,48,6,15,208,0,7,15,16,0,31,4,130,4,5,67,104,5,95,0,15,224,23,17,13,224,10,12,48,0,13,0,3,15,43,47,28,15,75,47,
+18,3,252,27,6,61,194,1,104,154,6,32,17,15,128,1,8,8,238,144,7,129,1,15,157,46,5,15,224,6,1,15,171,48,49,15,187,70,255,198,
+15,1,0,255,132,15,89,148,45,15,1,0,44,9,116,148,15,1,0,82,15,190,142,10,15,176,22,31,11,224,32,15,48,0,13,4,47,59,7,17,0,
+7,143,95,7,1,0,4,190,110,26,94,145,5,15,48,23,0,9,75,110,15,123,71,29,12,125,5,15,144,48,24,5,112,17,4,194,94,15,48,25,15,
+1,144,6,25,53,128,43,5,246,12,4,126,0,7,253,0,15,16,0,14,12,117,36,15,64,0,28,6,98,45,12,50,91,3,147,0,1,12,10,7,17,10,15,
+48,48,3,6,144,12,15,80,24,27,12,109,22,15,176,0,2,1,207,19,15,80,0,2,12,0,41,15,0,49,19,52,94,206,19,79,82,7,90,20,12,111,
+70,6,160,22,2,17,20,12,224,46,7,112,23,10,176,73,15,80,47,26,3,39,10,9,105,16,8,128,1,12,112,0,15,48,48,4,5,179,12,10,32,
+0,15,64,48,2,11,64,0,10,4,101,0,235,71,2,94,83,3,160,0,84,218,67,67,231,156,24,89,15,128,10,2,9,128,42,15,160,10,3,1,145,
+12,6,133,83,20,140,98,61,52,34,230,128,17,10,2,191,15,15,112,10,0,4,199,12,15,128,10,4,0,234,17,0,91,204,4,14,0,10,203,71,
+14,16,0,5,121,98,3,80,47,5,164,94,15,145,53,2,14,64,23,11,43,72,11,128,4,11,32,0,4,128,1,41,67,82,80,24,10,62,92,8,255,145,
+0,112,0,3,128,1,5,112,87,7,141,3,1,25,13,2,251,12,2,107,67,15,128,1,4,1,64,164,9,48,49,7,192,184,3,36,208,6,58,23,4,233,
+1,8,206,14,3,165,17,1,199,22,0,227,15,6,56,2,10,31,4,0,75,47,1,192,22,4,239,4,2,123,165,4,208,47,4,88,123,19,218,113,62,
+2,16,0,0,253,19,18,155,38,25,8,124,158,11,94,72,7,127,90,7,64,23,3,63,49,9,117,6,1,77,20,3,128,23,0,221,37,2,57,3,6,202,
+158,0,33,5,4,64,42,13,107,72,9,126,5,15,176,23,9,4,240,44,2,202,2,2,208,21,4,153,112,3,121,22,0,112,20,3,42,1,9,32,28,1,
+82,0,4,64,21,4,184,20,10,159,207,1,64,17,7,202,98,4,112,47,9,192,1,4,187,70,7,203,71,3,62,2,2,191,1,0,120,19,3,128,44,5,
+64,47,0,200,205,19,230,226,170,4,23,113,6,96,44,6,180,97,13,202,169,5,64,28,3,208,18,8,16,24,4,144,47,9,92,4,2,69,0,3,58,
+2,6,144,44,3,181,24,5,64,0,2,93,4,3,64,0,55,67,243,128,128,1,12,176,23,3,240,48,7,80,26,34,114,87,48,8,15,193,155,3,2,96,
+22,0,140,54,2,32,28,6,16,52,6,12,114,8,225,90,8,132,143,2,5,47,1,125,3,5,236,126,8,233,44,15,64,17,6,9,128,3,2,183,75,1,
+246,0,2,16,0,33,86,243,49,119,2,64,47,4,229,47,5,123,1,2,103,193,1,1,0,0,242,188,4,64,27,12,8,0,6,0,1,4,16,171,10,69,225,
+23,38,224,88,3,112,51,3,112,0,3,18,221,5,16,48,3,176,47,3,112,48,0,193,17,8,112,103,15,224,0,2,9,128,1,2,143,18,1,58,213,
+15,128,4,3,6,55,103,10,128,1,4,192,20,6,112,1,2,192,7,5,16,0,3,43,75,5,226,137,8,112,1,4,128,2,12,160,0,5,200,41,3,209,40,
+15,64,47,1,3,205,21,5,16,0,3,58,2,3,240,47,10,247,41,15,208,31,2,4,120,18,2,64,0,4,76,19,5,0,3,8,146,102,5,128,0,3,48,193,
+4,144,48,6,128,1,3,206,19,4,0,3,3,112,173,8,251,71,15,128,1,12,0,14,1,14,75,73,7,0,6,14,112,21,6,128,4,14,240,2,11,181,98,
+3,191,43,10,192,22,12,80,9,7,208,22,5,209,17,5,207,20,17,94,142,193,0,108,72,4,64,47,2,61,10,4,16,0,21,114,217,32,1,106,
+28,8,197,100,11,222,79,3,0,6,69,243,67,0,58,177,42,3,0,6,4,160,47,2,15,127,9,92,106,0,181,24,2,240,53,3,64,54,3,91,0,7,0,
+6,7,208,47,4,126,8,4,5,3,12,240,0,3,225,11,4,111,29,0,15,0,5,103,24,4,144,5,4,160,1,3,64,2,5,200,8,15,128,1,11,2,59,21,7,
+156,53,1,139,2,2,232,0,3,195,5,15,192,22,4,3,240,1,4,16,108,0,154,69,21,140,46,215,15,80,47,1,0,33,56,5,16,0,9,42,55,7,102,
+67,1,26,1,13,128,1,1,183,26,2,16,24,6,80,0,0,25,77,4,90,1,41,243,231,136,5,2,230,2,22,68,122,1,5,106,146,4,64,48,9,160,0,
+5,164,19,17,87,1,203,14,240,0,15,128,1,0,5,231,32,12,108,86,3,192,0,5,72,93,15,128,1,11,5,0,44,0,47,2,6,132,229,15,160,22,
+1,2,144,0,5,16,0,3,128,1,10,177,13,15,3,97,2,15,16,0,16,4,178,22,2,145,100,13,128,1,1,197,38,2,0,52,2,43,102,14,144,47,10,
+7,7,12,32,0,14,64,48,8,32,0,5,252,5,69,179,114,206,128,238,152,7,240,0,15,128,1,0,5,108,166,15,16,30,2,15,0,12,3,5,128,1,
+5,244,144,7,119,12,0,188,2,5,190,24,15,176,22,33,8,0,15,15,64,0,29,10,0,15,14,128,1,12,176,16,14,144,47,15,45,81,4,15,123,
+71,19,3,127,12,51,67,231,67,73,35,11,32,0,11,193,37,14,80,0,10,144,61,15,128,48,5,1,128,1,5,16,0,2,159,39,7,177,24,24,179,
+131,146,15,176,22,31,10,245,52,15,64,0,18,7,106,130,0,204,6,4,58,173,15,128,1,1,12,240,47,10,240,25,14,208,46,15,48,24,26,
+2,204,11,9,142,67,15,144,48,29,9,0,4,15,48,25,17,13,239,47,63,67,218,34,143,71,106,10,141,63,15,1,0,92,5,235,5,15,1,0,103,
+15,122,192,255,255,13,8,175,34,1,1,0,9,128,125,15,206,0,158,1,96,134,31,102,245,24,22,15,187,95,2,15,32,0,12,6,29,182,15,
+176,47,19,12,83,0,25,94,129,96,43,179,179,83,168,3,126,93,9,35,95,15,171,95,54,5,194,0,6,112,34,4,232,11,9,80,32,9,49,18,
+15,32,1,6,5,160,65,5,120,11,32,67,82,94,48,24,102,192,16,13,176,24,9,219,23,11,240,7,6,51,0,7,58,90,9,32,0,1,226,9,2,51,
+92,15,128,23,17,12,80,71,0,180,0,23,219,158,6,1,102,85,11,175,25,5,240,9,15,171,95,50,1,35,158,15,34,26,3,13,224,14,3,93,
+235,35,140,155,24,115,11,224,0,14,251,200,5,17,60,5,102,27,1,122,21,1,70,215,6,19,57,6,176,24,3,197,24,6,96,8,3,41,84,8,
+171,78,3,43,10,12,228,108,3,88,13,8,193,107,0,112,12,5,185,119,15,32,47,2,4,199,2,4,138,14,13,27,95,15,128,1,0,2,58,61,6,
+111,25,2,240,36,6,160,24,15,16,0,13,2,31,45,7,8,73,7,93,110,3,254,2,7,108,46,5,183,10,8,128,1,18,140,15,108,15,144,34,15,
+5,241,22,6,230,28,16,179,163,21,19,179,229,49,2,144,0,4,175,2,6,6,1,4,16,72,3,108,40,9,128,1,3,91,9,2,192,19,115,206,19,
+38,19,0,53,53,186,36,8,74,109,4,80,46,4,132,9,4,246,17,3,48,0,2,243,7,5,121,9,4,120,157,11,224,72,2,128,1,9,62,26,3,211,
+23,3,73,141,5,223,3,5,240,9,3,48,13,5,16,0,3,143,3,15,144,47,3,1,123,9,0,145,26,10,98,125,8,158,12,8,128,18,5,128,1,4,137,
+121,12,112,1,12,1,0,5,128,1,6,68,2,17,68,163,21,4,40,43,3,212,92,3,176,24,1,10,0,1,1,0,14,204,89,7,112,15,1,91,41,4,203,
+93,4,56,1,4,0,91,4,40,1,4,128,17,8,202,113,5,60,116,4,161,14,11,16,36,12,206,85,4,169,24,6,49,15,6,77,139,3,224,4,5,183,
+22,5,176,23,3,97,23,8,81,120,7,16,0,11,224,23,2,106,1,42,53,218,14,101,3,224,119,2,94,184,0,13,25,2,96,24,5,221,230,3,240,
+43,15,128,1,24,6,191,137,2,17,1,3,127,2,1,93,0,0,60,0,2,117,69,6,223,145,3,112,41,32,230,34,29,121,23,68,176,43,4,129,1,
+3,128,0,6,137,6,4,80,20,4,122,0,2,32,0,2,231,211,3,160,0,7,204,8,3,22,67,10,171,89,14,64,14,6,234,77,1,43,0,7,153,36,3,41,
+159,6,54,24,6,32,7,2,129,1,2,16,0,9,32,2,0,16,0,16,101,171,91,0,115,51,8,144,0,9,7,158,3,130,2,8,4,3,4,144,4,3,186,123,1,
+6,71,15,128,1,20,4,105,5,10,195,15,0,168,21,0,70,24,16,243,16,246,0,37,6,2,186,18,7,128,1,2,197,23,1,128,1,2,149,0,9,224,
+4,5,203,96,9,176,50,8,140,165,5,160,4,4,212,2,15,35,103,0,9,106,90,4,252,96,7,175,7,13,219,95,11,91,94,15,240,65,13,2,128,
+25,16,68,177,19,6,16,0,34,67,82,65,113,7,16,19,4,48,19,2,31,1,26,179,85,112,6,53,46,14,144,0,15,0,6,16,12,128,1,8,148,201,
+1,27,118,0,28,20,15,128,1,1,1,224,4,2,0,3,1,23,185,9,96,0,2,165,212,12,0,3,9,32,1,3,144,21,5,85,209,9,160,24,4,224,50,15,
+224,4,3,5,128,4,7,219,16,5,115,94,4,235,15,2,128,0,6,187,34,9,224,1,5,224,48,97,206,53,230,94,0,140,86,195,15,0,49,3,48,
+218,53,140,127,53,8,160,45,0,53,26,10,175,2,15,161,124,0,15,128,1,1,15,32,18,2,3,233,7,8,99,27,6,192,55,1,0,3,0,150,5,4,
+128,1,9,17,10,5,128,1,5,96,72,6,28,1,15,0,6,1,7,160,0,7,46,187,0,230,18,5,251,94,6,48,0,11,64,223,15,208,3,3,5,231,26,8,
+213,243,2,16,0,3,208,5,2,187,148,8,160,24,3,116,6,15,128,47,4,5,208,8,4,32,0,33,179,82,127,1,7,160,19,8,193,142,0,169,1,
+1,232,95,2,91,99,5,221,236,8,117,126,15,128,4,8,4,242,1,4,106,21,11,146,204,80,179,255,206,86,128,6,5,3,94,179,6,122,243,
+3,0,11,10,128,1,4,44,5,1,118,45,2,64,76,20,114,48,32,11,128,4,7,115,116,7,106,71,22,94,48,0,9,44,173,35,179,140,198,122,
+10,16,21,1,28,0,3,163,20,5,197,143,52,94,0,115,240,49,4,152,25,5,248,152,3,9,0,9,152,27,12,192,24,3,208,8,7,144,47,1,1,12,
+4,160,71,10,55,148,2,96,24,49,34,230,255,50,96,1,91,100,3,222,3,15,128,1,19,5,15,47,7,80,21,7,237,17,5,80,2,2,114,10,4,63,
+10,6,23,120,15,128,1,2,2,50,0,2,96,4,16,179,137,136,6,40,14,5,70,93,2,12,173,5,32,81,4,69,5,21,179,48,0,5,172,100,7,0,3,
+12,80,73,7,58,2,6,77,129,2,234,98,5,65,2,2,173,33,8,176,24,2,36,30,15,192,24,6,13,48,0,2,55,135,5,127,6,7,31,1,8,192,58,
+3,128,10,15,128,1,10,15,144,1,1,4,196,30,15,127,1,1,2,17,4,5,133,37,6,97,24,9,16,32,8,208,4,6,64,73,5,169,80,7,248,52,5,
+0,6,3,164,1,15,128,23,2,8,136,5,13,208,34,35,34,68,204,1,4,83,31,12,240,14,11,144,13,15,171,95,47,1,123,0,4,254,76,41,243,
+86,224,132,13,160,53,11,128,1,15,224,48,15,11,1,0,13,3,254,2,29,124,15,223,17,6,15,240,47,2,11,32,0,8,72,54,8,220,83,15,
+64,0,4,12,200,8,13,1,0,42,179,179,45,137,11,240,17,0,60,89,15,112,24,30,15,16,0,20,10,1,131,10,104,80,15,224,2,2,15,32,1,
+12,15,16,9,0,14,0,160,3,52,14,15,1,0,134,11,222,136,15,32,98,11,15,1,0,43,15,222,135,1,15,1,0,255,255,33,0,184,109,15,1,
+0,70,5,238,171,8,220,3,15,174,51,119,3,18,255,7,210,32,15,1,0,27,14,48,95,10,79,12,15,43,28,0,14,80,23,14,68,5,15,16,72,
+10,2,99,21,15,174,0,4,12,82,166,5,118,150,14,102,202,8,217,48,15,158,1,13,15,113,144,2,4,1,0,15,161,153,7,15,128,1,21,7,
+97,95,15,21,167,0,1,100,0,1,128,25,12,135,0,13,112,37,4,69,15,20,179,128,84,11,92,1,3,189,129,8,130,1,7,62,68,13,80,128,
+12,208,42,2,172,106,0,208,8,15,11,147,5,12,91,158,5,20,138,3,234,0,37,140,140,10,122,6,149,36,10,122,9,9,171,33,11,163,132,
+15,120,45,2,15,189,126,15,11,181,49,8,236,182,2,150,0,8,248,1,15,124,169,1,2,112,13,12,135,0,4,48,13,4,191,1,32,19,58,39,
+0,1,181,12,4,144,43,15,220,2,0,10,16,48,6,223,144,10,128,1,3,144,13,4,119,231,2,32,44,13,68,1,10,165,0,19,181,30,88,6,149,
+151,6,186,82,13,0,3,0,10,38,14,168,34,8,226,142,5,61,127,3,237,45,1,82,15,14,120,0,14,214,34,15,62,1,0,12,67,9,5,195,139,
+15,128,1,16,1,15,17,10,112,132,6,96,48,2,112,46,3,132,24,1,25,24,15,156,47,4,11,48,61,10,48,47,4,80,41,6,83,185,2,128,1,
+11,32,91,15,0,3,11,0,46,16,0,130,75,6,174,106,7,181,117,5,188,1,17,94,102,116,1,176,139,7,255,19,5,106,46,7,137,46,11,184,
+67,1,174,1,1,60,0,6,222,132,4,54,17,15,8,9,12,9,52,10,8,255,147,82,34,218,101,230,114,255,113,15,128,1,8,6,9,145,13,128,
+1,6,144,22,4,128,1,1,18,0,7,0,3,2,130,124,6,32,24,4,217,85,9,145,28,4,64,15,15,128,1,12,11,0,6,6,79,11,12,74,120,8,73,134,
+3,156,29,0,154,192,97,128,67,82,67,67,82,189,0,41,179,140,87,12,20,179,39,75,6,249,4,0,87,19,8,248,16,5,128,1,5,241,26,3,
+199,47,11,7,245,0,161,38,1,147,12,7,154,206,7,129,1,9,221,132,12,210,0,0,134,20,2,128,1,2,210,234,4,128,1,6,171,113,10,128,
+1,10,144,22,2,168,18,1,134,27,8,128,1,10,215,0,4,179,16,4,139,93,9,156,52,15,128,1,26,12,53,7,13,100,133,8,29,152,11,189,
+0,0,252,2,8,0,3,18,140,65,112,3,142,0,7,90,0,15,128,1,0,9,207,15,1,44,44,8,222,5,4,115,125,2,99,211,13,129,1,10,165,0,11,
+210,0,1,201,31,0,60,0,11,224,233,3,15,1,15,128,1,1,16,179,241,5,4,128,1,1,64,21,3,182,182,7,128,1,13,226,169,3,96,19,12,
+242,221,1,110,16,12,128,1,7,48,0,15,207,4,0,10,181,8,10,108,34,3,213,5,3,172,99,5,128,4,2,230,117,1,203,4,8,57,116,4,83,
+8,5,212,122,7,136,0,5,200,20,2,120,6,2,17,1,5,23,18,10,242,62,11,128,1,8,165,0,4,235,28,67,206,255,255,194,144,1,2,115,23,
+7,236,117,5,67,5,6,128,1,4,47,29,12,135,0,1,32,7,1,97,104,3,160,85,1,125,26,7,64,25,4,128,1,4,160,71,12,128,1,3,112,20,6,
+78,129,7,129,7,15,128,1,1,6,46,2,2,129,0,7,31,9,10,95,33,8,142,41,4,188,24,10,61,2,1,124,4,7,31,11,4,197,26,4,195,66,9,234,
+9,12,0,6,1,228,0,1,171,89,5,134,30,9,53,9,2,117,5,15,88,141,0,3,251,94,0,158,1,5,189,211,12,236,117,9,210,0,9,105,117,15,
+0,6,1,51,230,101,167,144,22,4,40,19,7,176,104,5,0,6,14,128,51,3,218,9,2,75,5,10,193,165,15,128,7,15,15,166,11,3,15,15,3,
+3,6,140,26,10,60,9,2,206,8,7,69,118,1,184,6,19,140,233,31,5,16,9,7,121,5,7,128,1,12,213,37,1,199,0,15,99,134,4,10,83,1,4,
+131,100,0,197,32,4,211,12,10,225,93,9,18,7,9,105,117,15,128,1,1,5,144,22,6,160,27,6,96,69,15,128,1,0,3,87,6,7,153,95,3,30,
+194,13,131,19,4,97,173,9,128,1,4,68,1,15,128,1,1,1,230,9,72,231,255,255,219,93,152,8,28,25,9,189,0,7,194,0,2,236,8,4,131,
+9,9,218,129,8,188,10,8,128,1,6,147,31,10,185,3,15,137,13,5,10,49,121,7,226,8,4,50,32,5,210,0,10,209,158,9,56,0,15,128,1,
+2,5,76,230,4,65,25,3,206,1,15,128,1,3,6,24,57,13,210,61,3,187,0,10,131,149,3,128,1,4,208,101,6,128,10,15,1,0,1,0,152,44,
+1,90,0,5,209,4,7,172,124,5,12,22,4,60,12,10,246,119,3,33,5,5,174,19,9,36,158,15,113,144,1,11,117,13,3,125,3,15,41,64,4,10,
+127,1,15,128,1,10,3,228,81,5,56,0,3,236,237,15,135,0,2,1,253,28,4,242,225,5,208,37,3,201,9,4,112,32,9,128,1,15,192,70,3,
+6,9,77,10,128,1,15,48,23,3,15,128,13,6,11,219,0,1,1,0,6,0,18,3,122,225,5,60,12,13,246,119,8,195,2,2,195,0,5,79,4,11,30,0,
+2,131,2,11,109,4,5,125,37,15,127,1,14,15,128,1,11,7,30,0,12,182,5,13,135,0,0,47,2,1,38,11,8,176,36,2,92,222,3,58,58,13,0,
+6,13,144,95,15,189,0,9,15,80,24,13,14,1,0,15,12,16,6,13,128,1,11,139,0,4,220,0,15,156,19,65,12,192,120,7,165,0,15,128,1,
+0,7,48,26,10,236,207,15,1,0,73,15,33,245,2,15,82,0,44,9,143,7,15,0,21,17,15,215,144,45,15,1,0,6,15,19,16,7,5,201,248,15,
+107,170,14,15,1,0,255,179,9,164,204,47,167,86,124,244,15,13,57,12,15,1,0,4,8,182,6,7,41,55,15,1,0,127,3,93,4,5,218,104,4,
+23,7,3,154,79,15,184,0,8,10,249,213,15,1,0,4,17,58,21,31,7,53,0,12,252,53,7,38,1,43,94,169,61,172,15,103,165,0,6,75,70,8,
+136,238,13,1,0,65,19,206,94,179,88,160,3,54,0,18,114,30,167,4,153,23,8,249,56,9,178,106,10,17,2,12,48,88,6,48,0,11,63,4,
+7,186,16,8,253,80,15,38,24,10,4,35,0,5,217,35,2,145,17,7,128,1,0,241,153,0,18,14,5,65,18,7,1,0,18,38,89,112,5,176,93,15,
+1,0,5,11,227,57,11,189,0,51,19,156,193,114,88,2,44,0,105,155,181,169,128,181,142,125,49,10,93,0,6,90,14,1,211,2,9,74,31,
+1,250,16,8,111,37,7,128,1,11,234,5,7,90,0,6,228,34,7,15,0,7,118,2,2,129,35,8,71,9,8,217,1,4,140,0,9,50,50,5,164,39,14,38,
+24,12,210,2,5,15,26,5,252,157,8,128,1,0,174,187,1,44,16,4,1,86,7,114,0,20,179,40,116,31,94,239,25,9,7,61,162,15,15,0,0,0,
+1,91,38,167,182,62,0,70,167,86,156,114,128,1,9,45,0,3,121,1,8,57,21,10,83,1,1,252,10,1,252,254,3,8,19,17,179,220,25,2,84,
+14,2,70,40,4,133,12,6,151,1,1,136,7,2,163,15,10,142,162,9,170,20,5,16,96,15,128,1,5,8,79,22,6,128,1,13,159,23,3,16,22,8,
+252,2,41,68,34,242,2,10,128,1,3,126,36,9,129,179,6,115,0,1,4,110,3,199,45,8,129,1,7,145,228,8,17,69,4,77,2,10,190,33,70,
+130,19,34,155,236,0,10,128,1,10,45,0,6,74,135,9,220,0,4,5,167,64,67,243,230,72,187,109,3,24,20,4,42,59,1,219,20,16,206,207,
+70,6,117,0,6,189,1,2,166,22,3,227,43,7,204,4,8,195,237,5,128,1,7,234,66,10,11,1,33,19,206,116,11,5,192,51,5,128,1,13,226,
+28,9,51,5,6,135,0,3,241,120,14,128,1,2,232,0,6,128,1,4,237,0,0,96,37,66,140,243,86,206,51,23,40,19,206,47,192,9,91,24,12,
+69,11,13,0,3,16,156,242,89,5,206,0,127,167,67,140,230,68,218,182,0,3,1,1,121,7,2,247,25,15,128,1,1,17,94,4,93,3,29,66,4,
+103,213,6,230,168,10,38,58,9,86,100,10,142,1,6,197,0,7,3,60,2,16,87,5,227,0,11,128,1,48,19,206,193,129,1,10,204,147,15,31,
+25,2,10,178,6,6,8,18,3,212,72,14,128,1,17,115,115,244,5,128,1,5,148,10,1,227,2,48,179,206,193,120,39,101,94,19,206,169,230,
+179,129,1,9,205,25,17,230,26,41,1,34,41,8,39,17,6,2,5,1,142,14,15,86,146,6,9,45,0,0,251,2,6,118,143,1,130,111,0,9,1,2,128,
+1,34,140,255,245,45,20,140,135,48,10,249,0,7,56,62,4,128,1,2,195,139,10,106,28,4,181,25,9,106,92,1,128,1,8,209,20,56,67,
+218,34,71,32,0,127,1,75,255,255,206,58,63,64,10,78,44,2,98,27,9,127,1,11,170,158,6,114,4,7,14,3,9,146,214,0,14,144,22,155,
+238,16,35,230,68,97,245,32,114,206,206,52,4,231,42,10,205,25,11,128,1,48,128,67,58,131,71,20,87,5,16,33,53,194,67,0,4,153,
+169,6,1,0,2,2,14,0,114,146,2,123,163,2,59,15,0,106,90,4,190,20,9,128,1,1,23,69,2,233,4,0,195,32,11,219,23,15,128,1,11,11,
+102,172,7,147,68,11,210,52,5,154,46,0,253,3,7,248,73,0,127,1,14,255,64,14,128,1,8,205,129,11,12,49,13,90,118,9,14,0,2,228,
+5,1,57,41,6,95,55,5,117,7,0,2,74,1,129,1,4,49,130,2,179,72,2,76,24,10,128,1,2,9,98,0,200,2,4,144,26,4,182,31,0,97,0,17,167,
+245,0,3,200,2,8,23,1,4,16,14,6,54,127,12,128,1,38,53,72,77,2,25,101,101,144,15,128,1,0,3,97,118,6,182,42,7,129,1,4,116,47,
+7,233,236,5,0,6,4,137,47,2,226,7,5,142,1,6,127,1,12,91,22,11,135,0,8,156,48,9,128,1,4,225,22,15,128,1,5,1,72,20,1,153,56,
+6,171,162,9,212,8,2,129,1,7,252,5,3,8,0,12,128,1,0,159,42,8,131,8,34,34,194,219,2,34,194,231,9,23,145,101,194,114,128,155,
+58,94,230,53,45,29,10,204,0,0,251,2,8,74,50,10,128,4,11,84,189,12,23,33,15,0,3,4,7,172,165,9,228,2,4,241,9,8,58,54,4,130,
+4,3,123,4,5,8,194,8,127,1,4,132,1,15,128,7,4,12,249,23,8,14,0,7,128,4,3,194,9,2,156,6,9,88,30,2,148,50,3,88,251,17,218,244,
+249,10,129,1,5,212,0,2,205,25,6,128,1,18,193,252,237,1,204,10,16,140,145,234,1,204,0,36,38,130,99,92,7,128,1,83,128,130,
+142,181,128,8,181,8,150,2,4,4,6,15,128,1,6,6,214,94,15,0,6,13,1,119,33,8,165,104,8,126,240,2,77,50,1,163,74,1,49,0,6,171,
+70,10,16,25,2,208,68,1,225,0,11,18,46,15,0,9,6,10,202,126,7,16,3,5,235,125,1,79,68,2,83,128,1,140,0,4,156,11,7,18,178,34,
+34,206,88,203,7,183,171,65,67,243,128,155,212,2,6,112,94,3,191,24,4,101,3,3,114,32,1,217,148,35,140,140,46,28,34,19,130,
+126,25,72,58,140,140,58,128,1,18,128,30,221,13,226,11,8,106,66,11,0,9,12,128,1,11,219,23,15,0,3,4,6,56,1,6,74,238,1,51,26,
+1,255,0,3,146,27,6,0,3,11,172,4,2,78,143,13,3,252,8,46,22,12,38,24,9,129,1,15,128,10,1,1,80,78,7,162,169,8,182,45,4,52,49,
+3,214,1,22,38,128,1,2,41,156,9,143,178,5,1,0,0,251,175,5,142,61,0,73,8,0,155,31,16,140,17,37,0,173,151,1,77,0,0,143,74,16,
+115,158,33,6,0,3,10,75,76,9,155,64,15,0,12,2,15,0,3,0,10,219,23,8,128,1,48,67,243,94,245,176,39,255,94,136,49,6,153,52,3,
+137,33,0,51,12,4,53,10,6,128,10,13,68,21,4,253,248,15,128,1,1,15,38,24,0,9,129,1,8,9,223,4,130,12,2,74,61,6,104,120,5,132,
+40,0,68,1,2,255,176,18,206,180,105,7,0,3,2,129,1,9,135,218,15,128,1,1,11,83,7,1,75,66,82,114,167,94,255,167,243,75,0,123,
+9,16,156,190,102,32,243,101,28,63,11,128,7,12,1,3,5,8,4,15,161,18,0,15,128,1,12,6,75,62,9,169,150,15,234,18,2,8,50,56,11,
+226,8,3,186,58,15,114,46,27,9,248,33,3,130,4,4,72,64,3,61,158,3,82,63,2,150,131,7,230,74,4,85,10,4,214,4,12,249,85,15,137,
+0,3,8,128,1,12,1,0,33,67,167,1,12,33,130,38,168,149,15,92,25,31,15,1,0,5,15,219,44,131,3,116,1,15,214,23,5,5,90,120,2,106,
+4,4,14,0,13,60,1,15,123,27,1,15,1,0,255,151,15,232,190,9,12,9,227,15,1,0,19,15,214,224,112,15,1,0,14,9,111,28,15,64,195,
+20,15,1,0,50,5,99,9,5,204,42,15,126,44,0,4,1,0,12,120,208,7,189,0,50,255,255,94,51,15,9,13,0,3,53,0,13,252,12,4,20,85,3,
+13,0,3,202,10,11,246,0,0,13,8,7,168,4,7,30,79,15,59,46,11,15,78,0,3,3,83,0,24,94,14,33,7,135,17,7,69,8,6,3,1,4,29,1,6,28,
+41,5,212,13,15,128,5,14,7,143,91,15,21,30,4,1,67,10,6,121,7,6,38,13,0,167,8,4,14,156,12,84,0,13,53,80,5,84,91,18,94,84,104,
+9,13,0,3,197,0,13,123,141,8,102,162,0,135,0,2,173,35,19,219,89,5,5,169,83,9,228,10,8,158,80,9,233,8,12,175,5,10,78,0,15,
+128,1,5,6,233,105,4,224,18,3,179,0,6,10,8,5,164,0,1,18,6,8,164,1,2,6,91,15,7,2,0,4,172,25,3,135,87,6,1,92,13,84,6,1,40,10,
+13,67,13,4,38,10,4,5,132,13,116,34,9,86,96,3,57,3,6,100,40,6,1,106,6,137,16,5,200,1,15,128,1,14,0,5,187,4,91,0,39,230,128,
+59,237,1,239,12,2,128,1,3,164,33,9,187,0,6,113,180,2,41,133,8,78,0,3,236,0,4,233,97,7,21,7,0,149,20,5,219,45,3,219,111,15,
+128,1,9,3,89,87,11,164,1,12,127,1,4,214,122,8,59,88,12,204,34,6,32,42,11,196,48,3,69,11,9,10,134,5,69,2,0,223,15,32,67,243,
+5,41,4,54,97,5,228,12,5,115,1,6,50,1,6,60,16,10,107,74,15,128,1,10,2,63,11,10,79,39,15,128,1,0,1,173,3,9,128,1,3,191,5,2,
+209,10,10,78,0,7,147,12,5,180,0,3,235,0,5,128,1,9,132,188,15,128,1,4,7,164,1,4,164,111,2,203,124,11,127,1,2,183,0,1,121,
+1,19,155,3,146,5,23,0,8,126,1,13,254,94,3,217,1,4,127,1,11,214,53,3,247,21,16,155,137,115,4,191,40,7,145,14,4,146,45,7,141,
+4,13,178,5,15,128,1,14,5,134,3,9,236,14,15,128,1,17,2,18,1,4,19,115,9,78,0,7,123,62,2,180,14,6,88,38,15,128,1,26,2,36,0,
+2,128,1,3,171,195,12,0,3,6,156,47,5,230,74,6,146,43,12,202,15,4,212,143,64,255,255,94,82,144,40,1,243,2,48,218,86,156,163,
+14,1,179,17,13,246,24,0,44,0,0,169,41,13,40,24,6,173,113,12,13,0,5,167,1,11,91,137,15,128,1,2,4,227,90,8,30,92,15,128,1,
+2,1,120,19,10,128,4,8,70,26,9,78,0,3,25,0,2,141,4,4,93,144,3,107,5,15,128,1,1,4,49,46,39,140,140,164,0,11,128,1,7,124,43,
+15,128,1,4,3,128,4,5,133,24,7,229,69,8,83,15,2,149,13,17,68,195,95,1,89,5,19,194,204,96,10,128,1,7,10,129,26,231,59,32,9,
+32,31,8,141,7,4,54,0,33,67,243,222,145,23,68,91,114,15,128,1,6,3,13,0,15,47,146,0,3,128,1,6,65,0,14,34,13,7,247,1,10,91,
+0,3,128,1,7,246,232,3,80,2,6,128,1,8,88,0,5,220,2,11,128,1,9,36,0,3,84,15,15,204,165,3,3,69,3,7,114,103,13,144,122,6,133,
+0,3,76,39,4,236,114,17,130,161,17,21,243,85,171,7,171,1,1,91,6,7,148,185,15,128,1,18,0,238,19,2,168,168,10,123,94,13,128,
+1,4,245,75,20,94,102,240,18,128,53,19,9,128,1,9,179,8,11,29,22,7,48,33,15,128,1,2,4,52,19,5,142,3,4,136,2,11,183,187,0,134,
+190,2,115,189,7,138,170,11,128,1,4,136,3,15,76,173,3,3,46,7,6,178,101,13,192,89,8,130,18,11,0,12,2,127,1,2,242,117,10,224,
+9,1,176,0,39,194,194,21,9,15,128,1,5,4,143,78,2,206,0,3,253,4,0,207,0,13,128,1,1,78,8,12,0,3,3,216,4,2,108,12,4,47,100,3,
+195,8,7,120,11,11,128,1,7,4,46,15,128,1,2,1,93,93,3,233,247,0,66,8,8,133,74,9,92,1,16,94,90,10,32,230,34,228,17,15,128,1,
+12,9,43,142,8,71,0,3,120,93,7,82,38,14,128,1,4,200,0,17,87,246,25,19,94,129,37,2,232,26,8,201,11,13,202,5,15,199,33,0,15,
+128,4,8,8,229,45,2,179,46,1,252,43,2,115,1,93,179,206,86,243,94,0,3,3,72,25,3,221,23,3,223,71,6,226,238,15,249,6,1,2,127,
+1,1,54,220,9,213,26,3,240,21,5,60,43,7,128,1,12,80,4,6,178,0,2,12,12,9,60,96,15,128,1,2,10,177,142,11,11,0,8,205,6,15,128,
+1,2,7,7,50,6,221,205,36,34,230,247,155,8,232,48,7,85,3,39,194,53,76,23,15,0,3,16,9,118,176,3,124,22,2,97,35,0,162,196,1,
+13,0,30,94,0,6,2,195,106,3,94,5,1,5,30,4,252,49,15,0,3,5,2,91,0,5,195,71,11,128,1,4,41,4,12,122,72,4,160,5,11,88,6,5,91,
+50,1,24,0,2,61,125,13,128,1,6,25,4,6,34,58,8,11,0,6,128,1,6,187,81,7,128,1,11,111,37,4,124,46,1,199,125,6,181,13,11,66,14,
+11,255,17,5,91,80,15,0,3,9,7,128,16,4,137,13,3,102,177,2,158,30,62,67,243,219,128,7,9,130,20,8,190,9,8,248,15,9,72,84,2,
+77,26,3,114,103,13,128,1,3,38,45,11,79,16,5,35,30,13,216,7,4,255,22,7,66,23,14,128,1,8,194,35,7,79,24,12,6,51,15,51,17,2,
+7,21,40,10,61,51,7,81,37,13,75,185,14,34,193,3,62,26,15,128,1,20,7,219,41,0,128,5,7,13,0,13,52,0,11,103,0,15,232,6,7,15,
+217,39,1,15,78,0,8,8,0,18,6,90,53,10,1,0,2,3,1,15,96,23,25,0,167,26,13,11,0,15,112,238,60,15,14,107,3,15,1,0,17,15,120,24,
+6,15,151,0,50,15,89,117,27,11,128,1,15,88,241,14,15,1,0,255,255,29,15,236,215,128,15,217,27,6,9,1,0,6,44,4,14,245,6,15,228,
+0,76,8,202,95,4,18,0,15,110,5,3,5,53,18,6,189,10,3,130,18,3,95,8,10,150,70,3,66,8,3,123,7,13,171,18,15,8,1,5,8,213,116,12,
+197,120,13,137,251,15,202,0,7,5,146,223,10,251,22,15,72,6,4,5,128,1,3,189,91,9,26,0,10,121,126,15,84,28,59,15,138,102,0,
+71,34,181,19,167,60,39,8,26,0,3,186,224,6,210,30,4,77,143,5,128,1,9,242,152,5,111,233,8,100,7,15,93,2,9,6,101,85,3,139,134,
+11,56,6,7,92,63,10,34,208,1,1,0,8,15,55,5,173,111,11,123,18,15,128,1,13,4,212,18,9,143,141,12,185,20,15,129,1,55,15,233,
+78,1,48,19,194,101,27,13,52,94,94,140,205,7,4,212,7,4,111,38,6,139,47,5,77,143,4,115,12,6,240,12,2,216,61,7,158,110,7,117,
+21,15,1,0,4,1,148,65,3,175,208,2,86,112,11,45,0,5,97,46,15,215,225,1,8,66,28,10,28,118,5,48,20,15,92,9,0,4,87,15,6,128,1,
+3,123,14,0,22,93,3,178,16,11,16,3,1,234,41,14,247,7,15,204,7,33,11,55,163,4,103,1,1,152,50,16,140,10,36,2,157,0,3,193,0,
+7,1,63,7,206,42,4,201,165,6,232,10,4,2,166,4,84,158,6,67,72,13,8,14,1,195,10,4,146,8,8,91,161,1,73,207,10,227,2,3,78,1,6,
+174,63,5,249,118,4,211,71,8,69,35,6,75,93,2,219,138,7,0,3,7,238,20,3,26,24,13,128,1,1,5,2,9,132,84,6,215,11,8,118,40,6,150,
+11,15,194,148,7,15,1,0,6,8,149,0,8,246,95,0,128,1,6,54,107,6,138,4,6,246,77,5,222,67,2,240,13,3,126,142,6,141,14,3,190,5,
+2,11,0,7,21,14,14,128,1,2,37,50,4,73,14,8,22,50,47,243,156,51,26,0,4,60,19,6,254,44,16,34,88,41,3,24,68,0,106,40,7,108,220,
+11,129,69,4,14,0,35,34,230,91,100,6,26,24,5,86,1,4,109,13,1,128,1,1,67,49,5,221,61,9,4,54,8,102,139,4,124,5,15,128,1,23,
+3,27,158,6,81,2,6,62,1,1,31,17,1,78,2,3,139,15,22,155,9,6,7,180,72,4,180,239,2,91,15,2,106,1,5,128,1,10,0,3,2,214,195,9,
+128,1,3,25,28,2,133,15,5,129,1,5,202,102,11,240,135,8,39,16,7,171,6,2,13,31,5,127,1,6,66,65,5,127,1,10,49,0,5,104,210,1,
+253,13,6,96,23,13,128,1,3,47,139,1,128,1,6,46,67,5,157,220,5,42,0,3,97,8,5,90,27,15,128,1,22,4,145,14,6,203,96,8,51,7,1,
+106,0,2,161,52,16,94,152,64,35,206,19,173,16,8,69,30,3,246,92,9,253,19,1,103,44,16,169,144,0,3,0,6,15,50,19,0,3,0,3,1,129,
+1,4,4,17,4,129,1,8,128,1,8,35,26,0,66,43,4,192,28,9,17,76,2,78,151,3,127,1,6,255,4,7,203,100,5,237,224,6,72,1,1,50,0,1,139,
+44,14,128,1,11,128,4,0,2,7,6,213,71,2,129,1,8,170,1,7,206,151,15,90,8,13,13,200,3,7,253,75,6,64,45,5,206,45,6,248,48,9,40,
+1,10,145,127,5,158,29,1,105,124,8,128,1,6,244,20,1,170,118,14,128,1,0,89,0,5,143,51,0,65,1,1,100,0,10,91,167,6,246,57,0,
+43,1,3,69,1,8,195,56,1,1,50,0,202,48,5,213,5,3,242,125,8,194,41,4,37,65,5,28,146,33,19,87,169,7,47,19,87,128,1,18,7,0,9,
+5,184,171,4,128,1,5,39,21,8,61,1,15,127,1,20,5,236,65,6,128,7,8,4,11,7,246,45,21,94,171,19,6,179,75,5,78,2,3,7,2,2,128,4,
+6,128,1,8,78,142,3,46,169,12,0,6,8,58,215,4,98,3,2,128,1,1,146,8,7,176,195,9,247,30,6,58,19,4,47,72,0,129,1,12,241,125,9,
+67,43,3,108,56,5,107,8,0,112,0,1,180,1,15,128,1,27,6,103,3,9,86,127,7,129,1,15,128,1,19,9,18,4,8,35,197,5,1,0,9,171,114,
+7,133,128,5,115,11,8,205,3,3,140,73,3,28,25,24,169,17,21,2,56,1,3,11,96,15,10,20,6,6,127,1,8,128,1,6,0,3,3,152,82,0,7,0,
+10,0,3,4,149,9,7,129,1,5,43,2,4,156,173,0,38,10,3,86,3,4,108,2,10,143,115,3,26,24,15,128,1,15,5,176,192,4,128,1,5,108,9,
+5,129,1,15,110,19,33,10,218,119,11,219,0,1,1,0,2,51,231,8,115,2,6,127,1,4,7,8,13,128,1,5,150,42,4,83,1,7,129,34,10,113,12,
+9,127,1,9,44,6,11,163,196,6,101,2,0,175,63,7,14,20,6,129,1,7,177,21,2,244,34,0,189,8,20,86,227,12,3,172,12,3,138,38,4,150,
+126,6,187,9,3,180,9,4,223,2,2,124,206,4,255,28,5,5,10,5,222,167,6,42,11,4,129,1,15,238,20,34,8,29,10,3,18,0,1,0,15,15,42,
+0,2,5,69,26,6,46,17,3,123,8,12,128,1,5,85,217,4,4,123,5,149,24,15,11,21,7,15,128,1,14,4,23,54,15,142,21,5,8,243,56,1,28,
+26,7,89,1,11,245,60,7,130,2,4,229,28,4,34,24,6,62,131,6,90,38,10,176,2,15,230,18,76,11,27,83,2,1,0,8,24,79,6,135,25,4,77,
+143,13,128,1,4,177,58,4,168,3,4,238,97,15,88,187,40,5,129,1,15,104,2,6,9,182,25,4,253,182,15,113,0,18,5,7,78,15,199,11,14,
+12,63,96,15,1,0,120,79,19,206,230,128,115,24,58,15,1,0,29,15,183,3,1,15,128,1,19,15,32,20,21,9,58,28,15,1,0,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,188,0
+};
 static int fontawesome_char_data[] = {32,40,240,3,15,-1,0,4,160,44,240,3,15,-1,0,4,168,56,240,3,15,-1,0,15,169,380,0,3,15,-1,0,15,174,380,208,3,15,-1,0,15,180,348,224,3,15,-1,0,15,198,352,224,3,15,-1,0,15,8192,356,224,3,15,-1,0,6,8193,360,224,3,15,-1,0,13,8194,364,224,3,15,-1,0,6,8195,368,224,3,15,-1,0,13,8196,372,224,3,15,-1,0,4,8197,376,224,3,15,-1,0,3,8198,380,224,3,15,-1,0,2,8199,0,240,3,15,-1,0,2,8200,4,240,3,15,-1,0,2,8201,8,240,3,15,-1,0,3,8202,12,240,3,15,-1,0,1,8239,16,240,3,15,-1,0,3,8287,20,240,3,15,-1,0,3,8482,24,240,3,15,-1,0,15,8734,28,240,3,15,-1,0,15,8800,32,240,3,15,-1,0,15,57344,36,240,3,15,-1,0,4,61440,80,112,15,15,0,0,15,61441,96,112,15,15,-1,0,13,61442,170,64,16,15,-1,0,14,61443,36,32,17,15,-1,0,15,61444,54,32,17,15,-1,0,15,61445,187,64,16,15,-1,0,14,61446,204,64,16,15,-1,0,14,61447,75,192,14,15,-1,0,12,61448,0,0,18,15,-1,0,16,61449,238,64,16,15,-1,0,14,61450,162,32,17,15,-1,0,15,61451,180,32,17,15,-1,0,15,61452,128,112,15,15,0,0,15,61453,214,208,12,15,0,0,12,61454,255,64,16,15,-1,0,14,61456,272,64,16,15,-1,0,14,61457,160,112,15,15,-1,0,13,61458,270,32,17,15,-1,0,15,61459,176,112,15,15,-1,0,13,61460,105,192,14,15,-1,0,12,61461,120,192,14,15,0,0,14,61462,227,208,12,15,-1,0,11,61463,240,112,15,15,-1,0,13,61464,357,64,16,15,0,0,16,61465,340,64,16,15,-1,0,14,61466,256,112,15,15,-1,0,13,61467,272,112,15,15,-1,0,13,61468,288,112,15,15,-1,0,13,61469,304,112,15,15,-1,0,13,61470,320,112,15,15,-1,0,13,61473,336,112,15,15,-1,0,13,61474,18,48,17,15,-1,0,15,61475,312,208,11,15,-1,0,9,61476,153,80,16,15,0,0,15,61477,17,80,16,15,-1,0,14,61478,266,224,8,15,-1,0,6,61479,240,208,11,15,-1,0,9,61480,272,80,16,15,-1,0,14,61481,112,176,14,15,-1,0,12,61482,234,16,17,15,-1,0,15,61483,180,192,14,15,-1,0,13,61484,95,0,18,15,-1,0,16,61485,170,80,16,15,-1,0,14,61486,123,208,12,15,-1,0,11,61487,0,80,16,15,-1,0,14,61488,57,0,18,15,-1,0,16,61489,136,80,16,15,-1,0,14,61490,210,192,14,15,-1,0,12,61491,55,224,10,15,-1,0,8,61492,144,48,17,15,-1,0,15,61493,96,128,15,15,-1,0,13,61494,162,48,17,15,-1,0,15,61495,180,48,17,15,-1,0,15,61496,198,48,17,15,-1,0,15,61497,216,48,17,15,-1,0,15,61498,234,48,17,15,-1,0,15,61499,252,48,17,15,-1,0,15,61500,270,48,17,15,-1,0,15,61501,72,48,17,15,-1,0,15,61502,323,0,18,15,-1,0,16,61504,240,192,14,15,-1,0,13,61505,99,224,10,15,-1,0,8,61506,144,128,15,15,-1,0,13,61507,373,96,10,15,-1,0,8,61508,324,48,17,15,-1,0,15,61509,102,80,16,15,-1,0,14,61510,119,80,16,15,-1,0,14,61511,0,16,17,15,-1,0,15,61512,110,224,10,15,-1,0,8,61513,54,16,17,15,-1,0,15,61514,192,128,15,15,0,0,14,61515,42,208,13,15,-1,0,12,61516,224,128,15,15,-1,0,13,61517,240,128,15,15,-1,0,13,61518,256,128,15,15,-1,0,14,61520,18,32,17,15,-1,0,15,61521,77,224,10,15,-1,0,8,61522,288,128,15,15,-1,0,13,61523,226,224,9,15,0,0,9,61524,66,224,10,15,0,0,9,61525,336,128,15,15,-1,0,13,61526,352,128,15,15,-1,0,13,61527,368,128,15,15,-1,0,13,61528,0,144,15,15,-1,0,13,61529,16,144,15,15,-1,0,13,61530,32,144,15,15,-1,0,13,61531,48,144,15,15,-1,0,13,61532,64,144,15,15,-1,0,13,61533,80,144,15,15,-1,0,13,61534,96,144,15,15,-1,0,13,61536,285,192,14,15,0,0,13,61537,292,176,14,15,-1,0,13,61538,307,176,14,15,0,0,14,61539,337,176,14,15,0,0,14,61540,72,32,17,15,-1,0,15,61541,176,144,15,15,-1,0,13,61542,352,176,14,15,-1,0,13,61543,255,192,14,15,-1,0,12,61544,127,176,14,15,-1,0,12,61545,142,176,14,15,0,0,14,61546,256,144,15,15,-1,0,13,61547,272,144,15,15,-1,0,13,61548,54,48,17,15,-1,0,15,61549,157,176,14,15,-1,0,12,61550,234,32,17,15,-1,0,15,61552,252,32,17,15,-1,0,15,61553,288,32,17,15,-1,0,15,61554,162,208,12,15,0,0,12,61555,342,48,16,15,-1,0,14,61556,18,16,17,15,-1,0,15,61557,36,16,17,15,-1,0,15,61558,304,144,15,15,-1,0,13,61559,0,192,14,15,0,0,14,61560,247,176,14,15,0,0,14,61561,133,0,18,15,-1,0,16,61562,34,64,16,15,-1,0,14,61563,51,64,16,15,-1,0,14,61564,144,16,17,15,-1,0,16,61565,318,224,7,15,0,0,6,61566,180,16,17,15,-1,0,15,61568,247,0,18,15,-1,0,16,61569,320,144,15,15,-1,0,13,61570,336,144,15,15,-1,0,13,61571,126,32,17,15,-1,0,15,61572,119,64,16,15,-1,0,15,61573,342,0,18,15,-1,0,16,61574,270,16,17,15,-1,0,15,61575,352,144,15,15,-1,0,13,61576,368,144,15,15,-1,0,13,61577,374,80,9,15,-1,0,7,61578,342,16,17,15,-1,0,15,61579,0,160,15,15,-1,0,14,61580,16,160,15,15,-1,0,13,61581,264,208,11,15,-1,0,9,61582,198,32,17,15,-1,0,15,61584,32,160,15,15,-1,0,13,61585,289,64,16,15,-1,0,14,61586,48,160,15,15,-1,0,13,61587,306,64,16,15,-1,0,14,61588,64,160,15,15,-1,0,13,61589,262,176,14,15,-1,0,12,61590,270,192,14,15,-1,0,12,61591,136,208,12,15,-1,0,11,61592,80,160,15,15,-1,0,13,61593,217,176,14,15,0,0,14,61594,284,224,8,15,-1,0,6,61595,96,160,15,15,-1,0,13,61596,221,80,16,15,-1,0,14,61597,114,0,18,15,-1,0,16,61598,195,192,14,15,-1,0,12,61600,112,160,15,15,-1,0,13,61601,36,48,17,15,-1,0,15,61602,68,80,16,15,-1,0,14,61603,128,160,15,15,-1,0,13,61604,108,48,17,15,-1,0,15,61605,126,48,17,15,-1,0,15,61606,144,160,15,15,-1,0,13,61607,160,160,15,15,-1,0,13,61608,176,160,15,15,-1,0,13,61609,192,160,15,15,-1,0,13,61610,208,160,15,15,-1,0,13,61611,224,160,15,15,-1,0,13,61612,240,160,15,15,-1,0,13,61613,256,160,15,15,0,0,14,61614,72,16,17,15,-1,0,15,61616,70,208,13,15,-1,0,12,61617,90,16,17,15,-1,0,15,61618,272,160,15,15,-1,0,13,61632,361,0,18,15,-1,0,16,61633,323,64,16,15,-1,0,14,61634,285,0,18,15,-1,0,16,61635,225,192,14,15,0,0,14,61636,126,16,17,15,-1,0,15,61637,162,16,17,15,-1,0,15,61638,370,192,13,15,-1,0,12,61639,288,160,15,15,-1,0,13,61640,304,160,15,15,-1,0,13,61641,320,160,15,15,-1,0,13,61642,216,16,17,15,-1,0,15,61643,252,16,17,15,-1,0,15,61644,288,16,17,15,-1,0,15,61645,336,160,15,15,-1,0,13,61646,68,96,16,15,-1,0,14,61648,352,160,15,15,-1,0,14,61649,204,80,16,15,0,0,15,61650,368,160,15,15,-1,0,13,61651,0,176,15,15,-1,0,13,61652,16,176,15,15,-1,0,13,61653,289,80,16,15,-1,0,14,61654,209,0,18,15,-1,0,16,61655,22,224,10,15,-1,0,8,61656,0,224,10,15,-1,0,8,61657,341,224,6,15,0,0,5,61658,326,224,7,15,-1,0,5,61659,85,64,16,15,-1,0,14,61660,347,208,10,15,-1,0,8,61661,336,208,10,15,-1,0,8,61662,374,64,9,15,0,0,8,61664,360,16,17,15,-1,0,15,61665,32,176,15,15,-1,0,13,61666,48,176,15,15,-1,0,13,61667,64,176,15,15,0,0,15,61668,306,32,17,15,-1,0,15,61669,360,32,17,15,-1,0,15,61670,0,48,17,15,-1,0,15,61671,216,224,9,15,-1,0,7,61672,90,48,17,15,-1,0,15,61673,0,96,16,15,-1,0,14,61674,288,48,17,15,-1,0,15,61675,358,208,10,15,-1,0,8,61676,306,48,17,15,-1,0,15,61677,190,0,18,15,-1,0,16,61678,171,0,18,15,-1,0,16,61680,30,192,14,15,-1,0,12,61681,342,192,13,15,-1,0,12,61682,108,16,17,15,-1,0,15,61683,51,80,16,15,-1,0,14,61684,198,16,17,15,-1,0,16,61685,322,176,14,15,-1,0,12,61686,149,208,12,15,-1,0,11,61687,172,176,14,15,-1,0,12,61688,135,192,14,15,-1,0,12,61689,90,32,17,15,0,0,16,61690,108,32,17,15,-1,0,15,61691,0,32,17,15,-1,0,16,61692,80,176,15,15,0,0,14,61693,96,176,15,15,-1,0,13,61694,85,96,15,15,-1,0,13,61696,206,224,9,15,0,0,8,61697,143,224,10,15,-1,0,8,61698,256,224,9,15,0,0,9,61699,44,224,10,15,0,0,9,61700,334,224,6,15,0,0,5,61701,310,224,7,15,-1,0,5,61702,176,224,9,15,0,0,9,61703,132,224,10,15,0,0,9,61704,38,0,18,15,-1,0,16,61705,152,0,18,15,-1,0,16,61706,300,208,11,15,-1,0,9,61707,293,224,8,15,-1,0,6,61708,117,96,15,15,-1,0,13,61709,238,80,16,15,-1,0,14,61710,187,80,16,15,-1,0,14,61712,133,96,15,15,-1,0,13,61713,149,96,15,15,-1,0,13,61714,306,16,17,15,-1,0,15,61715,85,80,16,15,-1,0,14,61716,255,80,16,15,-1,0,14,61717,76,0,18,15,-1,0,16,61718,48,240,3,15,-1,0,15,61719,52,240,3,15,-1,0,15,61720,165,96,15,15,-1,0,13,61721,181,96,15,15,-1,0,13,61722,197,96,15,15,-1,0,13,61723,228,0,18,15,-1,0,16,61724,304,0,18,15,-1,0,16,61725,153,64,16,15,0,0,15,61726,136,64,16,15,0,0,15,61728,102,64,16,15,-1,0,14,61729,359,48,16,15,0,0,16,61730,144,32,17,15,-1,0,15,61731,340,80,16,15,-1,0,14,61732,0,208,13,15,-1,0,12,61733,323,80,16,15,-1,0,14,61734,33,224,10,15,-1,0,8,61735,34,80,16,15,-1,0,14,61736,196,224,9,15,0,0,8,61737,302,224,7,15,-1,0,5,61738,378,16,5,15,0,0,5,61739,213,96,15,15,-1,0,13,61740,229,96,15,15,-1,0,13,61741,266,0,18,15,-1,0,16,61742,357,80,16,15,-1,0,14,61744,288,208,11,15,-1,0,9,61745,28,208,13,15,-1,0,12,61746,175,208,12,15,-1,0,11,61747,34,96,16,15,-1,0,14,61748,150,192,14,15,-1,0,12,61749,245,96,15,15,0,0,14,61750,17,96,16,15,-1,0,15,61751,261,96,15,15,-1,0,13,61752,277,96,15,15,-1,0,13,61753,293,96,15,15,-1,0,13,61754,309,96,15,15,-1,0,13,61755,202,176,14,15,-1,0,12,61756,51,96,16,15,0,0,15,61757,342,32,17,15,-1,0,15,61758,276,208,11,15,-1,0,9,61760,325,96,15,15,-1,0,13,61761,277,176,14,15,-1,0,12,61762,378,32,5,15,-1,0,3,61763,341,96,15,15,-1,0,13,61764,357,96,15,15,-1,0,13,61765,101,96,15,15,0,0,15,61766,0,112,15,15,-1,0,13,61767,367,176,14,15,-1,0,12,61768,369,208,10,15,-1,0,8,61769,121,224,10,15,-1,0,8,61770,16,112,15,15,-1,0,13,61771,32,112,15,15,-1,0,13,61772,48,112,15,15,-1,0,13,61773,64,112,15,15,-1,0,13,61774,112,112,15,15,-1,0,13,61776,144,112,15,15,-1,0,13,61777,192,112,15,15,-1,0,13,61778,208,112,15,15,-1,0,13,61779,11,224,10,15,-1,0,8,61780,154,224,10,15,-1,0,8,61781,236,224,9,15,0,0,8,61782,246,224,9,15,-1,0,7,61783,165,224,10,15,-1,0,8,61784,188,208,12,15,-1,0,11,61785,324,32,17,15,-1,0,15,61786,252,208,11,15,0,0,11,61787,84,208,12,15,-1,0,11,61788,97,208,12,15,-1,0,11,61789,224,112,15,15,0,0,14,61790,352,112,15,15,0,0,14,61792,306,80,16,15,0,0,15,61793,221,64,16,15,0,0,15,61794,314,192,13,15,0,0,13,61795,328,192,13,15,0,0,13,61796,368,112,15,15,-1,0,14,61797,0,128,15,15,-1,0,14,61798,16,128,15,15,-1,0,13,61799,60,192,14,15,-1,0,13,61800,90,192,14,15,-1,0,12,61801,32,128,15,15,-1,0,13,61802,324,16,17,15,-1,0,15,61803,48,128,15,15,0,0,15,61804,356,192,13,15,-1,0,12,61805,64,128,15,15,-1,0,13,61806,80,128,15,15,-1,0,13,61808,112,128,15,15,-1,0,13,61809,14,208,13,15,-1,0,12,61810,128,128,15,15,-1,0,13,61811,186,224,9,15,0,0,8,61812,160,128,15,15,-1,0,13,61813,275,224,8,15,-1,0,6,61814,376,48,7,15,0,0,6,61815,68,64,16,15,0,0,15,61816,17,64,16,15,-1,0,15,61817,300,192,13,15,-1,0,12,61818,0,64,16,15,-1,0,14,61819,15,192,14,15,-1,0,12,61820,45,192,14,15,-1,0,13,61821,176,128,15,15,-1,0,13,61822,208,128,15,15,-1,0,13,61824,272,128,15,15,-1,0,14,61825,304,128,15,15,-1,0,13,61826,110,208,12,15,-1,0,11,61827,88,224,10,15,-1,0,8,61828,320,128,15,15,-1,0,13,61829,112,144,15,15,0,0,15,61830,187,176,14,15,-1,0,13,61831,128,144,15,15,0,0,15,61832,165,192,14,15,0,0,14,61833,19,0,18,15,-1,0,16,61834,216,32,17,15,-1,0,15,61835,144,144,15,15,-1,0,13,61836,56,208,13,15,-1,0,12,61837,201,208,12,15,-1,0,11,61838,160,144,15,15,-1,0,13,61840,192,144,15,15,-1,0,13,61841,208,144,15,15,-1,0,13,61842,224,144,15,15,-1,0,13,61843,240,144,15,15,-1,0,14,61844,288,144,15,15,-1,0,13,61845,324,208,11,15,-1,0,9,61846,232,176,14,15,-1,0,12,61847,60,240,3,15,-1,0,15,61848,64,240,3,15,-1,0,15,61849,68,240,3,15,-1,0,15,61850,72,240,3,15,-1,0,15,61851,76,240,3,15,-1,0,15,61852,80,240,3,15,-1,0,15,61853,84,240,3,15,-1,0,15,61854,88,240,3,15,-1,0,15,62720,92,240,3,15,-1,0,15,119155,96,240,3,15,-1,0,4,119156,100,240,3,15,-1,0,4,119157,104,240,3,15,-1,0,4,119158,108,240,3,15,-1,0,4,119159,112,240,3,15,-1,0,4,119160,116,240,3,15,-1,0,4,119161,120,240,3,15,-1,0,4,119162,124,240,3,15,-1,0,4,917505,128,240,3,15,-1,0,4,917536,132,240,3,15,-1,0,4,917537,136,240,3,15,-1,0,4,917538,140,240,3,15,-1,0,4,917539,144,240,3,15,-1,0,4,917540,148,240,3,15,-1,0,4,917541,152,240,3,15,-1,0,4,917542,156,240,3,15,-1,0,4,917543,160,240,3,15,-1,0,4,917544,164,240,3,15,-1,0,4,917545,168,240,3,15,-1,0,4,917546,172,240,3,15,-1,0,4,917547,176,240,3,15,-1,0,4,917548,180,240,3,15,-1,0,4,917549,184,240,3,15,-1,0,4,917550,188,240,3,15,-1,0,4,917551,192,240,3,15,-1,0,4,917552,196,240,3,15,-1,0,4,917553,200,240,3,15,-1,0,4,917554,204,240,3,15,-1,0,4,917555,208,240,3,15,-1,0,4,917556,212,240,3,15,-1,0,4,917557,216,240,3,15,-1,0,4,917558,220,240,3,15,-1,0,4,917559,224,240,3,15,-1,0,4,917560,228,240,3,15,-1,0,4,917561,232,240,3,15,-1,0,4,917562,236,240,3,15,-1,0,4,917563,240,240,3,15,-1,0,4,917564,244,240,3,15,-1,0,4,917565,248,240,3,15,-1,0,4,917566,252,240,3,15,-1,0,4,917567,256,240,3,15,-1,0,4,917568,260,240,3,15,-1,0,4,917569,264,240,3,15,-1,0,4,917570,268,240,3,15,-1,0,4,917571,272,240,3,15,-1,0,4,917572,276,240,3,15,-1,0,4,917573,280,240,3,15,-1,0,4,917574,284,240,3,15,-1,0,4,917575,288,240,3,15,-1,0,4,917576,292,240,3,15,-1,0,4,917577,296,240,3,15,-1,0,4,917578,300,240,3,15,-1,0,4,917579,304,240,3,15,-1,0,4,917580,308,240,3,15,-1,0,4,917581,312,240,3,15,-1,0,4,917582,316,240,3,15,-1,0,4,917583,320,240,3,15,-1,0,4,917584,324,240,3,15,-1,0,4,917585,328,240,3,15,-1,0,4,917586,332,240,3,15,-1,0,4,917587,336,240,3,15,-1,0,4,917588,340,240,3,15,-1,0,4,917589,344,240,3,15,-1,0,4,917590,348,240,3,15,-1,0,4,917591,352,240,3,15,-1,0,4,917592,356,240,3,15,-1,0,4,917593,360,240,3,15,-1,0,4,917594,364,240,3,15,-1,0,4,917595,368,240,3,15,-1,0,4,917596,372,240,3,15,-1,0,4,917597,376,240,3,15,-1,0,4,917598,380,240,3,15,-1,0,4,917599,128,0,3,15,-1,0,4,917600,124,0,3,15,-1,0,4,917601,120,0,3,15,-1,0,4,917602,116,0,3,15,-1,0,4,917603,112,0,3,15,-1,0,4,917604,108,0,3,15,-1,0,4,917605,104,0,3,15,-1,0,4,917606,100,0,3,15,-1,0,4,917607,96,0,3,15,-1,0,4,917608,92,0,3,15,-1,0,4,917609,88,0,3,15,-1,0,4,917610,84,0,3,15,-1,0,4,917611,80,0,3,15,-1,0,4,917612,76,0,3,15,-1,0,4,917613,72,0,3,15,-1,0,4,917614,68,0,3,15,-1,0,4,917615,64,0,3,15,-1,0,4,917616,60,0,3,15,-1,0,4,917617,56,0,3,15,-1,0,4,917618,52,0,3,15,-1,0,4,917619,48,0,3,15,-1,0,4,917620,44,0,3,15,-1,0,4,917621,40,0,3,15,-1,0,4,917622,36,0,3,15,-1,0,4,917623,32,0,3,15,-1,0,4,917624,28,0,3,15,-1,0,4,917625,24,0,3,15,-1,0,4,917626,20,0,3,15,-1,0,4,917627,16,0,3,15,-1,0,4,917628,12,0,3,15,-1,0,4,917629,8,0,3,15,-1,0,4,917630,4,0,3,15,-1,0,4,917631,0,0,3,15,-1,0,4};
 
 class FontAwesome : public BitmapFont {
@@ -16,6 +532,10 @@ public:
        return false;
     }
 
+    if(setupShared(&fontawesome_pixel_data[0])) {
+      return true;
+    }
+
     line_height = 15;
     scale_w = 384;
     scale_h = 256;
@@ -39,9 +559,7 @@ public:
       chars[c.id] = c;
     }
 
-    setupTexture(scale_w, scale_h, (unsigned char*)&fontawesome_pixel_data[0]);
-
-    return true;
+    return setupTexture(scale_w, scale_h, fontawesome_pixel_data, sizeof(fontawesome_pixel_data));
   }
 };
 
@@ -20,6 +20,44 @@
 #  define BITMAP_FONT_GL BITMAP_FONT_GL2
 #endif
 
+#define RENDER_GL_UPLOAD_SUBDATA 1           /* Upload vertices with glBufferData/glBufferSubData into one buffer (default) */
+#define RENDER_GL_UPLOAD_RING 2              /* Upload vertices into a ring of buffer segments; persistent mapped with fences on GL 4.4+, orphaning otherwise. See BufferRing (BUFFER_RING_SEGMENTS). */
+
+#if !defined(RENDER_GL_UPLOAD)
+#  define RENDER_GL_UPLOAD RENDER_GL_UPLOAD_SUBDATA
+#endif
+
+#if RENDER_GL_UPLOAD == RENDER_GL_UPLOAD_RING
+#  define BITMAP_FONT_UPLOAD BITMAP_FONT_UPLOAD_RING
+#else
+#  define BITMAP_FONT_UPLOAD BITMAP_FONT_UPLOAD_SUBDATA
+#endif
+
+#define RENDER_GL_VERTEX_FLOAT 1            /* GuiVertexPC stores float positions and colors: 24 bytes per vertex, 48 for a GuiShapeVertex (default) */
+#define RENDER_GL_VERTEX_COMPACT 2          /* GuiVertexPC stores int16 fixed point positions and RGBA8 colors: 8 bytes per vertex, 20 for a GuiShapeVertex. Glyphs use int16 pos + uint16 texcoord + RGBA8: 12 bytes. */
+
+#if !defined(RENDER_GL_VERTEX_FORMAT)
+#  define RENDER_GL_VERTEX_FORMAT RENDER_GL_VERTEX_FLOAT
+#endif
+
+#if RENDER_GL_VERTEX_FORMAT == RENDER_GL_VERTEX_COMPACT
+#  define BITMAP_FONT_VERTEX_FORMAT BITMAP_FONT_VERTEX_COMPACT
+#else
+#  define BITMAP_FONT_VERTEX_FORMAT BITMAP_FONT_VERTEX_FLOAT
+#endif
+
+#if !defined(RENDER_GL_POS_SCALE)
+#  define RENDER_GL_POS_SCALE 4             /* Subpixel steps per pixel for compact positions; 4 keeps the anti aliased edges of rounded shapes and gives a range of +/- 8191 pixels. */
+#endif
+
+#if !defined(RENDER_GL_MAX_LAYERS)
+#  define RENDER_GL_MAX_LAYERS 4             /* Maximum number of layers, see setLayer(); each RenderMark stores the draw list sizes of this many layers. */
+#endif
+
+#if RENDER_GL == RENDER_GL3 && defined(GL_VERSION_3_3) && !defined(RENDER_GL_NO_INSTANCING)
+#  define RENDER_GL_INSTANCED                /* Every shape is one GuiRectPC instance that GUI_RENDER_RECT_VS expands into a quad; define RENDER_GL_NO_INSTANCING to use six GuiVertexPC per shape. */
+#endif
+
 /* @todo -> we should not do this here and use a proper GL loader like GLAD. (glew + OF does strange things with function pointers.)*/
 #if defined(__APPLE__) && RENDER_GL == RENDER_GL2
 #  define glGenVertexArrays glGenVertexArraysAPPLE
@@ -32,6 +70,7 @@
 #include <gui/textinput/TextInput.h>
 #include <gui/fonts/FontAwesome.h>
 #include <gui/fonts/DejaVu.h>
+#include <gui/fonts/FontAtlas.h>
 #include <gui/Render.h>
 #include <assert.h>
 #include <algorithm>
@@ -50,6 +89,36 @@
 
 /* -------------------------------------------------------------------------------------------------------------- */
 
+#define GUI_SHAPE_PLAIN 0                   /* The vertices are drawn as they are (rectangles, lines). */
+#define GUI_SHAPE_FILL 1                    /* The quad is a filled rounded rectangle, see GUI_RENDER_SHAPE_FS. */
+#define GUI_SHAPE_OUTLINE 2                 /* The quad is a one pixel wide outline of a rounded rectangle. */
+#define GUI_SHAPE_SHADOW 3                  /* The quad is an outline that only shows at the bottom and fades in over the radius; used by addRoundedShadowLine(). */
+
+/* 
+   Rounded rectangles are drawn as one quad. The distance to the rounded
+   rectangle is evaluated per fragment and used for coverage. `v_shape.xy`
+   is the position relative to the center of the rectangle, `v_shape.zw`
+   is half the size. `v_corner.x` is the radius and `v_corner.y` is 
+   GUI_SHAPE_* * 16 + the GUI_CORNER_* mask. 
+*/
+#define GUI_RENDER_SHAPE_FUNC ""                                                          \
+  "float gui_shape_alpha(vec4 shape, vec2 corner) {"                                      \
+  "  float mode = floor(corner.y / 16.0);"                                                \
+  "  if (mode < 0.5) { return 1.0; }"                                                     \
+  "  vec2 p = shape.xy;"                                                                  \
+  "  float bit = (p.y < 0.0) ? ((p.x < 0.0) ? 1.0 : 2.0) : ((p.x < 0.0) ? 8.0 : 4.0);"   \
+  "  float r = mod(floor(corner.y / bit), 2.0) * corner.x;"                              \
+  "  vec2 q = abs(p) - shape.zw + r;"                                                     \
+  "  float d = min(max(q.x, q.y), 0.0) + length(max(q, 0.0)) - r;"                        \
+  "  if (mode < 1.5) { return clamp(0.5 - d, 0.0, 1.0); }"                                \
+  "  float a = clamp(1.0 - abs(d), 0.0, 1.0);"                                            \
+  "  if (mode > 2.5) {"                                                                   \
+  "    float t = clamp((p.y - shape.w + corner.x) / max(corner.x, 1.0), 0.0, 1.0);"       \
+  "    a *= t * t;"                                                                       \
+  "  }"                                                                                   \
+  "  return a;"                                                                           \
+  "}"
+
 #if RENDER_GL == RENDER_GL2
 static const char* GUI_RENDER_VS = ""
   "#version 110\n"
@@ -71,6 +140,39 @@ static const char* GUI_RENDER_FS = ""
   "}"
   "";
 
+/* Position + Color + Shape, see GuiShapeVertex */
+/* -------------------------------------------------------------------------------------------------------------- */
+
+static const char* GUI_RENDER_SHAPE_VS = ""
+  "#version 110\n"
+  "uniform mat4 u_pm;"
+  "uniform float u_shape_scale;"
+  "attribute vec4 a_pos;"
+  "attribute vec4 a_color;"
+  "attribute vec4 a_shape;"
+  "attribute vec2 a_corner;"
+  "varying vec4 v_color;"
+  "varying vec4 v_shape;"
+  "varying vec2 v_corner;"
+  "void main() {"
+  "  gl_Position = u_pm * a_pos;"
+  "  v_color = a_color;"
+  "  v_shape = a_shape * u_shape_scale;"
+  "  v_corner = vec2(a_corner.x * u_shape_scale, a_corner.y);"
+  "}"
+  "";
+
+static const char* GUI_RENDER_SHAPE_FS = ""
+  "#version 110\n"
+  "varying vec4 v_color;"
+  "varying vec4 v_shape;"
+  "varying vec2 v_corner;"
+  GUI_RENDER_SHAPE_FUNC
+  "void main() {"
+  "  gl_FragColor = vec4(v_color.rgb, v_color.a * gui_shape_alpha(v_shape, v_corner));"
+  "}"
+  "";
+
 /* Position + TexCoord  */
 /* -------------------------------------------------------------------------------------------------------------- */
 
@@ -132,6 +234,67 @@ static const char* GUI_RENDER_FS = ""
   "}"
   "";
 
+/* Position + Color + Shape, see GuiShapeVertex */
+/* -------------------------------------------------------------------------------------------------------------- */
+
+static const char* GUI_RENDER_SHAPE_VS = ""
+  "#version 150\n"
+  "uniform mat4 u_pm;"
+  "uniform float u_shape_scale;"
+  "in vec4 a_pos;"
+  "in vec4 a_color;"
+  "in vec4 a_shape;"
+  "in vec2 a_corner;"
+  "out vec4 v_color;"
+  "out vec4 v_shape;"
+  "out vec2 v_corner;"
+  "void main() {"
+  "  gl_Position = u_pm * a_pos;"
+  "  v_color = a_color;"
+  "  v_shape = a_shape * u_shape_scale;"
+  "  v_corner = vec2(a_corner.x * u_shape_scale, a_corner.y);"
+  "}"
+  "";
+
+static const char* GUI_RENDER_SHAPE_FS = ""
+  "#version 150\n"
+  "in vec4 v_color;"
+  "in vec4 v_shape;"
+  "in vec2 v_corner;"
+  "out vec4 fragcolor;"
+  GUI_RENDER_SHAPE_FUNC
+  "void main() {"
+  "  fragcolor = vec4(v_color.rgb, v_color.a * gui_shape_alpha(v_shape, v_corner));"
+  "}"
+  "";
+
+/* Expands a GuiRectPC instance into a quad (triangle strip of 4 vertices) and applies the shading; used with GUI_RENDER_SHAPE_FS. */
+static const char* GUI_RENDER_RECT_VS = ""
+  "#version 150\n"
+  "uniform mat4 u_pm;"
+  "uniform float u_shape_scale;"
+  "in vec4 a_rect;"
+  "in vec4 a_color;"
+  "in vec2 a_shade;"
+  "in vec2 a_corner;"
+  "out vec4 v_color;"
+  "out vec4 v_shape;"
+  "out vec2 v_corner;"
+  "void main() {"
+  "  vec2 uv = vec2(float(gl_VertexID & 1), float(gl_VertexID >> 1));"
+  "  vec4 rect = a_rect * u_shape_scale;"
+  "  vec2 hs = rect.zw * 0.5;"
+  "  float e = (a_corner.y < 16.0) ? 0.0 : 1.0;"
+  "  vec2 local = (uv * 2.0 - 1.0) * (hs + e);"
+  "  vec3 top = min(vec3(1.0), a_color.rgb + a_shade.x);"
+  "  vec3 bot = max(vec3(0.0), a_color.rgb + a_shade.y);"
+  "  gl_Position = u_pm * vec4(rect.xy + hs + local, 0.0, 1.0);"
+  "  v_color = vec4(mix(top, bot, uv.y), a_color.a);"
+  "  v_shape = vec4(local, hs);"
+  "  v_corner = vec2(a_corner.x * u_shape_scale, a_corner.y);"
+  "}"
+  "";
+
 /* Position + TexCoord  */
 /* -------------------------------------------------------------------------------------------------------------- */
 
@@ -185,14 +348,77 @@ namespace rx {
     GuiVertexPC(float x, float y, float* col);
     void setPos(float x, float y);
     void setColor(float r, float g, float b, float a);
-    const float* ptr() { return &pos[0]; } 
+    const void* ptr() { return &pos[0]; } 
     void print();
 
   public:
-    float pos[2];
+#if RENDER_GL_VERTEX_FORMAT == RENDER_GL_VERTEX_COMPACT
+    int16_t pos[2];                                              /* Fixed point, RENDER_GL_POS_SCALE steps per pixel; the projection matrix of prog_pc scales back. 8 bytes per vertex. */
+    uint8_t color[4];                                            /* Normalized by GL. */
+#else
+    float pos[2];                                                /* 24 bytes per vertex. */
+    float color[4];
+#endif
+  };
+
+  /* -------------------------------------------------------------------------------------------------------------- */
+
+  /* position + colors + the rounded rectangle it belongs to; only for the GUI_SHAPE_{FILL, OUTLINE, SHADOW} quads, see addShape() */
+  struct GuiShapeVertex {
+
+  public:
+    GuiShapeVertex();
+    GuiShapeVertex(float x, float y, float* col);
+    void setPos(float x, float y);
+    void setColor(float r, float g, float b, float a);
+    void setShape(float lx, float ly, float hw, float hh, float radius, int flags); /* lx/ly: position relative to the center of the shape, hw/hh: half the size of the shape, flags: GUI_SHAPE_* * 16 + GUI_CORNER_* */
+    const void* ptr() { return &pos[0]; } 
+
+  public:
+#if RENDER_GL_VERTEX_FORMAT == RENDER_GL_VERTEX_COMPACT
+    int16_t pos[2];                                              /* Fixed point like GuiVertexPC. 20 bytes per vertex. */
+    uint8_t color[4];                                            /* Normalized by GL. */
+    int16_t shape[4];                                            /* Fixed point like `pos`; u_shape_scale scales back. */
+    int16_t corner[2];                                           /* Fixed point radius + flags. */
+#else
+    float pos[2];                                                /* 48 bytes per vertex. */
+    float color[4];
+    float shape[4];                                              /* Position relative to the center of the shape + half size. */
+    float corner[2];                                             /* Radius + flags, see GUI_SHAPE_*. */
+#endif
+  };
+
+  /* -------------------------------------------------------------------------------------------------------------- */
+
+  /* rectangle instance: one record per shape instead of six GuiVertexPC, see RENDER_GL_INSTANCED */
+  struct GuiRectPC {
+
+  public:
+    GuiRectPC();
+    GuiRectPC(float x, float y, float w, float h, float* col, float shadetop, float shadebot, float radius, int flags);
+    const void* ptr() { return &rect[0]; } 
+    void print();
+
+  public:
+#if RENDER_GL_VERTEX_FORMAT == RENDER_GL_VERTEX_COMPACT
+    int16_t rect[4];                                             /* x, y, w, h in fixed point; u_shape_scale scales back. 20 bytes per instance. */
+    uint8_t color[4];                                            /* Normalized by GL. */
+    int16_t shade[2];                                            /* shadetop, shadebot; normalized by GL. */
+    int16_t corner[2];                                           /* Fixed point radius + flags. */
+#else
+    float rect[4];                                               /* x, y, w, h. 48 bytes per instance. */
     float color[4];
+    float shade[2];                                              /* Added to the color at the top and bottom, see gl_shade_colors(). */
+    float corner[2];                                             /* Radius + flags, see GUI_SHAPE_*. */
+#endif
   };
 
+#if defined(RENDER_GL_INSTANCED)
+  typedef GuiRectPC GuiElementPC;                                /* The elements in RenderGL::vertices_pc. */
+#else
+  typedef GuiVertexPC GuiElementPC;
+#endif
+
   /* -------------------------------------------------------------------------------------------------------------- */
 
   /* position + texcoords */
@@ -236,8 +462,12 @@ namespace rx {
     TextureInfoGL* info;
   };
 
-  struct TextureDrawInfoSorter {
-    bool operator()(const TextureDrawInfo& a, const TextureDrawInfo& b) { return a.info->type > b.info->type; } 
+  struct TextureDrawInfoSorter {                                 /* Groups the draws by texture target (so we switch programs once) and then by texture. */
+    bool operator()(const TextureDrawInfo& a, const TextureDrawInfo& b) const {
+      if(a.info->type != b.info->type) { return a.info->type > b.info->type; }
+      if(a.info->id != b.info->id) { return a.info->id < b.info->id; }
+      return a.offset < b.offset;
+    }
   };
 
   /* -------------------------------------------------------------------------------------------------------------- */
@@ -247,6 +477,42 @@ namespace rx {
   void gui_print_program_link_info(GLuint prog);
   void gui_print_shader_compile_info(GLuint shader);
   void gui_ortho(float l, float r, float b, float t, float n, float f, float* dest);
+  void gui_scale_pc_projection(float* pm);                       /* Compensates the projection matrix for the fixed point positions of GuiVertexPC, see RENDER_GL_VERTEX_COMPACT. */
+
+  /* -------------------------------------------------------------------------------------------------------------- */
+
+  struct RenderFontMark {                                        /* Number of glyph vertices of a font at the moment a mark was taken. */
+    size_t count;
+    bool needs_update;
+  };
+
+  struct RenderLayerMark {                                       /* Sizes of the draw lists of one layer at the moment a mark was taken. */
+    int id;                                                      /* The layer id, see setLayer(). */
+    size_t bg;                                                   /* Number of entries in bg_offsets/bg_counts. */
+    size_t fg;                                                   /* Number of entries in fg_offsets/fg_counts. */
+    size_t shapes;                                               /* Number of entries in shape_offsets/shape_counts. */
+    size_t textures;                                             /* Number of entries in texture_draws. */
+    RenderFontMark font;
+  };
+
+  struct RenderMark {                                            /* Snapshot of the sizes of all vertex buffers and draw lists, used to find the vertices that a widget created. */
+    size_t pc;                                                   /* Number of GuiElementPC elements. */
+    size_t pt;                                                   /* Number of GuiVertexPT vertices. */
+    size_t shape;                                                /* Number of GuiShapeVertex vertices. */
+    bool needs_update_pc;
+    bool needs_update_pt;
+    bool needs_update_shape;
+    size_t num_layers;                                           /* Number of used entries in `layers`. */
+    RenderLayerMark layers[RENDER_GL_MAX_LAYERS];
+  };
+
+  struct RenderSpan {                                            /* The vertices a widget created during the last full build are the ones between `begin` and `end`. */
+    RenderSpan():build(0),is_duplicate(false) {}
+    RenderMark begin;
+    RenderMark end;
+    uint32_t build;                                              /* The full build that recorded this span; the span is only valid when this equals RenderGL::spans_build. */
+    bool is_duplicate;                                           /* Two widgets used the same span id during the last full build; we never patch it. */
+  };
 
   /* -------------------------------------------------------------------------------------------------------------- */
 
@@ -256,14 +522,16 @@ namespace rx {
 
   public:
     std::vector<GLint> bg_offsets;                               /* Offsets of the different background elements. */
-    std::vector<GLsizei> bg_counts;                              /* Vertex counts for the background elements. */
+    std::vector<GLsizei> bg_counts;                              /* Vertex (or instance, see RENDER_GL_INSTANCED) counts for the background elements. */
     std::vector<GLint> fg_offsets;                               /* Offsets of the foreground elements. */
-    std::vector<GLsizei> fg_counts;                              /* Vertex counts for the foreground elements. */
-    DejaVu text_font;                                            /* The font we use for e.g. drawing labels. */    
-    DejaVu number_font;                                          /* The number font can be something else if we want to. */ 
-    FontAwesome icon_font;                                       /* A font that contains icons, using the 'FontAwesome' font. */
-    DejaVu text_input_font;                                      /* We need to use another font object for the number font because the number font clears all vertices, so it cannot share the number_font. */
-    DejaVu number_input_font;                                    /* We need to use another font object for the text input because the text input clears all vertices, so it cannot share the text_font. */
+    std::vector<GLsizei> fg_counts;                              /* Vertex (or instance) counts for the foreground elements. */
+    std::vector<GLint> shape_offsets;                            /* Offsets of the rounded shapes into RenderGL::vertices_shape; drawn after the background. Empty when RENDER_GL_INSTANCED is defined. */
+    std::vector<GLsizei> shape_counts;                           /* Vertex counts of the rounded shapes. */
+    std::vector<TextureDrawInfo> texture_draws;                  /* The textured rectangles in the order they were added; ranges into RenderGL::vertices_pt. */
+    std::vector<TextureDrawInfo> texture_batches;                /* The texture_draws sorted by target and texture, with consecutive ranges of the same texture merged. See batchTextureDraws(). */
+    FontAtlas font;                                              /* Labels, numbers and icons; DejaVu and FontAwesome glyphs share one texture so all text of a layer is drawn with one draw call. */
+    DejaVu text_input_font;                                      /* We need to use another font object for the text input because the text input clears all vertices, so it cannot share `font`. */
+    DejaVu number_input_font;                                    /* We need to use another font object for the number input because the number input clears all vertices, so it cannot share `font`. */
     TextInput text_input;                                        /* Used for general text input. */ 
     TextInput number_input;                                      /* Used for character based text input. */
   };
@@ -286,8 +554,9 @@ namespace rx {
 
     /* Drawing */
     void clear();                                                                                                                                                               /* Removes all vertices, and offset data. */
-    void writeText(float x, float y, std::string text, float* color);                                                                                                           /* Write some text. */
+    void writeText(float x, float y, const std::string& text, float* color);                                                                                                    /* Write some text. */
     void writeNumber(float x, float y, std::string number, float* color);                                                                                                       /* Write a number value; we right align it. */
+    void writeNumber(float x, float y, const char* number, size_t len, float* color);
     void writeIcon(float x, float y, unsigned int icon, float* color);                                                                                                          /* Write an icon. see Types.h for the available icons. */
     void addRectangle(float x, float y, float w, float h, float* color, bool filled = true, float shadetop = -0.15, float shadebot = 0.15f);                                    /* Draw a rectangle at x/y with w/h and given color; must have 4 elements. shadetop is the amount that is added to the top color based on the relative y position, so a value of `-0.1` would make it darker and `0.1` would make it brighter, shadebot works similiar */
     void addRectangle(float x, float y, float w, float h, TextureInfo* texinfo);                                                                                                /* draw a rectangle at x/y with w/h for the given texture */
@@ -307,9 +576,35 @@ namespace rx {
     void onCharPress(unsigned int key);                          /* Gets called when a key is pressed (called by an editable widget). */
     void onKeyPress(int key, int mods);                          /* Gets called for special keys (called by an editable widget). */
 
+    /* Incremental updates */
+    void beginSpan(uint32_t id);                                 /* Remember where the vertices of the widget with the given id start. */
+    void endSpan(uint32_t id);                                   /* Stores the span of vertices that were created since beginSpan(). */
+    bool beginPatch(uint32_t id);                                /* The widget is going to recreate its shapes; they are appended to the end of the buffers first. */
+    bool endPatch(uint32_t id);                                  /* When the new shapes have exactly the same layout as the old span they are copied over it, and only that range is uploaded. The appended vertices are always removed again. */
+
+    /* Building on another thread */
+    Render* createStagingRender();                               /* Returns a new RenderGL; only its vertices and draw lists are used, so another thread can write into it. */
+    bool swapBuffers(Render* staging);                           /* Swaps the vertices and draw lists of all layers with the given RenderGL, see RenderSnapshot. */
+
   private: 
     void updatePositionColorBuffers();
     void updatePositionTexCoordBuffers();
+    void setupPositionColorAttributes(size_t offset);            /* Binds vbo_pc to vao_pc using the given byte offset, see BufferRing. */
+    void setupPositionTexCoordAttributes(size_t offset);         /* Binds vbo_pt to vao_pt using the given byte offset, see BufferRing. */
+#if !defined(RENDER_GL_INSTANCED)
+    void updateShapeBuffers();
+    void setupShapeAttributes(size_t offset);                    /* Binds vbo_shape to vao_shape using the given byte offset, see BufferRing. */
+#endif
+    void getMark(RenderMark& mark);                              /* Fills `mark` with the current sizes of all buffers and draw lists. */
+    bool canPatch(RenderSpan& span, RenderMark& from, RenderMark& to);  /* Returns true when the vertices between `from` and `to` have the same layout as the given span. */
+    void truncate(RenderMark& mark);                             /* Removes everything that was added after the given mark. */
+    void batchTextureDraws();                                    /* Creates the texture_batches of each layer. */
+    void drawTextures(RenderLayer* lyr);                         /* Draws the texture_batches of the given layer; binds the program only when the target changes and the texture only when it changes. */
+    void addShape(float x, float y, float w, float h, float radius, int corners, int mode, float* color, float shadetop, float shadebot); /* Appends a GUI_SHAPE_* quad: one instance, 6 GuiVertexPC for GUI_SHAPE_PLAIN or 6 GuiShapeVertex; the caller adds the offset/count to the layer. */
+    void addRoundedShape(float x, float y, float w, float h, float radius, int corners, int mode, float* color, float shadetop, float shadebot); /* Adds a GUI_SHAPE_{FILL, OUTLINE, SHADOW} quad and its offset/count to the current layer. */
+#if defined(RENDER_GL_INSTANCED)
+    void drawRects(std::vector<GLint>& offsets, std::vector<GLsizei>& counts); /* Draws the instances, merging adjacent ranges into one glDrawArraysInstanced(). */
+#endif
 
   public:
 
@@ -325,6 +620,13 @@ namespace rx {
     static GLuint vert_pc;                                       /* The vertex shader for the gui */
     static GLuint frag_pc;                                       /* The fragment shader for the gui */
 
+    /* GuiShapeVertex: rounded rectangles, outlines and shadow lines; not used when RENDER_GL_INSTANCED is defined */
+    GLuint vbo_shape;                                            /* VBO for the GuiShapeVertex vertices */
+    GLuint vao_shape;                                            /* VAO for the GuiShapeVertex vertices */
+    static GLuint prog_shape;                                    /* Shader program that renders GuiShapeVertex */
+    static GLuint vert_shape;                                    /* Vertex shader that renders GuiShapeVertex */
+    static GLuint frag_shape;                                    /* Fragment shader that evaluates the shape per fragment, see GUI_RENDER_SHAPE_FUNC */
+
     /* GuiVertexPT: textures */
     GLuint vbo_pt;                                               /* VBO for the position + texcoord buffers */
     GLuint vao_pt;                                               /* VAO for the position + textcoord buffers */
@@ -334,20 +636,39 @@ namespace rx {
     static GLuint frag_pt;                                       /* Fragment shader that renders GuiVertexPT */
     static GLuint frag_pt_rect;
 
+#if RENDER_GL_UPLOAD == RENDER_GL_UPLOAD_RING
+    BufferRing ring_pc;                                          /* Ring that owns vbo_pc. */
+    BufferRing ring_pt;                                          /* Ring that owns vbo_pt. */
+    BufferRing ring_shape;                                       /* Ring that owns vbo_shape. */
+#endif
+
     /* GuiVertexPC buffer info */
     bool needs_update_pc;                                        /* Set to true whenever we need to update the vbo for the position + color type*/
     size_t bytes_allocated_pc;                                   /* How many bytes we've allocated in the vbo for the position + color type */
-    std::vector<GuiVertexPC> vertices_pc;                        /* Vertices for that make up the gui (for color + position) */
+    std::vector<GuiElementPC> vertices_pc;                       /* Vertices for that make up the gui (for color + position); one GuiRectPC per shape when RENDER_GL_INSTANCED is defined. */
+    size_t dirty_pc_start;                                       /* When only a couple of widgets were patched, this is the first vertex that we need to upload. */
+    size_t dirty_pc_end;                                         /* One past the last vertex that we need to upload after patching. */
 
     /* GuiVertexPT buffer info */
     bool needs_update_pt;                                        /* Is set to true whenever we need t update the pos/tex vertices */
     size_t bytes_allocated_pt;                                   /* The number of bytes allocated in the GuiVertexPT buffer */
     std::vector<GuiVertexPT> vertices_pt;                        /* the vertices that we use to draw a texture */
-    std::vector<TextureDrawInfo> texture_draws;                  /* Keeps information about the textures we need to draw */
+
+    /* GuiShapeVertex buffer info */
+    bool needs_update_shape;                                     /* Set to true whenever we need to update vbo_shape */
+    size_t bytes_allocated_shape;                                /* The number of bytes allocated in vbo_shape */
+    std::vector<GuiShapeVertex> vertices_shape;                  /* Six vertices per rounded shape. */
+    size_t dirty_shape_start;                                    /* Like dirty_pc_start, for vertices_shape. */
+    size_t dirty_shape_end;
 
     /* Layers. */
     std::map<int, RenderLayer*> layers;                          /* We use Layers to draw things on top of each other. Layer 0 is the default layer and this is where most elements should be drawn onto. Layer 1 is used for the top layer (see Menu element). */
     RenderLayer* layer;                                          /* The current layer, by default we create the layer 0. */
+
+    /* Spans */
+    std::vector<RenderSpan> spans;                               /* The vertices each widget created during the last full build, indexed by span id. */
+    uint32_t spans_build;                                        /* Incremented by clear() so we don't have to reset all spans. */
+    RenderMark span_mark;                                        /* Mark taken in beginSpan() and beginPatch(). */
   };
 
   /* -------------------------------------------------------------------------------------------------------------- */
@@ -377,20 +698,16 @@ namespace rx {
     outb[3] = colin[3];
   }
 
-  inline void gl_add_shaded_vertex_pc(float x, float y, float miny, float maxy, 
-                                      const float coltop[4], const float colbot[4], float intcol[4],
-                                      std::vector<GuiVertexPC>& result)
-  {
-    gl_interpolate_colors_with_range(coltop, colbot, miny, maxy, y, intcol);
-    result.push_back(GuiVertexPC(x, y, intcol));
-  }
-
   /* -------------------------------------------------------------------------------------------------------------- */
   
   inline void RenderGL::setLayer(int l) {
 
     std::map<int, RenderLayer*>::iterator it = layers.find(l);
     if (it == layers.end()) {
+      if (layers.size() >= RENDER_GL_MAX_LAYERS) {
+        printf("Error: cannot create layer %d, we support %d layers (RENDER_GL_MAX_LAYERS).\n", l, RENDER_GL_MAX_LAYERS);
+        return;
+      }
       layer = new RenderLayer();
       if (NULL == layer) {
         printf("Cannot allocate new RenderLayer.\n");
@@ -428,16 +745,8 @@ namespace rx {
     ,number_input(0.0f, 0.0f, 0.0f, number_input_font)
   {
 
-    if(!text_font.setup()) {
-      printf("Error: cannot setup text font.\n");
-    }
-
-    if(!icon_font.setup()) {
-      printf("Error: cannot setup icon font.\n");
-    }
-
-    if(!number_font.setup()) {
-      printf("Error: cannot setup number font.\n");
+    if(!font.setup()) {
+      printf("Error: cannot setup the font atlas.\n");
     }
 
     if(!text_input_font.setup()) {
@@ -457,6 +766,9 @@ namespace rx {
   GLuint RenderGL::prog_pc = 0;
   GLuint RenderGL::vert_pc = 0;
   GLuint RenderGL::frag_pc = 0;
+  GLuint RenderGL::prog_shape = 0;
+  GLuint RenderGL::vert_shape = 0;
+  GLuint RenderGL::frag_shape = 0;
   GLuint RenderGL::prog_pt = 0;
   GLuint RenderGL::vert_pt = 0;
   GLuint RenderGL::frag_pt = 0;
@@ -470,11 +782,20 @@ namespace rx {
     :gl_version(gl)
     ,vbo_pc(0)
     ,vao_pc(0)
-    ,bytes_allocated_pc(0)
-    ,bytes_allocated_pt(0)
+    ,vbo_shape(0)
+    ,vao_shape(0)
     ,needs_update_pc(false)
+    ,bytes_allocated_pc(0)
+    ,dirty_pc_start(0)
+    ,dirty_pc_end(0)
     ,needs_update_pt(false)
+    ,bytes_allocated_pt(0)
+    ,needs_update_shape(false)
+    ,bytes_allocated_shape(0)
+    ,dirty_shape_start(0)
+    ,dirty_shape_end(0)
     ,layer(NULL) 
+    ,spans_build(1)
   {
     
     /* ortho projection */
@@ -486,11 +807,24 @@ namespace rx {
     if(!is_initialized) {
 
       /* shader for pos + color */
+#if defined(RENDER_GL_INSTANCED)
+      const char* atts_pc[] = { "a_rect", "a_color", "a_shade", "a_corner" };
+      vert_pc = gui_create_shader(GL_VERTEX_SHADER, GUI_RENDER_RECT_VS);
+      frag_pc = gui_create_shader(GL_FRAGMENT_SHADER, GUI_RENDER_SHAPE_FS);
+      prog_pc = gui_create_program(vert_pc, frag_pc, 4, atts_pc);
+#else
       const char* atts_pc[] = { "a_pos", "a_color" };
       vert_pc = gui_create_shader(GL_VERTEX_SHADER, GUI_RENDER_VS);
       frag_pc = gui_create_shader(GL_FRAGMENT_SHADER, GUI_RENDER_FS);
       prog_pc = gui_create_program(vert_pc, frag_pc, 2, atts_pc);
 
+      /* shader for pos + color + shape */
+      const char* atts_shape[] = { "a_pos", "a_color", "a_shape", "a_corner" };
+      vert_shape = gui_create_shader(GL_VERTEX_SHADER, GUI_RENDER_SHAPE_VS);
+      frag_shape = gui_create_shader(GL_FRAGMENT_SHADER, GUI_RENDER_SHAPE_FS);
+      prog_shape = gui_create_program(vert_shape, frag_shape, 4, atts_shape);
+#endif
+
       /* shader for pos + texcoord */
       const char* atts_pt[] = { "a_pos", "a_tex" } ;
       vert_pt = gui_create_shader(GL_VERTEX_SHADER, GUI_RENDER_PT_VS);
@@ -502,8 +836,25 @@ namespace rx {
       frag_pt_rect = gui_create_shader(GL_FRAGMENT_SHADER, GUI_RENDER_PT_RECT_FS);
       prog_pt_rect = gui_create_program(vert_pt, frag_pt_rect, 2, atts_pt_rect);
 
+      float pm_pc[16];
+      memcpy(pm_pc, pm, sizeof(pm_pc));
+      gui_scale_pc_projection(pm_pc);
+
+#if RENDER_GL_VERTEX_FORMAT == RENDER_GL_VERTEX_COMPACT
+      float shape_scale = 1.0f / RENDER_GL_POS_SCALE;
+#else
+      float shape_scale = 1.0f;
+#endif
+
       glUseProgram(prog_pc);
-      glUniformMatrix4fv(glGetUniformLocation(prog_pc, "u_pm"), 1, GL_FALSE, pm);
+      glUniformMatrix4fv(glGetUniformLocation(prog_pc, "u_pm"), 1, GL_FALSE, pm_pc);
+#if defined(RENDER_GL_INSTANCED)
+      glUniform1f(glGetUniformLocation(prog_pc, "u_shape_scale"), shape_scale);
+#else
+      glUseProgram(prog_shape);
+      glUniformMatrix4fv(glGetUniformLocation(prog_shape, "u_pm"), 1, GL_FALSE, pm_pc);
+      glUniform1f(glGetUniformLocation(prog_shape, "u_shape_scale"), shape_scale);
+#endif
 
       glUseProgram(prog_pt);
       glUniformMatrix4fv(glGetUniformLocation(prog_pt, "u_pm"), 1, GL_FALSE, pm);
@@ -516,34 +867,121 @@ namespace rx {
       is_initialized = true;
     }
 
-    /* pos + color vao,vbo */
+    /* vbos */
+#if RENDER_GL_UPLOAD == RENDER_GL_UPLOAD_RING
+    ring_pc.setup();
+    ring_pt.setup();
+    vbo_pc = ring_pc.vbo;
+    vbo_pt = ring_pt.vbo;
+#  if !defined(RENDER_GL_INSTANCED)
+    ring_shape.setup();
+    vbo_shape = ring_shape.vbo;
+#  endif
+#else
+    glGenBuffers(1, &vbo_pc);
+    glGenBuffers(1, &vbo_pt);
+#  if !defined(RENDER_GL_INSTANCED)
+    glGenBuffers(1, &vbo_shape);
+#  endif
+#endif
+
+    /* pos + color vao */
     glGenVertexArrays(1, &vao_pc);
-    glBindVertexArray(vao_pc);
+    setupPositionColorAttributes(0);
 
-    glGenBuffers(1, &vbo_pc);
+#if !defined(RENDER_GL_INSTANCED)
+    /* pos + color + shape vao */
+    glGenVertexArrays(1, &vao_shape);
+    setupShapeAttributes(0);
+#endif
+
+    /* pos + texcoord vao */
+    glGenVertexArrays(1, &vao_pt);
+    setupPositionTexCoordAttributes(0);
+
+    /* Create the bottom layer and the one of the menus; a layer sets up its fonts with GL
+       so we create them here and not while a PanelSet builds the panel on a worker thread. */
+    setLayer(1);
+    setLayer(0);
+  }
+
+  void RenderGL::setupPositionColorAttributes(size_t offset) {
+
+    glBindVertexArray(vao_pc);
     glBindBuffer(GL_ARRAY_BUFFER, vbo_pc);
 
+#if defined(RENDER_GL_INSTANCED)
+    glEnableVertexAttribArray(0); /* rect */
+    glEnableVertexAttribArray(1); /* color */
+    glEnableVertexAttribArray(2); /* shade */
+    glEnableVertexAttribArray(3); /* corner */
+
+    glVertexAttribDivisor(0, 1);
+    glVertexAttribDivisor(1, 1);
+    glVertexAttribDivisor(2, 1);
+    glVertexAttribDivisor(3, 1);
+
+#  if RENDER_GL_VERTEX_FORMAT == RENDER_GL_VERTEX_COMPACT
+    glVertexAttribPointer(0, 4, GL_SHORT, GL_FALSE, sizeof(GuiRectPC), (GLvoid*)(offset + 0)); /* rect */
+    glVertexAttribPointer(1, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(GuiRectPC), (GLvoid*)(offset + 8)); /* col */
+    glVertexAttribPointer(2, 2, GL_SHORT, GL_TRUE, sizeof(GuiRectPC), (GLvoid*)(offset + 12)); /* shade */
+    glVertexAttribPointer(3, 2, GL_SHORT, GL_FALSE, sizeof(GuiRectPC), (GLvoid*)(offset + 16)); /* corner */
+#  else
+    glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, sizeof(GuiRectPC), (GLvoid*)(offset + 0)); /* rect */
+    glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, sizeof(GuiRectPC), (GLvoid*)(offset + 16)); /* col */
+    glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(GuiRectPC), (GLvoid*)(offset + 32)); /* shade */
+    glVertexAttribPointer(3, 2, GL_FLOAT, GL_FALSE, sizeof(GuiRectPC), (GLvoid*)(offset + 40)); /* corner */
+#  endif
+
+#else
     glEnableVertexAttribArray(0); /* pos */
     glEnableVertexAttribArray(1); /* color */
 
-    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(GuiVertexPC), (GLvoid*)0); /* pos */
-    glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, sizeof(GuiVertexPC), (GLvoid*)8); /* col */
+#  if RENDER_GL_VERTEX_FORMAT == RENDER_GL_VERTEX_COMPACT
+    glVertexAttribPointer(0, 2, GL_SHORT, GL_FALSE, sizeof(GuiVertexPC), (GLvoid*)(offset + 0)); /* pos */
+    glVertexAttribPointer(1, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(GuiVertexPC), (GLvoid*)(offset + 4)); /* col */
+#  else
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(GuiVertexPC), (GLvoid*)(offset + 0)); /* pos */
+    glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, sizeof(GuiVertexPC), (GLvoid*)(offset + 8)); /* col */
+#  endif
+#endif
+  }
 
-    /* pos + texcoord vao,vbo */
-    glGenVertexArrays(1, &vao_pt);
-    glBindVertexArray(vao_pt);
+#if !defined(RENDER_GL_INSTANCED)
+  void RenderGL::setupShapeAttributes(size_t offset) {
 
-    glGenBuffers(1, &vbo_pt);
+    glBindVertexArray(vao_shape);
+    glBindBuffer(GL_ARRAY_BUFFER, vbo_shape);
+
+    glEnableVertexAttribArray(0); /* pos */
+    glEnableVertexAttribArray(1); /* color */
+    glEnableVertexAttribArray(2); /* shape */
+    glEnableVertexAttribArray(3); /* corner */
+
+#  if RENDER_GL_VERTEX_FORMAT == RENDER_GL_VERTEX_COMPACT
+    glVertexAttribPointer(0, 2, GL_SHORT, GL_FALSE, sizeof(GuiShapeVertex), (GLvoid*)(offset + 0)); /* pos */
+    glVertexAttribPointer(1, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(GuiShapeVertex), (GLvoid*)(offset + 4)); /* col */
+    glVertexAttribPointer(2, 4, GL_SHORT, GL_FALSE, sizeof(GuiShapeVertex), (GLvoid*)(offset + 8)); /* shape */
+    glVertexAttribPointer(3, 2, GL_SHORT, GL_FALSE, sizeof(GuiShapeVertex), (GLvoid*)(offset + 16)); /* corner */
+#  else
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(GuiShapeVertex), (GLvoid*)(offset + 0)); /* pos */
+    glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, sizeof(GuiShapeVertex), (GLvoid*)(offset + 8)); /* col */
+    glVertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, sizeof(GuiShapeVertex), (GLvoid*)(offset + 24)); /* shape */
+    glVertexAttribPointer(3, 2, GL_FLOAT, GL_FALSE, sizeof(GuiShapeVertex), (GLvoid*)(offset + 40)); /* corner */
+#  endif
+  }
+#endif
+
+  void RenderGL::setupPositionTexCoordAttributes(size_t offset) {
+
+    glBindVertexArray(vao_pt);
     glBindBuffer(GL_ARRAY_BUFFER, vbo_pt);
 
     glEnableVertexAttribArray(0); /* pos */
     glEnableVertexAttribArray(1); /* texcoord */
 
-    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(GuiVertexPT), (GLvoid*)0); /* pos */
-    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(GuiVertexPT), (GLvoid*)8); /* texcoord */
-
-    /* Create the bottom layer. */
-    setLayer(0);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(GuiVertexPT), (GLvoid*)(offset + 0)); /* pos */
+    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(GuiVertexPT), (GLvoid*)(offset + 8)); /* texcoord */
   }
 
   void RenderGL::getWindowSize(int& ww, int& wh) {
@@ -555,6 +993,9 @@ namespace rx {
   
     updatePositionColorBuffers();
     updatePositionTexCoordBuffers();
+#if !defined(RENDER_GL_INSTANCED)
+    updateShapeBuffers();
+#endif
   }
 
   void RenderGL::updatePositionColorBuffers() {
@@ -562,14 +1003,40 @@ namespace rx {
     if(!vertices_pc.size()) {
       return;
     }
+
+#if RENDER_GL_UPLOAD == RENDER_GL_UPLOAD_RING
+    /* The other segments contain older vertices, so we always write everything. */
+    if(needs_update_pc || dirty_pc_end > dirty_pc_start) {
+      if(ring_pc.upload(vertices_pc[0].ptr(), vertices_pc.size() * sizeof(GuiElementPC))) {
+        vbo_pc = ring_pc.vbo;
+        setupPositionColorAttributes(ring_pc.offset);
+      }
+    }
+    needs_update_pc = false;
+    dirty_pc_start = 0;
+    dirty_pc_end = 0;
+    return;
+#endif
   
     if(!needs_update_pc) {
+
+      /* Only upload the vertices of the patched widgets. */
+      if(dirty_pc_end > dirty_pc_start && dirty_pc_end <= vertices_pc.size()) {
+        glBindBuffer(GL_ARRAY_BUFFER, vbo_pc);
+        glBufferSubData(GL_ARRAY_BUFFER, 
+                        dirty_pc_start * sizeof(GuiElementPC), 
+                        (dirty_pc_end - dirty_pc_start) * sizeof(GuiElementPC), 
+                        vertices_pc[dirty_pc_start].ptr());
+      }
+
+      dirty_pc_start = 0;
+      dirty_pc_end = 0;
       return;
     }
 
     glBindBuffer(GL_ARRAY_BUFFER, vbo_pc);
 
-    size_t needed = vertices_pc.size() * sizeof(GuiVertexPC);
+    size_t needed = vertices_pc.size() * sizeof(GuiElementPC);
 
     if(needed > bytes_allocated_pc) {
       glBufferData(GL_ARRAY_BUFFER, needed, vertices_pc[0].ptr(), GL_STREAM_DRAW);
@@ -580,6 +1047,8 @@ namespace rx {
     }
 
     needs_update_pc = false;
+    dirty_pc_start = 0;
+    dirty_pc_end = 0;
   }
 
   void RenderGL::updatePositionTexCoordBuffers() {
@@ -592,6 +1061,17 @@ namespace rx {
       return;
     }
 
+    batchTextureDraws();
+
+#if RENDER_GL_UPLOAD == RENDER_GL_UPLOAD_RING
+    if(ring_pt.upload(vertices_pt[0].ptr(), vertices_pt.size() * sizeof(GuiVertexPT))) {
+      vbo_pt = ring_pt.vbo;
+      setupPositionTexCoordAttributes(ring_pt.offset);
+    }
+    needs_update_pt = false;
+    return;
+#endif
+
     glBindBuffer(GL_ARRAY_BUFFER, vbo_pt);
 
     size_t needed = vertices_pt.size() * sizeof(GuiVertexPT);
@@ -607,6 +1087,59 @@ namespace rx {
     needs_update_pt = false;
   }
 
+#if !defined(RENDER_GL_INSTANCED)
+  void RenderGL::updateShapeBuffers() {
+
+    if(!vertices_shape.size()) {
+      return;
+    }
+
+#if RENDER_GL_UPLOAD == RENDER_GL_UPLOAD_RING
+    if(needs_update_shape || dirty_shape_end > dirty_shape_start) {
+      if(ring_shape.upload(vertices_shape[0].ptr(), vertices_shape.size() * sizeof(GuiShapeVertex))) {
+        vbo_shape = ring_shape.vbo;
+        setupShapeAttributes(ring_shape.offset);
+      }
+    }
+    needs_update_shape = false;
+    dirty_shape_start = 0;
+    dirty_shape_end = 0;
+    return;
+#endif
+
+    if(!needs_update_shape) {
+
+      if(dirty_shape_end > dirty_shape_start && dirty_shape_end <= vertices_shape.size()) {
+        glBindBuffer(GL_ARRAY_BUFFER, vbo_shape);
+        glBufferSubData(GL_ARRAY_BUFFER, 
+                        dirty_shape_start * sizeof(GuiShapeVertex), 
+                        (dirty_shape_end - dirty_shape_start) * sizeof(GuiShapeVertex), 
+                        vertices_shape[dirty_shape_start].ptr());
+      }
+
+      dirty_shape_start = 0;
+      dirty_shape_end = 0;
+      return;
+    }
+
+    glBindBuffer(GL_ARRAY_BUFFER, vbo_shape);
+
+    size_t needed = vertices_shape.size() * sizeof(GuiShapeVertex);
+
+    if(needed > bytes_allocated_shape) {
+      glBufferData(GL_ARRAY_BUFFER, needed, vertices_shape[0].ptr(), GL_STREAM_DRAW);
+      bytes_allocated_shape = needed;
+    }
+    else {
+      glBufferSubData(GL_ARRAY_BUFFER, 0, needed, vertices_shape[0].ptr());
+    }
+
+    needs_update_shape = false;
+    dirty_shape_start = 0;
+    dirty_shape_end = 0;
+  }
+#endif
+
   void RenderGL::draw() {
 
     bool is_blend_enabled = glIsEnabled(GL_BLEND);
@@ -615,7 +1148,7 @@ namespace rx {
         glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
     }
 
-    if (vertices_pc.size()) {
+    if (vertices_pc.size() || vertices_shape.size()) {
 
       RenderLayer* lyr = NULL;
       std::map<int, RenderLayer*>::iterator it = layers.begin();
@@ -627,17 +1160,34 @@ namespace rx {
 
         lyr = it->second;
 
+#if defined(RENDER_GL_INSTANCED)
+        drawRects(lyr->bg_offsets, lyr->bg_counts);
+        drawRects(lyr->fg_offsets, lyr->fg_counts);
+#else
         if(lyr->bg_counts.size()) {
           glMultiDrawArrays(GL_TRIANGLES, &lyr->bg_offsets[0], &lyr->bg_counts[0], lyr->bg_counts.size());
         }
 
+        /* The rounded shapes are drawn on top of the plain rectangles of the layer and below the outlines. */
+        if(lyr->shape_counts.size()) {
+          glUseProgram(prog_shape);
+          glBindVertexArray(vao_shape);
+          glMultiDrawArrays(GL_TRIANGLES, &lyr->shape_offsets[0], &lyr->shape_counts[0], lyr->shape_counts.size());
+
+          if(lyr->fg_counts.size()) {
+            glUseProgram(prog_pc);
+            glBindVertexArray(vao_pc);
+          }
+        }
+
         if(lyr->fg_counts.size()) {
           glMultiDrawArrays(GL_LINE_STRIP, &lyr->fg_offsets[0], &lyr->fg_counts[0], lyr->fg_counts.size());
         } 
+#endif
+
+        drawTextures(lyr);
 
-        lyr->icon_font.draw();
-        lyr->text_font.draw();
-        lyr->number_font.draw();
+        lyr->font.draw();
         lyr->text_input.draw();
         lyr->number_input.draw();
 
@@ -645,62 +1195,113 @@ namespace rx {
       }
     }
 
+#if RENDER_GL_UPLOAD == RENDER_GL_UPLOAD_RING
+    ring_pc.fence();
+    ring_pt.fence();
+#  if !defined(RENDER_GL_INSTANCED)
+    ring_shape.fence();
+#  endif
+#endif
+
     if (false == is_blend_enabled) {
       glDisable(GL_BLEND);
     }
+  }
 
+  void RenderGL::batchTextureDraws() {
 
-    /*
-      We still need to implement (or remove) the texture draws for the layered feature. 
-     */
-#if 0
-    glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    std::map<int, RenderLayer*>::iterator it = layers.begin();
+    while (it != layers.end()) {
 
-    if(texture_draws.size()) {
+      RenderLayer* l = it->second;
+      l->texture_batches.clear();
 
-      glBindVertexArray(vao_pt);
-      glActiveTexture(GL_TEXTURE0);
+      if (l->texture_draws.size()) {
 
-      GLenum type = 0;
+        std::vector<TextureDrawInfo> sorted = l->texture_draws;
+        std::sort(sorted.begin(), sorted.end(), TextureDrawInfoSorter());
 
-      for(std::vector<TextureDrawInfo>::iterator it = texture_draws.begin(); it != texture_draws.end(); ++it) {
+        for (size_t i = 0; i < sorted.size(); ++i) {
 
-        TextureDrawInfo& tex = *it;
+          TextureDrawInfo& tex = sorted[i];
 
-        if(type != tex.info->type) {
-          if(tex.info->type == GL_TEXTURE_2D) {
-            glUseProgram(prog_pt);
+          if (l->texture_batches.size()) {
+            TextureDrawInfo& prev = l->texture_batches.back();
+            if (prev.info->type == tex.info->type
+                && prev.info->id == tex.info->id
+                && (prev.offset + prev.count) == tex.offset) 
+              {
+                prev.count += tex.count;
+                continue;
+              }
           }
+
+          l->texture_batches.push_back(tex);
+        }
+      }
+
+      ++it;
+    }
+  }
+
+  void RenderGL::drawTextures(RenderLayer* lyr) {
+
+    if (0 == lyr->texture_batches.size()) {
+      return;
+    }
+
+    glBindVertexArray(vao_pt);
+    glActiveTexture(GL_TEXTURE0);
+
+    GLenum type = 0;
+    GLuint id = 0;
+
+    for (std::vector<TextureDrawInfo>::iterator it = lyr->texture_batches.begin(); it != lyr->texture_batches.end(); ++it) {
+
+      TextureDrawInfo& tex = *it;
+
+      if (type != tex.info->type) {
+
+        if (tex.info->type == GL_TEXTURE_2D) {
+          glUseProgram(prog_pt);
+        }
 #if RENDER_GL == RENDER_GL2
-          else if(tex.info->type == GL_TEXTURE_RECTANGLE_ARB) {
-            glUseProgram(prog_pt_rect);
-          }
+        else if (tex.info->type == GL_TEXTURE_RECTANGLE_ARB) {
+          glUseProgram(prog_pt_rect);
+        }
 #elif RENDER_GL == RENDER_GL3
-          else if(tex.info->type == GL_TEXTURE_RECTANGLE) {
-            glUseProgram(prog_pt_rect);
-          }
+        else if (tex.info->type == GL_TEXTURE_RECTANGLE) {
+          glUseProgram(prog_pt_rect);
+        }
 #endif
-          else {
-            printf("Error: unsupported texture target.\n");
-          }
+        else {
+          printf("Error: unsupported texture target.\n");
+          continue;
         }
 
+        type = tex.info->type;
+        id = 0;
+      }
+
+      if (id != tex.info->id) {
         glBindTexture(tex.info->type, tex.info->id);
-        glDrawArrays(GL_TRIANGLES, tex.offset, tex.count);
+        id = tex.info->id;
       }
+
+      glDrawArrays(GL_TRIANGLES, tex.offset, tex.count);
     }
-    glDisable(GL_BLEND);
-#endif
   }
 
   void RenderGL::resize(int w, int h) {
 
     float pm[16];
+    float pm_pc[16];
     gui_ortho(0.0f, w, h, 0.0f, 0.0f, 100.0f, pm);
+    memcpy(pm_pc, pm, sizeof(pm_pc));
+    gui_scale_pc_projection(pm_pc);
 
     glUseProgram(prog_pc);
-    glUniformMatrix4fv(glGetUniformLocation(prog_pc, "u_pm"), 1, GL_FALSE, pm);
+    glUniformMatrix4fv(glGetUniformLocation(prog_pc, "u_pm"), 1, GL_FALSE, pm_pc);
 
     glUseProgram(prog_pt);
     glUniformMatrix4fv(glGetUniformLocation(prog_pt, "u_pm"), 1, GL_FALSE, pm);
@@ -711,11 +1312,10 @@ namespace rx {
     std::map<int, RenderLayer*>::iterator it = layers.begin();
     while (it != layers.end()) {
       RenderLayer* l = it->second;
-      l->icon_font.resize(w, h);
-      l->text_font.resize(w, h);
-      l->number_font.resize(w, h);
+      l->font.resize(w, h);
       l->text_input_font.resize(w, h);
       l->number_input_font.resize(w, h);
+      ++it;
     }
 
     viewport[2] = w;
@@ -738,7 +1338,12 @@ namespace rx {
 
     vertices_pc.clear();
     vertices_pt.clear();
-    texture_draws.clear();
+    vertices_shape.clear();
+    spans_build++;
+    dirty_pc_start = 0;
+    dirty_pc_end = 0;
+    dirty_shape_start = 0;
+    dirty_shape_end = 0;
 
     std::map<int, RenderLayer*>::iterator it = layers.begin();
     while (it != layers.end()) {
@@ -747,11 +1352,12 @@ namespace rx {
       l->bg_counts.clear();
       l->fg_offsets.clear();
       l->fg_counts.clear();
-      l->text_font.clear();
-      l->number_font.clear();
-      l->icon_font.clear();
-      l->text_input_font.clear();
-      l->number_input_font.clear();
+      l->shape_offsets.clear();
+      l->shape_counts.clear();
+      l->texture_draws.clear();
+      l->texture_batches.clear();
+      l->font.clear();
+      /* The glyphs of the text and number input are managed by TextInput; they stay valid while the input is enabled (see RenderSnapshot). */
       ++it;
     }
   }
@@ -780,29 +1386,378 @@ namespace rx {
     }
   }
 
-  void RenderGL::writeText(float x, float y, std::string text, float* color) {
+  void RenderGL::beginSpan(uint32_t id) {
 
-    layer->text_font.setColor(color[0], color[1], color[2], color[3]);
-    layer->text_font.write(x, y, text, BITMAP_FONT_ALIGN_LEFT);
+    getMark(span_mark);
   }
 
-  void RenderGL::writeNumber(float x, float y, std::string number, float* color) {
+  void RenderGL::endSpan(uint32_t id) {
 
-    layer->number_font.setColor(color[0], color[1], color[2], color[3]);
-    layer->number_font.write(x, y, number, BITMAP_FONT_ALIGN_RIGHT);
-  }
+    if(id >= spans.size()) {
+      spans.resize(id + 1);
+    }
 
-  void RenderGL::writeIcon(float x, float y, unsigned int icon, float* color) {
-  
-    layer->icon_font.setColor(color[0], color[1], color[2], color[3]);
-    layer->icon_font.write(x, y, icon);
+    RenderSpan& span = spans[id];
+
+    if(span.build == spans_build) {
+      printf("Error: two widgets use the same span id: %u; we can't patch them.\n", id);
+      span.is_duplicate = true;
+      return;
+    }
+
+    span.build = spans_build;
+    span.is_duplicate = false;
+    span.begin = span_mark;
+    getMark(span.end);
   }
 
-  void RenderGL::enableTextInput(float x, float y, float maxw, std::string value, float* color) {
+  bool RenderGL::beginPatch(uint32_t id) {
 
-    layer->text_input.x = x;
-    layer->text_input.y = y;
-    layer->text_input.w = maxw;
+    if(id >= spans.size() || spans[id].build != spans_build || spans[id].is_duplicate) {
+      return false;
+    }
+
+    getMark(span_mark);
+
+    return true;
+  }
+
+  bool RenderGL::endPatch(uint32_t id) {
+
+    if(id >= spans.size() || spans[id].build != spans_build) {
+      truncate(span_mark);
+      return false;
+    }
+
+    RenderSpan& span = spans[id];
+    RenderMark curr;
+    getMark(curr);
+
+    if(!canPatch(span, span_mark, curr)) {
+      truncate(span_mark);
+      return false;
+    }
+
+    /* Copy the new vertices over the old span. */
+    size_t count = curr.pc - span_mark.pc;
+    if(count) {
+
+      std::copy(vertices_pc.begin() + span_mark.pc, vertices_pc.begin() + curr.pc, vertices_pc.begin() + span.begin.pc);
+
+      if(dirty_pc_end == dirty_pc_start) {
+        dirty_pc_start = span.begin.pc;
+        dirty_pc_end = span.begin.pc + count;
+      }
+      else {
+        dirty_pc_start = std::min<size_t>(dirty_pc_start, span.begin.pc);
+        dirty_pc_end = std::max<size_t>(dirty_pc_end, span.begin.pc + count);
+      }
+    }
+
+    /* Rounded shapes. */
+    size_t count_shape = curr.shape - span_mark.shape;
+    if(count_shape) {
+
+      std::copy(vertices_shape.begin() + span_mark.shape, vertices_shape.begin() + curr.shape, vertices_shape.begin() + span.begin.shape);
+
+      if(dirty_shape_end == dirty_shape_start) {
+        dirty_shape_start = span.begin.shape;
+        dirty_shape_end = span.begin.shape + count_shape;
+      }
+      else {
+        dirty_shape_start = std::min<size_t>(dirty_shape_start, span.begin.shape);
+        dirty_shape_end = std::max<size_t>(dirty_shape_end, span.begin.shape + count_shape);
+      }
+    }
+
+    /* Textured rectangles; the draws keep their offsets relative to the span. */
+    size_t count_pt = curr.pt - span_mark.pt;
+    if(count_pt) {
+      std::copy(vertices_pt.begin() + span_mark.pt, vertices_pt.begin() + curr.pt, vertices_pt.begin() + span.begin.pt);
+      needs_update_pt = true;
+    }
+
+    size_t i = 0;
+    std::map<int, RenderLayer*>::iterator lit = layers.begin();
+    while (lit != layers.end()) {
+      RenderLayer* l = lit->second;
+      RenderLayerMark& dst = span.begin.layers[i];
+      RenderLayerMark& src = span_mark.layers[i];
+      RenderLayerMark& end = curr.layers[i];
+      l->font.replace(dst.font.count, src.font.count, end.font.count - src.font.count);
+
+      for (size_t j = 0; j < (end.textures - src.textures); ++j) {
+        TextureDrawInfo& tex = l->texture_draws[dst.textures + j];
+        tex = l->texture_draws[src.textures + j];
+        tex.offset = tex.offset - span_mark.pt + span.begin.pt;
+      }
+      ++lit;
+      ++i;
+    }
+
+    truncate(span_mark);
+
+    return true;
+  }
+
+  Render* RenderGL::createStagingRender() {
+    return new RenderGL(gl_version);
+  }
+
+  bool RenderGL::swapBuffers(Render* staging) {
+
+    RenderGL* other = static_cast<RenderGL*>(staging);
+    if (NULL == other || this == other) {
+      printf("Error: cannot swap the buffers, invalid staging render.\n");
+      return false;
+    }
+
+    /* We're on the GL thread, so we can create the layers the other render has and we don't. */
+    RenderLayer* curr_layer = layer;
+    std::map<int, RenderLayer*>::iterator it = other->layers.begin();
+    while (it != other->layers.end()) {
+      if (layers.find(it->first) == layers.end()) {
+        setLayer(it->first);
+      }
+      ++it;
+    }
+    layer = curr_layer;
+
+    vertices_pc.swap(other->vertices_pc);
+    vertices_pt.swap(other->vertices_pt);
+    vertices_shape.swap(other->vertices_shape);
+
+    it = layers.begin();
+    while (it != layers.end()) {
+
+      RenderLayer* l = it->second;
+      std::map<int, RenderLayer*>::iterator oit = other->layers.find(it->first);
+
+      if (oit == other->layers.end()) {
+        /* Nothing was drawn on this layer. */
+        l->bg_offsets.clear();
+        l->bg_counts.clear();
+        l->fg_offsets.clear();
+        l->fg_counts.clear();
+        l->shape_offsets.clear();
+        l->shape_counts.clear();
+        l->texture_draws.clear();
+        l->font.clear();
+      }
+      else {
+        RenderLayer* ol = oit->second;
+        l->bg_offsets.swap(ol->bg_offsets);
+        l->bg_counts.swap(ol->bg_counts);
+        l->fg_offsets.swap(ol->fg_offsets);
+        l->fg_counts.swap(ol->fg_counts);
+        l->shape_offsets.swap(ol->shape_offsets);
+        l->shape_counts.swap(ol->shape_counts);
+        l->texture_draws.swap(ol->texture_draws);
+        l->font.vertices.swap(ol->font.vertices);
+        l->font.dirty_start = 0;
+        l->font.dirty_end = 0;
+      }
+
+      /* Recreated by batchTextureDraws() in the next update(). */
+      l->texture_batches.clear();
+      l->font.needs_update = true;
+
+      ++it;
+    }
+
+    /* The spans describe the vertices we had before. */
+    spans_build++;
+    other->spans_build++;
+
+    needs_update_pc = true;
+    needs_update_pt = true;
+    needs_update_shape = true;
+    dirty_pc_start = 0;
+    dirty_pc_end = 0;
+    dirty_shape_start = 0;
+    dirty_shape_end = 0;
+
+    return true;
+  }
+
+  void RenderGL::getMark(RenderMark& mark) {
+
+    mark.pc = vertices_pc.size();
+    mark.pt = vertices_pt.size();
+    mark.shape = vertices_shape.size();
+    mark.needs_update_pc = needs_update_pc;
+    mark.needs_update_pt = needs_update_pt;
+    mark.needs_update_shape = needs_update_shape;
+    mark.num_layers = layers.size();
+
+    size_t i = 0;
+    std::map<int, RenderLayer*>::iterator it = layers.begin();
+    while (it != layers.end()) {
+      RenderLayer* l = it->second;
+      RenderLayerMark& lm = mark.layers[i];
+      lm.id = it->first;
+      lm.bg = l->bg_offsets.size();
+      lm.fg = l->fg_offsets.size();
+      lm.shapes = l->shape_offsets.size();
+      lm.textures = l->texture_draws.size();
+      lm.font.count = l->font.vertices.size();
+      lm.font.needs_update = l->font.needs_update;
+      ++it;
+      ++i;
+    }
+  }
+
+  bool RenderGL::canPatch(RenderSpan& span, RenderMark& from, RenderMark& to) {
+
+    if ((to.pc - from.pc) != (span.end.pc - span.begin.pc)
+        || (to.pt - from.pt) != (span.end.pt - span.begin.pt)
+        || (to.shape - from.shape) != (span.end.shape - span.begin.shape)) 
+      {
+        return false;
+      }
+
+    /* A layer was created while patching. */
+    if (to.num_layers != span.begin.num_layers 
+        || to.num_layers != span.end.num_layers
+        || to.num_layers != from.num_layers) 
+      {
+        return false;
+      }
+
+    size_t i = 0;
+    std::map<int, RenderLayer*>::iterator it = layers.begin();
+    while (it != layers.end()) {
+
+      RenderLayer* l = it->second;
+      RenderLayerMark& sb = span.begin.layers[i];
+      RenderLayerMark& se = span.end.layers[i];
+      RenderLayerMark& fm = from.layers[i];
+      RenderLayerMark& tm = to.layers[i];
+
+      if (sb.id != tm.id || fm.id != tm.id) {
+        return false;
+      }
+
+      if ((tm.bg - fm.bg) != (se.bg - sb.bg) 
+          || (tm.fg - fm.fg) != (se.fg - sb.fg)
+          || (tm.shapes - fm.shapes) != (se.shapes - sb.shapes)
+          || (tm.textures - fm.textures) != (se.textures - sb.textures)
+          || (tm.font.count - fm.font.count) != (se.font.count - sb.font.count))
+        {
+          return false;
+        }
+
+      /* The draw lists must describe exactly the same ranges relative to the start of the span. */
+      for (size_t j = 0; j < (tm.bg - fm.bg); ++j) {
+        if (l->bg_counts[fm.bg + j] != l->bg_counts[sb.bg + j] 
+            || (l->bg_offsets[fm.bg + j] - from.pc) != (l->bg_offsets[sb.bg + j] - span.begin.pc)) 
+          {
+            return false;
+          }
+      }
+
+      for (size_t j = 0; j < (tm.fg - fm.fg); ++j) {
+        if (l->fg_counts[fm.fg + j] != l->fg_counts[sb.fg + j] 
+            || (l->fg_offsets[fm.fg + j] - from.pc) != (l->fg_offsets[sb.fg + j] - span.begin.pc)) 
+          {
+            return false;
+          }
+      }
+
+      for (size_t j = 0; j < (tm.shapes - fm.shapes); ++j) {
+        if (l->shape_counts[fm.shapes + j] != l->shape_counts[sb.shapes + j] 
+            || (l->shape_offsets[fm.shapes + j] - from.shape) != (l->shape_offsets[sb.shapes + j] - span.begin.shape)) 
+          {
+            return false;
+          }
+      }
+
+      ++it;
+      ++i;
+    }
+
+    return true;
+  }
+
+  void RenderGL::truncate(RenderMark& mark) {
+
+    vertices_pc.resize(mark.pc);
+    vertices_pt.resize(mark.pt);
+    vertices_shape.resize(mark.shape);
+    needs_update_pc = mark.needs_update_pc;
+    needs_update_pt = mark.needs_update_pt;
+    needs_update_shape = mark.needs_update_shape;
+
+    std::map<int, RenderLayer*>::iterator it = layers.begin();
+    while (it != layers.end()) {
+
+      RenderLayer* l = it->second;
+      RenderLayerMark* lm = NULL;
+
+      for (size_t i = 0; i < mark.num_layers; ++i) {
+        if (mark.layers[i].id == it->first) {
+          lm = &mark.layers[i];
+          break;
+        }
+      }
+
+      if (NULL == lm) {
+        /* Layer was created after the mark was taken. */
+        l->bg_offsets.clear();
+        l->bg_counts.clear();
+        l->fg_offsets.clear();
+        l->fg_counts.clear();
+        l->shape_offsets.clear();
+        l->shape_counts.clear();
+        l->texture_draws.clear();
+        l->font.clear();
+      }
+      else {
+        l->bg_offsets.resize(lm->bg);
+        l->bg_counts.resize(lm->bg);
+        l->fg_offsets.resize(lm->fg);
+        l->fg_counts.resize(lm->fg);
+        l->shape_offsets.resize(lm->shapes);
+        l->shape_counts.resize(lm->shapes);
+        l->texture_draws.resize(lm->textures);
+        l->font.truncate(lm->font.count);
+        l->font.needs_update = lm->font.needs_update;
+      }
+
+      ++it;
+    }
+  }
+
+  void RenderGL::writeText(float x, float y, const std::string& text, float* color) {
+
+    /* labels rarely change, so we copy the glyphs that we shaped before */
+    layer->font.setColor(color[0], color[1], color[2], color[3]);
+    layer->font.writeCached(x, y, text, BITMAP_FONT_ALIGN_LEFT);
+  }
+
+  void RenderGL::writeNumber(float x, float y, std::string number, float* color) {
+
+    layer->font.setColor(color[0], color[1], color[2], color[3]);
+    layer->font.write(x, y, number, BITMAP_FONT_ALIGN_RIGHT);
+  }
+
+  void RenderGL::writeNumber(float x, float y, const char* number, size_t len, float* color) {
+
+    layer->font.setColor(color[0], color[1], color[2], color[3]);
+    layer->font.write(x, y, number, len, BITMAP_FONT_ALIGN_RIGHT);
+  }
+
+  void RenderGL::writeIcon(float x, float y, unsigned int icon, float* color) {
+  
+    layer->font.setColor(color[0], color[1], color[2], color[3]);
+    layer->font.write(x, y, icon);
+  }
+
+  void RenderGL::enableTextInput(float x, float y, float maxw, std::string value, float* color) {
+
+    layer->text_input.x = x;
+    layer->text_input.y = y;
+    layer->text_input.w = maxw;
 
     layer->text_input.clear(); /* @todo this might be a duplicate call, when a widget makes its state editable RenderGL::clear() will be called too. */
     layer->text_input.enable();
@@ -850,7 +1805,7 @@ namespace rx {
     ww = 0;
     hh = 0;
 
-    if(!layer->icon_font.getChar(id, result)) {
+    if(!layer->font.getChar(id, result)) {
       return false;
     }
 
@@ -862,43 +1817,29 @@ namespace rx {
 
   void RenderGL::addRectangle(float x, float y, float w, float h, float* color, bool filled, float shadetop, float shadebot) {
 
-    float coltop[4]; /* color for the top */
-    float colbot[4]; /* color for the bottom */
-    float min_y = y;
-    float max_y = y + h;
-    float cola[4];
-    float colb[4];
-
-    gl_shade_colors(color, shadetop, shadebot, coltop, colbot);
-    gl_interpolate_colors_with_range(coltop, colbot, min_y, max_y, min_y, cola);
-    gl_interpolate_colors_with_range(coltop, colbot, min_y, max_y, max_y, colb);
-
-    GuiVertexPC a(x, y + h, colb);     /* bottom left */
-    GuiVertexPC b(x + w, y + h, colb); /* bottom right */
-    GuiVertexPC c(x + w, y, cola);     /* top right */
-    GuiVertexPC d(x, y, cola);         /* top left */
-  
     if(filled) { 
       layer->bg_offsets.push_back(vertices_pc.size()); 
-
-      vertices_pc.push_back(a);
-      vertices_pc.push_back(b);
-      vertices_pc.push_back(c);
-
-      vertices_pc.push_back(a);
-      vertices_pc.push_back(c);
-      vertices_pc.push_back(d);
-
+      addShape(x, y, w, h, 0.0f, GUI_STYLE_NONE, GUI_SHAPE_PLAIN, color, shadetop, shadebot);
       layer->bg_counts.push_back(vertices_pc.size() - layer->bg_offsets.back()); 
     }
     else {
       layer->fg_offsets.push_back(vertices_pc.size()); 
 
+#if defined(RENDER_GL_INSTANCED)
+      /* An instance can't be a line strip; a one pixel outline through the centers of the edge pixels. */
+      addShape(x + 0.5f, y + 0.5f, w - 1.0f, h - 1.0f, 0.0f, GUI_STYLE_NONE, GUI_SHAPE_OUTLINE, color, 0.0f, 0.0f);
+#else
+      GuiVertexPC a(x, y + h, color);     /* bottom left */
+      GuiVertexPC b(x + w, y + h, color); /* bottom right */
+      GuiVertexPC c(x + w, y, color);     /* top right */
+      GuiVertexPC d(x, y, color);         /* top left */
+
       vertices_pc.push_back(a);
       vertices_pc.push_back(b);
       vertices_pc.push_back(c);
       vertices_pc.push_back(d);
       vertices_pc.push_back(a);
+#endif
 
       layer->fg_counts.push_back(vertices_pc.size() - layer->fg_offsets.back());
     }
@@ -907,11 +1848,7 @@ namespace rx {
   }
 
   void RenderGL::addRectangle(float x, float y, float w, float h, TextureInfo* tex) {
-    /*
-      @todo - disabled the texture feature when implementing the layered draws. 
-              I'm not sure if we need to reimplement this feature. 
-     */
-#if 0
+
     TextureInfoGL* tex_gl = static_cast<TextureInfoGL*>(tex);
     float tex_w = 1.0f;
     float tex_h = 1.0f;
@@ -946,285 +1883,127 @@ namespace rx {
 
     draw_info.count = vertices_pt.size() - draw_info.offset;
 
-    texture_draws.push_back(draw_info);
-
-    std::sort(texture_draws.begin(), texture_draws.end(), TextureDrawInfoSorter());
+    /* Sorted and merged once per update, see batchTextureDraws(). */
+    layer->texture_draws.push_back(draw_info);
 
     needs_update_pt = true;
-#endif
   }
 
   void RenderGL::addRoundedRectangle(float x, float y, float w, float h, float radius, float* color, bool filled, float shadetop, float shadebot, int corners) {
 
-    int resolution = 7;
-    float angle = 0.0;
-    float rx = 0.0f;
-    float ry = 0.0f;
-    float min_y = y;
-    float max_y = y + h;
-    float coltop[4];                 /* color for the top */
-    float colbot[4];                 /* color for the bottom */
-    float intcol[4];                 /* interpolated color */
-    float ca = 0.0f;
-    float sa = 0.0f;
-
-    /* Calculate the sin/cos values. */
-    /* @todo we could cache the output of sin/cos to optimize a bit. */
-    std::vector<float> points;
-    for (int i = 0; i <= resolution; ++i) {
-      ca = radius * cos(angle);
-      sa = radius * sin(angle);
-      points.push_back(ca);
-      points.push_back(sa);
-      angle += (HALF_PI / resolution);
-    }
-
+    /* The outline is a quad too, so it's drawn with the other shapes; after the fill that was added before it. */
     if (true == filled) {
+      addRoundedShape(x, y, w, h, radius, corners, GUI_SHAPE_FILL, color, shadetop, shadebot);
+    }
+    else {
+      addRoundedShape(x, y, w, h, radius, corners, GUI_SHAPE_OUTLINE, color, 0.0f, 0.0f);
+    }
+  }
+  
+  /* Draws a "emboss", "shadow" line underneath buttons, selects etc.. gives the gui a bit of depth. */
+  void RenderGL::addRoundedShadowLine(float x, float y, float w, float h, float radius, float* color, int corners) {
+    addRoundedShape(x, y, w, h, radius, corners, GUI_SHAPE_SHADOW, color, 0.0f, 0.0f);
+  }
 
-      gl_shade_colors(color, shadetop, shadebot, coltop, colbot);
-
-      layer->bg_offsets.push_back(vertices_pc.size()); 
-
-      /* bottom right corner. */
-      rx = x + w - radius;
-      ry = y + h - radius;
-      if (corners & GUI_CORNER_BOTTOM_RIGHT) {
-        for (size_t i = 0; i < (points.size()/2)-1; ++i) {
-          gl_add_shaded_vertex_pc(rx, ry, min_y, max_y, coltop, colbot, intcol, vertices_pc);
-          gl_add_shaded_vertex_pc(rx + points[(i+1) * 2 + 0], ry + points[(i+1) * 2 + 1],  min_y, max_y, coltop, colbot, intcol, vertices_pc); 
-          gl_add_shaded_vertex_pc(rx + points[i * 2 + 0], ry + points[i * 2 + 1], min_y, max_y, coltop, colbot, intcol, vertices_pc);
-        }
-      }
-      else {
-        gl_add_shaded_vertex_pc(rx, ry + radius, min_y, max_y, coltop, colbot, intcol, vertices_pc);
-        gl_add_shaded_vertex_pc(rx + radius, ry + radius, min_y, max_y, coltop, colbot, intcol, vertices_pc);
-        gl_add_shaded_vertex_pc(rx + radius, ry, min_y, max_y, coltop, colbot, intcol, vertices_pc);
-
-        gl_add_shaded_vertex_pc(rx, ry + radius, min_y, max_y, coltop, colbot, intcol, vertices_pc);
-        gl_add_shaded_vertex_pc(rx + radius, ry , min_y, max_y, coltop, colbot, intcol, vertices_pc);
-        gl_add_shaded_vertex_pc(rx, ry , min_y, max_y, coltop, colbot, intcol, vertices_pc);
-      }
+  void RenderGL::addRoundedShape(float x, float y, float w, float h, float radius, int corners, int mode, float* color, float shadetop, float shadebot) {
 
-      /* top right corner */
-      rx = x + w - radius;
-      ry = y + radius;
-      if (corners & GUI_CORNER_TOP_RIGHT) { 
-        for (size_t i = 0; i < (points.size()/2)-1; ++i) {
-          gl_add_shaded_vertex_pc(rx, ry, min_y, max_y, coltop, colbot, intcol, vertices_pc);
-          gl_add_shaded_vertex_pc(rx + points[i * 2 + 0], (ry - points[i * 2 + 1]), min_y, max_y, coltop, colbot, intcol, vertices_pc);
-          gl_add_shaded_vertex_pc(rx + points[(i+1) * 2 + 0], (ry - points[(i+1) * 2 + 1]),min_y, max_y, coltop, colbot, intcol, vertices_pc);
-        }
-      }
-      else {
-        gl_add_shaded_vertex_pc(rx, ry, min_y, max_y, coltop, colbot, intcol, vertices_pc);
-        gl_add_shaded_vertex_pc(rx + radius, ry, min_y, max_y, coltop, colbot, intcol, vertices_pc);
-        gl_add_shaded_vertex_pc(rx + radius, ry - radius, min_y, max_y, coltop, colbot, intcol, vertices_pc);
+#if defined(RENDER_GL_INSTANCED)
+    layer->bg_offsets.push_back(vertices_pc.size()); 
+    addShape(x, y, w, h, radius, corners, mode, color, shadetop, shadebot);
+    layer->bg_counts.push_back(vertices_pc.size() - layer->bg_offsets.back());
+    needs_update_pc = true;
+#else
+    layer->shape_offsets.push_back(vertices_shape.size()); 
+    addShape(x, y, w, h, radius, corners, mode, color, shadetop, shadebot);
+    layer->shape_counts.push_back(vertices_shape.size() - layer->shape_offsets.back());
+    needs_update_shape = true;
+#endif
+  }
 
-        gl_add_shaded_vertex_pc(rx, ry, min_y, max_y, coltop, colbot, intcol, vertices_pc);
-        gl_add_shaded_vertex_pc(rx + radius, ry - radius, min_y, max_y, coltop, colbot, intcol, vertices_pc);
-        gl_add_shaded_vertex_pc(rx, ry - radius, min_y, max_y, coltop, colbot, intcol, vertices_pc);
-      }
+  void RenderGL::addShape(float x, float y, float w, float h, float radius, int corners, int mode, float* color, float shadetop, float shadebot) {
 
-      /* fill right. */
-      gl_add_shaded_vertex_pc(rx, (y + h - radius), min_y, max_y, coltop, colbot, intcol, vertices_pc);
-      gl_add_shaded_vertex_pc(rx + radius, (y + h - radius), min_y, max_y, coltop, colbot, intcol, vertices_pc);
-      gl_add_shaded_vertex_pc(rx + radius, ry, min_y, max_y, coltop, colbot, intcol, vertices_pc);
-      gl_add_shaded_vertex_pc(rx, (y + h - radius), min_y, max_y, coltop, colbot, intcol, vertices_pc);
-      gl_add_shaded_vertex_pc(rx + radius, ry, min_y, max_y, coltop, colbot, intcol, vertices_pc);
-      gl_add_shaded_vertex_pc(rx, ry, min_y, max_y, coltop, colbot, intcol, vertices_pc);
-
-      /* top left corner */
-      rx = x + radius;
-      ry = y + radius;
-      if (corners & GUI_CORNER_TOP_LEFT) {
-        for (size_t i = 0; i < (points.size()/2)-1; ++i) {
-          gl_add_shaded_vertex_pc(rx, ry, min_y, max_y, coltop, colbot, intcol, vertices_pc);
-          gl_add_shaded_vertex_pc(rx - points[(i+1) * 2 + 0], (ry - points[(i+1) * 2 + 1]), min_y, max_y, coltop, colbot, intcol, vertices_pc);
-          gl_add_shaded_vertex_pc(rx - points[i * 2 + 0],  (ry - points[i * 2 + 1]), min_y, max_y, coltop, colbot, intcol, vertices_pc);
-        }
-      }
-      else {
-        gl_add_shaded_vertex_pc(rx - radius, ry, min_y, max_y, coltop, colbot, intcol, vertices_pc);
-        gl_add_shaded_vertex_pc(rx, ry, min_y, max_y, coltop, colbot, intcol, vertices_pc);
-        gl_add_shaded_vertex_pc(rx, ry - radius, min_y, max_y, coltop, colbot, intcol, vertices_pc);
+    int flags = mode * 16 + (corners & GUI_CORNER_ALL);
 
-        gl_add_shaded_vertex_pc(rx - radius, ry, min_y, max_y, coltop, colbot, intcol, vertices_pc);
-        gl_add_shaded_vertex_pc(rx, ry - radius, min_y, max_y, coltop, colbot, intcol, vertices_pc);
-        gl_add_shaded_vertex_pc(rx - radius, ry - radius, min_y, max_y, coltop, colbot, intcol, vertices_pc);
-      }
+    radius = std::max<float>(0.0f, std::min<float>(radius, std::min<float>(w, h) * 0.5f));
 
-      /* fill left. */
-      gl_add_shaded_vertex_pc(rx - radius, (y + h - radius), min_y, max_y, coltop, colbot, intcol, vertices_pc);
-      gl_add_shaded_vertex_pc(rx, ry, min_y, max_y, coltop, colbot, intcol, vertices_pc);
-      gl_add_shaded_vertex_pc(rx - radius, ry, min_y, max_y, coltop, colbot, intcol, vertices_pc);
-      gl_add_shaded_vertex_pc(rx - radius, (y + h - radius), min_y, max_y, coltop, colbot, intcol, vertices_pc);
-      printf("%s : %d, I think the line below is wrong, check with line polygon mode, the rx + radius is too far to the right if I'm correct.", __FILE__, __LINE__);
-      gl_add_shaded_vertex_pc(rx + radius, (y + h - radius), min_y, max_y, coltop, colbot, intcol, vertices_pc);
-      gl_add_shaded_vertex_pc(rx, ry, min_y, max_y, coltop, colbot, intcol, vertices_pc);
-
-      /* bottom left corner */
-      rx = x + radius;
-      ry = y + h - radius;
-      if (corners & GUI_CORNER_BOTTOM_LEFT) {
-        for (size_t i = 0; i < (points.size()/2)-1; ++i) {
-          gl_add_shaded_vertex_pc(rx, ry, min_y, max_y, coltop, colbot, intcol, vertices_pc);
-          gl_add_shaded_vertex_pc(rx - points[i * 2 + 0], ry + points[i * 2 + 1], min_y, max_y, coltop, colbot, intcol, vertices_pc);
-          gl_add_shaded_vertex_pc(rx - points[(i+1) * 2 + 0], ry + points[(i+1) * 2 + 1], min_y, max_y, coltop, colbot, intcol, vertices_pc);
-        }
-      }
-      else {
-        gl_add_shaded_vertex_pc(rx - radius, ry + radius, min_y, max_y, coltop, colbot, intcol, vertices_pc);
-        gl_add_shaded_vertex_pc(rx + radius, ry + radius, min_y, max_y, coltop, colbot, intcol, vertices_pc);
-        gl_add_shaded_vertex_pc(rx, ry, min_y, max_y, coltop, colbot, intcol, vertices_pc);
+#if defined(RENDER_GL_INSTANCED)
+    vertices_pc.push_back(GuiRectPC(x, y, w, h, color, shadetop, shadebot, radius, flags));
+#else
+    float coltop[4];                 /* color for the top */
+    float colbot[4];                 /* color for the bottom */
+    float hw = w * 0.5f;
+    float hh = h * 0.5f;
+    float e = 1.0f;                  /* we grow the quad of a rounded shape by a pixel so the anti aliased edge fits. */
 
-        gl_add_shaded_vertex_pc(rx - radius, ry + radius, min_y, max_y, coltop, colbot, intcol, vertices_pc);
-        gl_add_shaded_vertex_pc(rx, ry, min_y, max_y, coltop, colbot, intcol, vertices_pc);
-        gl_add_shaded_vertex_pc(rx - radius, ry, min_y, max_y, coltop, colbot, intcol, vertices_pc);
-      }
+    gl_shade_colors(color, shadetop, shadebot, coltop, colbot);
 
-      /* fill center */
-      gl_add_shaded_vertex_pc(x + radius, y + h, min_y, max_y, coltop, colbot, intcol, vertices_pc);
-      gl_add_shaded_vertex_pc(x + w - radius, y, min_y, max_y, coltop, colbot, intcol, vertices_pc);
-      gl_add_shaded_vertex_pc(x + radius, y, min_y, max_y, coltop, colbot, intcol, vertices_pc);
-      gl_add_shaded_vertex_pc(x + radius, y + h, min_y, max_y, coltop, colbot, intcol, vertices_pc);
-      gl_add_shaded_vertex_pc(x + w - radius, y + h, min_y, max_y, coltop, colbot, intcol, vertices_pc);
-      gl_add_shaded_vertex_pc(x + w - radius, y, min_y, max_y, coltop, colbot, intcol, vertices_pc);
+    if (GUI_SHAPE_PLAIN == mode) {
 
-      layer->bg_counts.push_back(vertices_pc.size() - layer->bg_offsets.back());
+      GuiVertexPC a(x, y + h, colbot);            /* bottom left */
+      GuiVertexPC b(x + w, y + h, colbot);        /* bottom right */
+      GuiVertexPC c(x + w, y, coltop);            /* top right */
+      GuiVertexPC d(x, y, coltop);                /* top left */
 
-    } /* true == filled */
-    else {
+      vertices_pc.push_back(a);
+      vertices_pc.push_back(b);
+      vertices_pc.push_back(c);
 
-      layer->fg_offsets.push_back(vertices_pc.size()); 
+      vertices_pc.push_back(a);
+      vertices_pc.push_back(c);
+      vertices_pc.push_back(d);
+      return;
+    }
 
-      /* bottom right corner. */
-      if (corners & GUI_CORNER_BOTTOM_RIGHT) {
-        rx = x + w - radius;
-        ry = y + h - radius;
-        for (int i = (resolution - 1); i > 0 ; --i) {
-          vertices_pc.push_back(GuiVertexPC(rx + points[(i * 2) + 0], ry + points[(i * 2) + 1], color));
-        }
-      }
-      else {
-        vertices_pc.push_back(GuiVertexPC(x + w, y + h, color));
-      }
+    GuiShapeVertex a(x - e, y + h + e, colbot);      /* bottom left */
+    GuiShapeVertex b(x + w + e, y + h + e, colbot);  /* bottom right */
+    GuiShapeVertex c(x + w + e, y - e, coltop);      /* top right */
+    GuiShapeVertex d(x - e, y - e, coltop);          /* top left */
 
-      /* top right corner */
-      rx = x + w - radius;
-      ry = y + radius;
-      if (corners & GUI_CORNER_TOP_RIGHT) { 
-        for (size_t i = 0; i < resolution ; ++i) {
-          vertices_pc.push_back(GuiVertexPC(rx + points[(i * 2) + 0], ry - points[(i * 2) + 1], color));
-        }
-      }
-      else {
-        vertices_pc.push_back(GuiVertexPC(x + w, y, color));
-      }
+    a.setShape(-hw - e,  hh + e, hw, hh, radius, flags);
+    b.setShape( hw + e,  hh + e, hw, hh, radius, flags);
+    c.setShape( hw + e, -hh - e, hw, hh, radius, flags);
+    d.setShape(-hw - e, -hh - e, hw, hh, radius, flags);
 
-      /* top left corner */
-      rx = x + radius;
-      ry = y + radius;
-      if (corners & GUI_CORNER_TOP_LEFT) {
-        for (int i = (resolution - 1); i > 0 ; --i) {
-          vertices_pc.push_back(GuiVertexPC(rx - points[(i * 2) + 0], ry - points[(i * 2) + 1], color));
-        }
-      }
-      else {
-        //gl_add_shaded_vertex_pc(x, y, min_y, max_y, coltop, colbot, intcol, vertices_pc);      
-        vertices_pc.push_back(GuiVertexPC(x, y, color));
-      }
+    vertices_shape.push_back(a);
+    vertices_shape.push_back(b);
+    vertices_shape.push_back(c);
 
-      /* bottom left corner */
-      rx = x + radius;
-      ry = y + h - radius;
-      if (corners & GUI_CORNER_BOTTOM_LEFT) {
-        for (size_t i = 0; i < resolution ; ++i) {
-          vertices_pc.push_back(GuiVertexPC(rx - points[(i * 2) + 0], ry + points[(i * 2) + 1], color));
-        }
-      }
-      else {
-        vertices_pc.push_back(GuiVertexPC(x, y + h, color));
-      }
+    vertices_shape.push_back(a);
+    vertices_shape.push_back(c);
+    vertices_shape.push_back(d);
+#endif
+  }
 
-      /* back to bottom right again to close loop. */
-      if (corners & GUI_CORNER_BOTTOM_RIGHT) {
-        rx = x + w - radius;
-        ry = y + h - radius;
-        vertices_pc.push_back(GuiVertexPC(rx + points[(resolution -1) * 2 + 0], ry + points[(resolution-1) * 2 + 1], color));
-      }
-      else {
-        vertices_pc.push_back(GuiVertexPC(x + w, y + h, color));
-      }
+#if defined(RENDER_GL_INSTANCED)
+  void RenderGL::drawRects(std::vector<GLint>& offsets, std::vector<GLsizei>& counts) {
 
-      layer->fg_counts.push_back(vertices_pc.size() - layer->fg_offsets.back());
+#if RENDER_GL_UPLOAD == RENDER_GL_UPLOAD_RING
+    size_t base = ring_pc.offset;
+#else
+    size_t base = 0;
+#endif
 
+    size_t i = 0;
+    GLint start = 0;
+    GLsizei count = 0;
 
-    } /* false == filled */
-    needs_update_pc = true;    
-  }
-  
-  /* Draws a "emboss", "shadow" line underneath buttons, selects etc.. gives the gui a bit of depth. */
-  void RenderGL::addRoundedShadowLine(float x, float y, float w, float h, float radius, float* color, int corners) {
+    /* Without base instances (GL 4.2) we point the attributes to the first instance of every range. */
+    while (i < offsets.size()) {
 
-    int resolution = 7;
-    float angle = 0.0;
-    float rx;
-    float ry;
-    float ca;
-    float sa;
-    float min_y = y + h - radius;
-    float max_y = y + h;
-    float yy;
-    float p;
-
-    /* Calculate the sin/cos values. */
-    /* @todo we could cache the output of sin/cos to optimize a bit. */
-    std::vector<float> points;
-    for (int i = 0; i <= resolution; ++i) {
-      ca = radius * cos(angle);
-      sa = radius * sin(angle);
-      points.push_back(ca);
-      points.push_back(sa);
-      angle += (HALF_PI / resolution);
-    }
+      start = offsets[i];
+      count = counts[i];
+      ++i;
 
-    layer->fg_offsets.push_back(vertices_pc.size()); 
-
-    /* bottom left corner */
-    rx = x + radius;
-    ry = y + h - radius;
-    if (corners & GUI_CORNER_BOTTOM_LEFT) {
-      for (size_t i = 0; i < resolution ; ++i) {
-        yy = ry + points[(i * 2) + 1];
-        p = 1.0 - (max_y - yy) / (max_y - min_y);;
-        color[3] = p * p;
-        vertices_pc.push_back(GuiVertexPC(rx - points[(i * 2) + 0], yy, color));
-      }
-    }
-    else {
-      vertices_pc.push_back(GuiVertexPC(x, y + h, color));
-    }
-    color[1] = 0.6;
-
-    /* bottom right corner. */
-    if (corners & GUI_CORNER_BOTTOM_RIGHT) {
-      rx = x + w - radius;
-      ry = y + h - radius;
-      for (int i = (resolution - 1); i > 0 ; --i) {
-        yy = ry + points[(i * 2) + 1];
-        p = 1.0 - (max_y - yy) / (max_y - min_y);
-        color[3] = p * p;
-        vertices_pc.push_back(GuiVertexPC(rx + points[(i * 2) + 0], yy, color));
+      while (i < offsets.size() && offsets[i] == (start + count)) {
+        count += counts[i];
+        ++i;
       }
-    }
-    else {
-      vertices_pc.push_back(GuiVertexPC(x + w, y + h, color));
-    }
-
-    layer->fg_counts.push_back(vertices_pc.size() - layer->fg_offsets.back());
 
-    needs_update_pc = true;
+      setupPositionColorAttributes(base + start * sizeof(GuiRectPC));
+      glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, count);
+    }
   }
+#endif
 
   /* -------------------------------------------------------------------------------------------------------------- */
 
@@ -1243,6 +2022,70 @@ namespace rx {
     setColor(r,g,b,a);
   }
 
+  GuiShapeVertex::GuiShapeVertex() {
+    setPos(0.0f, 0.0f);
+    setColor(1.0f, 1.0f, 1.0f, 1.0f);
+    setShape(0.0f, 0.0f, 0.0f, 0.0f, 0.0f, GUI_SHAPE_PLAIN);
+  }
+
+  GuiShapeVertex::GuiShapeVertex(float x, float y, float* col) {
+    setPos(x, y);
+    setColor(col[0], col[1], col[2], col[3]);
+    setShape(0.0f, 0.0f, 0.0f, 0.0f, 0.0f, GUI_SHAPE_PLAIN);
+  }
+
+#if RENDER_GL_VERTEX_FORMAT == RENDER_GL_VERTEX_COMPACT
+
+  static int16_t gui_quantize_pos(float v) {
+    v = floorf(v * RENDER_GL_POS_SCALE + 0.5f);
+    return (int16_t)std::max<float>(-32768.0f, std::min<float>(32767.0f, v));
+  }
+
+  static uint8_t gui_quantize_color(float v) {
+    return (uint8_t)(std::max<float>(0.0f, std::min<float>(1.0f, v)) * 255.0f + 0.5f);
+  }
+
+  void GuiVertexPC::setPos(float x, float y) {
+    pos[0] = gui_quantize_pos(x);
+    pos[1] = gui_quantize_pos(y);
+  }
+
+  void GuiVertexPC::setColor(float r, float g, float b, float a) {
+    color[0] = gui_quantize_color(r);
+    color[1] = gui_quantize_color(g);
+    color[2] = gui_quantize_color(b);
+    color[3] = gui_quantize_color(a);
+  }
+
+  void GuiVertexPC::print() {
+    printf("x: %3.2f, y: %3.2f, r: %3d, g: %3d, b: %3d a: %3d\n", 
+           float(pos[0]) / RENDER_GL_POS_SCALE, float(pos[1]) / RENDER_GL_POS_SCALE, 
+           color[0], color[1], color[2], color[3]);
+  }
+
+  void GuiShapeVertex::setPos(float x, float y) {
+    pos[0] = gui_quantize_pos(x);
+    pos[1] = gui_quantize_pos(y);
+  }
+
+  void GuiShapeVertex::setColor(float r, float g, float b, float a) {
+    color[0] = gui_quantize_color(r);
+    color[1] = gui_quantize_color(g);
+    color[2] = gui_quantize_color(b);
+    color[3] = gui_quantize_color(a);
+  }
+
+  void GuiShapeVertex::setShape(float lx, float ly, float hw, float hh, float radius, int flags) {
+    shape[0] = gui_quantize_pos(lx);
+    shape[1] = gui_quantize_pos(ly);
+    shape[2] = gui_quantize_pos(hw);
+    shape[3] = gui_quantize_pos(hh);
+    corner[0] = gui_quantize_pos(radius);
+    corner[1] = (int16_t)flags;
+  }
+
+#else
+
   void GuiVertexPC::setPos(float x, float y) {
     pos[0] = x;
     pos[1] = y;
@@ -1259,6 +2102,88 @@ namespace rx {
     printf("x: %3.2f, y: %3.2f, r: %3.2f, g: %3.2f, b: %3.2f a: %3.2f\n", pos[0], pos[1], color[0], color[1], color[2], color[3]);
   }
 
+  void GuiShapeVertex::setPos(float x, float y) {
+    pos[0] = x;
+    pos[1] = y;
+  }
+
+  void GuiShapeVertex::setColor(float r, float g, float b, float a) {
+    color[0] = r;
+    color[1] = g;
+    color[2] = b;
+    color[3] = a;
+  }
+
+  void GuiShapeVertex::setShape(float lx, float ly, float hw, float hh, float radius, int flags) {
+    shape[0] = lx;
+    shape[1] = ly;
+    shape[2] = hw;
+    shape[3] = hh;
+    corner[0] = radius;
+    corner[1] = flags;
+  }
+
+#endif
+
+  /* -------------------------------------------------------------------------------------------------------------- */
+
+  GuiRectPC::GuiRectPC() {
+    float col[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+    *this = GuiRectPC(0.0f, 0.0f, 0.0f, 0.0f, col, 0.0f, 0.0f, 0.0f, GUI_SHAPE_PLAIN);
+  }
+
+#if RENDER_GL_VERTEX_FORMAT == RENDER_GL_VERTEX_COMPACT
+
+  static int16_t gui_quantize_shade(float v) {
+    return (int16_t)(std::max<float>(-1.0f, std::min<float>(1.0f, v)) * 32767.0f);
+  }
+
+  GuiRectPC::GuiRectPC(float x, float y, float w, float h, float* col, float shadetop, float shadebot, float radius, int flags) {
+    rect[0] = gui_quantize_pos(x);
+    rect[1] = gui_quantize_pos(y);
+    rect[2] = gui_quantize_pos(w);
+    rect[3] = gui_quantize_pos(h);
+    color[0] = gui_quantize_color(col[0]);
+    color[1] = gui_quantize_color(col[1]);
+    color[2] = gui_quantize_color(col[2]);
+    color[3] = gui_quantize_color(col[3]);
+    shade[0] = gui_quantize_shade(shadetop);
+    shade[1] = gui_quantize_shade(shadebot);
+    corner[0] = gui_quantize_pos(radius);
+    corner[1] = (int16_t)flags;
+  }
+
+  void GuiRectPC::print() {
+    printf("x: %3.2f, y: %3.2f, w: %3.2f, h: %3.2f, r: %3d, g: %3d, b: %3d a: %3d, flags: %d\n", 
+           float(rect[0]) / RENDER_GL_POS_SCALE, float(rect[1]) / RENDER_GL_POS_SCALE, 
+           float(rect[2]) / RENDER_GL_POS_SCALE, float(rect[3]) / RENDER_GL_POS_SCALE, 
+           color[0], color[1], color[2], color[3], corner[1]);
+  }
+
+#else
+
+  GuiRectPC::GuiRectPC(float x, float y, float w, float h, float* col, float shadetop, float shadebot, float radius, int flags) {
+    rect[0] = x;
+    rect[1] = y;
+    rect[2] = w;
+    rect[3] = h;
+    color[0] = col[0];
+    color[1] = col[1];
+    color[2] = col[2];
+    color[3] = col[3];
+    shade[0] = shadetop;
+    shade[1] = shadebot;
+    corner[0] = radius;
+    corner[1] = flags;
+  }
+
+  void GuiRectPC::print() {
+    printf("x: %3.2f, y: %3.2f, w: %3.2f, h: %3.2f, r: %3.2f, g: %3.2f, b: %3.2f a: %3.2f, flags: %d\n", 
+           rect[0], rect[1], rect[2], rect[3], color[0], color[1], color[2], color[3], int(corner[1]));
+  }
+
+#endif
+
   /* -------------------------------------------------------------------------------------------------------------- */
 
   GuiVertexPT::GuiVertexPT() {
@@ -1402,6 +2327,15 @@ namespace rx {
     dest[15] = 1.0f;
   }
 
+  void gui_scale_pc_projection(float* pm) {
+#if RENDER_GL_VERTEX_FORMAT == RENDER_GL_VERTEX_COMPACT && !defined(RENDER_GL_INSTANCED) /* GUI_RENDER_RECT_VS scales the instances itself. */
+    float s = 1.0f / RENDER_GL_POS_SCALE;
+    for (int i = 0; i < 8; ++i) {
+      pm[i] *= s;
+    }
+#endif
+  }
+
 } /* namespace rx */
 
 #endif
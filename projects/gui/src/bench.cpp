@@ -0,0 +1,277 @@
+/*
+
+  remoxly_bench
+  -------------
+
+  Builds a synthetic Panel with `groups` Groups of `widgets` widgets each
+  (a mix of Slider<int>, Slider<float>, Toggle, ColorRGB, Select and Text)
+  and renders it into a RenderRecorder, so it runs without a GL context.
+  For every step we print the average time of `iterations` runs. Run this
+  before and after you change something in the widgets or renderers.
+
+  Usage:
+
+      ./remoxly_bench [groups] [widgets per group] [iterations] [virtual]
+
+  Pass 1 for `virtual` to measure a Panel with virtual scrolling.
+
+  When REMOXLY_BENCH_SERIALIZER is defined (the remote project does this)
+  we also measure Serializer::serialize().
+
+ */
+#include <stdlib.h>
+#include <stdio.h>
+#include <vector>
+#include <string>
+
+#if defined(_WIN32)
+#  include <windows.h>
+#else
+#  include <sys/time.h>
+#endif
+
+#include <gui/Remoxly.h>
+#include <gui/RenderRecorder.h>
+
+#if defined(REMOXLY_BENCH_SERIALIZER)
+#  include <gui/remote/Serializer.h>
+#endif
+
+using namespace rx;
+
+/* -------------------------------------------------------------------------------------------------------------- */
+
+struct BenchValues {                                             /* The widgets keep references to their values. */
+  int* ints;
+  float* floats;
+  bool* bools;
+  float* colors;
+  std::string* texts;
+};
+
+static double bench_now();                                       /* Returns the time in microseconds. */
+static void bench_print(const char* name, double total, int iterations);
+static void bench_menu_click(int menuid, int optionid, void* user);
+
+/* -------------------------------------------------------------------------------------------------------------- */
+
+int main(int argc, char** argv) {
+
+  int num_groups = (argc > 1) ? atoi(argv[1]) : 50;
+  int num_widgets = (argc > 2) ? atoi(argv[2]) : 20;
+  int iterations = (argc > 3) ? atoi(argv[3]) : 20;
+  int is_virtual = (argc > 4) ? atoi(argv[4]) : 0;
+  int total = num_groups * num_widgets;
+  int types = 6;
+  bool result = false;
+  double start = 0.0;
+  double d = 0.0;
+
+  if (num_groups <= 0 || num_widgets <= 0 || iterations <= 0) {
+    printf("Error: usage: remoxly_bench [groups] [widgets per group] [iterations] [virtual]\n");
+    exit(EXIT_FAILURE);
+  }
+
+  BenchValues values;
+  values.ints = new int[total];
+  values.floats = new float[total];
+  values.bools = new bool[total];
+  values.colors = new float[total * 3];
+  values.texts = new std::string[total];
+
+  std::vector<std::string> options;
+  options.push_back("first");
+  options.push_back("second");
+  options.push_back("third");
+
+  /* Create the tree. */
+  RenderRecorder* render = new RenderRecorder();
+  Panel* panel = new Panel(render, 720);
+
+  if (is_virtual) {
+    panel->enableVirtualScroll();
+  }
+
+  start = bench_now();
+  for (int i = 0; i < num_groups; ++i) {
+
+    char label[64];
+    sprintf(label, "Group %d", i);
+    Group* group = panel->addGroup(label);
+
+    for (int j = 0; j < num_widgets; ++j) {
+
+      int dx = i * num_widgets + j;
+      values.ints[dx] = dx % 100;
+      values.floats[dx] = 0.5f;
+      values.bools[dx] = (dx % 2) == 0;
+      values.colors[dx * 3 + 0] = values.colors[dx * 3 + 1] = values.colors[dx * 3 + 2] = 1.0f;
+      values.texts[dx] = "value";
+
+      sprintf(label, "widget %d", dx);
+
+      switch (dx % types) {
+        case 0: { group->add(new Slider<int>(label, values.ints[dx], 0, 100, 1));                 break; }
+        case 1: { group->add(new Slider<float>(label, values.floats[dx], 0.0f, 1.0f, 0.01f));     break; }
+        case 2: { group->add(new Toggle(label, values.bools[dx]));                                break; }
+        case 3: { group->add(new ColorRGB(label, &values.colors[dx * 3]));                        break; }
+        case 4: { group->add(new Select(label, dx, options, bench_menu_click, NULL));             break; }
+        case 5: { group->add(new Text(label, values.texts[dx]));                                  break; }
+      }
+    }
+  }
+  d = bench_now() - start;
+
+  printf("\n");
+  printf("groups: %d, widgets per group: %d, widgets: %d, iterations: %d, virtual: %s\n", num_groups, num_widgets, total, iterations, (is_virtual) ? "yes" : "no");
+  printf("-----------------------------------------------------------------------\n");
+  bench_print("create tree", d, 1);
+
+  /* First full build. */
+  panel->draw();
+
+  /* position() */
+  start = bench_now();
+  for (int i = 0; i < iterations; ++i) {
+    panel->position();
+  }
+  bench_print("position()", bench_now() - start, iterations);
+
+  /* build(); the recorder must be cleared like Panel::update() does. */
+  start = bench_now();
+  for (int i = 0; i < iterations; ++i) {
+    render->clear();
+    panel->build();
+  }
+  bench_print("clear() + build()", bench_now() - start, iterations);
+
+  /* needsRedraw() on a clean tree; this is what every idle frame costs. */
+  panel->setNeedsRedraw();
+  panel->draw();
+
+  start = bench_now();
+  for (int i = 0; i < iterations; ++i) {
+    result |= panel->needsRedraw();
+  }
+  bench_print("needsRedraw()", bench_now() - start, iterations);
+
+  /* Move the mouse over the visible area of the panel. */
+  int steps = 100;
+  start = bench_now();
+  for (int i = 0; i < iterations; ++i) {
+    for (int j = 0; j < steps; ++j) {
+      panel->onMouseMove(panel->x + (j * 7) % panel->w, panel->y + (j * 13) % panel->h);
+    }
+  }
+  bench_print("onMouseMove() x 100", bench_now() - start, iterations);
+
+  /* Click on a slider, which changes its value and redraws it. */
+  Widget* target = panel->groups[0]->children[0];
+  float mx = target->x + target->w - 10;
+  float my = target->y + target->h * 0.5f;
+
+  start = bench_now();
+  for (int i = 0; i < iterations; ++i) {
+    panel->onMouseMove(mx, my);
+    panel->onMousePress(mx, my, 0, 0);
+    panel->onMouseRelease(mx, my, 0, 0);
+  }
+  bench_print("press + release", bench_now() - start, iterations);
+
+  /* A frame in which one widget changed. */
+  start = bench_now();
+  for (int i = 0; i < iterations; ++i) {
+    target->setNeedsRedraw();
+    panel->draw();
+  }
+  bench_print("draw() one dirty widget", bench_now() - start, iterations);
+
+  /* A frame in which everything changed. */
+  start = bench_now();
+  for (int i = 0; i < iterations; ++i) {
+    panel->setNeedsRedraw();
+    panel->draw();
+  }
+  bench_print("draw() full rebuild", bench_now() - start, iterations);
+
+  /* Scroll through the panel; every step repositions and rebuilds it. */
+  start = bench_now();
+  for (int i = 0; i < iterations; ++i) {
+    panel->scroll.setPercentageValue(float(i) / iterations);
+    panel->scroll.setNeedsRedraw();
+    panel->draw();
+  }
+  bench_print("draw() while scrolling", bench_now() - start, iterations);
+
+#if defined(REMOXLY_BENCH_SERIALIZER)
+  Serializer serializer;
+  std::string json;
+  serializer.addPanel(panel);
+
+  start = bench_now();
+  for (int i = 0; i < iterations; ++i) {
+    json.clear();
+    serializer.serialize(json);
+  }
+  bench_print("Serializer::serialize()", bench_now() - start, iterations);
+  printf("%-28s %10lu bytes\n", "json", (unsigned long)json.size());
+#endif
+
+  /* What the last full build produced. */
+  size_t shape_vertices = render->getNumShapeVertices();
+  size_t glyph_vertices = render->getNumGlyphVertices();
+  size_t shape_bytes = 0;
+
+  for (size_t i = 0; i < render->shapes.size(); ++i) {
+    switch (render->shapes[i].type) {
+      case GUI_RECORD_RECTANGLE: { shape_bytes += 6 * 24; break; }   /* GuiVertexPC: pos, color */
+      case GUI_RECORD_OUTLINE:   { shape_bytes += 5 * 24; break; }
+      case GUI_RECORD_TEXTURE:   { shape_bytes += 6 * 16; break; }   /* GuiVertexPT: pos, texcoord */
+      default:                   { shape_bytes += 6 * 48; break; }   /* GuiShapeVertex: pos, color, shape, corner */
+    }
+  }
+
+  printf("-----------------------------------------------------------------------\n");
+  printf("%-28s %10lu\n", "shapes", (unsigned long)render->shapes.size());
+  printf("%-28s %10lu\n", "text runs", (unsigned long)render->texts.size());
+  printf("%-28s %10lu\n", "shape vertices", (unsigned long)shape_vertices);
+  printf("%-28s %10lu\n", "glyph vertices", (unsigned long)glyph_vertices);
+  printf("%-28s %10lu bytes\n", "shape vertex data (float)", (unsigned long)shape_bytes);
+  printf("%-28s %10lu bytes\n", "glyph vertex data (float)", (unsigned long)(glyph_vertices * 32));  /* CharacterVertex: pos, texcoord, color */
+  printf("%-28s %10s\n", "clean tree needs redraw", (result) ? "yes" : "no");
+  printf("%-28s %10llu / %llu\n", "patches / failed", (unsigned long long)render->num_patches, (unsigned long long)render->num_failed_patches);
+  printf("\n");
+
+  delete panel;
+  delete render;
+  delete[] values.ints;
+  delete[] values.floats;
+  delete[] values.bools;
+  delete[] values.colors;
+  delete[] values.texts;
+
+  return EXIT_SUCCESS;
+}
+
+/* -------------------------------------------------------------------------------------------------------------- */
+
+static double bench_now() {
+#if defined(_WIN32)
+  LARGE_INTEGER freq;
+  LARGE_INTEGER now;
+  QueryPerformanceFrequency(&freq);
+  QueryPerformanceCounter(&now);
+  return (double(now.QuadPart) * 1000000.0) / double(freq.QuadPart);
+#else
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  return double(tv.tv_sec) * 1000000.0 + double(tv.tv_usec);
+#endif
+}
+
+static void bench_print(const char* name, double total, int iterations) {
+  printf("%-28s %10.2f us\n", name, total / iterations);
+}
+
+static void bench_menu_click(int menuid, int optionid, void* user) {
+}
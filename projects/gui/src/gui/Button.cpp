@@ -82,7 +82,7 @@ namespace rx {
     if(GUI_IS_INSIDE_WIDGET(this, mx, my)) {
       state |= GUI_STATE_DOWN_INSIDE;
       icon_button.state |= GUI_STATE_DOWN_INSIDE;
-      needs_redraw = true;
+      setNeedsRedraw();
     }
   }
 
@@ -90,7 +90,7 @@ namespace rx {
   
     if(state & GUI_STATE_DOWN_INSIDE) {
       icon_button.call();
-      needs_redraw = true;
+      setNeedsRedraw();
 
       notify(GUI_EVENT_VALUE_CHANGED); 
     }
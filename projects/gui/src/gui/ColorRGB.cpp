@@ -48,14 +48,14 @@ void ColorRGB::onMousePress(float mx, float my, int button, int modkeys) {
   if(GUI_IS_INSIDE_WIDGET(this, mx, my)) {
     state |= GUI_STATE_DOWN_INSIDE;
     setMousePositionValue(mx);
-    needs_redraw = true;
+    setNeedsRedraw();
   }
 }
 
 void ColorRGB::onMouseRelease(float mx, float my, int button, int modkeys) {
 
   if(state & GUI_STATE_DOWN_INSIDE) {
-    needs_redraw = true;
+    setNeedsRedraw();
   }
 
   state &= ~GUI_STATE_DOWN_INSIDE;
@@ -78,7 +78,7 @@ void ColorRGB::setMousePositionValue(int mx) {
   pos_v = 1.0 - float((x + w - 22) - pos_x) / (w-22);
 
   setPercentageValue(pos_v);
-  needs_redraw = true ;
+  setNeedsRedraw();
 }
 
 void ColorRGB::setPercentageValue(float p) {
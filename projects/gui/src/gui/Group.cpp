@@ -15,7 +15,7 @@ namespace rx {
     g->closeChildren();
     g->close_button.hide();
     g->open_button.show();
-    g->needs_redraw = true;
+    g->setNeedsRedraw();
     g->children_closed = true;
   }
 
@@ -25,7 +25,7 @@ namespace rx {
     g->openChildren();
     g->close_button.show();
     g->open_button.hide();
-    g->needs_redraw = true;
+    g->setNeedsRedraw();
     g->children_closed = false;
   }
 
@@ -44,6 +44,9 @@ namespace rx {
     ,shade_top(0.1f)
     ,shade_bottom(-0.1f)
     ,overlay(NULL)
+    ,use_culling(false)
+    ,cull_miny(0)
+    ,cull_maxy(0)
   {
     x = 10;
     y = 10;
@@ -62,6 +65,8 @@ namespace rx {
     float theme_hl_color[] = { 0.394, 0.0f, 0.917, 1.0 };
     setColors(theme_bg_color, theme_fg_color, theme_hl_color);
 
+    close_button.parent = this;
+    open_button.parent = this;
     close_button.setGroup(this);
     open_button.setGroup(this);
     open_button.hide();
@@ -121,6 +126,8 @@ namespace rx {
       return *wid;
     }
 
+    hit_index.invalidate();
+
     return Widget::add(wid, this);
   }
 
@@ -150,9 +157,14 @@ namespace rx {
   void Group::update() {
 
     if(needsRedraw()) {
-      render->clear();
-      position();
-      build();
+
+      /* only rewrite the vertices of the dirty widgets when the layout didn't change */
+      if(!rebuild()) {
+        render->clear();
+        position();
+        build();
+      }
+
       render->update();
     }
   }
@@ -161,8 +173,9 @@ namespace rx {
 
     int curr_x = x;
     int curr_y = y + h + padding;
-    int el_w = 0;
-    int el_h = 0;
+    int new_y = 0;
+    bool moved = false;
+    bool resized = false;
     int count = 0;
 
     for(std::vector<Widget*>::iterator it = children.begin(); it != children.end(); ++it) {
@@ -173,12 +186,52 @@ namespace rx {
         continue;
       }
 
+      new_y = curr_y + (count * padding);
+      moved = (wid->x != curr_x || wid->y != new_y);
+      resized = (wid->w != w);
+
       wid->x = curr_x;
-      wid->y = curr_y + (count * padding);
+      wid->y = new_y;
       wid->w = w;
 
-      wid->position();
-      wid->setBoundingBox();
+      /* outside the visible area; we use the height of the previous layout. */
+      if (use_culling 
+          && wid->bbox[3] > 0 
+          && false == wid->needs_layout
+          && wid->isDrawn() 
+          && gui_is_outside_range(wid->y, wid->bbox[3], cull_miny, cull_maxy)) 
+        {
+          wid->state |= GUI_STATE_CULLED;
+          wid->bbox[0] = wid->x;
+          wid->bbox[1] = wid->y;
+          wid->bbox[2] = wid->w;
+          curr_y += wid->bbox[3];
+          ++count;
+          continue;
+        }
+
+      if (wid->needs_layout || resized) {
+        /* new, resized, shown or opened: measure it again. */
+        wid->position();
+        wid->setBoundingBox();
+        wid->needs_layout = false;
+      }
+      else if (moved || (wid->state & GUI_STATE_CULLED)) {
+        /* a widget before it changed size, or we were dragged/scrolled; the height stays the same. */
+        wid->position();
+        if (wid->isDrawn()) {
+          wid->bbox[0] = wid->x;
+          wid->bbox[1] = wid->y;
+        }
+      }
+
+      /* positioned for the first time (or opened) and not visible; we don't have to draw it. */
+      if (use_culling && gui_is_outside_range(wid->y, wid->bbox[3], cull_miny, cull_maxy)) {
+        wid->state |= GUI_STATE_CULLED;
+      }
+      else {
+        wid->state &= ~GUI_STATE_CULLED;
+      }
 
       curr_y += wid->bbox[3];
 
@@ -191,6 +244,33 @@ namespace rx {
     open_button.y = close_button.y; 
   
     setBoundingBox();
+
+    hit_index.build(children);
+
+    needs_layout = false;
+  }
+
+  void Group::setBoundingBox() {
+
+    if (!isDrawn()) {
+      bbox[0] = bbox[1] = bbox[2] = bbox[3] = 0;
+      return;
+    }
+
+    bbox[0] = x;
+    bbox[1] = y;
+    bbox[2] = w;
+    bbox[3] = h + margin[3];
+
+    for(std::vector<Widget*>::iterator it = children.begin(); it != children.end(); ++it) {
+
+      Widget* wid = *it;
+      bbox[3] += wid->bbox[3];
+
+      if(wid->isDrawn()) {
+        bbox[3] += padding;
+      }
+    }
   }
 
   void Group::onMousePress(float mx, float my, int button, int modkeys) {
@@ -223,16 +303,66 @@ namespace rx {
       int ddy = press_y + (my - mouse_press_y);
       x = ddx;
       y = ddy;
-      needs_redraw = true;
+      setNeedsRedraw();
     }
 
     Widget::onMouseMove(mx, my);
   }
 
+  void Group::onMousePressChildren(float mx, float my, int button, int modkeys) {
+
+    if (overlay && GUI_IS_INSIDE(mx, my, overlay_bbox[0], overlay_bbox[1], overlay_bbox[2], overlay_bbox[3])) {
+      return;
+    }
+
+    if (!hit_index.onMousePress(children, mx, my, button, modkeys)) {
+      Widget::onMousePressChildren(mx, my, button, modkeys);
+    }
+  }
+
+  void Group::onMouseReleaseChildren(float mx, float my, int button, int modkeys) {
+
+    if (overlay && GUI_IS_INSIDE(mx, my, overlay_bbox[0], overlay_bbox[1], overlay_bbox[2], overlay_bbox[3])) {
+      return;
+    }
+
+    if (!hit_index.onMouseRelease(children, mx, my, button, modkeys)) {
+      Widget::onMouseReleaseChildren(mx, my, button, modkeys);
+    }
+  }
+
+  void Group::onMouseMoveChildren(float mx, float my) {
+
+    if (!hit_index.onMouseMove(children, mx, my)) {
+      Widget::onMouseMoveChildren(mx, my);
+    }
+  }
+
+  bool Group::hasCapture() {
+    return Widget::hasCapture() || hit_index.hasCapture();
+  }
+
   bool Group::needsRedraw() {
     return Widget::needsRedraw() || close_button.needs_redraw || open_button.needs_redraw;
   }
 
+  bool Group::rebuild() {
+
+    /* dragged, opened or closed, or one of the children changed size; the layout changed. */
+    if(needs_redraw || needs_layout || !isDrawn()) {
+      return false;
+    }
+
+    /* the header buttons are drawn in our create(). */
+    if(close_button.needs_redraw || open_button.needs_redraw) {
+      if(!patch()) {
+        return false;
+      }
+    }
+
+    return rebuildChildren();
+  }
+
   void Group::unsetNeedsRedraw() {
     needs_redraw = false;
     close_button.needs_redraw = false;
@@ -0,0 +1,163 @@
+#include <algorithm>
+#include <gui/HitIndex.h>
+#include <gui/Widget.h>
+#include <gui/Types.h>
+
+namespace rx {
+
+  /* -------------------------------------------------------------------------------------------------------------- */
+
+  static bool hit_entry_sort(const HitEntry& a, const HitEntry& b) {
+    return (a.top == b.top) ? (a.index < b.index) : (a.top < b.top);
+  }
+
+  /* -------------------------------------------------------------------------------------------------------------- */
+
+  HitIndex::HitIndex()
+    :is_valid(false)
+    ,num_widgets(0)
+  {
+  }
+
+  void HitIndex::build(std::vector<Widget*>& widgets) {
+
+    entries.clear();
+
+    for (size_t i = 0; i < widgets.size(); ++i) {
+
+      Widget* wid = widgets[i];
+
+      if (!wid->isDrawn() || (wid->state & GUI_STATE_CULLED)) {
+        continue;
+      }
+
+      HitEntry entry;
+      entry.index = i;
+      entry.top = wid->bbox[1];
+      entry.bottom = wid->bbox[1] + std::max<int>(wid->bbox[3], wid->h);
+      entry.reach = entry.bottom;
+      entries.push_back(entry);
+    }
+
+    /* The children are positioned from top to bottom, so this is usually sorted already. */
+    std::sort(entries.begin(), entries.end(), hit_entry_sort);
+
+    for (size_t i = 1; i < entries.size(); ++i) {
+      entries[i].reach = std::max<int>(entries[i].bottom, entries[i - 1].reach);
+    }
+
+    /* Events may have been forwarded to all widgets while the index was invalid. */
+    captured.clear();
+    for (size_t i = 0; i < widgets.size(); ++i) {
+      if (widgets[i]->hasCapture()) {
+        captured.push_back(i);
+      }
+    }
+
+    num_widgets = widgets.size();
+    is_valid = true;
+  }
+
+  bool HitIndex::onMousePress(std::vector<Widget*>& widgets, float mx, float my, int button, int modkeys) {
+
+    if (!isValid(widgets)) {
+      return false;
+    }
+
+    query(my);
+
+    for (size_t i = 0; i < targets.size() && targets[i] < widgets.size(); ++i) {
+      Widget* wi = widgets[targets[i]];
+      if (wi->isDrawn()) {
+        wi->onMousePress(mx, my, button, modkeys);
+      }
+    }
+
+    capture(widgets);
+
+    return true;
+  }
+
+  bool HitIndex::onMouseRelease(std::vector<Widget*>& widgets, float mx, float my, int button, int modkeys) {
+
+    if (!isValid(widgets)) {
+      return false;
+    }
+
+    query(my);
+
+    for (size_t i = 0; i < targets.size() && targets[i] < widgets.size(); ++i) {
+      Widget* wi = widgets[targets[i]];
+      if (wi->isDrawn()) {
+        wi->onMouseRelease(mx, my, button, modkeys);
+      }
+    }
+
+    capture(widgets);
+
+    return true;
+  }
+
+  bool HitIndex::onMouseMove(std::vector<Widget*>& widgets, float mx, float my) {
+
+    if (!isValid(widgets)) {
+      return false;
+    }
+
+    query(my);
+
+    for (size_t i = 0; i < targets.size() && targets[i] < widgets.size(); ++i) {
+      widgets[targets[i]]->onMouseMove(mx, my);
+    }
+
+    capture(widgets);
+
+    return true;
+  }
+
+  /* -------------------------------------------------------------------------------------------------------------- */
+
+  void HitIndex::query(float my) {
+
+    targets.clear();
+
+    /* The first entry that starts below the mouse; all entries that contain `my` are before it. */
+    size_t lo = 0;
+    size_t hi = entries.size();
+
+    while (lo < hi) {
+      size_t mid = lo + (hi - lo) / 2;
+      if (entries[mid].top <= my) {
+        lo = mid + 1;
+      }
+      else {
+        hi = mid;
+      }
+    }
+
+    while (lo > 0 && entries[lo - 1].reach >= my) {
+      --lo;
+      if (entries[lo].bottom >= my) {
+        targets.push_back(entries[lo].index);
+      }
+    }
+
+    targets.insert(targets.end(), captured.begin(), captured.end());
+
+    /* Keep the order of the children, like when we forward the event to all of them. */
+    std::sort(targets.begin(), targets.end());
+    targets.erase(std::unique(targets.begin(), targets.end()), targets.end());
+  }
+
+  void HitIndex::capture(std::vector<Widget*>& widgets) {
+
+    captured.clear();
+
+    for (size_t i = 0; i < targets.size(); ++i) {
+      if (targets[i] < widgets.size() && widgets[targets[i]]->hasCapture()) {
+        captured.push_back(targets[i]);
+      }
+    }
+  }
+
+} /* namespace rx */
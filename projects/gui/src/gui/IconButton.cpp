@@ -63,11 +63,11 @@ void IconButton::onMouseRelease(float mx, float my, int button, int mods) {
     call();
 
     state &= ~GUI_STATE_DOWN_INSIDE;
-    needs_redraw = true;
+    setNeedsRedraw();
   }
   else {
     if(state & GUI_STATE_DOWN_INSIDE) {
-      needs_redraw = true;
+      setNeedsRedraw();
     }
     state &= ~GUI_STATE_DOWN_INSIDE;
   }
@@ -81,7 +81,7 @@ void IconButton::onMousePress(float mx, float my, int button, int mods) {
 
   if(GUI_IS_INSIDE_WIDGET(this, mx, my)) {
     state |= GUI_STATE_DOWN_INSIDE;
-    needs_redraw = true;
+    setNeedsRedraw();
   }
   else {
     state &= ~GUI_STATE_DOWN_INSIDE;
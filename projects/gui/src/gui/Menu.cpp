@@ -88,7 +88,7 @@ namespace rx {
 
     if (GUI_DIRECTION_DOWN == direction) { 
       if (GUI_IS_INSIDE(mx, my, x, y, w, (h + popup_height))) {
-        needs_redraw = true;
+        setNeedsRedraw();
       }
       else {
         listener->onMenuShouldClose();
@@ -96,7 +96,7 @@ namespace rx {
     }
     else {
       if (GUI_IS_INSIDE(mx, my, x, y - popup_height, w, (h + popup_height))) {
-        needs_redraw = true;
+        setNeedsRedraw();
       }
       else {
         listener->onMenuShouldClose();
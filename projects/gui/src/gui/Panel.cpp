@@ -2,6 +2,7 @@
 #include <gui/Scroll.h>
 #include <gui/Render.h>
 #include <gui/Group.h>
+#include <gui/Utils.h>
 #include <stdio.h>
 
 namespace rx { 
@@ -9,6 +10,8 @@ namespace rx {
 Panel::Panel(Render* r, int height, int style)
   :Widget(GUI_TYPE_PANEL, "")
   ,scroll(style)
+  ,is_virtual(false)
+  ,needs_upload(false)
 {
   x = 10;
   y = 10;
@@ -16,6 +19,7 @@ Panel::Panel(Render* r, int height, int style)
   h = height;
   render = r;
   scroll.render = r;
+  scroll.parent = this;
 }
 
 Panel::~Panel() {
@@ -44,48 +48,106 @@ Group* Panel::addGroup(std::string title, int style) {
 
   groups.push_back(g);
 
+  hit_index.invalidate();
+
   return g;
 }
 
 void Panel::position() {
 
   int start_offset_y = scroll.offset_y;
+  int content_h = positionGroups();
+
+  if (NULL != group) {
+
+    content_h += group->padding; 
+
+    scroll.x = x;
+    scroll.y = y;
+    scroll.setVisibleArea(x - group->padding, y - group->padding, w + group->padding * 2, h, content_h); 
+    scroll.position();
+  }
+
+  /* the content height changed (e.g. a group was closed) and with it the scroll offset; this only moves the groups, their heights stay the same. */
+  if (start_offset_y != scroll.offset_y) {
+    positionGroups();
+  }
+
+  hit_index.build(children);
+
+  needs_layout = false;
+}
+
+int Panel::positionGroups() {
+
   int gx = x;
   int gy = y - scroll.offset_y;
   int gw = w;
-  int gh = h;
   int content_h = 0;
-  int visible_h = 0;
-
+  bool moved = false;
 
   for(std::vector<Group*>::iterator it = groups.begin(); it != groups.end(); ++it) {
 
     Group* g = *it;
 
+    moved = (g->x != gx || g->y != gy || g->w != gw);
+
     g->x = gx;
     g->y = gy;
     g->w = gw;
-    
-    g->position();
+
+    if (is_virtual) {
+
+      if (g->bbox[3] > 0 && false == g->needs_layout && gui_is_outside_range(gy, g->bbox[3], y, y + h)) {
+
+        /* not visible, we use the height of the previous layout. */
+        g->state |= GUI_STATE_CULLED;
+        g->bbox[0] = gx;
+        g->bbox[1] = gy;
+        g->bbox[2] = gw;
+      }
+      else {
+
+        if (moved 
+            || g->needs_layout 
+            || (g->state & GUI_STATE_CULLED)
+            || false == g->use_culling 
+            || g->cull_miny != y 
+            || g->cull_maxy != y + h) 
+          {
+            g->setCullRange(y, y + h);
+            g->position();
+          }
+
+        if (gui_is_outside_range(gy, g->bbox[3], y, y + h)) {
+          g->state |= GUI_STATE_CULLED;
+        }
+        else {
+          g->state &= ~GUI_STATE_CULLED;
+        }
+      }
+    }
+    else if (moved || g->needs_layout || g->use_culling || (g->state & GUI_STATE_CULLED)) {
+      g->state &= ~GUI_STATE_CULLED;
+      g->disableCulling();
+      g->position();
+    }
 
     gy += g->bbox[3] + g->padding;
     content_h += g->bbox[3] + g->padding;
   }
 
-  if (NULL != group) {
-
-    content_h += group->padding; 
+  return content_h;
+}
 
-    scroll.x = x;
-    scroll.y = y;
-    scroll.setVisibleArea(x - group->padding, y - group->padding, gw + group->padding * 2, h, content_h); 
-    scroll.position();
-  }
+void Panel::enableVirtualScroll() {
+  is_virtual = true;
+  setNeedsRedraw();
+}
 
-  // @todo - we need a better fix for this. when the content height changes, i.e. becomes smaller, then we need to reposition; this is kind of a hack which works okay, but is not perfect. 
-  if(start_offset_y != scroll.offset_y) {
-    position();
-  }
+void Panel::disableVirtualScroll() {
+  is_virtual = false;
+  setNeedsRedraw();
 }
 
 void Panel::create() {
@@ -98,18 +160,42 @@ void Panel::create() {
 
 void Panel::update() {
 
+  if (prepare()) {
+    upload();
+  }
+}
+
+bool Panel::prepare() {
+
   if (0 == groups.size()) {
-    return;
+    return false;
   }
 
   if(needsRedraw()) {
-    render->clear();
-    position();
-    build();
-    scroll.create();
-    render->update();
+
+    /* when only widgets inside the groups changed we rewrite their vertices in place */
+    if(needs_redraw || needs_layout || scroll.needs_redraw || !rebuildChildren()) {
+      render->clear();
+      position();
+      build();
+      scroll.create();
+    }
+
     needs_redraw = false;
+    needs_upload = true;
   }
+
+  return needs_upload;
+}
+
+void Panel::upload() {
+
+  if (false == needs_upload) {
+    return;
+  }
+
+  render->update();
+  needs_upload = false;
 }
 
 void Panel::draw() {
@@ -162,13 +248,46 @@ void Panel::onMouseMove(float mx, float my) {
     int dy = press_y + (my - mouse_press_y);
     x = dx;
     y = dy;
-    needs_redraw = true;
+    setNeedsRedraw();
   }
 
   Widget::onMouseMove(mx, my);
   scroll.onMouseMove(mx, my);
 }
 
+void Panel::onMousePressChildren(float mx, float my, int button, int modkeys) {
+
+  if (group && group->overlay) {
+    if (GUI_IS_INSIDE(mx, my, group->overlay_bbox[0], group->overlay_bbox[1], group->overlay_bbox[2], group->overlay_bbox[3])) {
+      return;
+    }
+  }
+
+  if (!hit_index.onMousePress(children, mx, my, button, modkeys)) {
+    Widget::onMousePressChildren(mx, my, button, modkeys);
+  }
+}
+
+void Panel::onMouseReleaseChildren(float mx, float my, int button, int modkeys) {
+
+  if (group && group->overlay) {
+    if (GUI_IS_INSIDE(mx, my, group->overlay_bbox[0], group->overlay_bbox[1], group->overlay_bbox[2], group->overlay_bbox[3])) {
+      return;
+    }
+  }
+
+  if (!hit_index.onMouseRelease(children, mx, my, button, modkeys)) {
+    Widget::onMouseReleaseChildren(mx, my, button, modkeys);
+  }
+}
+
+void Panel::onMouseMoveChildren(float mx, float my) {
+
+  if (!hit_index.onMouseMove(children, mx, my)) {
+    Widget::onMouseMoveChildren(mx, my);
+  }
+}
+
 bool Panel::needsRedraw() {
   return needs_redraw || scroll.needs_redraw || needsRedrawChildren();
 }
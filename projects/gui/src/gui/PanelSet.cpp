@@ -0,0 +1,190 @@
+#include <stdio.h>
+#include <algorithm>
+#include <gui/PanelSet.h>
+#include <gui/Panel.h>
+
+namespace rx {
+
+  /* -------------------------------------------------------------------------------------------------------------- */
+
+  PanelSet::PanelSet(int numThreads)
+    :num_threads(numThreads)
+    ,next_job(0)
+    ,num_done(0)
+    ,must_stop(false)
+  {
+    if (num_threads < 0) {
+      num_threads = std::min<int>(gui_get_num_cpus() - 1, 3);
+    }
+  }
+
+  PanelSet::~PanelSet() {
+    stop();
+  }
+
+  bool PanelSet::add(Panel* panel) {
+
+    if (NULL == panel) {
+      printf("Error: cannot add a NULL panel to the panel set.\n");
+      return false;
+    }
+
+    for (size_t i = 0; i < panels.size(); ++i) {
+
+      if (panels[i] == panel) {
+        printf("Error: the panel was already added to the panel set.\n");
+        return false;
+      }
+
+      if (panels[i]->render == panel->render) {
+        printf("Error: the panel uses the same render as another panel in the set; each panel needs its own render.\n");
+        return false;
+      }
+    }
+
+    panels.push_back(panel);
+
+    return true;
+  }
+
+  void PanelSet::update() {
+
+    dirty.clear();
+
+    for (size_t i = 0; i < panels.size(); ++i) {
+      if (panels[i]->needsRedraw()) {
+        dirty.push_back(panels[i]);
+      }
+    }
+
+    if (1 == dirty.size() || 0 == num_threads) {
+      for (size_t i = 0; i < dirty.size(); ++i) {
+        dirty[i]->prepare();
+      }
+    }
+    else if (dirty.size() > 1) {
+
+      if (0 == threads.size()) {
+        start();
+      }
+
+      /* The workers only see the jobs while we hold the lock or wait for them. */
+      mutex.lock();
+      {
+        jobs.swap(dirty);
+        next_job = 0;
+        num_done = 0;
+        work_cond.broadcast();
+
+        work();
+
+        while (num_done < jobs.size()) {
+          done_cond.wait(mutex);
+        }
+
+        jobs.clear();
+        next_job = 0;
+      }
+      mutex.unlock();
+    }
+
+    /* GL calls; one after another on this thread. */
+    for (size_t i = 0; i < panels.size(); ++i) {
+      panels[i]->upload();
+    }
+  }
+
+  void PanelSet::draw() {
+
+    update();
+
+    for (size_t i = 0; i < panels.size(); ++i) {
+      panels[i]->draw();
+    }
+  }
+
+  /* -------------------------------------------------------------------------------------------------------------- */
+
+  bool PanelSet::start() {
+
+    must_stop = false;
+
+    for (int i = 0; i < num_threads; ++i) {
+
+      Thread* t = new Thread();
+
+      if (false == t->create(PanelSet::threadMain, this)) {
+        printf("Error: cannot create a panel set thread; we build the panels with %lu thread(s).\n", (unsigned long)(threads.size() + 1));
+        delete t;
+        num_threads = (int)threads.size();
+        return false;
+      }
+
+      threads.push_back(t);
+    }
+
+    return true;
+  }
+
+  void PanelSet::stop() {
+
+    if (0 == threads.size()) {
+      return;
+    }
+
+    mutex.lock();
+      must_stop = true;
+      work_cond.broadcast();
+    mutex.unlock();
+
+    for (size_t i = 0; i < threads.size(); ++i) {
+      threads[i]->join();
+      delete threads[i];
+    }
+
+    threads.clear();
+  }
+
+  void PanelSet::threadMain(void* user) {
+
+    PanelSet* ps = static_cast<PanelSet*>(user);
+    ps->run();
+  }
+
+  void PanelSet::run() {
+
+    mutex.lock();
+
+    while (false == must_stop) {
+
+      if (next_job >= jobs.size()) {
+        work_cond.wait(mutex);
+        continue;
+      }
+
+      work();
+    }
+
+    mutex.unlock();
+  }
+
+  void PanelSet::work() {
+
+    while (next_job < jobs.size()) {
+
+      Panel* panel = jobs[next_job];
+      next_job++;
+
+      mutex.unlock();
+        panel->prepare();
+      mutex.lock();
+
+      num_done++;
+
+      if (num_done == jobs.size()) {
+        done_cond.signal();
+      }
+    }
+  }
+
+} /* namespace rx */
@@ -0,0 +1,239 @@
+#include <stdio.h>
+#include <gui/PanelThread.h>
+#include <gui/RenderSnapshot.h>
+#include <gui/Panel.h>
+
+namespace rx {
+
+  /* -------------------------------------------------------------------------------------------------------------- */
+
+  PanelThread::PanelThread(Panel* panel, RenderSnapshot* snapshot)
+    :panel(panel)
+    ,snapshot(snapshot)
+    ,needs_redraw(false)
+    ,must_stop(false)
+  {
+  }
+
+  PanelThread::~PanelThread() {
+    stop();
+  }
+
+  bool PanelThread::start() {
+
+    if (NULL == panel || NULL == snapshot) {
+      printf("Error: cannot start the panel thread without a panel and snapshot.\n");
+      return false;
+    }
+
+    if (panel->render != snapshot) {
+      printf("Error: the panel must be created with the RenderSnapshot that is passed into PanelThread.\n");
+      return false;
+    }
+
+    if (thread.isRunning()) {
+      printf("Error: the panel thread is already running.\n");
+      return false;
+    }
+
+    mutex.lock();
+      must_stop = false;
+      needs_redraw = true;
+    mutex.unlock();
+
+    return thread.create(PanelThread::threadMain, this);
+  }
+
+  void PanelThread::stop() {
+
+    if (false == thread.isRunning()) {
+      return;
+    }
+
+    mutex.lock();
+      must_stop = true;
+      cond.signal();
+    mutex.unlock();
+
+    thread.join();
+  }
+
+  void PanelThread::draw() {
+
+    snapshot->upload();
+    snapshot->drawTarget();
+  }
+
+  void PanelThread::setNeedsRedraw() {
+
+    mutex.lock();
+      needs_redraw = true;
+      cond.signal();
+    mutex.unlock();
+  }
+
+  void PanelThread::resize(int w, int h) {
+
+    if (NULL != snapshot->target) {
+      snapshot->target->resize(w, h);
+    }
+
+    PanelEvent ev;
+    ev.type = GUI_PANEL_EVENT_RESIZE;
+    ev.x = w;
+    ev.y = h;
+    push(ev);
+  }
+
+  /* -------------------------------------------------------------------------------------------------------------- */
+
+  void PanelThread::onMousePress(float mx, float my, int button, int modkeys) {
+
+    PanelEvent ev;
+    ev.type = GUI_PANEL_EVENT_MOUSE_PRESS;
+    ev.x = mx;
+    ev.y = my;
+    ev.button = button;
+    ev.mods = modkeys;
+    push(ev);
+  }
+
+  void PanelThread::onMouseRelease(float mx, float my, int button, int modkeys) {
+
+    PanelEvent ev;
+    ev.type = GUI_PANEL_EVENT_MOUSE_RELEASE;
+    ev.x = mx;
+    ev.y = my;
+    ev.button = button;
+    ev.mods = modkeys;
+    push(ev);
+  }
+
+  void PanelThread::onMouseMove(float mx, float my) {
+
+    PanelEvent ev;
+    ev.type = GUI_PANEL_EVENT_MOUSE_MOVE;
+    ev.x = mx;
+    ev.y = my;
+    push(ev);
+  }
+
+  void PanelThread::onCharPress(unsigned int key) {
+
+    /* Edit the input first so the worker reads the new value. */
+    snapshot->onTargetCharPress(key);
+
+    PanelEvent ev;
+    ev.type = GUI_PANEL_EVENT_CHAR_PRESS;
+    ev.key = key;
+    push(ev);
+  }
+
+  void PanelThread::onKeyPress(int key, int modkeys) {
+
+    snapshot->onTargetKeyPress(key, modkeys);
+
+    PanelEvent ev;
+    ev.type = GUI_PANEL_EVENT_KEY_PRESS;
+    ev.key = key;
+    ev.mods = modkeys;
+    push(ev);
+  }
+
+  void PanelThread::onKeyRelease(int key, int modkeys) {
+
+    PanelEvent ev;
+    ev.type = GUI_PANEL_EVENT_KEY_RELEASE;
+    ev.key = key;
+    ev.mods = modkeys;
+    push(ev);
+  }
+
+  /* -------------------------------------------------------------------------------------------------------------- */
+
+  void PanelThread::threadMain(void* user) {
+
+    PanelThread* pt = static_cast<PanelThread*>(user);
+    pt->run();
+  }
+
+  void PanelThread::run() {
+
+    bool redraw = false;
+
+    mutex.lock();
+
+    while (false == must_stop || events.size()) {
+
+      if (0 == events.size() && false == needs_redraw) {
+        cond.wait(mutex);
+        continue;
+      }
+
+      work.swap(events);
+      redraw = needs_redraw;
+      needs_redraw = false;
+
+      mutex.unlock();
+
+      for (size_t i = 0; i < work.size(); ++i) {
+        handle(work[i]);
+      }
+
+      work.clear();
+
+      if (redraw) {
+        panel->setNeedsRedraw();
+      }
+
+      /* Only rebuilds when something changed; the snapshot is published in RenderSnapshot::draw(). */
+      panel->draw();
+
+      mutex.lock();
+    }
+
+    mutex.unlock();
+  }
+
+  void PanelThread::push(PanelEvent& ev) {
+
+    mutex.lock();
+    {
+      /* The widgets only need the latest position. */
+      if (GUI_PANEL_EVENT_MOUSE_MOVE == ev.type
+          && events.size()
+          && GUI_PANEL_EVENT_MOUSE_MOVE == events.back().type)
+        {
+          events.back() = ev;
+        }
+      else {
+        events.push_back(ev);
+      }
+
+      cond.signal();
+    }
+    mutex.unlock();
+  }
+
+  void PanelThread::handle(PanelEvent& ev) {
+
+    switch (ev.type) {
+      case GUI_PANEL_EVENT_MOUSE_PRESS:    { panel->onMousePress(ev.x, ev.y, ev.button, ev.mods);      break; }
+      case GUI_PANEL_EVENT_MOUSE_RELEASE:  { panel->onMouseRelease(ev.x, ev.y, ev.button, ev.mods);    break; }
+      case GUI_PANEL_EVENT_MOUSE_MOVE:     { panel->onMouseMove(ev.x, ev.y);                            break; }
+      case GUI_PANEL_EVENT_CHAR_PRESS:     { panel->onCharPress(ev.key);                                break; }
+      case GUI_PANEL_EVENT_KEY_PRESS:      { panel->onKeyPress(ev.key, ev.mods);                        break; }
+      case GUI_PANEL_EVENT_KEY_RELEASE:    { panel->onKeyRelease(ev.key, ev.mods);                      break; }
+      case GUI_PANEL_EVENT_RESIZE: {
+        snapshot->resize(ev.x, ev.y);
+        panel->setNeedsRedraw();
+        break;
+      }
+      default: {
+        printf("Error: unhandled panel event: %d\n", ev.type);
+        break;
+      }
+    }
+  }
+
+} /* namespace rx */
@@ -22,9 +22,10 @@ void Render::endScissor() { }
 
 void Render::clear() { }
 
-void Render::writeText(float x, float y, std::string text, float* color) { } 
+void Render::writeText(float x, float y, const std::string& text, float* color) { } 
 
 void Render::writeNumber(float x, float y, std::string number, float* color) { } 
+void Render::writeNumber(float x, float y, const char* number, size_t len, float* color) { writeNumber(x, y, std::string(number, len), color); }
 
 void Render::writeIcon(float x, float y, unsigned int icon, float* color) { }
 
@@ -56,4 +57,16 @@ void Render::onKeyPress(int key, int mods) { }
 
 void Render::setLayer(int layer) { } 
 
+void Render::beginSpan(uint32_t id) { }
+
+void Render::endSpan(uint32_t id) { }
+
+bool Render::beginPatch(uint32_t id) { return false; }
+
+bool Render::endPatch(uint32_t id) { return false; }
+
+Render* Render::createStagingRender() { return NULL; }
+
+bool Render::swapBuffers(Render* staging) { return false; }
+
 }  /* namespace rx */
@@ -0,0 +1,290 @@
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <gui/RenderRecorder.h>
+
+namespace rx {
+
+  /* -------------------------------------------------------------------------------------------------------------- */
+
+  RenderRecorder::RenderRecorder()
+    :spans_build(1)
+    ,layer(0)
+    ,win_w(1024)
+    ,win_h(768)
+    ,icon_w(14)
+    ,icon_h(14)
+    ,is_text_input_enabled(false)
+    ,is_number_input_enabled(false)
+    ,num_clears(0)
+    ,num_updates(0)
+    ,num_draws(0)
+    ,num_patches(0)
+    ,num_failed_patches(0)
+  {
+    span_mark.shapes = 0;
+    span_mark.texts = 0;
+  }
+
+  bool RenderRecorder::setup() {
+    return true;
+  }
+
+  void RenderRecorder::update() {
+    num_updates++;
+  }
+
+  void RenderRecorder::draw() {
+    num_draws++;
+  }
+
+  void RenderRecorder::resize(int w, int h) {
+    win_w = w;
+    win_h = h;
+  }
+
+  void RenderRecorder::getWindowSize(int& ww, int& wh) {
+    ww = win_w;
+    wh = win_h;
+  }
+
+  void RenderRecorder::beginScissor() { }
+
+  void RenderRecorder::scissor(int sx, int sy, int sw, int sh) { }
+
+  void RenderRecorder::endScissor() { }
+
+  void RenderRecorder::onCharPress(unsigned int key) {
+
+    if (key > 127) {
+      return;
+    }
+
+    if (is_text_input_enabled) {
+      text_input_value.push_back((char)key);
+    }
+    else if (is_number_input_enabled) {
+      number_input_value.push_back((char)key);
+    }
+  }
+
+  void RenderRecorder::onKeyPress(int key, int mods) { }
+
+  /* -------------------------------------------------------------------------------------------------------------- */
+
+  void RenderRecorder::clear() {
+    shapes.clear();
+    texts.clear();
+    text_data.clear();
+    spans_build++;
+    span_mark.shapes = 0;
+    span_mark.texts = 0;
+    num_clears++;
+  }
+
+  void RenderRecorder::getNumberInputValue(std::string& result) {
+    result = number_input_value;
+  }
+
+  void RenderRecorder::disableNumberInput() {
+    is_number_input_enabled = false;
+  }
+
+  void RenderRecorder::enableNumberInput(float x, float y, float maxw, std::string value, float* color) {
+    is_number_input_enabled = true;
+    number_input_value = value;
+  }
+
+  void RenderRecorder::getTextInputValue(std::string& result) {
+    result = text_input_value;
+  }
+
+  void RenderRecorder::disableTextInput() {
+    is_text_input_enabled = false;
+  }
+
+  void RenderRecorder::enableTextInput(float x, float y, float maxw, std::string value, float* color) {
+    is_text_input_enabled = true;
+    text_input_value = value;
+  }
+
+  void RenderRecorder::writeText(float x, float y, const std::string& text, float* color) {
+    addText(GUI_RECORD_TEXT, x, y, text.c_str(), text.size(), 0, color);
+  }
+
+  void RenderRecorder::writeNumber(float x, float y, std::string number, float* color) {
+    addText(GUI_RECORD_NUMBER, x, y, number.c_str(), number.size(), 0, color);
+  }
+
+  void RenderRecorder::writeNumber(float x, float y, const char* number, size_t len, float* color) {
+    addText(GUI_RECORD_NUMBER, x, y, number, len, 0, color);
+  }
+
+  void RenderRecorder::writeIcon(float x, float y, unsigned int icon, float* color) {
+    addText(GUI_RECORD_ICON, x, y, "", 0, icon, color);
+  }
+
+  bool RenderRecorder::getIconSize(unsigned int id, int& w, int& h) {
+    w = icon_w;
+    h = icon_h;
+    return true;
+  }
+
+  void RenderRecorder::addRectangle(float x, float y, float w, float h, float* color, bool filled, float shadetop, float shadebot) {
+    addShape((filled) ? GUI_RECORD_RECTANGLE : GUI_RECORD_OUTLINE, x, y, w, h, 0.0f, color, shadetop, shadebot, 0);
+  }
+
+  void RenderRecorder::addRectangle(float x, float y, float w, float h, TextureInfo* texinfo) {
+    float color[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+    addShape(GUI_RECORD_TEXTURE, x, y, w, h, 0.0f, color, 0.0f, 0.0f, 0);
+    shapes.back().texture = texinfo;
+  }
+
+  void RenderRecorder::addRoundedRectangle(float x, float y, float w, float h, float radius, float* color, bool filled, float shadetop, float shadebot, int corners) {
+    addShape((filled) ? GUI_RECORD_ROUNDED_RECTANGLE : GUI_RECORD_ROUNDED_OUTLINE, x, y, w, h, radius, color, shadetop, shadebot, corners);
+  }
+
+  void RenderRecorder::addRoundedShadowLine(float x, float y, float w, float h, float radius, float* color, int corners) {
+    addShape(GUI_RECORD_SHADOW_LINE, x, y, w, h, radius, color, 0.0f, 0.0f, corners);
+  }
+
+  void RenderRecorder::setLayer(int l) {
+    layer = l;
+  }
+
+  /* -------------------------------------------------------------------------------------------------------------- */
+
+  void RenderRecorder::beginSpan(uint32_t id) {
+    getMark(span_mark);
+  }
+
+  void RenderRecorder::endSpan(uint32_t id) {
+
+    if (id >= spans.size()) {
+      spans.resize(id + 1);
+    }
+
+    RecordedSpan& span = spans[id];
+
+    if (span.build == spans_build) {
+      printf("Error: two widgets use the same span id: %u; we can't patch them.\n", id);
+      span.is_duplicate = true;
+      return;
+    }
+
+    span.build = spans_build;
+    span.is_duplicate = false;
+    span.begin = span_mark;
+    getMark(span.end);
+  }
+
+  bool RenderRecorder::beginPatch(uint32_t id) {
+
+    if (id >= spans.size() || spans[id].build != spans_build || spans[id].is_duplicate) {
+      num_failed_patches++;
+      return false;
+    }
+
+    getMark(span_mark);
+
+    return true;
+  }
+
+  bool RenderRecorder::endPatch(uint32_t id) {
+
+    if (id >= spans.size() || spans[id].build != spans_build) {
+      return false;
+    }
+
+    RecordedSpan& span = spans[id];
+    RecordedMark curr;
+    bool can_patch = false;
+
+    getMark(curr);
+
+    can_patch = ((curr.shapes - span_mark.shapes) == (span.end.shapes - span.begin.shapes))
+             && ((curr.texts - span_mark.texts) == (span.end.texts - span.begin.texts));
+
+    if (can_patch) {
+      std::copy(shapes.begin() + span_mark.shapes, shapes.end(), shapes.begin() + span.begin.shapes);
+      std::copy(texts.begin() + span_mark.texts, texts.end(), texts.begin() + span.begin.texts);
+      num_patches++;
+    }
+    else {
+      num_failed_patches++;
+    }
+
+    /* The characters of the new text runs stay in text_data; clear() releases them. */
+    shapes.resize(span_mark.shapes);
+    texts.resize(span_mark.texts);
+
+    return can_patch;
+  }
+
+  /* -------------------------------------------------------------------------------------------------------------- */
+
+  size_t RenderRecorder::getNumShapeVertices() {
+
+    size_t result = 0;
+
+    for (size_t i = 0; i < shapes.size(); ++i) {
+      result += (shapes[i].type == GUI_RECORD_OUTLINE) ? 5 : 6;
+    }
+
+    return result;
+  }
+
+  size_t RenderRecorder::getNumGlyphVertices() {
+
+    size_t result = 0;
+
+    for (size_t i = 0; i < texts.size(); ++i) {
+      result += texts[i].count * 6;
+    }
+
+    return result;
+  }
+
+  /* -------------------------------------------------------------------------------------------------------------- */
+
+  void RenderRecorder::addShape(int type, float x, float y, float w, float h, float radius, float* color, float shadetop, float shadebot, int corners) {
+
+    RecordedShape shape;
+    shape.type = type;
+    shape.layer = layer;
+    shape.x = x;
+    shape.y = y;
+    shape.w = w;
+    shape.h = h;
+    shape.radius = radius;
+    shape.shade_top = shadetop;
+    shape.shade_bottom = shadebot;
+    shape.corners = corners;
+    shape.texture = NULL;
+    memcpy(shape.color, color, sizeof(shape.color));
+
+    shapes.push_back(shape);
+  }
+
+  void RenderRecorder::addText(int type, float x, float y, const char* text, size_t len, unsigned int icon, float* color) {
+
+    RecordedText run;
+    run.type = type;
+    run.layer = layer;
+    run.x = x;
+    run.y = y;
+    run.icon = icon;
+    run.offset = text_data.size();
+    run.count = (type == GUI_RECORD_ICON) ? 1 : len;
+    memcpy(run.color, color, sizeof(run.color));
+
+    text_data.append(text, len);
+    texts.push_back(run);
+  }
+
+  void RenderRecorder::getMark(RecordedMark& mark) {
+    mark.shapes = shapes.size();
+    mark.texts = texts.size();
+  }
+
+} /* namespace rx */
@@ -0,0 +1,430 @@
+#include <stdio.h>
+#include <string.h>
+#include <gui/RenderSnapshot.h>
+
+namespace rx {
+
+  /* -------------------------------------------------------------------------------------------------------------- */
+
+  static void render_snapshot_reset_input(RecordedInput& input);
+  static bool render_snapshot_input_changed(RecordedInput& a, RecordedInput& b);
+
+  /* -------------------------------------------------------------------------------------------------------------- */
+
+  RenderSnapshot::RenderSnapshot(Render* target)
+    :target(target)
+    ,back(&lists[0])
+    ,pending(&lists[1])
+    ,front(&lists[2])
+    ,has_pending(false)
+    ,has_changes(false)
+    ,is_scissor_enabled(false)
+    ,num_published(0)
+    ,num_uploaded(0)
+  {
+    scissor_rect[0] = scissor_rect[1] = scissor_rect[2] = scissor_rect[3] = 0;
+
+    render_snapshot_reset_input(text_input);
+    render_snapshot_reset_input(number_input);
+    render_snapshot_reset_input(target_text_input);
+    render_snapshot_reset_input(target_number_input);
+
+    for (int i = 0; i < 3; ++i) {
+      lists[i].staging = (NULL != target) ? target->createStagingRender() : NULL;
+      render_snapshot_reset_input(lists[i].text_input);
+      render_snapshot_reset_input(lists[i].number_input);
+      lists[i].is_scissor_enabled = false;
+      lists[i].scissor[0] = lists[i].scissor[1] = lists[i].scissor[2] = lists[i].scissor[3] = 0;
+    }
+  }
+
+  RenderSnapshot::~RenderSnapshot() {
+
+    for (int i = 0; i < 3; ++i) {
+      if (NULL != lists[i].staging) {
+        delete lists[i].staging;
+        lists[i].staging = NULL;
+      }
+    }
+  }
+
+  void RenderSnapshot::update() {
+    RenderRecorder::update();
+    has_changes = true;
+  }
+
+  void RenderSnapshot::draw() {
+
+    RenderRecorder::draw();
+
+    if (false == has_changes) {
+      return;
+    }
+
+    /* Without the lock; the GL thread never touches `back`. */
+    if (NULL != back->staging) {
+      /* Create the vertices of the target here, so the GL thread only has to upload them. */
+      replay(back->staging, shapes, texts, text_data);
+    }
+    else {
+      /* The vectors keep their capacity. */
+      back->shapes = shapes;
+      back->texts = texts;
+      back->text_data = text_data;
+    }
+
+    back->text_input = text_input;
+    back->number_input = number_input;
+    back->is_scissor_enabled = is_scissor_enabled;
+    memcpy(back->scissor, scissor_rect, sizeof(scissor_rect));
+
+    mutex.lock();
+    {
+      RenderDrawList* tmp = pending;
+      pending = back;
+      back = tmp;
+      has_pending = true;
+    }
+    mutex.unlock();
+
+    has_changes = false;
+    num_published++;
+  }
+
+  /* -------------------------------------------------------------------------------------------------------------- */
+
+  void RenderSnapshot::beginScissor() {
+    is_scissor_enabled = true;
+  }
+
+  void RenderSnapshot::scissor(int sx, int sy, int sw, int sh) {
+
+    if (sx != scissor_rect[0] || sy != scissor_rect[1] || sw != scissor_rect[2] || sh != scissor_rect[3]) {
+      has_changes = true;
+    }
+
+    scissor_rect[0] = sx;
+    scissor_rect[1] = sy;
+    scissor_rect[2] = sw;
+    scissor_rect[3] = sh;
+  }
+
+  void RenderSnapshot::endScissor() {
+  }
+
+  /* -------------------------------------------------------------------------------------------------------------- */
+
+  void RenderSnapshot::onCharPress(unsigned int key) {
+    /* The GL thread already passed the key to the target, see onTargetCharPress(). */
+  }
+
+  void RenderSnapshot::onKeyPress(int key, int mods) {
+  }
+
+  void RenderSnapshot::getNumberInputValue(std::string& result) {
+    mutex.lock();
+      result = edited_number;
+    mutex.unlock();
+  }
+
+  void RenderSnapshot::disableNumberInput() {
+
+    if (number_input.is_enabled) {
+      number_input.is_enabled = false;
+      has_changes = true;
+    }
+  }
+
+  void RenderSnapshot::enableNumberInput(float x, float y, float maxw, std::string value, float* color) {
+
+    RecordedInput input;
+    input.is_enabled = true;
+    input.layer = layer;
+    input.x = x;
+    input.y = y;
+    input.maxw = maxw;
+    input.value = value;
+    memcpy(input.color, color, sizeof(input.color));
+
+    /* Widgets call this every time they are created while they are being edited. */
+    if (false == render_snapshot_input_changed(input, number_input)) {
+      return;
+    }
+
+    number_input = input;
+
+    mutex.lock();
+      edited_number = value;
+    mutex.unlock();
+
+    has_changes = true;
+  }
+
+  void RenderSnapshot::getTextInputValue(std::string& result) {
+    mutex.lock();
+      result = edited_text;
+    mutex.unlock();
+  }
+
+  void RenderSnapshot::disableTextInput() {
+
+    if (text_input.is_enabled) {
+      text_input.is_enabled = false;
+      has_changes = true;
+    }
+  }
+
+  void RenderSnapshot::enableTextInput(float x, float y, float maxw, std::string value, float* color) {
+
+    RecordedInput input;
+    input.is_enabled = true;
+    input.layer = layer;
+    input.x = x;
+    input.y = y;
+    input.maxw = maxw;
+    input.value = value;
+    memcpy(input.color, color, sizeof(input.color));
+
+    /* Widgets call this every time they are created while they are being edited. */
+    if (false == render_snapshot_input_changed(input, text_input)) {
+      return;
+    }
+
+    text_input = input;
+
+    mutex.lock();
+      edited_text = value;
+    mutex.unlock();
+
+    has_changes = true;
+  }
+
+  bool RenderSnapshot::getIconSize(unsigned int id, int& w, int& h) {
+
+    if (NULL == target) {
+      return RenderRecorder::getIconSize(id, w, h);
+    }
+
+    return target->getIconSize(id, w, h);
+  }
+
+  /* -------------------------------------------------------------------------------------------------------------- */
+
+  bool RenderSnapshot::upload() {
+
+    if (NULL == target) {
+      printf("Error: cannot upload the snapshot, no target render.\n");
+      return false;
+    }
+
+    mutex.lock();
+    {
+      if (false == has_pending) {
+        mutex.unlock();
+        return false;
+      }
+
+      RenderDrawList* tmp = front;
+      front = pending;
+      pending = tmp;
+      has_pending = false;
+    }
+    mutex.unlock();
+
+    if (NULL != front->staging) {
+      target->swapBuffers(front->staging);
+    }
+    else {
+      replay(target, front->shapes, front->texts, front->text_data);
+    }
+
+    applyInputs(*front);
+    target->update();
+
+    num_uploaded++;
+
+    return true;
+  }
+
+  void RenderSnapshot::drawTarget() {
+
+    if (NULL == target) {
+      return;
+    }
+
+    if (front->is_scissor_enabled) {
+      target->beginScissor();
+      target->scissor(front->scissor[0], front->scissor[1], front->scissor[2], front->scissor[3]);
+    }
+
+    target->draw();
+
+    if (front->is_scissor_enabled) {
+      target->endScissor();
+    }
+  }
+
+  void RenderSnapshot::onTargetCharPress(unsigned int key) {
+
+    if (NULL == target) {
+      return;
+    }
+
+    target->onCharPress(key);
+    copyInputValues();
+  }
+
+  void RenderSnapshot::onTargetKeyPress(int key, int mods) {
+
+    if (NULL == target) {
+      return;
+    }
+
+    target->onKeyPress(key, mods);
+    copyInputValues();
+  }
+
+  /* -------------------------------------------------------------------------------------------------------------- */
+
+  void RenderSnapshot::replay(Render* dest, std::vector<RecordedShape>& shape_list, std::vector<RecordedText>& text_list, std::string& chars) {
+
+    int curr_layer = 0;
+
+    dest->clear();
+    dest->setLayer(curr_layer);
+
+    for (size_t i = 0; i < shape_list.size(); ++i) {
+
+      RecordedShape& s = shape_list[i];
+
+      if (s.layer != curr_layer) {
+        curr_layer = s.layer;
+        dest->setLayer(curr_layer);
+      }
+
+      switch (s.type) {
+        case GUI_RECORD_RECTANGLE:          { dest->addRectangle(s.x, s.y, s.w, s.h, s.color, true, s.shade_top, s.shade_bottom);                                  break; }
+        case GUI_RECORD_OUTLINE:            { dest->addRectangle(s.x, s.y, s.w, s.h, s.color, false, s.shade_top, s.shade_bottom);                                 break; }
+        case GUI_RECORD_ROUNDED_RECTANGLE:  { dest->addRoundedRectangle(s.x, s.y, s.w, s.h, s.radius, s.color, true, s.shade_top, s.shade_bottom, s.corners);      break; }
+        case GUI_RECORD_ROUNDED_OUTLINE:    { dest->addRoundedRectangle(s.x, s.y, s.w, s.h, s.radius, s.color, false, s.shade_top, s.shade_bottom, s.corners);     break; }
+        case GUI_RECORD_SHADOW_LINE:        { dest->addRoundedShadowLine(s.x, s.y, s.w, s.h, s.radius, s.color, s.corners);                                        break; }
+        case GUI_RECORD_TEXTURE:            { dest->addRectangle(s.x, s.y, s.w, s.h, s.texture);                                                                   break; }
+        default: {
+          printf("Error: unhandled shape type in the snapshot: %d\n", s.type);
+          break;
+        }
+      }
+    }
+
+    for (size_t i = 0; i < text_list.size(); ++i) {
+
+      RecordedText& t = text_list[i];
+
+      if (t.layer != curr_layer) {
+        curr_layer = t.layer;
+        dest->setLayer(curr_layer);
+      }
+
+      switch (t.type) {
+        case GUI_RECORD_TEXT:    { dest->writeText(t.x, t.y, chars.substr(t.offset, t.count), t.color);                   break; }
+        case GUI_RECORD_NUMBER:  { dest->writeNumber(t.x, t.y, chars.data() + t.offset, t.count, t.color);              break; }
+        case GUI_RECORD_ICON:    { dest->writeIcon(t.x, t.y, t.icon, t.color);                                            break; }
+        default: {
+          printf("Error: unhandled text type in the snapshot: %d\n", t.type);
+          break;
+        }
+      }
+    }
+
+    dest->setLayer(0);
+  }
+
+  void RenderSnapshot::applyInputs(RenderDrawList& list) {
+
+    /* The widgets enable the input every time they are created; we only reset the input of the target when it really changed, otherwise we would lose what the user typed. */
+    if (render_snapshot_input_changed(list.text_input, target_text_input)) {
+
+      target->setLayer(list.text_input.layer);
+
+      if (list.text_input.is_enabled) {
+        target->enableTextInput(list.text_input.x, list.text_input.y, list.text_input.maxw, list.text_input.value, list.text_input.color);
+      }
+      else {
+        target->disableTextInput();
+      }
+
+      target_text_input = list.text_input;
+    }
+
+    if (render_snapshot_input_changed(list.number_input, target_number_input)) {
+
+      target->setLayer(list.number_input.layer);
+
+      if (list.number_input.is_enabled) {
+        target->enableNumberInput(list.number_input.x, list.number_input.y, list.number_input.maxw, list.number_input.value, list.number_input.color);
+      }
+      else {
+        target->disableNumberInput();
+      }
+
+      target_number_input = list.number_input;
+    }
+
+    target->setLayer(0);
+  }
+
+  void RenderSnapshot::copyInputValues() {
+
+    std::string text;
+    std::string number;
+
+    if (target_text_input.is_enabled) {
+      target->getTextInputValue(text);
+    }
+
+    if (target_number_input.is_enabled) {
+      target->getNumberInputValue(number);
+    }
+
+    mutex.lock();
+    {
+      if (target_text_input.is_enabled) {
+        edited_text = text;
+      }
+      if (target_number_input.is_enabled) {
+        edited_number = number;
+      }
+    }
+    mutex.unlock();
+  }
+
+  /* -------------------------------------------------------------------------------------------------------------- */
+
+  static void render_snapshot_reset_input(RecordedInput& input) {
+    input.is_enabled = false;
+    input.layer = 0;
+    input.x = 0.0f;
+    input.y = 0.0f;
+    input.maxw = 0.0f;
+    input.value.clear();
+    input.color[0] = input.color[1] = input.color[2] = input.color[3] = 0.0f;
+  }
+
+  static bool render_snapshot_input_changed(RecordedInput& a, RecordedInput& b) {
+
+    if (a.is_enabled != b.is_enabled) {
+      return true;
+    }
+
+    if (false == a.is_enabled) {
+      return false;
+    }
+
+    return a.layer != b.layer
+        || a.x != b.x
+        || a.y != b.y
+        || a.maxw != b.maxw
+        || a.value != b.value;
+  }
+
+} /* namespace rx */
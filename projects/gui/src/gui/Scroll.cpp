@@ -47,6 +47,8 @@ Scroll::Scroll(int style)
 void Scroll::setGroup(Group* g) {
  
   Widget::setGroup(g);
+  down_button.parent = this;
+  up_button.parent = this;
   down_button.setGroup(g);
   up_button.setGroup(g);
 }
@@ -82,16 +84,16 @@ void Scroll::onMousePress(float mx, float my, int button, int modkeys) {
   // press inside grip area
   if(GUI_IS_INSIDE(mx, my, scroll_bar_x, grip_y, w, grip_h)) {
     state |= GUI_STATE_DOWN_INSIDE;
-    needs_redraw = true;
+    setNeedsRedraw();
   }
   // press inside track area
   else if(GUI_IS_INSIDE(mx, my, scroll_bar_x, track_y, w, track_h)) {
     state |= GUI_STATE_DOWN_CUSTOM0;
-    needs_redraw = true;
+    setNeedsRedraw();
   }
   else {
     if(state & GUI_STATE_DOWN_INSIDE) {
-      needs_redraw = true;
+      setNeedsRedraw();
       state &= ~GUI_STATE_DOWN_INSIDE;
     }
   }
@@ -106,7 +108,7 @@ void Scroll::onMouseRelease(float mx, float my, int button, int modkeys) {
   needs_redraw = (up_button.needs_redraw || down_button.needs_redraw);
 
   if(state & (GUI_STATE_DOWN_INSIDE | GUI_STATE_DOWN_CUSTOM0)) {
-    needs_redraw = true;
+    setNeedsRedraw();
   }
 
   if(state & GUI_STATE_DOWN_CUSTOM0) {
@@ -142,7 +144,7 @@ void Scroll::setMousePositionValue(float my) {
   float grip_perc = float(new_grip_y - track_y) / (grip_space);
 
   setPercentageValue(grip_perc);
-  needs_redraw = true;
+  setNeedsRedraw();
 }
 
 void Scroll::setPercentageValue(float v) {
@@ -170,7 +172,7 @@ void Scroll::setVisibleArea(int visx, int visy, int visw, int vish, int contenth
 
   int div = prev_content_h - content_h;
   if(div) {
-    // @todo - when then contents becomes smaller/bigger we need to adjust the percentage. reproduce: Create a panel with these groups and widgets: https://gist.github.com/roxlu/218d6ab2039e9967cf7c . 1) open all groups 2) scroll down, 3) close water simulation 4) open water simulation. This is now fixed by calling Panel::position() again in Panel::position() when the offsets change.
+    // @todo - when then contents becomes smaller/bigger we need to adjust the percentage. reproduce: Create a panel with these groups and widgets: https://gist.github.com/roxlu/218d6ab2039e9967cf7c . 1) open all groups 2) scroll down, 3) close water simulation 4) open water simulation. Panel::position() moves the groups again when the offset changed.
   }
 }
 
@@ -202,7 +204,7 @@ void Scroll::movePageUp() {
   float page_ratio = float(visible_h) / content_h;
   setPercentageValue(perc - page_ratio);
   position();
-  needs_redraw = true;
+  setNeedsRedraw();
 }
 
 void Scroll::movePageDown() {
@@ -210,7 +212,7 @@ void Scroll::movePageDown() {
   float page_ratio = float(visible_h) / content_h;
   setPercentageValue(perc + page_ratio);
   position();
-  needs_redraw = true;
+  setNeedsRedraw();
 }
 
 void Scroll::beginScissor() {
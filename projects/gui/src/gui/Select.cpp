@@ -108,7 +108,7 @@ namespace rx {
       state |= GUI_STATE_DOWN_INSIDE;
       icon_button.state |= GUI_STATE_DOWN_INSIDE;
       menu.show();
-      needs_redraw = true;
+      setNeedsRedraw();
 
       if (GUI_DIRECTION_DOWN == menu.direction) {
         /* @todo: when you have a panel/group with only one select
@@ -118,6 +118,7 @@ namespace rx {
            we reset the height to default. */
 
         h = 22 + menu.popup_height;
+        setNeedsLayout();
         
         /* end quickfix */
       }
@@ -128,7 +129,7 @@ namespace rx {
 
     menu.hide();
 
-    needs_redraw = true;
+    setNeedsRedraw();
     state &= ~GUI_STATE_DOWN_INSIDE;
     icon_button.state &= ~GUI_STATE_DOWN_INSIDE;
 
@@ -138,6 +139,7 @@ namespace rx {
               otherwise the scissor test will hide our contents. Here
               we reset the height to default. */
     h = 22;
+    setNeedsLayout();
     /* end quickfix */
   }
 
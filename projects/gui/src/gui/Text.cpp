@@ -55,7 +55,7 @@ void Text::onMousePress(float mx, float my, int button, int modkeys) {
   if(GUI_IS_INSIDE(mx, my, text_x, y, text_w, h)) {
     if(!(state & GUI_STATE_EDITABLE)) {
       state |= GUI_STATE_EDITABLE;
-      needs_redraw = true;
+      setNeedsRedraw();
     }
   }
   else {
@@ -79,7 +79,7 @@ void Text::disableInputAndCopyValue() {
   render->disableTextInput();
 
   state &= ~GUI_STATE_EDITABLE;
-  needs_redraw = true;
+  setNeedsRedraw();
 
   notify(GUI_EVENT_VALUE_CHANGED);
 }
@@ -0,0 +1,182 @@
+#include <stdio.h>
+#if !defined(_WIN32)
+#  include <unistd.h>
+#endif
+#include <gui/Thread.h>
+
+namespace rx {
+
+  /* -------------------------------------------------------------------------------------------------------------- */
+
+#if defined(_WIN32)
+  static DWORD WINAPI thread_main(LPVOID user) {
+    Thread* t = static_cast<Thread*>(user);
+    t->func(t->user);
+    return 0;
+  }
+#else
+  static void* thread_main(void* user) {
+    Thread* t = static_cast<Thread*>(user);
+    t->func(t->user);
+    return NULL;
+  }
+#endif
+
+  /* -------------------------------------------------------------------------------------------------------------- */
+
+  int gui_get_num_cpus() {
+
+    int num = 1;
+
+#if defined(_WIN32)
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    num = (int)info.dwNumberOfProcessors;
+#else
+    num = (int)sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+
+    return (num < 1) ? 1 : num;
+  }
+
+  /* -------------------------------------------------------------------------------------------------------------- */
+
+  Mutex::Mutex() {
+#if defined(_WIN32)
+    InitializeCriticalSection(&handle);
+#else
+    pthread_mutex_init(&handle, NULL);
+#endif
+  }
+
+  Mutex::~Mutex() {
+#if defined(_WIN32)
+    DeleteCriticalSection(&handle);
+#else
+    pthread_mutex_destroy(&handle);
+#endif
+  }
+
+  void Mutex::lock() {
+#if defined(_WIN32)
+    EnterCriticalSection(&handle);
+#else
+    pthread_mutex_lock(&handle);
+#endif
+  }
+
+  void Mutex::unlock() {
+#if defined(_WIN32)
+    LeaveCriticalSection(&handle);
+#else
+    pthread_mutex_unlock(&handle);
+#endif
+  }
+
+  /* -------------------------------------------------------------------------------------------------------------- */
+
+  Condition::Condition() {
+#if defined(_WIN32)
+    InitializeConditionVariable(&handle);
+#else
+    pthread_cond_init(&handle, NULL);
+#endif
+  }
+
+  Condition::~Condition() {
+#if !defined(_WIN32)
+    pthread_cond_destroy(&handle);
+#endif
+  }
+
+  void Condition::wait(Mutex& m) {
+#if defined(_WIN32)
+    SleepConditionVariableCS(&handle, &m.handle, INFINITE);
+#else
+    pthread_cond_wait(&handle, &m.handle);
+#endif
+  }
+
+  void Condition::signal() {
+#if defined(_WIN32)
+    WakeConditionVariable(&handle);
+#else
+    pthread_cond_signal(&handle);
+#endif
+  }
+
+  void Condition::broadcast() {
+#if defined(_WIN32)
+    WakeAllConditionVariable(&handle);
+#else
+    pthread_cond_broadcast(&handle);
+#endif
+  }
+
+  /* -------------------------------------------------------------------------------------------------------------- */
+
+  Thread::Thread()
+    :func(NULL)
+    ,user(NULL)
+    ,is_running(false)
+  {
+#if defined(_WIN32)
+    handle = NULL;
+#endif
+  }
+
+  Thread::~Thread() {
+    join();
+  }
+
+  bool Thread::create(gui_thread_function f, void* u) {
+
+    if (true == is_running) {
+      printf("Error: the thread is already running.\n");
+      return false;
+    }
+
+    if (NULL == f) {
+      printf("Error: cannot create a thread without a function.\n");
+      return false;
+    }
+
+    func = f;
+    user = u;
+
+#if defined(_WIN32)
+    handle = CreateThread(NULL, 0, thread_main, this, 0, NULL);
+    if (NULL == handle) {
+      printf("Error: cannot create the thread.\n");
+      return false;
+    }
+#else
+    if (0 != pthread_create(&handle, NULL, thread_main, this)) {
+      printf("Error: cannot create the thread.\n");
+      return false;
+    }
+#endif
+
+    is_running = true;
+
+    return true;
+  }
+
+  void Thread::join() {
+
+    if (false == is_running) {
+      return;
+    }
+
+#if defined(_WIN32)
+    WaitForSingleObject(handle, INFINITE);
+    CloseHandle(handle);
+    handle = NULL;
+#else
+    pthread_join(handle, NULL);
+#endif
+
+    is_running = false;
+  }
+
+} /* namespace rx */
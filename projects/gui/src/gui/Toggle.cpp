@@ -35,7 +35,7 @@ namespace rx {
 
     if(GUI_IS_INSIDE_WIDGET(this, mx, my)) {
       state |= GUI_STATE_DOWN_INSIDE;
-      needs_redraw = true;
+      setNeedsRedraw();
     }
   }
 
@@ -45,7 +45,7 @@ namespace rx {
       if(GUI_IS_INSIDE_WIDGET(this, mx, my)) {
         setValue(!value);
       }
-      needs_redraw = true;
+      setNeedsRedraw();
     }
 
     state &= ~GUI_STATE_DOWN_INSIDE;
@@ -1,5 +1,8 @@
 #include <cmath>
 #include <cctype>
+#include <cstdio>  // sprintf
+#include <cstdlib>
+#include <stdint.h>
 #include <algorithm>  // transform
 #include <sstream>
 #include <gui/Utils.h>
@@ -62,6 +65,254 @@ bool gui_string_to_bool(std::string str) {
   return result;
 }
 
+/* -------------------------------------------------------------------------------------------------------------- */
+
+/* writes the digits of `value` backwards, starting at `end`; returns the position of the first digit */
+static char* gui_format_digits(uint64_t value, char* end, int min_digits) {
+
+  char* p = end;
+
+  do {
+    *--p = '0' + (value % 10);
+    value /= 10;
+    --min_digits;
+  } while (value > 0 || min_digits > 0);
+
+  return p;
+}
+
+/* copies [from, end) to the start of `buf` */
+static int gui_format_copy(const char* from, const char* end, char* buf, int nbytes) {
+
+  int len = end - from;
+
+  if (len >= nbytes) {
+    len = nbytes - 1;
+  }
+
+  for (int i = 0; i < len; ++i) {
+    buf[i] = from[i];
+  }
+
+  buf[len] = '\0';
+
+  return len;
+}
+
+/* parses an optional sign and the digits that follow; returns true when the number is negative */
+static bool gui_parse_digits(const char* str, uint64_t& value) {
+
+  const char* p = str;
+  bool negative = false;
+
+  value = 0;
+
+  while (' ' == *p) {
+    ++p;
+  }
+
+  if ('-' == *p || '+' == *p) {
+    negative = ('-' == *p);
+    ++p;
+  }
+
+  while (*p >= '0' && *p <= '9') {
+    value = value * 10 + (*p - '0');
+    ++p;
+  }
+
+  return negative;
+}
+
+int gui_format_number(long long value, int /*precision*/, char* buf, int nbytes) {
+
+  char tmp[GUI_NUMBER_BUFFER_SIZE];
+  char* end = tmp + sizeof(tmp);
+  uint64_t v = (value < 0) ? (uint64_t(0) - uint64_t(value)) : uint64_t(value);
+  char* p = gui_format_digits(v, end, 1);
+
+  if (value < 0) {
+    *--p = '-';
+  }
+
+  return gui_format_copy(p, end, buf, nbytes);
+}
+
+int gui_format_number(unsigned long long value, int /*precision*/, char* buf, int nbytes) {
+
+  char tmp[GUI_NUMBER_BUFFER_SIZE];
+  char* end = tmp + sizeof(tmp);
+  char* p = gui_format_digits(uint64_t(value), end, 1);
+
+  return gui_format_copy(p, end, buf, nbytes);
+}
+
+int gui_format_number(int value, int precision, char* buf, int nbytes) {
+  return gui_format_number((long long)value, precision, buf, nbytes);
+}
+
+int gui_format_number(unsigned int value, int precision, char* buf, int nbytes) {
+  return gui_format_number((unsigned long long)value, precision, buf, nbytes);
+}
+
+int gui_format_number(long value, int precision, char* buf, int nbytes) {
+  return gui_format_number((long long)value, precision, buf, nbytes);
+}
+
+int gui_format_number(unsigned long value, int precision, char* buf, int nbytes) {
+  return gui_format_number((unsigned long long)value, precision, buf, nbytes);
+}
+
+int gui_format_number(double value, int precision, char* buf, int nbytes) {
+
+  char tmp[GUI_NUMBER_BUFFER_SIZE];
+  char* end = tmp + sizeof(tmp);
+  char* p = end;
+  bool strip = false;
+  uint64_t scale = 1;
+  uint64_t n = 0;
+  double v = (value < 0.0) ? -value : value;
+
+
+  if (precision < 0) {
+    precision = 6;
+    strip = true;
+  }
+  else if (precision > 9) {
+    precision = 9;
+  }
+
+  for (int i = 0; i < precision; ++i) {
+    scale *= 10;
+  }
+
+  /* nan, inf or too big for our fixed point; rare for a gui, so we let sprintf handle it */
+  if (value != value || v * scale >= 9.0e18) {
+    int len = sprintf(tmp, "%g", value);
+    return gui_format_copy(tmp, tmp + len, buf, nbytes);
+  }
+
+  n = uint64_t(v * scale + 0.5);
+
+  if (precision > 0) {
+
+    uint64_t frac = n % scale;
+    int digits = precision;
+
+    if (strip) {
+      while (digits > 0 && 0 == (frac % 10)) {
+        frac /= 10;
+        --digits;
+      }
+    }
+
+    if (digits > 0) {
+      p = gui_format_digits(frac, p, digits);
+      *--p = '.';
+    }
+  }
+
+  p = gui_format_digits(n / scale, p, 1);
+
+  if (value < 0.0 && n > 0) {
+    *--p = '-';
+  }
+
+  return gui_format_copy(p, end, buf, nbytes);
+}
+
+int gui_format_number(float value, int precision, char* buf, int nbytes) {
+  return gui_format_number(double(value), precision, buf, nbytes);
+}
+
+void gui_parse_number(const char* str, long long& result) {
+
+  uint64_t v = 0;
+  bool negative = gui_parse_digits(str, v);
+
+  result = negative ? (long long)(uint64_t(0) - v) : (long long)v;
+}
+
+void gui_parse_number(const char* str, unsigned long long& result) {
+
+  uint64_t v = 0;
+  bool negative = gui_parse_digits(str, v);
+
+  result = negative ? 0 : (unsigned long long)v;
+}
+
+void gui_parse_number(const char* str, int& result) {
+  long long v = 0;
+  gui_parse_number(str, v);
+  result = int(v);
+}
+
+void gui_parse_number(const char* str, unsigned int& result) {
+  unsigned long long v = 0;
+  gui_parse_number(str, v);
+  result = (unsigned int)v;
+}
+
+void gui_parse_number(const char* str, long& result) {
+  long long v = 0;
+  gui_parse_number(str, v);
+  result = long(v);
+}
+
+void gui_parse_number(const char* str, unsigned long& result) {
+  unsigned long long v = 0;
+  gui_parse_number(str, v);
+  result = (unsigned long)v;
+}
+
+void gui_parse_number(const char* str, double& result) {
+
+  /* we don't use strtod() because it uses the decimal point of the locale */
+  const char* p = str;
+  double sign = 1.0;
+  double scale = 0.1;
+
+  result = 0.0;
+
+  while (' ' == *p) {
+    ++p;
+  }
+
+  if ('-' == *p || '+' == *p) {
+    sign = ('-' == *p) ? -1.0 : 1.0;
+    ++p;
+  }
+
+  while (*p >= '0' && *p <= '9') {
+    result = result * 10.0 + (*p - '0');
+    ++p;
+  }
+
+  if ('.' == *p || ',' == *p) {
+    ++p;
+    while (*p >= '0' && *p <= '9') {
+      result += (*p - '0') * scale;
+      scale *= 0.1;
+      ++p;
+    }
+  }
+
+  if ('e' == *p || 'E' == *p) {
+    result *= pow(10.0, double(strtol(p + 1, NULL, 10)));
+  }
+
+  result *= sign;
+}
+
+void gui_parse_number(const char* str, float& result) {
+
+  double v = 0.0;
+  gui_parse_number(str, v);
+  result = float(v);
+}
+
+/* -------------------------------------------------------------------------------------------------------------- */
+
 void gui_hsv_to_rgb(float h, float s, float v, float& r, float& g, float& b) {
   float tmp_r = gui_clamp<float>((-1.0f + fabs(6.0f * h - 3.0f)), 0,1);
   float tmp_g = gui_clamp<float>(( 2.0f - fabs(6.0f * h - 2.0f)), 0,1);      
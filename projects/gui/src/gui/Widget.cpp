@@ -15,6 +15,7 @@ namespace rx {
     ,mods(GUI_MOD_NONE)
     ,label(label)
     ,group(NULL)
+    ,parent(NULL)
     ,render(NULL)
     ,x(0)
     ,y(0)
@@ -22,6 +23,8 @@ namespace rx {
     ,h(0)
     ,style(0)
     ,needs_redraw(true)
+    ,needs_redraw_children(false)
+    ,needs_layout(true)
     ,mouse_x(0)
     ,mouse_y(0)
     ,mouse_press_x(0)
@@ -32,6 +35,7 @@ namespace rx {
     bbox[0] = bbox[1] = bbox[2] = bbox[3] = 0;
     margin[0] = margin[1] = margin[2] = margin[3] = 0;
     id = generated_ids;
+    span_id = generated_ids;
     generated_ids++;
   }
 
@@ -56,52 +60,110 @@ namespace rx {
 
   Widget& Widget::add(Widget* w, Group* g) {
 
+    w->parent = this;
     w->setGroup(g);
 
     children.push_back(w);
 
+    /* the layout changed */
+    w->setNeedsLayout();
+    w->setNeedsRedraw();
+
     return *w;
   }
 
-  bool Widget::needsRedraw() {
+  void Widget::create() {
+  }
 
-    if(needs_redraw) {
-      return true;
+  void Widget::build() {
+
+    if(!isDrawn() || (state & GUI_STATE_CULLED)) {
+      unsetNeedsRedraw();
+      needs_redraw_children = false;
+      return;
     }
 
-    return needsRedrawChildren();
+    render->beginSpan(span_id);
+    create();
+    render->endSpan(span_id);
+
+    buildChildren();
+    unsetNeedsRedraw();
+    needs_redraw_children = false;
   }
 
-  bool Widget::needsRedrawChildren() {
+  void Widget::buildChildren() {
 
     for(std::vector<Widget*>::iterator it = children.begin(); it != children.end(); ++it) {
-      if((*it)->needsRedraw()) {
-        return true;
+      (*it)->build();
+    }
+  }
+
+  bool Widget::rebuild() {
+
+    if(!isDrawn()) {
+      return false;
+    }
+
+    /* widgets with children might have changed their layout */
+    if(children.size()) {
+      if(needs_redraw) {
+        return false;
       }
+      return rebuildChildren();
     }
-    return false;
+
+    return patch();
   }
 
-  void Widget::create() {
+  bool Widget::rebuildChildren() {
+
+    /* cleared first, so a child that is marked again while we patch it is handled in the next update. */
+    needs_redraw_children = false;
+
+    for(std::vector<Widget*>::iterator it = children.begin(); it != children.end(); ++it) {
+
+      Widget* wi = *it;
+
+      if(!wi->needsRedraw()) {
+        continue;
+      }
+
+      /* not drawn; it's created when it is scrolled into view. */
+      if(wi->state & GUI_STATE_CULLED) {
+        wi->unsetNeedsRedraw();
+        wi->needs_redraw_children = false;
+        continue;
+      }
+
+      if(!wi->rebuild()) {
+        return false;
+      }
+    }
+
+    return true;
   }
 
-  void Widget::build() {
+  bool Widget::patch() {
 
-    if(!isDrawn()) {
-      unsetNeedsRedraw();
-      return;
+    if(!render->beginPatch(span_id)) {
+      return false;
     }
 
     create();
-    buildChildren();
-    unsetNeedsRedraw();
-  }
 
-  void Widget::buildChildren() {
+    if(!render->endPatch(span_id)) {
+      return false;
+    }
 
-    for(std::vector<Widget*>::iterator it = children.begin(); it != children.end(); ++it) {
-      (*it)->build();
+    unsetNeedsRedraw();
+
+    /* the embedded widgets (e.g. the buttons of a Slider) were drawn in create(). */
+    if (0 == children.size()) {
+      needs_redraw_children = false;
     }
+
+    return true;
   }
 
   void Widget::onCharPress(unsigned int key) {
@@ -164,7 +226,7 @@ namespace rx {
       }
     }
 
-    Widget::onMousePressChildren(mx, my, button, modkeys);
+    onMousePressChildren(mx, my, button, modkeys);
   }
 
   void Widget::onMousePressChildren(float mx, float my, int button, int modkeys) {
@@ -229,7 +291,7 @@ namespace rx {
       }
     }
 
-    Widget::onMouseReleaseChildren(mx, my, button, modkeys);
+    onMouseReleaseChildren(mx, my, button, modkeys);
   }
 
   void Widget::onMouseReleaseChildren(float mx, float my, int button, int modkeys) {
@@ -275,7 +337,7 @@ namespace rx {
 
   void Widget::onMouseMove(float mx, float my) {
 
-    Widget::onMouseMoveChildren(mx, my);
+    onMouseMoveChildren(mx, my);
 
     mouse_x = mx;
     mouse_y = my;
@@ -375,14 +437,17 @@ namespace rx {
 
   void Widget::show() {
     state &= ~GUI_STATE_HIDDEN;
+    setNeedsLayout();
   }
 
   void Widget::open() {
     state &= ~GUI_STATE_CLOSED;
+    setNeedsLayout();
   }
 
   void Widget::close() {
     state |= GUI_STATE_CLOSED;
+    setNeedsLayout();
   }
 
   void Widget::disableNotifications() {
@@ -401,6 +466,7 @@ namespace rx {
     bbox[3] = 0;
 
     state |= GUI_STATE_HIDDEN;
+    setNeedsLayout();
   }
 
   void Widget::print() {
@@ -1,3 +1,4 @@
+#include <sstream>
 #include <gui/Utils.h>
 #include <gui/Widget.h>
 #include <gui/Slider.h>
@@ -176,7 +177,7 @@ bool StorageXML::load() {
             Slider<int>* slider = static_cast<Slider<int>* >(widget);
             std::string str_value = xwidget->value();
             slider->setAbsoluteValue(gui_string_to_int(str_value));
-            slider->needs_redraw = true;
+            slider->setNeedsRedraw();
             break;
           }
 
@@ -184,7 +185,7 @@ bool StorageXML::load() {
             Slider<float>* slider = static_cast<Slider<float>* >(widget);
             std::string str_value = xwidget->value();
             slider->setAbsoluteValue(gui_string_to_float(str_value));
-            slider->needs_redraw = true;
+            slider->setNeedsRedraw();
             break;
           }
 
@@ -192,7 +193,7 @@ bool StorageXML::load() {
             Toggle* toggle = static_cast<Toggle*>(widget);
             std::string str_value = xwidget->value();
             toggle->value = gui_string_to_bool(str_value);
-            toggle->needs_redraw = true;
+            toggle->setNeedsRedraw();
             break;
           }
 
@@ -200,14 +201,14 @@ bool StorageXML::load() {
             ColorRGB* color = static_cast<ColorRGB*>(widget);
             std::string str_value = xwidget->value();
             color->setPercentageValue(gui_string_to_float(str_value));
-            color->needs_redraw = true;
+            color->setNeedsRedraw();
             break;
           }
 
           case GUI_TYPE_TEXT: {
             Text* text = static_cast<Text*>(widget);
             text->value = xwidget->value();
-            text->needs_redraw = true;
+            text->setNeedsRedraw();
             break;
           }
 
@@ -254,12 +254,12 @@ int main() {
 #if USE_PANEL
 # if 1
     //    test_slider->setAbsoluteValue( (0.5 + sin(test_slider_value) * 0.5) * 10.0f);
-    //    test_slider->needs_redraw = true;
+    //    test_slider->setNeedsRedraw();
 #endif
 
     panel.draw();
     //    changing_slider->setAbsoluteValue( (0.5 + sin(test_slider_value) * 0.5) * 1000000.0f);
-    //    changing_slider->needs_redraw = true;
+    //    changing_slider->setNeedsRedraw();
     //test_slider_value += 0.3;
 
 #endif
@@ -340,7 +340,7 @@ void key_callback(GLFWwindow* win, int key, int scancode, int action, int mods)
   if(panel_ptr) {
     panel_ptr->onKeyPress(key, mods);
     if(key == GLFW_KEY_F1) {
-      panel_ptr->needs_redraw = true;
+      panel_ptr->setNeedsRedraw();
     }
   }
 
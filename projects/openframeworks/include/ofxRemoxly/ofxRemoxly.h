@@ -98,6 +98,7 @@ class ofxRemoxly {
   Group* curr_group;
   std::vector<Panel*> panels;
   std::vector<Group*> groups;
+  PanelSet panel_set;                /* rebuilds the panels that changed in parallel */
 
   /* client <> server */
   Server* server;
@@ -29,9 +29,7 @@ void ofxRemoxly::draw() {
     client->update();
   }
 
-  for(std::vector<Panel*>::iterator it = panels.begin(); it != panels.end(); ++it) {
-    (*it)->draw();
-  }
+  panel_set.draw();
 
   glBindTexture(GL_TEXTURE_2D, 0);
   glBindBuffer(GL_ARRAY_BUFFER, 0);
@@ -68,6 +66,7 @@ Panel* ofxRemoxly::addPanel(int h) {
   curr_panel = new Panel(new RenderGL(), h);
   curr_panel->x = panels.size() * (curr_panel->w + curr_panel->scroll.w)  + (1 + panels.size()) * 10;
   panels.push_back(curr_panel);
+  panel_set.add(curr_panel);
   return curr_panel;
 }
 
@@ -17,6 +17,17 @@
      GUI yourself. When connected to the server the server sends the
      GUI model and you use a generator to create all the widgets. 
 
+  Changed values are coalesced per widget: while a value of a widget
+  is queued, a newer value replaces it, so a slider drag sends at most
+  one value per widget per writable callback. Use setMaxValueRate() to
+  also limit how often we send values, e.g. for clients on a slow
+  network.
+
+  A ShardedServer can ask us to connect to the port of the shard that
+  keeps the application (REMOTE_TASK_REDIRECT). We then close the 
+  connection and reconnect to that port right away; when auto_reconnect
+  is disabled we ignore the redirect.
+
 
  */
 #ifndef REMOXLY_GUI_REMOTE_CLIENT_H
@@ -72,6 +83,7 @@ class Client : public WidgetListener {
   void shutdown();                                                       /* shutsdown the connection and clears up all allocated memory */
   bool isApplication();                                                  /* a client can be used in two situations. one, a client is used to send a gui model to the server. in this case the user creates and adds the panels and groups to the client. On the other side a client can be used to retrieve a gui model */
   bool isConnected();                                                    /* returns true when the client is connected */
+  void setMaxValueRate(int perSecond);                                   /* send the changed values at most `perSecond` times per second; 0 (default) sends them on every writable callback */
   void onDisconnected();                                                 /* is called when we get disconnected; is also passed on to the listener */
                                                                          
   /* used to serialize + events */                                       
@@ -84,6 +96,7 @@ class Client : public WidgetListener {
   bool onTaskValueChanged(char* data, size_t len, std::string value);     /* gets called when we receive a message from the server that a value has changed */
   bool onTaskGetValues(char* data, size_t len, std::string value);        /* gets called when a client wants to update all of it's values for the gui */
   bool onTaskSetValues(char* data, size_t len, std::string value);        /* gets called when a client (which is not the application) wants to update the values */
+  bool onTaskRedirect(char* data, size_t len, std::string value);         /* gets called when the server wants us to connect to another port; returns true when we must close the connection so we reconnect to that port */
 
   /* websocket callbacks */
   int onCallbackClientWritable();                                          /* gets called from the websocket callback when necessary; do not call this your self */
@@ -107,12 +120,14 @@ class Client : public WidgetListener {
   /* connection info */                          
   std::string host;                                                        /* address of the server */
   int port;                                                                /* port of the server */
+  int redirect_port;                                                       /* the port the server asked us to connect to, see REMOTE_TASK_REDIRECT; 0 when we use `port`. reset when we get disconnected for another reason */
   bool use_ssl;                                                            /* use SSL */
                                                                            
   /* websocket */                                                          
   uint64_t reconnect_timeout;                                              /* when we reach this timeout we will reconnect after being disconnected  */
   uint64_t reconnect_delay;                                                /* try to reconnect every `reconnect_delay` millis */
   bool auto_reconnect;                                                     /* by default this is set to true; it will make sure that the client tries to reconnect when disconnected */
+  bool is_redirecting;                                                     /* true when we closed the connection to follow a redirect; we reconnect without waiting for the reconnect_delay */
   int state;                                                               /* the current state of the Client. used to keep track if we're connected or not */
   lws_context_creation_info info;                                          /* used to create a libwebsocket context */
   libwebsocket_context* context;                                           /* the libwebsocket context object */
@@ -123,6 +138,9 @@ class Client : public WidgetListener {
   Serializer serializer;                                                   /* the serializer is used to serialize the gui model and event data */
   Deserializer deserializer;                                               /* used to deserialize the values we get from the server */
   std::vector<ConnectionTask*> tasks;                                      /* all the tasks that we want to deliver to the server */
+  std::map<int, ConnectionTask*> value_tasks;                              /* the queued REMOTE_TASK_VALUE_CHANGED task per widget id; a newer value replaces the queued one */
+  uint64_t value_interval;                                                 /* when > 0, the minimum number of nanos between two writes of values, see setMaxValueRate() */
+  uint64_t value_timeout;                                                  /* we don't send values before this time */
                                                                            
   bool is_application;                                                     /* is set to true, when a client adds panels and/or groups to this object. */
   ClientListener* listener;                                                /* listener that can be used to handle certain client events, see the ClientListener interface */
@@ -47,7 +47,7 @@ class Deserializer {
   Text*          deserializeText(json_t* el, std::string label, int id);           /* deserialzies a text */
 
   /* protocol */
-  bool deserializeTask(char* data, int& appID, int& taskID, std::string& value);   /* deserializes a task that we receive from the server; it merely extracts the app id and task id */
+  bool deserializeTask(char* data, int& appID, int& taskID, std::string& value, int* widgetID = NULL);   /* deserializes a task that we receive from the server; it merely extracts the app id and task id. when `widgetID` is given we store the `i` of the value in it, or -1 */
   bool deserializeValueChanged(Widget* w, std::string& json);                      /* deserialize the given json that contains values for the Widget */
   bool deserializeValueChanged(Widget* w, json_t* js);
   bool deserializeValueSliderInt(Slider<int>* slider, json_t* js);
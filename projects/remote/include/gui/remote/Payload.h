@@ -0,0 +1,107 @@
+/*
+
+  Payload
+  -------
+
+  Immutable, reference counted message that is sent to several
+  websockets. The data is stored once, with the PRE and POST padding
+  that libwebsockets needs around it, so the server can write the
+  same memory to every connection that listens for an application
+  instead of copying the message for each of them.
+
+  Payload.create(data, nbytes)    - copies the data once; the caller owns the first reference
+  Payload.retain()                - add a reference, e.g. for every task that sends the payload
+  Payload.release()               - remove a reference; the last one deletes the payload
+  Payload.ptr()                   - the data, to pass into libwebsocket_write()
+
+  The reference count is atomic so the last reference can be released
+  by another shard of a ShardedServer. libwebsockets writes the frame
+  header into the PRE padding, so a payload must only be written by
+  the connections of one shard; Server::proxyData() creates one per
+  shard.
+
+ */
+#ifndef REMOXLY_GUI_REMOTE_PAYLOAD_H
+#define REMOXLY_GUI_REMOTE_PAYLOAD_H
+
+#include <string.h>
+#include <gui/Thread.h>
+
+extern "C" {
+#  include <libwebsockets.h>
+}
+
+// -----------------------------------------------------------
+
+namespace rx {
+
+class Payload {
+
+ public:
+  static Payload* create(const char* data, size_t nbytes);   /* returns a payload with one reference */
+  void retain();
+  void release();
+  unsigned char* ptr();                                      /* the data; libwebsockets writes the frame header in the PRE padding in front of it */
+  size_t size();                                             /* the number of bytes of the data, w/o the paddings */
+
+ private:
+  Payload();
+  ~Payload();
+  Payload(const Payload& other);                             /* not copyable; shared by reference */
+  Payload& operator=(const Payload& other);
+
+ public:
+  volatile int refcount;
+  size_t nbytes;
+  unsigned char* data;                                       /* PRE padding + nbytes + POST padding */
+};
+
+// -----------------------------------------------------------
+
+inline Payload::Payload()
+  :refcount(1)
+  ,nbytes(0)
+  ,data(NULL)
+{
+}
+
+inline Payload::~Payload() {
+  delete[] data;
+  data = NULL;
+}
+
+inline Payload* Payload::create(const char* data, size_t nbytes) {
+
+  Payload* p = new Payload();
+  p->nbytes = nbytes;
+  p->data = new unsigned char[LWS_SEND_BUFFER_PRE_PADDING + nbytes + LWS_SEND_BUFFER_POST_PADDING];
+
+  if(nbytes) {
+    memcpy(p->data + LWS_SEND_BUFFER_PRE_PADDING, data, nbytes);
+  }
+
+  return p;
+}
+
+inline void Payload::retain() {
+  gui_atomic_add(&refcount, 1);
+}
+
+inline void Payload::release() {
+
+  if(0 == gui_atomic_add(&refcount, -1)) {
+    delete this;
+  }
+}
+
+inline unsigned char* Payload::ptr() {
+  return data + LWS_SEND_BUFFER_PRE_PADDING;
+}
+
+inline size_t Payload::size() {
+  return nbytes;
+}
+
+} // namespace rx
+
+#endif
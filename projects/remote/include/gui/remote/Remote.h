@@ -3,12 +3,14 @@
 
 #include <gui/remote/Utils.h>
 #include <gui/remote/Buffer.h>
+#include <gui/remote/Payload.h>
 #include <gui/remote/Types.h>
 #include <gui/remote/Serializer.h>
 #include <gui/remote/Deserializer.h>
 #include <gui/remote/Client.h>
 #include <gui/remote/ClientListener.h>
 #include <gui/remote/Server.h>
+#include <gui/remote/ShardedServer.h>
 #include <gui/remote/Generator.h>
 
 #endif
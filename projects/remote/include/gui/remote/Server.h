@@ -9,27 +9,68 @@
   client for a specific application to the correct other clients which 
   are also listening for changes from this application.
 
+  update(timeout) waits at most `timeout` milliseconds for activity on
+  the sockets; on Linux we keep the sockets of libwebsockets in an epoll
+  set (see the *PollFD callbacks) together with an eventfd so other
+  threads can wake us up with post() or wakeup(). A standalone server
+  calls update(REMOXLY_SERVER_DEFAULT_TIMEOUT) in a loop and sleeps while
+  nothing happens; an application that runs the server in its draw loop
+  calls update() which doesn't block. On other platforms we let
+  libwebsockets poll with the given timeout; a posted job is then called
+  at the latest when the timeout expires.
+
+  A server can also be one shard of a ShardedServer. The data and the
+  subscribers of an application are kept by its home shard (see
+  getHomeShard()); tasks for an application of another shard are
+  forwarded to that shard and the tasks it sends back are written by
+  the shard that owns the socket. The shards only talk to each other
+  through their ShardQueue, so a server never locks another shard.
+  When a client asks for the gui model of an application of another
+  shard, the home shard sends it a REMOTE_TASK_REDIRECT with its own
+  port so the client reconnects there and the home shard writes its
+  tasks itself.
+
+  Proxied REMOTE_TASK_VALUE_CHANGED tasks are coalesced per widget:
+  when a connection still has a value of the widget queued, the newer
+  value replaces it. setMaxValueRate() also limits how often we write
+  values to a connection; the values that change in between are
+  coalesced and written when the interval has passed.
+
  */
 #ifndef REMOXLY_GUI_REMOTE_SERVER_H
 #define REMOXLY_GUI_REMOTE_SERVER_H
 
 #include <string> 
 #include <map>
+#include <set>
+#include <vector>
 #include <libwebsockets.h>
+#include <gui/Thread.h>
 #include <gui/remote/Utils.h>
 #include <gui/remote/Buffer.h>
+#include <gui/remote/Payload.h>
+#include <gui/remote/ShardQueue.h>
 #include <gui/remote/Deserializer.h>
 
 extern "C" {
 #  include <jansson.h>
 }
 
+#if defined(__linux)
+#  define REMOXLY_SERVER_USE_EPOLL
+#endif
+
+#define REMOXLY_SERVER_DEFAULT_TIMEOUT 1000                                                /* the timeout in millis for a standalone server; libwebsockets checks its own timeouts once per second so don't wait longer */
+#define REMOXLY_SERVER_MAX_EVENTS 64                                                       /* the number of socket events we handle per epoll_wait() */
+
 namespace rx  {
 
 // -----------------------------------------------------------
 
 class Server;
 
+typedef void(*remoxly_server_job)(Server* server, void* user);                            /* a job that is posted from another thread, see Server::post() */
+
 // -----------------------------------------------------------
 
 int remoxly_server_websocket(struct libwebsocket_context* ctx,
@@ -53,6 +94,11 @@ class Connection {
   bool is_app;                                                                          /* set to true, which this is the connection that gave us the gui model */
   struct libwebsocket* ws;                                                              /* the connection ptr */
   std::vector<ConnectionTask*> tasks;                                                   /* tasks for this specific connections; mostly involves writing to the socket */
+  unsigned int id;                                                                      /* unique id of the connection on the shard that owns the socket; used to refer to it from another shard */
+  int shard;                                                                            /* the shard that owns the socket; when this isn't the shard of the server, this connection represents a socket of another shard, see ShardedServer */
+  int forward_shard;                                                                    /* the shard to which we forwarded the tasks of this connection, or -1 */
+  std::map<int, ConnectionTask*> value_tasks;                                           /* the queued value per widget id; a newer value replaces the queued one */
+  uint64_t value_timeout;                                                               /* we don't write values before this time, see Server::setMaxValueRate() */
 };
 
 // -----------------------------------------------------------
@@ -75,40 +121,74 @@ struct ApplicationData {
 
 // -----------------------------------------------------------
 
+struct ServerJob {
+  remoxly_server_job func;
+  void* user;
+};
+
+// -----------------------------------------------------------
+
 class Server {
  public:
   Server(int port, bool ssl = false);
   ~Server();
 
   bool start();                                                                            /* start the server; let it accept client connections */
-  void update();                                                                           /* call this often; it will process incoming data */
+  void update(int timeoutMillis = 0);                                                      /* call this often; it will process incoming data. waits at most timeoutMillis for something to happen; 0 returns immediately */
+  bool post(remoxly_server_job func, void* user);                                          /* thread safe; queues a job that is called by update() on the thread that updates the server, and wakes up that thread */
+  void wakeup();                                                                           /* thread safe; makes an update() that is waiting return */
+  void setMaxValueRate(int perSecond);                                                     /* write the changed values at most `perSecond` times per second to each connection; 0 (default) writes them on every writable callback */
 
   /* libwebsocket callbacks */
   int onCallbackEstablished(struct libwebsocket* ws);                                      /* gets called when a client has established a connection */
   int onCallbackReceive(struct libwebsocket* ws, char* data, size_t len);                  /* gets called when we receive some data from a client */
   int onCallbackServerWritable(struct libwebsocket* ws);                                   /* gets called when the given socket becomes writable (this is how libwebsocket works, we have to trigger writes). when it becomes writable we will process all the tasks for this connection */
   int onCallbackClosed(struct libwebsocket* ws);                                           /* gets called when the remote connection is closed */
-  int onCallbackDelPollFD(struct libwebsocket* ws);                                        /* gets called when libwesocket has removed the socket */
+  int onCallbackAddPollFD(int fd, int events);                                             /* gets called when libwebsocket starts using a socket; we add it to our epoll set */
+  int onCallbackDelPollFD(struct libwebsocket* ws, int fd);                                /* gets called when libwesocket has removed the socket */
+  int onCallbackSetModePollFD(int fd, int events);                                         /* gets called when libwebsocket wants to wait for more events (e.g. POLLOUT when we want to write) */
+  int onCallbackClearModePollFD(int fd, int events);                                       /* gets called when libwebsocket doesn't want to wait for the events anymore */
 
   /* handling of incoming tasks */
-  int onReceiveSetGuiModel(struct libwebsocket* ws, int appID, char* data, size_t len);    /* gets called when a client sends us a REMOTE_TASK_SET_GUI_MODEL event */
-  int onReceiveGetGuiModel(struct libwebsocket* ws, int appID, char* data, size_t len);    /* gets called when a client sends us a REMOTE_TASK_GET_GUI_MODEL event */
-  int onReceiveValueChanged(struct libwebsocket* ws, int appID, char* data, size_t len);   /* gets called when a client sends us a REMOTE_TASK_VALUE_CHANGED event */
-  int onReceiveGetValues(struct libwebsocket* ws, int appID, char* data, size_t len);      /* gets called when a client sends us a REMOTE_TASK_GET_VALUES event. */
-  int onReceiveSetValues(struct libwebsocket* ws, int appID, char* data, size_t len);      /* gets called when a client sends us a REMOTE_TASK_SET_VALUES event. */
-  void proxyData(int appID, char* data, size_t len);                                       /* proxy the given data to the clients for the given "appID". */
+  int handleTask(Connection* c, int task, int appID, int widgetID, char* data, size_t len); /* calls the onReceive* function for the task that the given connection sent */
+  int onReceiveSetGuiModel(Connection* c, int appID, char* data, size_t len);              /* gets called when a client sends us a REMOTE_TASK_SET_GUI_MODEL event */
+  int onReceiveGetGuiModel(Connection* c, int appID, char* data, size_t len);              /* gets called when a client sends us a REMOTE_TASK_GET_GUI_MODEL event */
+  int onReceiveValueChanged(Connection* c, int appID, int widgetID, char* data, size_t len); /* gets called when a client sends us a REMOTE_TASK_VALUE_CHANGED event */
+  int onReceiveGetValues(Connection* c, int appID, char* data, size_t len);                /* gets called when a client sends us a REMOTE_TASK_GET_VALUES event. */
+  int onReceiveSetValues(Connection* c, int appID, char* data, size_t len);                /* gets called when a client sends us a REMOTE_TASK_SET_VALUES event. */
+  void proxyData(int appID, char* data, size_t len, int widgetID = -1);                    /* proxy the given data to the clients for the given "appID"; the data is copied once (per shard) into a Payload that the clients share. pass the widget id for values so they are coalesced */
+  void queueTask(Connection* c, ConnectionTask* task);                                     /* queues the task and asks libwebsockets to tell us when we can write it; when the socket is owned by another shard we hand the task over to that shard */
+
+  /* sharding, see ShardedServer */
+  void setShards(std::vector<Server*>* group, int index);                                  /* makes this server shard `index` of the group; call this before start(). pass NULL to detach the shards (e.g. before they are deleted) */
+  int getHomeShard(int appID);                                                             /* the shard that keeps the data and subscribers of the given application */
+  void postMessage(ShardMessage* msg);                                                     /* thread safe, lock free; hands the message to this shard and wakes it up */
 
   /* connection management */
-  void addConnection(struct libwebsocket* ws);                                             /* add a new connection, is used to keep state/data for all connections */
+  Connection* addConnection(struct libwebsocket* ws);                                      /* add a new connection, is used to keep state/data for all connections */
   void closeConnection(struct libwebsocket* ws);                                           /* remove the given connection and cleanup all related data */
   void removeConnection(struct libwebsocket* ws);                                          /* closing and removing a connection is a two step process with libwebsocket; first we close the connection, then we remove it */
   Connection* getConnection(struct libwebsocket* ws);                                      /* get connection state info based on the given websocket connection */
-  Connection* getApplicationConnection(int appID);
+  Connection* getApplicationConnection(int appID);                                         /* get the connection of the application that gave us the gui model for the given "appID" */
+  void setConnectionApplication(Connection* con, int appID);                               /* sets the app id of the connection and moves it into the subscribers of that application */
+  void removeSubscriber(Connection* con);                                                  /* removes the connection from the subscribers of its application */
 
   /* application data (gui models) */
   void removeApplicationData(int appID);                                                   /* removes the gui data and all clients which are listening for information about this gui; when this is called it means that the application has been closed */
   void closeApplicationConnections(int appID);                                             /* closes all the connections for the given application ID */
   bool getApplicationData(int appID, ApplicationData& result);                             /* get gui information for the give gui model id. GuiData holds information about specific guis */
+  ApplicationData* getApplication(int appID);                                              /* same as getApplicationData() but w/o copying the gui model; returns NULL when we don't have the application */
+
+ private:
+  void runJobs();                                                                          /* calls the jobs that were posted */
+  void processMessages();                                                                  /* handles the messages that other shards posted */
+  void postToShard(int shard, ShardMessage* msg);                                          /* posts the message to the given shard; deletes it when we're not (anymore) part of a group */
+  void forwardTask(Connection* c, int shard, int task, int appID, int widgetID, char* data, size_t len); /* hands a task that a connection of this shard sent to the home shard of the application */
+  void requestDeferredWrites();                                                            /* asks libwebsockets for a writable callback for the connections whose held back values may be written now */
+  int getDeferredTimeout(int timeoutMillis);                                               /* limits the time update() waits so we don't write held back values too late */
+  Connection* getRemoteConnection(int shard, unsigned int id);                             /* returns the connection that represents a socket of another shard; creates it when it doesn't exist yet */
+  void removeRemoteConnection(int shard, unsigned int id);                                 /* the socket on the other shard was closed */
+  bool modifyPollFD(int fd, int events);                                                   /* changes the events we wait for on the given socket */
 
  public:
   /* connection info */
@@ -119,6 +199,28 @@ class Server {
   libwebsocket_context* context;
   std::map<int, ApplicationData> applications;                                             /* contains the received gui models */
   std::map<struct libwebsocket*, Connection*> connections;                                 /* custom data we keep per connection */
+  std::map<int, std::vector<Connection*> > subscribers;                                    /* the connections per app id (including the application itself); used to proxy data w/o iterating over all connections */
+  std::map<unsigned int, Connection*> connection_ids;                                      /* our connections by id, so other shards can refer to them */
+  std::map<std::pair<int, unsigned int>, Connection*> remote_connections;                  /* connections that represent sockets of other shards, by shard and id */
+  unsigned int next_connection_id;
+
+  /* sharding */
+  std::vector<Server*>* shards;                                                            /* all shards of the ShardedServer, or NULL */
+  int shard_index;                                                                         /* our index in `shards`, 0 when we're not sharded */
+  ShardQueue inbox;                                                                        /* the messages other shards posted to us */
+  std::vector<Payload*> shard_payloads;                                                    /* used by proxyData(); one payload per shard */
+
+  /* value coalescing */
+  uint64_t value_interval;                                                                 /* when > 0, the minimum number of nanos between two writes of values to a connection */
+  std::set<unsigned int> deferred_values;                                                  /* the ids of the connections that have values which we held back */
+
+  /* event loop */
+  int epoll_fd;                                                                            /* the epoll set with all sockets of libwebsockets and the wakeup_fd; -1 when we don't use epoll */
+  int wakeup_fd;                                                                           /* eventfd that is written by wakeup() */
+  std::map<int, int> poll_fds;                                                             /* the poll events (POLLIN, POLLOUT) that libwebsockets wants per socket */
+  Mutex job_mutex;                                                                         /* protects `jobs` */
+  std::vector<ServerJob> jobs;                                                             /* the jobs that were posted */
+  std::vector<ServerJob> work;                                                             /* the jobs we're calling; swapped with `jobs` so we don't hold the lock */
 
   /* protocol */
   Deserializer deserializer;
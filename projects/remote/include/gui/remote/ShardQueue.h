@@ -0,0 +1,150 @@
+/*
+
+  ShardQueue
+  ----------
+
+  Lock free queue that the shards of a ShardedServer use to hand tasks
+  to each other. Any thread can push() a message; only the shard that
+  owns the queue pops them, in the order they were pushed. This is an
+  intrusive multi producer / single consumer queue: pushing exchanges
+  the head pointer, so a producer never waits for another producer or
+  for the consumer. A message that is being pushed is only visible
+  after the producer linked it; the producer wakes up the consumer
+  after pushing so nothing gets lost.
+
+ */
+#ifndef REMOXLY_GUI_REMOTE_SHARD_QUEUE_H
+#define REMOXLY_GUI_REMOTE_SHARD_QUEUE_H
+
+#include <stdlib.h>
+#include <gui/Thread.h>
+#include <gui/remote/Utils.h>
+
+#define REMOXLY_SHARD_MSG_NONE 0
+#define REMOXLY_SHARD_MSG_RECEIVE 1                                   /* a connection of another shard sent a task for an application of this shard */
+#define REMOXLY_SHARD_MSG_CLOSED 2                                    /* a connection of another shard that sent us tasks was closed */
+#define REMOXLY_SHARD_MSG_SEND 3                                      /* the home shard of an application wants to send a task to one of our connections */
+
+namespace rx {
+
+// -----------------------------------------------------------
+
+struct ShardMessage {
+  ShardMessage();
+  ~ShardMessage();                                                    /* deletes the task when it wasn't taken */
+
+  ShardMessage* volatile next;
+  int type;                                                           /* REMOXLY_SHARD_MSG_* */
+  int from_shard;                                                     /* the shard that pushed the message */
+  unsigned int connection_id;                                         /* the id of the connection on the shard that owns the socket */
+  ConnectionTask* task;                                               /* RECEIVE: task_name, task_id and the received data in the payload. SEND: the task that we write to the connection */
+};
+
+// -----------------------------------------------------------
+
+class ShardQueue {
+
+ public:
+  ShardQueue();
+  ~ShardQueue();                                                      /* deletes the messages that weren't popped */
+  void push(ShardMessage* msg);                                       /* thread safe; the queue owns the message until it's popped */
+  ShardMessage* pop();                                                /* only call this from the thread that owns the queue; returns NULL when empty */
+
+ private:
+  ShardQueue(const ShardQueue& other);
+  ShardQueue& operator=(const ShardQueue& other);
+
+ public:
+  ShardMessage stub;                                                  /* always in the list so push() never has to handle an empty queue */
+  ShardMessage* volatile head;                                        /* the last pushed message; exchanged by the producers */
+  ShardMessage* tail;                                                 /* the next message to pop; only used by the consumer */
+};
+
+// -----------------------------------------------------------
+
+inline ShardMessage::ShardMessage()
+  :next(NULL)
+  ,type(REMOXLY_SHARD_MSG_NONE)
+  ,from_shard(-1)
+  ,connection_id(0)
+  ,task(NULL)
+{
+}
+
+inline ShardMessage::~ShardMessage() {
+
+  if(task) {
+    delete task;
+    task = NULL;
+  }
+}
+
+// -----------------------------------------------------------
+
+inline ShardQueue::ShardQueue()
+  :head(&stub)
+  ,tail(&stub)
+{
+}
+
+inline ShardQueue::~ShardQueue() {
+
+  ShardMessage* msg = NULL;
+
+  while((msg = pop())) {
+    delete msg;
+  }
+}
+
+inline void ShardQueue::push(ShardMessage* msg) {
+
+  gui_atomic_store_ptr(&msg->next, (ShardMessage*)NULL);
+
+  ShardMessage* prev = gui_atomic_exchange_ptr(&head, msg);
+
+  /* between the exchange and this store the consumer can't see `msg` yet */
+  gui_atomic_store_ptr(&prev->next, msg);
+}
+
+inline ShardMessage* ShardQueue::pop() {
+
+  ShardMessage* t = tail;
+  ShardMessage* next = gui_atomic_load_ptr(&t->next);
+
+  if(t == &stub) {
+
+    if(NULL == next) {
+      return NULL;
+    }
+
+    tail = next;
+    t = next;
+    next = gui_atomic_load_ptr(&next->next);
+  }
+
+  if(next) {
+    tail = next;
+    return t;
+  }
+
+  /* a producer exchanged the head but didn't link its message yet; it wakes us up when it's done */
+  if(t != gui_atomic_load_ptr(&head)) {
+    return NULL;
+  }
+
+  /* `t` is the last message; put the stub behind it so we can take it */
+  push(&stub);
+
+  next = gui_atomic_load_ptr(&t->next);
+
+  if(next) {
+    tail = next;
+    return t;
+  }
+
+  return NULL;
+}
+
+} // namespace rx
+
+#endif
@@ -0,0 +1,75 @@
+/*
+
+  ShardedServer
+  -------------
+
+  Runs one Server per processor, each on its own thread, so a relay
+  with many clients isn't limited by a single core. Every shard has
+  its own libwebsockets context and listens on `port + shard index`.
+  A client can connect to any of the ports; the shards hand the tasks
+  to the home shard of the application (appID modulo the number of
+  shards) and back, see Server. Clients that connect to the port of
+  getShardPort(appID) skip that hop; a Client that connects to another
+  port is redirected to it after it asked for the gui model, so all
+  ports must be reachable for the clients.
+
+  ShardedServer server(2255);
+  server.start();
+  ...
+  server.stop();
+
+ */
+#ifndef REMOXLY_GUI_REMOTE_SHARDED_SERVER_H
+#define REMOXLY_GUI_REMOTE_SHARDED_SERVER_H
+
+#include <vector>
+#include <gui/Thread.h>
+#include <gui/remote/Server.h>
+
+#if defined(REMOXLY_SERVER_USE_EPOLL)
+#  define REMOXLY_SHARD_TIMEOUT REMOXLY_SERVER_DEFAULT_TIMEOUT              /* the shards are woken up by messages */
+#else
+#  define REMOXLY_SHARD_TIMEOUT 5                                           /* without epoll a message waits until libwebsockets returns */
+#endif
+
+namespace rx {
+
+class ShardedServer;
+
+// -----------------------------------------------------------
+
+struct ShardWorker {
+  ShardedServer* owner;
+  int index;
+};
+
+// -----------------------------------------------------------
+
+class ShardedServer {
+
+ public:
+  ShardedServer(int port, int numShards = -1, bool ssl = false);           /* -1 creates one shard per processor */
+  ~ShardedServer();
+  bool start();                                                             /* creates and starts the shards and their threads */
+  void stop();                                                              /* stops the threads and destroys the shards */
+  int getNumShards();
+  int getShardPort(int appID);                                              /* the port of the home shard of the application */
+  void setMaxValueRate(int perSecond);                                      /* see Server::setMaxValueRate(); call this before start() */
+
+ private:
+  static void threadMain(void* user);
+
+ public:
+  int port;
+  int num_shards;
+  bool use_ssl;
+  int max_value_rate;
+  volatile int must_stop;
+  std::vector<Server*> shards;
+  std::vector<Thread*> threads;
+  std::vector<ShardWorker> workers;
+};
+
+} // namespace rx
+
+#endif
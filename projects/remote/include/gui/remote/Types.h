@@ -8,6 +8,7 @@
 #define REMOTE_TASK_CLOSE         5    /* libwebsocket is using a "interesting" way to close a socket. the protocol handler needs to return -1 to close a socket. what we do: we add a new task, trigger a write request and if the task is REMOTE_TASK_CLOSE we let the callback return -1 which closes the socket */
 #define REMOTE_TASK_GET_VALUES    6    /* Get the current values */
 #define REMOTE_TASK_SET_VALUES    7    /* Clients should accept the values and update the gui */
+#define REMOTE_TASK_REDIRECT      8    /* The server asks the client to reconnect to another port, e.g. the shard that keeps the application (see ShardedServer). The value holds the port: {"p":2256}. Clients that don't know this task ignore it and keep working through the port they're connected to */
 
 #define REMOTE_STATE_NONE           0x0000 
 #define REMOTE_STATE_CONNECTING     0x0001
@@ -18,6 +18,8 @@ extern "C" {
 
 namespace rx { 
 
+class Payload;
+
 std::string remoxly_websocket_reason_to_string(enum libwebsocket_callback_reasons reason);
 
 int remoxly_websocket_write(struct libwebsocket* ws, 
@@ -38,9 +40,12 @@ uint64_t remoxly_hrtime();
 // Used by Server and Client, it describe a task they need to process
 struct ConnectionTask {
   ConnectionTask();
+  ~ConnectionTask();                                                        /* releases the payload */
   int task_name;
   int task_id;
   std::string task_data;
+  Payload* payload;                                                         /* when set, we send this (shared) payload instead of task_data; the task owns one reference */
+  int widget_id;                                                            /* the widget of a (proxied) REMOTE_TASK_VALUE_CHANGED task or -1; the queues only keep the newest value per widget */
 };
 
 // -----------------------------------------------------------
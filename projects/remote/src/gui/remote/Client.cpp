@@ -66,6 +66,7 @@ int remoxly_client_websocket(struct libwebsocket_context* ctx,
 Client::Client(std::string host, int port, bool ssl, ClientListener* listener) 
   :host(host)
   ,port(port)
+  ,redirect_port(0)
   ,use_ssl(ssl)
   ,context(NULL)
   ,ws(NULL)
@@ -75,6 +76,9 @@ Client::Client(std::string host, int port, bool ssl, ClientListener* listener)
   ,reconnect_delay(30ULL * 1000ULL * 1000000ULL)   /* reconnect every 30 seconds */
   ,is_application(false)
   ,auto_reconnect(true)
+  ,is_redirecting(false)
+  ,value_interval(0)
+  ,value_timeout(0)
 {
 
   // setup the creation info.
@@ -122,6 +126,7 @@ void Client::removeTasks() {
     delete *it;
   }
   tasks.clear();
+  value_tasks.clear();
 }
 
 bool Client::connect() {
@@ -159,9 +164,18 @@ void Client::update() {
     }
   }
 
+  // the values we held back because of the max value rate
+  if(value_interval && value_tasks.size() && isConnected() && remoxly_hrtime() >= value_timeout) {
+    libwebsocket_callback_on_writable(context, ws);
+  }
+
   int n = libwebsocket_service(context, 0);
 }
 
+void Client::setMaxValueRate(int perSecond) {
+  value_interval = (perSecond > 0) ? (1000000000ULL / perSecond) : 0;
+}
+
 void Client::addPanel(Panel* panel) {
   serializer.addPanel(panel);
   setWidgets(panel);
@@ -221,7 +235,7 @@ bool Client::createConnection() {
   // @todo -> not sure about the host/origin parameters!
   ws = libwebsocket_client_connect(context,
                                    host.c_str(),
-                                   port, 
+                                   (redirect_port > 0) ? redirect_port : port, 
                                    use_ssl,
                                    "/",
                                    host.c_str(),
@@ -231,6 +245,9 @@ bool Client::createConnection() {
 
   if(!ws) {
     printf("Error: cannot create client connection.\n");
+    state = REMOTE_STATE_DISCONNECTED;
+    reconnect_timeout = remoxly_hrtime() + reconnect_delay;
+    redirect_port = 0;
     return false;
   }
 
@@ -304,11 +321,21 @@ bool Client::createSetValuesTask() {
 int Client::onCallbackClientWritable() {
 
   int result = 0;
+  uint64_t now = (value_interval) ? remoxly_hrtime() : 0;
+  bool send_values = (0 == value_interval || now >= value_timeout);
+  size_t num_kept = 0;
+  size_t num_values = 0;
 
   for(size_t i = 0; i < tasks.size(); ++i) {
           
     ConnectionTask* task = tasks[i];
 
+    // keep the values until the max value rate allows us to send them
+    if(task->task_name == REMOTE_TASK_VALUE_CHANGED && !send_values) {
+      tasks[num_kept++] = task;
+      continue;
+    }
+
     switch(task->task_name) {
 
       case REMOTE_TASK_SET_VALUES:
@@ -321,6 +348,7 @@ int Client::onCallbackClientWritable() {
 
       case REMOTE_TASK_VALUE_CHANGED: {
         sendTask(task);
+        num_values++;
         break;
       }
 
@@ -334,7 +362,14 @@ int Client::onCallbackClientWritable() {
     task = NULL;
   }
 
-  tasks.clear();
+  tasks.resize(num_kept);
+
+  if(send_values) {
+    value_tasks.clear();
+    if(num_values && value_interval) {
+      value_timeout = now + value_interval;
+    }
+  }
 
   return 0;
 }
@@ -350,9 +385,33 @@ void Client::onDisconnected() {
     serializer.clear();
   }
 
+  // the values we held back are stale when we reconnect
+  if(value_tasks.size()) {
+    size_t num_kept = 0;
+    for(size_t i = 0; i < tasks.size(); ++i) {
+      if(tasks[i]->task_name == REMOTE_TASK_VALUE_CHANGED) {
+        delete tasks[i];
+        continue;
+      }
+      tasks[num_kept++] = tasks[i];
+    }
+    tasks.resize(num_kept);
+    value_tasks.clear();
+  }
+
   if(tasks.size()) {
     printf("Error: we should not have any tasks when we are disconnected. @todo Client::onDisconnect() - this situation shouldn't happen. \n");
   }
+
+  // we closed the connection to follow a redirect; connect to the new port right away.
+  // any other disconnect or failed connect (e.g. the server restarted with fewer shards) makes us go back to `port`
+  if(is_redirecting) {
+    is_redirecting = false;
+    reconnect_timeout = 0;
+  }
+  else {
+    redirect_port = 0;
+  }
 }
 
 // an "application" calls addGroup/addPanel (which are internally added to the serializer). 
@@ -446,6 +505,41 @@ bool Client::onTaskSetValues(char* data, size_t len, std::string value) {
   return true;
 }
 
+bool Client::onTaskRedirect(char* data, size_t len, std::string value) {
+
+  if(!auto_reconnect) {
+    // we wouldn't reconnect, so we keep using this connection
+    return false;
+  }
+
+  json_error_t err;
+  json_t* js_redirect = json_loads(value.c_str(), 0, &err);
+
+  if(!js_redirect) {
+    printf("Error: cannot decode the redirect json: %s\n", err.text);
+    return false;
+  }
+
+  int new_port = 0;
+
+  if(!remoxly_json_get_int(js_redirect, "p", new_port) || new_port <= 0) {
+    printf("Error: the server asked us to connect to an invalid port.\n");
+    REMOXLY_FREE_JSON(js_redirect);
+    return false;
+  }
+
+  REMOXLY_FREE_JSON(js_redirect);
+
+  if(new_port == ((redirect_port > 0) ? redirect_port : port)) {
+    return false;
+  }
+
+  redirect_port = new_port;
+  is_redirecting = true;
+
+  return true;
+}
+
 bool Client::onTaskGetValues(char* data, size_t len, std::string value) {
 
   if(!isApplication()) {
@@ -513,6 +607,14 @@ int Client::onCallbackReceive(char* data, size_t len) {
       break;
     }
 
+    // closing the connection makes us reconnect to the new port, see onDisconnected()
+    case REMOTE_TASK_REDIRECT: {
+      if(onTaskRedirect(data, len, value)) {
+        return -1;
+      }
+      break;
+    }
+
     default: {
 #if !defined(NDEBUG)
       printf("Warning: unhandled server task: %d\n", task_id);
@@ -568,11 +670,20 @@ void Client::onEvent(int event, Widget* w) {
     return;
   }
 
+  // latest value wins; the queued task keeps its place and sends the new value
+  std::map<int, ConnectionTask*>::iterator it = value_tasks.find(w->id);
+  if(it != value_tasks.end()) {
+    it->second->task_data.swap(widget_json);
+    return;
+  }
+
   ConnectionTask* task = new ConnectionTask();
   task->task_name = REMOTE_TASK_VALUE_CHANGED;
   task->task_id = 0; // connection/gui, @todo fix
   task->task_data = widget_json;
+  task->widget_id = w->id;
   tasks.push_back(task);
+  value_tasks[w->id] = task;
 
   // trigger a write
   libwebsocket_callback_on_writable(context, ws);
@@ -322,7 +322,7 @@ Text* Deserializer::deserializeText(json_t* el, std::string label, int id) {
   return gen->createText(label, id, text_w);
 }
 
-bool Deserializer::deserializeTask(char* data, int& appID, int& taskID, std::string& value) {
+bool Deserializer::deserializeTask(char* data, int& appID, int& taskID, std::string& value, int* widgetID) {
 
   json_error_t err;
   json_t* root = json_loads((const char*)data, 0, &err);
@@ -354,6 +354,14 @@ bool Deserializer::deserializeTask(char* data, int& appID, int& taskID, std::str
     value = json_dumps(js_value, 0);
   }
 
+  if(widgetID) {
+    *widgetID = -1;
+    json_t* js_id = (js_value && json_is_object(js_value)) ? json_object_get(js_value, "i") : NULL;
+    if(js_id && json_is_number(js_id)) {
+      *widgetID = json_integer_value(js_id);
+    }
+  }
+
   REMOXLY_FREE_JSON(root);
 
   return true;
@@ -451,7 +459,7 @@ bool Deserializer::deserializeValueSliderInt(Slider<int>* slider, json_t* js) {
   slider->disableNotifications();
   slider->setAbsoluteValue(v);
   slider->enableNotifications();
-  slider->needs_redraw = true;
+  slider->setNeedsRedraw();
 
   return true;
 }
@@ -469,7 +477,7 @@ bool Deserializer::deserializeValueSliderFloat(Slider<float>* slider, json_t* js
   slider->disableNotifications();
   slider->setAbsoluteValue(v);
   slider->enableNotifications();
-  slider->needs_redraw = true;
+  slider->setNeedsRedraw();
 
   return true;
 }
@@ -486,7 +494,7 @@ bool Deserializer::deserializeValueToggle(Toggle* toggle, json_t* js) {
   toggle->disableNotifications();
   toggle->setValue(v == 1); 
   toggle->enableNotifications();
-  toggle->needs_redraw = true;
+  toggle->setNeedsRedraw();
 
   return true;
 }
@@ -503,7 +511,7 @@ bool Deserializer::deserializeValueColorRGB(ColorRGB* col, json_t* js) {
   col->disableNotifications();
   col->setPercentageValue(v);
   col->enableNotifications();
-  col->needs_redraw = true;
+  col->setNeedsRedraw();
   
   return true;
 }
@@ -523,7 +531,7 @@ bool Deserializer::deserializeValueText(Text* text, json_t* js) {
   }
 
   text->value = v;
-  text->needs_redraw = true;
+  text->setNeedsRedraw();
   return true;
 }
 
@@ -1,11 +1,24 @@
 #include <stdio.h>
 #include <sstream>
+#include <poll.h>
 #include <gui/remote/Serializer.h>
 #include <gui/remote/Types.h>
 #include <gui/remote/Server.h>
 
+#if defined(REMOXLY_SERVER_USE_EPOLL)
+#  include <errno.h>
+#  include <unistd.h>
+#  include <sys/epoll.h>
+#  include <sys/eventfd.h>
+#endif
+
 namespace rx { 
 
+#if defined(REMOXLY_SERVER_USE_EPOLL)
+static uint32_t remoxly_poll_to_epoll(int events);
+static short remoxly_epoll_to_poll(uint32_t events);
+#endif
+
 // -----------------------------------------------------------
 
 int remoxly_server_websocket(struct libwebsocket_context* ctx,
@@ -37,9 +50,21 @@ int remoxly_server_websocket(struct libwebsocket_context* ctx,
       return server->onCallbackClosed(ws);
     }
 
+    /* libwebsockets 1.2 passes the socket in `user` and the events in `len` */
+    case LWS_CALLBACK_ADD_POLL_FD: {
+      return server->onCallbackAddPollFD((int)(long)user, (int)len);
+    }
+
     case LWS_CALLBACK_DEL_POLL_FD: {
-      return server->onCallbackDelPollFD(ws);
-      break;
+      return server->onCallbackDelPollFD(ws, (int)(long)user);
+    }
+
+    case LWS_CALLBACK_SET_MODE_POLL_FD: {
+      return server->onCallbackSetModePollFD((int)(long)user, (int)len);
+    }
+
+    case LWS_CALLBACK_CLEAR_MODE_POLL_FD: {
+      return server->onCallbackClearModePollFD((int)(long)user, (int)len);
     }
 
     default: {
@@ -67,6 +92,10 @@ Connection::Connection(struct libwebsocket* ws)
   :ws(ws)
   ,app_id(-1)
   ,is_app(false)
+  ,id(0)
+  ,shard(0)
+  ,forward_shard(-1)
+  ,value_timeout(0)
 {
 }
 
@@ -85,6 +114,12 @@ Server::Server(int port, bool ssl)
   :port(port)
   ,use_ssl(ssl)
   ,context(NULL)
+  ,next_connection_id(0)
+  ,shards(NULL)
+  ,shard_index(0)
+  ,value_interval(0)
+  ,epoll_fd(-1)
+  ,wakeup_fd(-1)
 {
 }
 
@@ -94,6 +129,25 @@ Server::~Server() {
     libwebsocket_context_destroy(context);
     context = NULL;
   }
+
+  std::map<std::pair<int, unsigned int>, Connection*>::iterator it = remote_connections.begin();
+  while(it != remote_connections.end()) {
+    delete it->second;
+    ++it;
+  }
+  remote_connections.clear();
+
+#if defined(REMOXLY_SERVER_USE_EPOLL)
+  if(wakeup_fd >= 0) {
+    close(wakeup_fd);
+    wakeup_fd = -1;
+  }
+
+  if(epoll_fd >= 0) {
+    close(epoll_fd);
+    epoll_fd = -1;
+  }
+#endif
 }
 
 bool Server::start() {
@@ -113,6 +167,31 @@ bool Server::start() {
   info.uid = -1;
   info.user = (void*) this;
 
+#if defined(REMOXLY_SERVER_USE_EPOLL)
+  /* libwebsockets adds the listening socket while creating the context, so the epoll set must exist. */
+  epoll_fd = epoll_create(REMOXLY_SERVER_MAX_EVENTS);
+  if(epoll_fd < 0) {
+    printf("Error: cannot create the epoll set for the server.\n");
+    return false;
+  }
+
+  wakeup_fd = eventfd(0, EFD_NONBLOCK);
+  if(wakeup_fd < 0) {
+    printf("Error: cannot create the wakeup fd for the server.\n");
+    return false;
+  }
+
+  struct epoll_event ev;
+  memset(&ev, 0, sizeof(ev));
+  ev.events = EPOLLIN;
+  ev.data.fd = wakeup_fd;
+
+  if(epoll_ctl(epoll_fd, EPOLL_CTL_ADD, wakeup_fd, &ev) < 0) {
+    printf("Error: cannot add the wakeup fd to the epoll set.\n");
+    return false;
+  }
+#endif
+
 #ifndef LWS_NO_EXTENSIONS
   info.extensions = libwebsocket_get_internal_extensions();
 #endif
@@ -128,7 +207,7 @@ bool Server::start() {
   return true;
 }
 
-void Server::update() {
+void Server::update(int timeoutMillis) {
 
 #if !defined(NDEBUG)
   if(!context) {
@@ -137,26 +216,361 @@ void Server::update() {
   }
 #endif
 
-  int n = libwebsocket_service(context, 0);
+  timeoutMillis = getDeferredTimeout(timeoutMillis);
+
+#if defined(REMOXLY_SERVER_USE_EPOLL)
+
+  struct epoll_event events[REMOXLY_SERVER_MAX_EVENTS];
+  int n = epoll_wait(epoll_fd, events, REMOXLY_SERVER_MAX_EVENTS, timeoutMillis);
+
+  if(n < 0 && errno != EINTR) {
+    printf("Error: epoll_wait() failed: %d\n", errno);
+  }
+
+  for(int i = 0; i < n; ++i) {
+
+    if(events[i].data.fd == wakeup_fd) {
+      uint64_t count = 0;
+      ssize_t r = read(wakeup_fd, &count, sizeof(count));
+      (void)r;
+      continue;
+    }
+
+    std::map<int, int>::iterator it = poll_fds.find(events[i].data.fd);
+    if(it == poll_fds.end()) {
+      continue;
+    }
+
+    struct pollfd pfd;
+    pfd.fd = it->first;
+    pfd.events = it->second;
+    pfd.revents = remoxly_epoll_to_poll(events[i].events);
+
+    if(libwebsocket_service_fd(context, &pfd) < 0) {
+      printf("Error: libwebsocket_service_fd() failed.\n");
+    }
+  }
+
+  /* without a socket, libwebsockets only checks the timeouts of the connections */
+  libwebsocket_service_fd(context, NULL);
+
+#else
+  libwebsocket_service(context, timeoutMillis);
+#endif
+
+  runJobs();
+  processMessages();
+  requestDeferredWrites();
+}
+
+void Server::setMaxValueRate(int perSecond) {
+  value_interval = (perSecond > 0) ? (1000000000ULL / perSecond) : 0;
+}
+
+int Server::getDeferredTimeout(int timeoutMillis) {
+
+  if(deferred_values.empty()) {
+    return timeoutMillis;
+  }
+
+  int wait = (int)(value_interval / 1000000ULL) + 1;
+
+  if(timeoutMillis < 0 || timeoutMillis > wait) {
+    return wait;
+  }
+
+  return timeoutMillis;
+}
+
+void Server::requestDeferredWrites() {
+
+  if(deferred_values.empty()) {
+    return;
+  }
+
+  uint64_t now = remoxly_hrtime();
+  std::set<unsigned int>::iterator it = deferred_values.begin();
+
+  while(it != deferred_values.end()) {
+
+    std::map<unsigned int, Connection*>::iterator con_it = connection_ids.find(*it);
+
+    if(con_it == connection_ids.end()) {
+      deferred_values.erase(it++);
+      continue;
+    }
+
+    Connection* c = con_it->second;
+
+    if(now < c->value_timeout) {
+      ++it;
+      continue;
+    }
+
+    libwebsocket_callback_on_writable(context, c->ws);
+    deferred_values.erase(it++);
+  }
+}
+
+bool Server::post(remoxly_server_job func, void* user) {
+
+  if(!func) {
+    printf("Error: cannot post a job without a function.\n");
+    return false;
+  }
+
+  ServerJob job;
+  job.func = func;
+  job.user = user;
+
+  job_mutex.lock();
+    jobs.push_back(job);
+  job_mutex.unlock();
+
+  wakeup();
+
+  return true;
+}
+
+void Server::wakeup() {
+
+#if defined(REMOXLY_SERVER_USE_EPOLL)
+  if(wakeup_fd < 0) {
+    return;
+  }
+
+  uint64_t one = 1;
+  ssize_t r = write(wakeup_fd, &one, sizeof(one));
+  (void)r;
+#endif
+}
+
+void Server::setShards(std::vector<Server*>* group, int index) {
+  shards = group;
+  shard_index = index;
+}
+
+int Server::getHomeShard(int appID) {
+
+  if(!shards || shards->size() <= 1) {
+    return shard_index;
+  }
+
+  int n = (int)shards->size();
+  int home = appID % n;
+
+  if(home < 0) {
+    home += n;
+  }
+
+  return home;
+}
+
+void Server::postMessage(ShardMessage* msg) {
+  inbox.push(msg);
+  wakeup();
+}
+
+void Server::postToShard(int shard, ShardMessage* msg) {
+
+  if(!shards || shard < 0 || shard >= (int)shards->size()) {
+    delete msg;
+    return;
+  }
+
+  msg->from_shard = shard_index;
+  (*shards)[shard]->postMessage(msg);
+}
+
+void Server::processMessages() {
+
+  ShardMessage* msg = NULL;
+
+  while((msg = inbox.pop())) {
+
+    switch(msg->type) {
+
+      case REMOXLY_SHARD_MSG_RECEIVE: {
+        Connection* c = getRemoteConnection(msg->from_shard, msg->connection_id);
+        ConnectionTask* task = msg->task;
+        handleTask(c, task->task_name, task->task_id, task->widget_id, (char*)task->payload->ptr(), task->payload->size());
+        break;
+      }
+
+      case REMOXLY_SHARD_MSG_CLOSED: {
+        removeRemoteConnection(msg->from_shard, msg->connection_id);
+        break;
+      }
+
+      case REMOXLY_SHARD_MSG_SEND: {
+        std::map<unsigned int, Connection*>::iterator it = connection_ids.find(msg->connection_id);
+        if(it == connection_ids.end()) {
+          break; /* closed in the meantime; the message deletes the task */
+        }
+        queueTask(it->second, msg->task);
+        msg->task = NULL;
+        break;
+      }
+
+      default: {
+        printf("Error: unhandled shard message: %d\n", msg->type);
+        break;
+      }
+    }
+
+    delete msg;
+    msg = NULL;
+  }
+}
+
+void Server::forwardTask(Connection* c, int shard, int task, int appID, int widgetID, char* data, size_t len) {
+
+  /* the connection switched to an application of another shard; the previous shard can forget about it */
+  if(c->forward_shard >= 0 && c->forward_shard != shard) {
+    ShardMessage* closed = new ShardMessage();
+    closed->type = REMOXLY_SHARD_MSG_CLOSED;
+    closed->connection_id = c->id;
+    postToShard(c->forward_shard, closed);
+  }
+
+  c->forward_shard = shard;
+
+  ConnectionTask* con_task = new ConnectionTask();
+  con_task->task_name = task;
+  con_task->task_id = appID;
+  con_task->widget_id = widgetID;
+  con_task->payload = Payload::create(data, len);
+
+  ShardMessage* msg = new ShardMessage();
+  msg->type = REMOXLY_SHARD_MSG_RECEIVE;
+  msg->connection_id = c->id;
+  msg->task = con_task;
+
+  postToShard(shard, msg);
+}
+
+Connection* Server::getRemoteConnection(int shard, unsigned int id) {
+
+  std::pair<int, unsigned int> key(shard, id);
+  std::map<std::pair<int, unsigned int>, Connection*>::iterator it = remote_connections.find(key);
+
+  if(it != remote_connections.end()) {
+    return it->second;
+  }
+
+  Connection* c = new Connection(NULL);
+  c->id = id;
+  c->shard = shard;
+  remote_connections.insert(std::pair<std::pair<int, unsigned int>, Connection*>(key, c));
+
+  return c;
+}
+
+void Server::removeRemoteConnection(int shard, unsigned int id) {
+
+  std::map<std::pair<int, unsigned int>, Connection*>::iterator it = remote_connections.find(std::pair<int, unsigned int>(shard, id));
+
+  if(it == remote_connections.end()) {
+    return;
+  }
+
+  Connection* con = it->second;
+
+  if(con->is_app) {
+    closeApplicationConnections(con->app_id);
+    removeApplicationData(con->app_id);
+  }
+
+  removeSubscriber(con);
+
+  delete con;
+  con = NULL;
+
+  remote_connections.erase(it);
+}
+
+void Server::queueTask(Connection* c, ConnectionTask* task) {
+
+  if(c->shard != shard_index) {
+    ShardMessage* msg = new ShardMessage();
+    msg->type = REMOXLY_SHARD_MSG_SEND;
+    msg->connection_id = c->id;
+    msg->task = task;
+    postToShard(c->shard, msg);
+    return;
+  }
+
+  if(task->widget_id >= 0) {
+
+    // latest value wins; the queued task keeps its place and writes the new value
+    std::map<int, ConnectionTask*>::iterator it = c->value_tasks.find(task->widget_id);
+    if(it != c->value_tasks.end()) {
+      std::swap(it->second->payload, task->payload);
+      it->second->task_data.swap(task->task_data);
+      delete task;
+      return;
+    }
+
+    c->value_tasks[task->widget_id] = task;
+  }
+
+  c->tasks.push_back(task);
+
+  // the writable callback for values is requested when the max value rate allows it; other tasks are written right away
+  if(task->widget_id >= 0 && deferred_values.count(c->id)) {
+    return;
+  }
+
+  libwebsocket_callback_on_writable(context, c->ws);
+}
+
+void Server::runJobs() {
+
+  job_mutex.lock();
+    work.swap(jobs);
+  job_mutex.unlock();
+
+  for(size_t i = 0; i < work.size(); ++i) {
+    work[i].func(this, work[i].user);
+  }
+
+  work.clear();
 }
 
 bool Server::getApplicationData(int appID, ApplicationData& result) {
 
-  std::map<int, ApplicationData>::iterator it = applications.find(appID);
+  ApplicationData* app = getApplication(appID);
 
-  if(it == applications.end()) {
+  if(!app) {
     return false;
   }
 
-  result = it->second;
+  result = *app;
 
   return true;
 }
 
-void Server::addConnection(struct libwebsocket* ws) {
+ApplicationData* Server::getApplication(int appID) {
+
+  std::map<int, ApplicationData>::iterator it = applications.find(appID);
+
+  if(it == applications.end()) {
+    return NULL;
+  }
+
+  return &it->second;
+}
+
+Connection* Server::addConnection(struct libwebsocket* ws) {
 
   Connection* c = new Connection(ws);
+  c->id = ++next_connection_id;
+  c->shard = shard_index;
+
   connections.insert(std::pair<struct libwebsocket*, Connection*>(ws, c));
+  connection_ids[c->id] = c;
+
+  return c;
 }
 
 void Server::closeConnection(struct libwebsocket* ws) {
@@ -202,6 +616,18 @@ void Server::removeConnection(struct libwebsocket* ws) {
     removeApplicationData(con->app_id);
   }
 
+  removeSubscriber(con);
+
+  if(con->forward_shard >= 0) {
+    ShardMessage* msg = new ShardMessage();
+    msg->type = REMOXLY_SHARD_MSG_CLOSED;
+    msg->connection_id = con->id;
+    postToShard(con->forward_shard, msg);
+  }
+
+  connection_ids.erase(con->id);
+  deferred_values.erase(con->id);
+
   delete con;
   con = NULL;
 
@@ -211,21 +637,24 @@ void Server::removeConnection(struct libwebsocket* ws) {
 // makes sure that all connections that rely on the given application data are closed and cleaned up.
 void Server::closeApplicationConnections(int appID) {
 
-  std::map<struct libwebsocket*, Connection*>::iterator it = connections.begin();
+  std::map<int, std::vector<Connection*> >::iterator it = subscribers.find(appID);
 
-  while(it != connections.end()) {
+  if(it == subscribers.end()) {
+    return;
+  }
+
+  std::vector<Connection*>& subs = it->second;
+
+  for(size_t i = 0; i < subs.size(); ++i) {
 
-    struct libwebsocket* ws = it->first;
-    Connection* con = it->second;
+    Connection* con = subs[i];
     
-    if(con->app_id == appID && !con->is_app) {
+    if(!con->is_app) {
       ConnectionTask* task = new ConnectionTask();
       task->task_name = REMOTE_TASK_CLOSE;
       task->task_id = appID;
-      con->tasks.push_back(task);
-      libwebsocket_callback_on_writable(context, ws);
+      queueTask(con, task);
     }
-    ++it;
   }
 }
 
@@ -242,13 +671,48 @@ Connection* Server::getConnection(struct libwebsocket* ws) {
 
 Connection* Server::getApplicationConnection(int appID) {
   
-  ApplicationData app_data;
+  ApplicationData* app = getApplication(appID);
 
-  if(!getApplicationData(appID, app_data)) {
+  if(!app) {
     return NULL;
   }
 
-  return app_data.connection;
+  return app->connection;
+}
+
+void Server::setConnectionApplication(Connection* con, int appID) {
+
+  if(con->app_id == appID) {
+    return;
+  }
+
+  removeSubscriber(con);
+
+  con->app_id = appID;
+  subscribers[appID].push_back(con);
+}
+
+void Server::removeSubscriber(Connection* con) {
+
+  std::map<int, std::vector<Connection*> >::iterator it = subscribers.find(con->app_id);
+
+  if(it == subscribers.end()) {
+    return;
+  }
+
+  std::vector<Connection*>& subs = it->second;
+
+  for(size_t i = 0; i < subs.size(); ++i) {
+    if(subs[i] == con) {
+      subs[i] = subs.back();
+      subs.pop_back();
+      break;
+    }
+  }
+
+  if(subs.empty()) {
+    subscribers.erase(it);
+  }
 }
 
 int Server::onCallbackEstablished(struct libwebsocket* ws) {
@@ -256,31 +720,22 @@ int Server::onCallbackEstablished(struct libwebsocket* ws) {
   return 0;
 }
 
-// gets called when we receive a gui model from the given websocket.
-int Server::onReceiveSetGuiModel(struct libwebsocket* ws, int appID, char* data, size_t len) {
-  
-  Connection* c = getConnection(ws);
-
-  if(!c) {
-    printf("Cannot find the connection for the socket that gave us the gui model.\n");
-    return -1;
-  }
+// gets called when we receive a gui model from the given connection.
+int Server::onReceiveSetGuiModel(Connection* c, int appID, char* data, size_t len) {
 
   c->is_app = true;
-  c->app_id = appID;
+  setConnectionApplication(c, appID);
 
-  ApplicationData ad;
+  ApplicationData& ad = applications[appID];
   ad.app_id = appID;
-  ad.ws = ws;
+  ad.ws = c->ws;
   ad.json_model.assign(data, len);
   ad.connection = c;
-
-  applications[appID] = ad;
  
   return 0;
 }
 
-int Server::onReceiveGetValues(struct libwebsocket* ws, int appID, char* data, size_t len) {
+int Server::onReceiveGetValues(Connection* from, int appID, char* data, size_t len) {
 
   Connection* c = getApplicationConnection(appID);
 
@@ -293,84 +748,103 @@ int Server::onReceiveGetValues(struct libwebsocket* ws, int appID, char* data, s
   task->task_name = REMOTE_TASK_GET_VALUES;
   task->task_id = appID;
   task->task_data.assign(data, len);
-  c->tasks.push_back(task);
+  queueTask(c, task);
 
-  libwebsocket_callback_on_writable(context, c->ws);
   return 0;
 }
 
 // @todo - Server::onReceiveSetValues(), we proxy the values to all clients now. an optimization would be to only send it to the client which asked for the values.
-int Server::onReceiveSetValues(struct libwebsocket* ws, int appID, char* data, size_t len) {
+int Server::onReceiveSetValues(Connection* c, int appID, char* data, size_t len) {
   proxyData(appID, data, len);
   return 0;
 }
 
-void Server::proxyData(int appID, char* data, size_t len) {
+void Server::proxyData(int appID, char* data, size_t len, int widgetID) {
 
   if(!len || !data) {
     printf("Warning: trying to proxy data, but data/len is invalid: %p/%ld\n", data, len);
     return;
   }
 
-  // find all connections for the given appID
- std::map<struct libwebsocket*, Connection*>::iterator it = connections.begin();
+  std::map<int, std::vector<Connection*> >::iterator it = subscribers.find(appID);
 
- while(it != connections.end()) {
+  if(it == subscribers.end()) {
+    return;
+  }
+
+  // one copy of the data per shard, shared by the tasks of all its connections for the given appID
+  std::vector<Connection*>& subs = it->second;
+  shard_payloads.assign((shards) ? shards->size() : 1, (Payload*)NULL);
+
+  for(size_t i = 0; i < subs.size(); ++i) {
    
-   struct libwebsocket* ws = it->first;
-   Connection* c = it->second;
+    Connection* c = subs[i];
 
-   if(c->app_id != appID) {
-     ++it;
-     continue;
-   }
+    if(c->shard < 0 || c->shard >= (int)shard_payloads.size()) {
+      continue;
+    }
 
-   ConnectionTask* task = new ConnectionTask();
-   task->task_name = REMOTE_TASK_PROXY;
-   task->task_id = appID;
-   task->task_data.assign(data, len);
+    Payload*& payload = shard_payloads[c->shard];
+    if(!payload) {
+      payload = Payload::create(data, len);
+    }
 
-   c->tasks.push_back(task);
+    ConnectionTask* task = new ConnectionTask();
+    task->task_name = REMOTE_TASK_PROXY;
+    task->task_id = appID;
+    task->widget_id = widgetID;
+    task->payload = payload;
+    payload->retain();
 
-   libwebsocket_callback_on_writable(context, ws);
+    queueTask(c, task);
+  }
 
-   ++it;
- }
+  for(size_t i = 0; i < shard_payloads.size(); ++i) {
+    if(shard_payloads[i]) {
+      shard_payloads[i]->release();
+      shard_payloads[i] = NULL;
+    }
+  }
 }
 
 // proxies the given data to all clients that listen for the given app id
-int Server::onReceiveValueChanged(struct libwebsocket* ws, int appID, char* data, size_t len) {
-  proxyData(appID, data, len);
+int Server::onReceiveValueChanged(Connection* c, int appID, int widgetID, char* data, size_t len) {
+  proxyData(appID, data, len, widgetID);
   return 0;
 }
 
 // this will add a task that sends the gui model to the client.
-int Server::onReceiveGetGuiModel(struct libwebsocket* ws, int appID, char* data, size_t len) {
+int Server::onReceiveGetGuiModel(Connection* c, int appID, char* data, size_t len) {
 
-  Connection* c = getConnection(ws);
+  ApplicationData* app = getApplication(appID);
 
-  if(!c) {
-    printf("Error: connection not found; but wants to retrieve a gui model.\n");
-    return -1;
-  }
-      
-  ApplicationData gd;
-
-  if(!getApplicationData(appID, gd)) {
+  if(!app) {
     printf("Error: cannot find any gui data for the given id: %d\n", appID);
     return -1;
   }
 
-  c->app_id = appID;
+  setConnectionApplication(c, appID);
+
+  // the socket is owned by another shard which writes everything we send to it; ask the client to connect to our port instead.
+  if(c->shard != shard_index) {
+    std::stringstream ss;
+    ss << "{\"t\":" << REMOTE_TASK_REDIRECT << ",\"v\":{\"p\":" << port << "},\"i\":" << appID << "}";
+
+    ConnectionTask* redirect = new ConnectionTask();
+    redirect->task_name = REMOTE_TASK_REDIRECT;
+    redirect->task_data = ss.str();
+    redirect->task_id = appID;
+
+    queueTask(c, redirect);
+  }
 
   ConnectionTask* con_task = new ConnectionTask();
   con_task->task_name = REMOTE_TASK_SET_GUI_MODEL; 
-  con_task->task_data = gd.json_model;
+  con_task->task_data = app->json_model;
   con_task->task_id = appID; 
 
-  c->tasks.push_back(con_task);
+  queueTask(c, con_task);
 
-  libwebsocket_callback_on_writable(context, ws);
   return 0;
 }
 
@@ -379,32 +853,53 @@ int Server::onCallbackReceive(struct libwebsocket* ws, char* data, size_t len) {
 
   int task = 0;
   int id = 0;
+  int widget_id = -1;
   std::string value;
 
-  if(!deserializer.deserializeTask(data, id, task, value)) {
+  if(!deserializer.deserializeTask(data, id, task, value, &widget_id)) {
     return -1;
   }
 
+  Connection* c = getConnection(ws);
+
+  if(!c) {
+    printf("Error: cannot find the connection that sent us a task.\n");
+    return -1;
+  }
+
+  // the data and subscribers of an application live on its home shard
+  int home = getHomeShard(id);
+
+  if(home != shard_index) {
+    forwardTask(c, home, task, id, widget_id, data, len);
+    return 0;
+  }
+
+  return handleTask(c, task, id, widget_id, data, len);
+}
+
+int Server::handleTask(Connection* c, int task, int id, int widgetID, char* data, size_t len) {
+
   switch(task) {
 
     case REMOTE_TASK_VALUE_CHANGED: {
-      return onReceiveValueChanged(ws, id, data, len);
+      return onReceiveValueChanged(c, id, widgetID, data, len);
     }
 
     case REMOTE_TASK_SET_GUI_MODEL: {
-      return onReceiveSetGuiModel(ws, id, data, len);
+      return onReceiveSetGuiModel(c, id, data, len);
     }
 
     case REMOTE_TASK_GET_GUI_MODEL: {
-      return onReceiveGetGuiModel(ws, id, data, len); 
+      return onReceiveGetGuiModel(c, id, data, len); 
     }      
 
     case REMOTE_TASK_GET_VALUES: {
-      return onReceiveGetValues(ws, id, data, len);
+      return onReceiveGetValues(c, id, data, len);
     }
 
     case REMOTE_TASK_SET_VALUES: {
-      return onReceiveSetValues(ws, id, data, len);
+      return onReceiveSetValues(c, id, data, len);
     }
 
     default: {
@@ -434,23 +929,49 @@ int Server::onCallbackServerWritable(struct libwebsocket* ws) {
   }
 
   int result = 0;
+  uint64_t now = (value_interval) ? remoxly_hrtime() : 0;
+  bool write_values = (0 == value_interval || now >= c->value_timeout);
+  size_t num_kept = 0;
+  size_t num_values = 0;
 
   for(size_t i = 0; i < c->tasks.size(); ++i) {
 
     ConnectionTask* task = c->tasks[i];
+
+    // keep the values until the max value rate allows us to write them
+    if(task->widget_id >= 0) {
+      if(!write_values) {
+        c->tasks[num_kept++] = task;
+        continue;
+      }
+      num_values++;
+    }
     
     switch(task->task_name) {
 
+      // written straight from the shared payload; it already has the padding
+      case REMOTE_TASK_PROXY: {
+        if(task->payload) {
+          result = remoxly_websocket_write(ws, task->payload->ptr(), task->payload->size());
+          break;
+        }
+        c->buffer.set(task->task_data);
+        result = remoxly_websocket_write(ws, c->buffer.ptr(), c->buffer.getDataNumBytes());
+        break;
+      }
+
       case REMOTE_TASK_GET_VALUES: 
-      case REMOTE_TASK_PROXY: 
-      case REMOTE_TASK_SET_GUI_MODEL: {
+      case REMOTE_TASK_SET_GUI_MODEL: 
+      case REMOTE_TASK_REDIRECT: {
         c->buffer.set(task->task_data); // task data contains a complete task json string
         result = remoxly_websocket_write(ws, c->buffer.ptr(), c->buffer.getDataNumBytes());
         break;
       }
 
-       // We were ask to close the given `ws` socket; returning -1 will do this.
+       // We were ask to close the given `ws` socket; returning -1 will do this. The connection deletes the tasks we didn't handle.
       case REMOTE_TASK_CLOSE: {
+        c->tasks.erase(c->tasks.begin() + num_kept, c->tasks.begin() + i);
+        c->value_tasks.clear();
         return -1;
       }
 
@@ -464,7 +985,17 @@ int Server::onCallbackServerWritable(struct libwebsocket* ws) {
     task = NULL;
   }
 
-  c->tasks.clear();
+  c->tasks.resize(num_kept);
+
+  if(!write_values) {
+    deferred_values.insert(c->id);
+  }
+  else {
+    c->value_tasks.clear();
+    if(num_values && value_interval) {
+      c->value_timeout = now + value_interval;
+    }
+  }
 
   return result;
 }
@@ -474,9 +1005,134 @@ int Server::onCallbackClosed(struct libwebsocket* ws) {
   return 0;
 }
 
-int Server::onCallbackDelPollFD(struct libwebsocket* ws) {
-  closeConnection(ws);
+int Server::onCallbackAddPollFD(int fd, int events) {
+
+  poll_fds[fd] = events;
+
+#if defined(REMOXLY_SERVER_USE_EPOLL)
+  struct epoll_event ev;
+  memset(&ev, 0, sizeof(ev));
+  ev.events = remoxly_poll_to_epoll(events);
+  ev.data.fd = fd;
+
+  if(epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, &ev) < 0) {
+    printf("Error: cannot add socket %d to the epoll set: %d\n", fd, errno);
+    return 1;
+  }
+#endif
+
+  return 0;
+}
+
+int Server::onCallbackDelPollFD(struct libwebsocket* ws, int fd) {
+
+  poll_fds.erase(fd);
+
+#if defined(REMOXLY_SERVER_USE_EPOLL)
+  /* the socket is closed right after this; closing removes it from the set too so we ignore errors */
+  struct epoll_event ev;
+  memset(&ev, 0, sizeof(ev));
+  epoll_ctl(epoll_fd, EPOLL_CTL_DEL, fd, &ev);
+#endif
+
+  if(ws) {
+    closeConnection(ws);
+  }
+
   return 0;
 }
 
+int Server::onCallbackSetModePollFD(int fd, int events) {
+
+  std::map<int, int>::iterator it = poll_fds.find(fd);
+  if(it == poll_fds.end()) {
+    return 0;
+  }
+
+  if((it->second & events) == events) {
+    return 0;
+  }
+
+  it->second |= events;
+
+  return modifyPollFD(fd, it->second) ? 0 : 1;
+}
+
+int Server::onCallbackClearModePollFD(int fd, int events) {
+
+  std::map<int, int>::iterator it = poll_fds.find(fd);
+  if(it == poll_fds.end()) {
+    return 0;
+  }
+
+  if(0 == (it->second & events)) {
+    return 0;
+  }
+
+  it->second &= ~events;
+
+  return modifyPollFD(fd, it->second) ? 0 : 1;
+}
+
+bool Server::modifyPollFD(int fd, int events) {
+
+#if defined(REMOXLY_SERVER_USE_EPOLL)
+  struct epoll_event ev;
+  memset(&ev, 0, sizeof(ev));
+  ev.events = remoxly_poll_to_epoll(events);
+  ev.data.fd = fd;
+
+  if(epoll_ctl(epoll_fd, EPOLL_CTL_MOD, fd, &ev) < 0) {
+    printf("Error: cannot change the events of socket %d: %d\n", fd, errno);
+    return false;
+  }
+#endif
+
+  return true;
+}
+
+// -----------------------------------------------------------
+
+#if defined(REMOXLY_SERVER_USE_EPOLL)
+
+static uint32_t remoxly_poll_to_epoll(int events) {
+
+  uint32_t result = 0;
+
+  if(events & POLLIN) {
+    result |= EPOLLIN;
+  }
+
+  if(events & POLLOUT) {
+    result |= EPOLLOUT;
+  }
+
+  return result;
+}
+
+static short remoxly_epoll_to_poll(uint32_t events) {
+
+  short result = 0;
+
+  if(events & EPOLLIN) {
+    result |= POLLIN;
+  }
+
+  if(events & EPOLLOUT) {
+    result |= POLLOUT;
+  }
+
+  if(events & EPOLLERR) {
+    result |= POLLERR;
+  }
+
+  if(events & EPOLLHUP) {
+    result |= POLLHUP;
+  }
+
+  return result;
+}
+
+#endif
+
 } // namespace rx 
@@ -0,0 +1,127 @@
+#include <stdio.h>
+#include <gui/remote/ShardedServer.h>
+
+namespace rx {
+
+// -----------------------------------------------------------
+
+ShardedServer::ShardedServer(int port, int numShards, bool ssl)
+  :port(port)
+  ,num_shards(numShards)
+  ,use_ssl(ssl)
+  ,max_value_rate(0)
+  ,must_stop(0)
+{
+  if(num_shards <= 0) {
+    num_shards = gui_get_num_cpus();
+  }
+}
+
+ShardedServer::~ShardedServer() {
+  stop();
+}
+
+bool ShardedServer::start() {
+
+  if(shards.size()) {
+    printf("Error: the sharded server is already started.\n");
+    return false;
+  }
+
+  gui_atomic_store(&must_stop, 0);
+
+  for(int i = 0; i < num_shards; ++i) {
+    Server* server = new Server(port + i, use_ssl);
+    shards.push_back(server);
+    server->setShards(&shards, i);
+    server->setMaxValueRate(max_value_rate);
+  }
+
+  /* all shards must exist before a thread can post to them */
+  for(int i = 0; i < num_shards; ++i) {
+    if(!shards[i]->start()) {
+      printf("Error: cannot start shard %d on port %d.\n", i, port + i);
+      stop();
+      return false;
+    }
+  }
+
+  workers.resize(num_shards);
+
+  for(int i = 0; i < num_shards; ++i) {
+
+    workers[i].owner = this;
+    workers[i].index = i;
+
+    Thread* thread = new Thread();
+    threads.push_back(thread);
+
+    if(!thread->create(ShardedServer::threadMain, &workers[i])) {
+      printf("Error: cannot create the thread for shard %d.\n", i);
+      stop();
+      return false;
+    }
+  }
+
+  return true;
+}
+
+void ShardedServer::stop() {
+
+  gui_atomic_store(&must_stop, 1);
+
+  for(size_t i = 0; i < threads.size(); ++i) {
+    shards[i]->wakeup();
+  }
+
+  for(size_t i = 0; i < threads.size(); ++i) {
+    threads[i]->join();
+    delete threads[i];
+  }
+
+  threads.clear();
+  workers.clear();
+
+  /* destroying a context closes its sockets; the shards must not post to each other anymore */
+  for(size_t i = 0; i < shards.size(); ++i) {
+    shards[i]->setShards(NULL, i);
+  }
+
+  for(size_t i = 0; i < shards.size(); ++i) {
+    delete shards[i];
+  }
+
+  shards.clear();
+}
+
+int ShardedServer::getNumShards() {
+  return num_shards;
+}
+
+void ShardedServer::setMaxValueRate(int perSecond) {
+  max_value_rate = perSecond;
+}
+
+int ShardedServer::getShardPort(int appID) {
+
+  int home = appID % num_shards;
+
+  if(home < 0) {
+    home += num_shards;
+  }
+
+  return port + home;
+}
+
+void ShardedServer::threadMain(void* user) {
+
+  ShardWorker* worker = static_cast<ShardWorker*>(user);
+  ShardedServer* sharded = worker->owner;
+  Server* server = sharded->shards[worker->index];
+
+  while(0 == gui_atomic_load(&sharded->must_stop)) {
+    server->update(REMOXLY_SHARD_TIMEOUT);
+  }
+}
+
+} // namespace rx
@@ -1,4 +1,5 @@
 #include <gui/remote/Utils.h>
+#include <gui/remote/Payload.h>
 
 namespace rx { 
 
@@ -141,9 +142,19 @@ uint64_t remoxly_hrtime() {
 ConnectionTask::ConnectionTask() 
   :task_name(0)
   ,task_id(0)
+  ,payload(NULL)
+  ,widget_id(-1)
 {
 }
 
+ConnectionTask::~ConnectionTask() {
+
+  if(payload) {
+    payload->release();
+    payload = NULL;
+  }
+}
+
 // -----------------------------------------------------------
 
 std::string remoxly_websocket_reason_to_string(enum libwebsocket_callback_reasons reason) {